@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_BLOCK_SCALE_HPP
+#define ROCWMMA_BLOCK_SCALE_HPP
+
+#include "types.hpp"
+
+#include "float_conversion.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        ///
+        /// E8M0 block scales (OCP microscaling formats): an unsigned, biased
+        /// power-of-two exponent. Code e encodes 2^(e - 127), 0xFF is NaN and
+        /// there is no zero.
+        ///
+        struct E8M0
+        {
+            constexpr static uint32_t Bias       = 127u;
+            constexpr static uint32_t NanCode    = 0xFFu;
+            constexpr static int32_t  MinExp     = -127;
+            constexpr static int32_t  MaxExp     = 127;
+            constexpr static uint32_t F32NanBits = 0x7FC00000u;
+        };
+
+        ROCWMMA_HOST_DEVICE inline float32_t e8m0ToFloat(uint32_t code)
+        {
+            // 2^-127 is the only value below the fp32 normal range
+            return fp32_from_bits(code == E8M0::NanCode ? E8M0::F32NanBits
+                                  : code == 0u          ? 0x00400000u
+                                                        : code << 23u);
+        }
+
+        ///
+        /// Shared scale of a block whose largest magnitude is amax, for elements
+        /// with largest normal exponent ElemEmax (8 for E4M3, 15 for E5M2):
+        /// floor(log2(amax)) - ElemEmax, clamped to the E8M0 range. Inf or NaN
+        /// amax gives the NaN scale.
+        ///
+        template <int32_t ElemEmax>
+        ROCWMMA_HOST_DEVICE inline uint32_t e8m0BlockScale(float32_t amax)
+        {
+            auto bits = fp32_to_bits(amax) & 0x7FFFFFFFu;
+            if(bits >= 0x7F800000u)
+            {
+                return E8M0::NanCode;
+            }
+
+            // Zero and fp32 denormals are below the smallest scale
+            auto exp = static_cast<int32_t>(bits >> 23u);
+            if(exp == 0)
+            {
+                return 0u;
+            }
+
+            auto scale = exp - static_cast<int32_t>(E8M0::Bias) - ElemEmax;
+            scale      = scale < E8M0::MinExp ? E8M0::MinExp : scale;
+            scale      = scale > E8M0::MaxExp ? E8M0::MaxExp : scale;
+            return static_cast<uint32_t>(scale + static_cast<int32_t>(E8M0::Bias));
+        }
+
+        ///
+        /// Applies the scales of matrix_a and matrix_b to an unscaled block
+        /// product with a single rounding: value * 2^(scaleA - 127) * 2^(scaleB - 127).
+        ///
+        ROCWMMA_HOST_DEVICE inline float32_t
+            applyBlockScale(float32_t value, uint32_t scaleA, uint32_t scaleB)
+        {
+            if(scaleA == E8M0::NanCode || scaleB == E8M0::NanCode)
+            {
+                return fp32_from_bits(E8M0::F32NanBits);
+            }
+            return __builtin_ldexpf(value,
+                                    static_cast<int32_t>(scaleA + scaleB)
+                                        - 2 * static_cast<int32_t>(E8M0::Bias));
+        }
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_BLOCK_SCALE_HPP
@@ -0,0 +1,291 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_COMPLEX_HPP
+#define ROCWMMA_COMPLEX_HPP
+
+#if !defined(__HIPCC_RTC__)
+#include <ostream>
+#endif // !defined(__HIPCC_RTC__)
+
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    ///
+    /// Complex number with real datatype T. The memory layout is the
+    /// interleaved { real, imag } pair of std::complex<T> and hipFloatComplex,
+    /// so buffers of either may be passed by pointer cast.
+    ///
+    template <typename T>
+    struct complex_t
+    {
+        using value_type = T;
+
+        T real;
+        T imag;
+
+        complex_t() = default;
+
+        ROCWMMA_HOST_DEVICE constexpr complex_t(T re, T im = static_cast<T>(0))
+            : real(re)
+            , imag(im)
+        {
+        }
+
+        template <typename U>
+        ROCWMMA_HOST_DEVICE constexpr explicit complex_t(complex_t<U> const& other)
+            : real(static_cast<T>(other.real))
+            , imag(static_cast<T>(other.imag))
+        {
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr complex_t& operator+=(complex_t const& other)
+        {
+            real += other.real;
+            imag += other.imag;
+            return *this;
+        }
+    };
+
+    using complex_float16_t = complex_t<float16_t>;
+    using complex_float32_t = complex_t<float32_t>;
+    using complex_float64_t = complex_t<float64_t>;
+
+    template <typename T>
+    ROCWMMA_HOST_DEVICE constexpr inline complex_t<T> operator-(complex_t<T> const& x)
+    {
+        return complex_t<T>(-x.real, -x.imag);
+    }
+
+    template <typename T>
+    ROCWMMA_HOST_DEVICE constexpr inline complex_t<T> operator+(complex_t<T> const& x,
+                                                                complex_t<T> const& y)
+    {
+        return complex_t<T>(x.real + y.real, x.imag + y.imag);
+    }
+
+    template <typename T>
+    ROCWMMA_HOST_DEVICE constexpr inline complex_t<T> operator-(complex_t<T> const& x,
+                                                                complex_t<T> const& y)
+    {
+        return complex_t<T>(x.real - y.real, x.imag - y.imag);
+    }
+
+    template <typename T>
+    ROCWMMA_HOST_DEVICE constexpr inline complex_t<T> operator*(complex_t<T> const& x,
+                                                                complex_t<T> const& y)
+    {
+        return complex_t<T>(x.real * y.real - x.imag * y.imag, x.real * y.imag + x.imag * y.real);
+    }
+
+    template <typename T>
+    ROCWMMA_HOST_DEVICE constexpr inline bool operator==(complex_t<T> const& x,
+                                                         complex_t<T> const& y)
+    {
+        return x.real == y.real && x.imag == y.imag;
+    }
+
+    template <typename T>
+    ROCWMMA_HOST_DEVICE constexpr inline bool operator!=(complex_t<T> const& x,
+                                                         complex_t<T> const& y)
+    {
+        return !(x == y);
+    }
+
+    ///
+    /// Complex mma algorithms over real mma of the split real / imag parts.
+    /// 4M uses four real products. 3M (Gauss) uses three, at the cost of
+    /// extra element-wise adds and of forming Ar + Ai and Br + Bi in the
+    /// input datatype, which may round for float16_t inputs.
+    ///
+    struct complex_mma_4m
+    {
+    };
+
+    struct complex_mma_3m
+    {
+    };
+
+    namespace detail
+    {
+        ///
+        /// Element-wise ops on operands of the same type, such as the real
+        /// or imag fragment of a complex fragment.
+        ///
+        struct ElementwiseOps
+        {
+            template <typename FragT>
+            ROCWMMA_HOST_DEVICE static inline FragT zero()
+            {
+                FragT result;
+                for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                {
+                    result[i] = static_cast<typename FragT::element_type>(0);
+                }
+                return result;
+            }
+
+            template <typename FragT>
+            ROCWMMA_HOST_DEVICE static inline FragT neg(FragT const& x)
+            {
+                FragT result;
+                for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                {
+                    result[i] = -x[i];
+                }
+                return result;
+            }
+
+            template <typename FragT>
+            ROCWMMA_HOST_DEVICE static inline FragT add(FragT const& x, FragT const& y)
+            {
+                FragT result;
+                for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                {
+                    result[i] = x[i] + y[i];
+                }
+                return result;
+            }
+
+            template <typename FragT>
+            ROCWMMA_HOST_DEVICE static inline FragT sub(FragT const& x, FragT const& y)
+            {
+                FragT result;
+                for(uint32_t i = 0u; i < FragT::num_elements; i++)
+                {
+                    result[i] = x[i] - y[i];
+                }
+                return result;
+            }
+        };
+
+        ///
+        /// Decomposes the complex mma D = A * B + C into real mma of the
+        /// real / imag parts of each operand. mma(d, a, b, c) computes
+        /// d = a * b + c on real operands, and Ops provides element-wise
+        /// ops as ElementwiseOps. C may alias D.
+        ///
+        template <typename AlgoT>
+        struct ComplexMma;
+
+        ///
+        /// Dr = (Cr + Ar * Br) + (-Ai) * Bi
+        /// Di = (Ci + Ar * Bi) + Ai * Br
+        ///
+        template <>
+        struct ComplexMma<complex_mma_4m>
+        {
+            constexpr static uint32_t MmaCount = 4u;
+
+            template <typename Ops,
+                      typename FragD,
+                      typename FragA,
+                      typename FragB,
+                      typename FragC,
+                      typename MmaFunc>
+            ROCWMMA_HOST_DEVICE static inline void exec(FragD&       dr,
+                                                        FragD&       di,
+                                                        FragA const& ar,
+                                                        FragA const& ai,
+                                                        FragB const& br,
+                                                        FragB const& bi,
+                                                        FragC const& cr,
+                                                        FragC const& ci,
+                                                        MmaFunc&&    mma)
+            {
+                FragD accumR, accumI;
+                mma(accumR, ar, br, cr);
+                mma(accumR, Ops::neg(ai), bi, accumR);
+                mma(accumI, ar, bi, ci);
+                mma(accumI, ai, br, accumI);
+
+                dr = accumR;
+                di = accumI;
+            }
+        };
+
+        ///
+        /// T1 = Ar * Br, T2 = Ai * Bi, T3 = (Ar + Ai) * (Br + Bi)
+        /// Dr = Cr + (T1 - T2)
+        /// Di = (Ci + T3) - T1 - T2
+        ///
+        /// C is combined with D element-wise, so they must have the same
+        /// type: register layouts of accumulators vary with the data layout.
+        ///
+        template <>
+        struct ComplexMma<complex_mma_3m>
+        {
+            constexpr static uint32_t MmaCount = 3u;
+
+            template <typename Ops,
+                      typename FragD,
+                      typename FragA,
+                      typename FragB,
+                      typename FragC,
+                      typename MmaFunc>
+            ROCWMMA_HOST_DEVICE static inline void exec(FragD&       dr,
+                                                        FragD&       di,
+                                                        FragA const& ar,
+                                                        FragA const& ai,
+                                                        FragB const& br,
+                                                        FragB const& bi,
+                                                        FragC const& cr,
+                                                        FragC const& ci,
+                                                        MmaFunc&&    mma)
+            {
+                static_assert(is_same<FragC, FragD>::value,
+                              "3M complex mma requires matching C and D accumulators");
+
+                auto  zero = Ops::template zero<FragD>();
+                FragD t1, t2, t3;
+                mma(t1, ar, br, zero);
+                mma(t2, ai, bi, zero);
+                mma(t3, Ops::add(ar, ai), Ops::add(br, bi), ci);
+
+                // Di does not read Cr, so it is safe to write first when C aliases D
+                di = Ops::sub(Ops::sub(t3, t1), t2);
+                dr = Ops::add(cr, Ops::sub(t1, t2));
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+namespace std
+{
+#if !defined(__HIPCC_RTC__)
+    template <typename T>
+    inline ostream& operator<<(ostream& stream, rocwmma::complex_t<T> const& val)
+    {
+        return stream << "(" << val.real << ", " << val.imag << ")";
+    }
+#endif // !defined(__HIPCC_RTC__)
+
+} // namespace std
+
+#endif // ROCWMMA_COMPLEX_HPP
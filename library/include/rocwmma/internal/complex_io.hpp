@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_COMPLEX_IO_HPP
+#define ROCWMMA_COMPLEX_IO_HPP
+
+#include "complex.hpp"
+#include "io_config.hpp"
+#include "layout/layout.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    ///
+    /// Loads interleaved complex data into the split real / imag registers
+    /// of a complex fragment, walking the fragment's matrix layout as
+    /// OpaqueLoad does. Each vector of VW complex elements is read as one
+    /// vector of 2 * VW values and de-interleaved in registers, so each part
+    /// keeps the element order of a native DataT load.
+    ///
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct ComplexLoad
+    {
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information for complex data");
+
+        using IOConfig     = IOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using IOLayout     = typename IOConfig::IOLayout;
+        using IOTraits     = typename IOConfig::IOTraits;
+        using DataLayout   = typename IOLayout::DataLayout;
+        using MatrixLayout = typename IOLayout::MatrixLayout;
+        using PostLoad     = typename IOConfig::PostLoadXForm;
+
+        constexpr static uint32_t VW = IOLayout::VW;
+
+        using AccessT = VecT<DataT, IOTraits::UnpackedSize>;
+        using LoadT   = VecT<DataT, VW>;
+        using PairsT  = VecT<DataT, 2u * VW>;
+
+        ROCWMMA_DEVICE static inline void loadVector(
+            LoadT& real, LoadT& imag, DataT const* dataPtr, uint32_t ldm, Coord2d const& coord)
+        {
+            // Complex element e starts at value 2 * e
+            auto offset = DataLayout::fromMatrixCoord(coord, ldm);
+            auto pairs  = *reinterpret_cast<PairsT const*>(dataPtr + 2u * offset);
+
+#pragma unroll
+            for(uint32_t i = 0u; i < VW; i++)
+            {
+                real.data[i] = pairs.data[2u * i];
+                imag.data[i] = pairs.data[2u * i + 1u];
+            }
+        }
+
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        template <size_t Depth = 0, typename Iterator, typename StrideCounts, typename Strides2d>
+        ROCWMMA_DEVICE static inline void unroll_right(Iterator&      real,
+                                                       Iterator&      imag,
+                                                       DataT const*   dataPtr,
+                                                       uint32_t       ldm,
+                                                       Coord2d        coord,
+                                                       StrideCounts&& strideCounts,
+                                                       Strides2d&&    strides2d)
+        {
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    loadVector(*real, *imag, dataPtr, ldm, coord);
+                    coord = coord + stride2d;
+                    real++;
+                    imag++;
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        real, imag, dataPtr, ldm, coord, strideCounts, strides2d);
+                    coord = coord + stride2d;
+                }
+            }
+        }
+
+        ROCWMMA_DEVICE static void
+            exec(AccessT& real, AccessT& imag, complex_t<DataT> const* data, uint32_t ldm)
+        {
+            auto itR = makeVectorIterator<VW>(real).begin();
+            auto itI = makeVectorIterator<VW>(imag).begin();
+
+            constexpr auto strideCounts = MatrixLayout::strideCounts();
+            constexpr auto strides      = MatrixLayout::strides();
+
+            unroll_right(itR,
+                         itI,
+                         reinterpret_cast<DataT const*>(data),
+                         ldm,
+                         MatrixLayout::baseOffset(),
+                         strideCounts,
+                         strides);
+
+            real = PostLoad::exec(real);
+            imag = PostLoad::exec(imag);
+        }
+    };
+
+    ///
+    /// Stores the split real / imag registers of a complex fragment as
+    /// interleaved complex data. The inverse of ComplexLoad: each vector of
+    /// VW elements of both parts is interleaved in registers and written as
+    /// one vector of 2 * VW values.
+    ///
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct ComplexStore
+    {
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information for complex data");
+
+        using IOConfig     = IOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using IOLayout     = typename IOConfig::IOLayout;
+        using IOTraits     = typename IOConfig::IOTraits;
+        using DataLayout   = typename IOLayout::DataLayout;
+        using MatrixLayout = typename IOLayout::MatrixLayout;
+        using PreStore     = typename IOConfig::PreStoreXForm;
+
+        constexpr static uint32_t VW = IOLayout::VW;
+
+        using AccessT = VecT<DataT, IOTraits::UnpackedSize>;
+        using StoreT  = VecT<DataT, VW>;
+        using PairsT  = VecT<DataT, 2u * VW>;
+
+        ROCWMMA_DEVICE static inline void storeVector(DataT*         dataPtr,
+                                                      StoreT const&  real,
+                                                      StoreT const&  imag,
+                                                      uint32_t       ldm,
+                                                      Coord2d const& coord)
+        {
+            PairsT pairs;
+
+#pragma unroll
+            for(uint32_t i = 0u; i < VW; i++)
+            {
+                pairs.data[2u * i]      = real.data[i];
+                pairs.data[2u * i + 1u] = imag.data[i];
+            }
+
+            auto offset = DataLayout::fromMatrixCoord(coord, ldm);
+            *reinterpret_cast<PairsT*>(dataPtr + 2u * offset) = pairs;
+        }
+
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        template <size_t Depth = 0, typename Iterator, typename StrideCounts, typename Strides2d>
+        ROCWMMA_DEVICE static inline void unroll_right(DataT*         dataPtr,
+                                                       Iterator&      real,
+                                                       Iterator&      imag,
+                                                       uint32_t       ldm,
+                                                       Coord2d        coord,
+                                                       StrideCounts&& strideCounts,
+                                                       Strides2d&&    strides2d)
+        {
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    storeVector(dataPtr, *real, *imag, ldm, coord);
+                    coord = coord + stride2d;
+                    real++;
+                    imag++;
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        dataPtr, real, imag, ldm, coord, strideCounts, strides2d);
+                    coord = coord + stride2d;
+                }
+            }
+        }
+
+        ROCWMMA_DEVICE static void exec(complex_t<DataT>* data,
+                                        AccessT const&    real,
+                                        AccessT const&    imag,
+                                        uint32_t          ldm)
+        {
+            auto storeR = PreStore::exec(real);
+            auto storeI = PreStore::exec(imag);
+
+            auto itR = makeVectorIterator<VW>(storeR).begin();
+            auto itI = makeVectorIterator<VW>(storeI).begin();
+
+            constexpr auto strideCounts = MatrixLayout::strideCounts();
+            constexpr auto strides      = MatrixLayout::strides();
+
+            unroll_right(reinterpret_cast<DataT*>(data),
+                         itR,
+                         itI,
+                         ldm,
+                         MatrixLayout::baseOffset(),
+                         strideCounts,
+                         strides);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_COMPLEX_IO_HPP
@@ -26,6 +26,7 @@
 #ifndef ROCWMMA_CONVERT_HPP
 #define ROCWMMA_CONVERT_HPP
 
+#include "stochastic_rounding.hpp"
 #include "types.hpp"
 #include "utility/forward.hpp"
 
@@ -102,11 +103,50 @@ namespace rocwmma
 
 #endif // !ROCWMMA_NO_HALF
 
+        // Stochastic rounding conversion. Register i of the given lane is rounded
+        // with word i of the lane's random stream (see stochasticRoundingWord).
+        template <typename InputT, typename OutputT>
+        struct amdgcn_convert_sr
+        {
+            static_assert(is_same<InputT, float32_t>::value,
+                          "Stochastic rounding only supported from float32_t");
+            static_assert(StochasticRoundingTraits<OutputT>::Supported,
+                          "Stochastic rounding not supported for OutputT");
+
+            template <uint32_t NumRegs>
+            ROCWMMA_DEVICE static inline auto exec(VecT<InputT, NumRegs> const& regsIn,
+                                                   uint64_t                      seed,
+                                                   uint64_t                      offset,
+                                                   uint32_t                      lane)
+                -> VecT<OutputT, NumRegs>
+            {
+                VecT<OutputT, NumRegs> result;
+
+                // One Philox block covers four registers
+#pragma unroll
+                for(unsigned i = 0; i < NumRegs; i += 4u)
+                {
+                    auto rng = stochasticRoundingBlock(seed, offset, lane, i / 4u);
+
+#pragma unroll
+                    for(unsigned j = 0; j < 4u && i + j < NumRegs; j++)
+                    {
+                        result.data[i + j]
+                            = stochasticRound<OutputT>(regsIn.data[i + j], rng.data[j]);
+                    }
+                }
+                return result;
+            }
+        };
+
     } // namespace detail
 
     template <typename InputT, typename OutputT>
     using Convert = detail::amdgcn_convert<InputT, OutputT>;
 
+    template <typename InputT, typename OutputT>
+    using ConvertSR = detail::amdgcn_convert_sr<InputT, OutputT>;
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_CONVERT_HPP
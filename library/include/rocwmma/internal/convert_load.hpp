@@ -0,0 +1,137 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_CONVERT_LOAD_HPP
+#define ROCWMMA_CONVERT_LOAD_HPP
+
+#include "io_config.hpp"
+#include "layout/layout.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    ///
+    /// Loads SrcT data into a fragment of a wider DataT, walking the
+    /// fragment's matrix layout as OpaqueLoad does. Each vector of VW
+    /// elements is read in SrcT and upcast in registers, so the fragment
+    /// keeps the element order of a native DataT load.
+    ///
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename SrcT>
+    struct ConvertLoad
+    {
+        static_assert(!is_same<SrcT, DataT>::value, "Use the native load for matching types");
+        static_assert(!is_same<SrcT, int4x2_t>::value && !is_same<SrcT, uint4x2_t>::value,
+                      "Packed 4-bit data requires zero-points or dequantization params");
+        static_assert(sizeof(SrcT) <= sizeof(DataT), "Converting loads must upcast");
+        static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                      "Converting loads are only supported for matrix_a and matrix_b");
+
+        using IOConfig     = IOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using IOLayout     = typename IOConfig::IOLayout;
+        using IOTraits     = typename IOConfig::IOTraits;
+        using DataLayout   = typename IOLayout::DataLayout;
+        using MatrixLayout = typename IOLayout::MatrixLayout;
+        using PostLoad     = typename IOConfig::PostLoadXForm;
+
+        constexpr static uint32_t VW = IOLayout::VW;
+
+        using AccessT = VecT<DataT, IOTraits::UnpackedSize>;
+        using LoadT   = VecT<DataT, VW>;
+        using SrcVecT = VecT<SrcT, VW>;
+
+        ROCWMMA_DEVICE static inline void
+            loadVector(LoadT& out, SrcT const* dataPtr, uint32_t ldm, Coord2d const& coord)
+        {
+            auto offset = DataLayout::fromMatrixCoord(coord, ldm);
+            auto src    = *reinterpret_cast<SrcVecT const*>(dataPtr + offset);
+
+            // Narrow types widen exactly through f32
+#pragma unroll
+            for(uint32_t i = 0u; i < VW; i++)
+            {
+                out.data[i] = static_cast<DataT>(static_cast<float32_t>(src.data[i]));
+            }
+        }
+
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        template <size_t Depth = 0, typename Iterator, typename StrideCounts, typename Strides2d>
+        ROCWMMA_DEVICE static inline void unroll_right(Iterator&      out,
+                                                       SrcT const*    dataPtr,
+                                                       uint32_t       ldm,
+                                                       Coord2d        coord,
+                                                       StrideCounts&& strideCounts,
+                                                       Strides2d&&    strides2d)
+        {
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    loadVector(*out, dataPtr, ldm, coord);
+                    coord = coord + stride2d;
+                    out++;
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(out, dataPtr, ldm, coord, strideCounts, strides2d);
+                    coord = coord + stride2d;
+                }
+            }
+        }
+
+        ROCWMMA_DEVICE static void exec(AccessT& data, SrcT const* dataPtr, uint32_t ldm)
+        {
+            auto it = makeVectorIterator<VW>(data).begin();
+
+            constexpr auto strideCounts = MatrixLayout::strideCounts();
+            constexpr auto strides      = MatrixLayout::strides();
+
+            unroll_right(it, dataPtr, ldm, MatrixLayout::baseOffset(), strideCounts, strides);
+
+            data = PostLoad::exec(data);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_CONVERT_LOAD_HPP
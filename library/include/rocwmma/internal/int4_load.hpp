@@ -0,0 +1,254 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_INT4_LOAD_HPP
+#define ROCWMMA_INT4_LOAD_HPP
+
+#include "int4_unpack.hpp"
+#include "io_config.hpp"
+#include "layout/layout.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    ///
+    /// Loads packed 4-bit integers into an int8_t or float16_t fragment,
+    /// walking the fragment's matrix layout as OpaqueLoad does. Each vector of
+    /// VW elements is read as packed bytes (one dword per eight elements) and
+    /// unpacked in registers, then has its zero-point subtracted and, for
+    /// float16_t, its scale applied. Zero-points and scales are indexed by the
+    /// row (matrix_a) or column (matrix_b) of each element.
+    ///
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename PackedT>
+    struct Int4Load
+    {
+        static_assert(is_same<PackedT, int4x2_t>::value || is_same<PackedT, uint4x2_t>::value,
+                      "Packed data must be int4x2_t or uint4x2_t");
+        static_assert(is_same<DataT, int8_t>::value || is_same<DataT, float16_t>::value,
+                      "Packed 4-bit data unpacks to int8_t or float16_t");
+        static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                      "Packed 4-bit data is only supported for matrix_a and matrix_b");
+
+        using IOConfig     = IOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        using IOLayout     = typename IOConfig::IOLayout;
+        using IOTraits     = typename IOConfig::IOTraits;
+        using DataLayout   = typename IOLayout::DataLayout;
+        using MatrixLayout = typename IOLayout::MatrixLayout;
+        using PostLoad     = typename IOConfig::PostLoadXForm;
+        using Unpack       = detail::Int4Unpack;
+
+        constexpr static bool     Signed = is_same<PackedT, int4x2_t>::value;
+        constexpr static uint32_t VW     = IOLayout::VW;
+
+        // Elements unpacked from each dword
+        constexpr static uint32_t ChunkSize = VW < 8u ? VW : 8u;
+
+        static_assert(VW % ChunkSize == 0u, "Vector width must be a multiple of the chunk size");
+
+        using AccessT = VecT<DataT, IOTraits::UnpackedSize>;
+        using LoadT   = VecT<DataT, VW>;
+
+        struct Params
+        {
+            uint8_t const*   zeroPoints;
+            float16_t const* scales;
+            uint32_t         ldq;
+        };
+
+        // Dword holding ChunkSize elements from element offset, low nibble first
+        ROCWMMA_DEVICE static inline uint32_t loadChunk(uint8_t const* bytes, uint32_t offset)
+        {
+            if constexpr(ChunkSize == 8u)
+            {
+                return *reinterpret_cast<uint32_t const*>(bytes + offset / 2u);
+            }
+            else if constexpr(ChunkSize == 4u)
+            {
+                return *reinterpret_cast<uint16_t const*>(bytes + offset / 2u);
+            }
+            else if constexpr(ChunkSize == 2u)
+            {
+                return bytes[offset / 2u];
+            }
+            else
+            {
+                return bytes[offset / 2u] >> ((offset & 1u) * 4u);
+            }
+        }
+
+        // Coordinate of element i along the contiguous dimension
+        ROCWMMA_DEVICE static inline auto elementCoord(Coord2d const& coord, uint32_t i)
+        {
+            return is_same<DataLayoutT, row_major>::value ? coord + make_coord2d(0u, i)
+                                                          : coord + make_coord2d(i, 0u);
+        }
+
+        // Offset of the zero-point / scale of an element: one per row of
+        // matrix_a or column of matrix_b, in the data layout
+        ROCWMMA_DEVICE static inline uint32_t groupOffset(Coord2d const& coord, uint32_t ldq)
+        {
+            auto groupCoord = is_same<MatrixT, matrix_a>::value ? make_coord2d(get<0>(coord), 0u)
+                                                                : make_coord2d(0u, get<1>(coord));
+            return DataLayout::fromMatrixCoord(groupCoord, ldq);
+        }
+
+        ROCWMMA_DEVICE static inline void loadVector(LoadT&         out,
+                                                     uint8_t const* bytes,
+                                                     uint32_t       ldm,
+                                                     Coord2d const& coord,
+                                                     Params const&  params)
+        {
+            auto offset = DataLayout::fromMatrixCoord(coord, ldm);
+
+#pragma unroll
+            for(uint32_t i = 0u; i < VW; i += ChunkSize)
+            {
+                auto packed = loadChunk(bytes, offset + i);
+
+                if constexpr(is_same<DataT, int8_t>::value)
+                {
+                    uint32_t words[2];
+                    Unpack::toInt8<Signed>(packed, words[0], words[1]);
+
+                    if(params.zeroPoints != nullptr)
+                    {
+#pragma unroll
+                        for(uint32_t w = 0u; w < 2u; w++)
+                        {
+                            uint32_t zeroPoints = 0u;
+#pragma unroll
+                            for(uint32_t j = 0u; j < 4u && w * 4u + j < ChunkSize; j++)
+                            {
+                                auto elemCoord = elementCoord(coord, i + w * 4u + j);
+                                zeroPoints |= static_cast<uint32_t>(
+                                                  params.zeroPoints[groupOffset(elemCoord,
+                                                                                params.ldq)])
+                                              << (j * 8u);
+                            }
+                            words[w] = Unpack::subBytes(words[w], zeroPoints);
+                        }
+                    }
+
+#pragma unroll
+                    for(uint32_t j = 0u; j < ChunkSize; j++)
+                    {
+                        out.data[i + j] = static_cast<int8_t>(words[j / 4u] >> ((j % 4u) * 8u));
+                    }
+                }
+                else
+                {
+                    uint32_t words[4];
+                    Unpack::toF16Magic<Signed>(packed, words);
+
+#pragma unroll
+                    for(uint32_t j = 0u; j < ChunkSize; j++)
+                    {
+                        auto elemCoord = elementCoord(coord, i + j);
+                        auto group     = groupOffset(elemCoord, params.ldq);
+
+                        auto bits  = static_cast<uint16_t>(words[j / 2u] >> ((j % 2u) * 16u));
+                        auto value = reinterpret_cast<float16_t const&>(bits);
+
+                        // 1024 + q - (1024 + zeroPoint) is exact in f16
+                        uint32_t zeroPoint
+                            = params.zeroPoints != nullptr ? params.zeroPoints[group] : 0u;
+                        value -= static_cast<float16_t>(Unpack::f16Offset<Signed>(zeroPoint));
+
+                        out.data[i + j]
+                            = params.scales != nullptr ? value * params.scales[group] : value;
+                    }
+                }
+            }
+        }
+
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        template <size_t Depth = 0, typename Iterator, typename StrideCounts, typename Strides2d>
+        ROCWMMA_DEVICE static inline void unroll_right(Iterator&      out,
+                                                       uint8_t const* bytes,
+                                                       uint32_t       ldm,
+                                                       Coord2d        coord,
+                                                       Params const&  params,
+                                                       StrideCounts&& strideCounts,
+                                                       Strides2d&&    strides2d)
+        {
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    loadVector(*out, bytes, ldm, coord, params);
+                    coord = coord + stride2d;
+                    out++;
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        out, bytes, ldm, coord, params, strideCounts, strides2d);
+                    coord = coord + stride2d;
+                }
+            }
+        }
+
+        ROCWMMA_DEVICE static void
+            exec(AccessT& data, PackedT const* dataPtr, uint32_t ldm, Params const& params)
+        {
+            auto it = makeVectorIterator<VW>(data).begin();
+
+            constexpr auto strideCounts = MatrixLayout::strideCounts();
+            constexpr auto strides      = MatrixLayout::strides();
+
+            unroll_right(it,
+                         reinterpret_cast<uint8_t const*>(dataPtr),
+                         ldm,
+                         MatrixLayout::baseOffset(),
+                         params,
+                         strideCounts,
+                         strides);
+
+            data = PostLoad::exec(data);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_INT4_LOAD_HPP
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_INT4_UNPACK_HPP
+#define ROCWMMA_INT4_UNPACK_HPP
+
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        ///
+        /// v_perm_b32 byte select on the concatenation {src1, src0}, with the
+        /// same selector convention as the Blend PermByte ops: selectors 0-3
+        /// pick bytes of src0 and 4-7 bytes of src1. 8-11 replicate the sign
+        /// bits of bytes 1 and 3 of src0 and src1, 12 gives 0x00 and 13+ give 0xFF.
+        ///
+        ROCWMMA_HOST_DEVICE inline uint32_t permBytes(uint32_t src0, uint32_t src1, uint32_t sel)
+        {
+#if ROCWMMA_ARCH_HOST
+            uint32_t result = 0u;
+            for(uint32_t i = 0u; i < 4u; i++)
+            {
+                auto     s    = (sel >> (i * 8u)) & 0xFFu;
+                uint32_t byte = 0u;
+                if(s < 4u)
+                {
+                    byte = (src0 >> (s * 8u)) & 0xFFu;
+                }
+                else if(s < 8u)
+                {
+                    byte = (src1 >> ((s - 4u) * 8u)) & 0xFFu;
+                }
+                else if(s < 12u)
+                {
+                    auto src = s < 10u ? src0 : src1;
+                    auto bit = (s % 2u) ? 31u : 15u;
+                    byte     = ((src >> bit) & 1u) ? 0xFFu : 0x00u;
+                }
+                else
+                {
+                    byte = s == 12u ? 0x00u : 0xFFu;
+                }
+                result |= byte << (i * 8u);
+            }
+            return result;
+#else
+            return __builtin_amdgcn_perm(src1, src0, sel);
+#endif // ROCWMMA_ARCH_HOST
+        }
+
+        ///
+        /// Bit-level unpacking of eight packed 4-bit integers, as loaded in one
+        /// dword: element 2i is the low nibble and element 2i + 1 the high nibble
+        /// of byte i. Nibbles are split into even and odd bytes with two masks,
+        /// then interleaved with byte permutes.
+        ///
+        struct Int4Unpack
+        {
+            constexpr static uint32_t NibbleMask = 0x0F0F0F0Fu;
+            constexpr static uint32_t SignMask   = 0x08080808u;
+
+            // f16 1024.0 in the high byte: 0x6400 | q encodes 1024 + q exactly
+            constexpr static uint32_t F16MagicBits = 0x64006400u;
+            constexpr static uint32_t F16Magic     = 1024u;
+
+            // Signed nibbles are biased by SignedBias for f16 unpacking
+            constexpr static uint32_t SignedBias = 8u;
+
+            constexpr static uint32_t selector(uint32_t s0, uint32_t s1, uint32_t s2, uint32_t s3)
+            {
+                return s0 | (s1 << 8u) | (s2 << 16u) | (s3 << 24u);
+            }
+
+            constexpr static uint32_t SelZero = 12u;
+
+            ///
+            /// Unpacks to eight int8 values, sign-extended for int4: lo holds
+            /// elements 0-3 and hi elements 4-7. Selectors match Blend::UnpackByteLo
+            /// and Blend::UnpackByteHi.
+            ///
+            template <bool Signed>
+            ROCWMMA_HOST_DEVICE static inline void
+                toInt8(uint32_t packed, uint32_t& lo, uint32_t& hi)
+            {
+                auto even = packed & NibbleMask;
+                auto odd  = (packed >> 4u) & NibbleMask;
+
+                if constexpr(Signed)
+                {
+                    // Bit 3 of each nibble fills bits 4-7 of its byte, without carries
+                    even |= (even & SignMask) * 0x1Eu;
+                    odd |= (odd & SignMask) * 0x1Eu;
+                }
+
+                lo = permBytes(even, odd, selector(0u, 4u, 1u, 5u));
+                hi = permBytes(even, odd, selector(2u, 6u, 3u, 7u));
+            }
+
+            ///
+            /// Unpacks to eight f16 words 0x6400 | q, encoding 1024 + q. Signed
+            /// nibbles are biased by 8 first, so every result encodes
+            /// F16Magic + bias(Signed) + value. out[i] holds elements 2i and 2i + 1.
+            ///
+            template <bool Signed>
+            ROCWMMA_HOST_DEVICE static inline void toF16Magic(uint32_t packed, uint32_t (&out)[4])
+            {
+                if constexpr(Signed)
+                {
+                    packed ^= 0x88888888u;
+                }
+
+                auto even = packed & NibbleMask;
+                auto odd  = (packed >> 4u) & NibbleMask;
+
+                out[0] = permBytes(even, odd, selector(0u, SelZero, 4u, SelZero)) | F16MagicBits;
+                out[1] = permBytes(even, odd, selector(1u, SelZero, 5u, SelZero)) | F16MagicBits;
+                out[2] = permBytes(even, odd, selector(2u, SelZero, 6u, SelZero)) | F16MagicBits;
+                out[3] = permBytes(even, odd, selector(3u, SelZero, 7u, SelZero)) | F16MagicBits;
+            }
+
+            ///
+            /// f16 value to subtract from a magic word to recover q - zeroPoint
+            ///
+            template <bool Signed>
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t f16Offset(uint32_t zeroPoint)
+            {
+                return F16Magic + (Signed ? SignedBias : 0u) + zeroPoint;
+            }
+
+            ///
+            /// Byte-wise a - b of four int8 lanes, without borrows between bytes
+            ///
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t subBytes(uint32_t a, uint32_t b)
+            {
+                constexpr uint32_t H = 0x80808080u;
+                return ((a | H) - (b & ~H)) ^ ((a ^ ~b) & H);
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_INT4_UNPACK_HPP
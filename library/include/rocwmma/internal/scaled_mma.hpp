@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SCALED_MMA_HPP
+#define ROCWMMA_SCALED_MMA_HPP
+
+#include "block_scale.hpp"
+#include "constants.hpp"
+#include "io_config.hpp"
+#include "layout/layout.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        ///
+        /// Matrix coordinates of the float32_t accumulator registers in mma layout,
+        /// used to pair each block product with the scales of its row and column.
+        /// The col_major accumulator storage layout is walked in the same order
+        /// as OpaqueLoad, encoding each element as col * BlockM + row, and the
+        /// result is re-ordered from storage to fragment to mma register layout.
+        ///
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK>
+        struct AccumMmaCoords
+        {
+            using IOConfig
+                = IOConfig<accumulator, BlockM, BlockN, BlockK, float32_t, col_major>;
+            using IOLayout     = typename IOConfig::IOLayout;
+            using IOTraits     = typename IOConfig::IOTraits;
+            using DataLayout   = typename IOLayout::DataLayout;
+            using MatrixLayout = typename IOLayout::MatrixLayout;
+
+            using StorageToFragment = typename IOConfig::PostLoadXForm;
+            using FragmentToMma     = register_layout_transform<typename IOLayout::FragmentLayout,
+                                                            typename IOLayout::MmaLayout>;
+
+            constexpr static uint32_t VW = IOLayout::VW;
+
+            using CoordsT = VecT<float32_t, IOTraits::UnpackedSize>;
+
+            template <size_t Depth = 0,
+                      typename Iterator,
+                      typename StrideCounts,
+                      typename Strides2d>
+            ROCWMMA_DEVICE static inline void unroll_right(Iterator&      out,
+                                                           uint32_t       offset,
+                                                           StrideCounts&& strideCounts,
+                                                           Strides2d&&    strides2d)
+            {
+                auto strideOffset = DataLayout::fromMatrixCoord(get<Depth>(strides2d), BlockM);
+                auto strideCount  = get<Depth>(strideCounts);
+
+                if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+                {
+#pragma unroll
+                    for(int i = 0; i < strideCount; i++)
+                    {
+                        // VW elements are contiguous in col_major
+#pragma unroll
+                        for(uint32_t j = 0; j < VW; j++)
+                        {
+                            (*out).data[j] = static_cast<float32_t>(offset + j);
+                        }
+                        offset += strideOffset;
+                        out++;
+                    }
+                }
+                else
+                {
+#pragma unroll
+                    for(int i = 0; i < strideCount; i++)
+                    {
+                        unroll_right<Depth + 1>(out, offset, strideCounts, strides2d);
+                        offset += strideOffset;
+                    }
+                }
+            }
+
+            ROCWMMA_DEVICE static inline CoordsT exec()
+            {
+                CoordsT coords;
+                auto    it = makeVectorIterator<VW>(coords).begin();
+
+                constexpr auto strideCounts = MatrixLayout::strideCounts();
+                constexpr auto strides      = MatrixLayout::strides();
+
+                unroll_right(it,
+                             DataLayout::fromMatrixCoord(MatrixLayout::baseOffset(), BlockM),
+                             strideCounts,
+                             strides);
+
+                return FragmentToMma::exec(StorageToFragment::exec(coords));
+            }
+        };
+
+        ///
+        /// Broadcasts the E8M0 scale at the given row / column index of a
+        /// scaled fragment to the calling lane. Scale i is held in register
+        /// i / WaveSize of lane i % WaveSize.
+        ///
+        template <uint32_t RegCount>
+        ROCWMMA_DEVICE inline uint32_t blockScaleLookup(VecT<uint32_t, RegCount> const& scales,
+                                                        uint32_t                        index)
+        {
+            constexpr uint32_t WaveSize = Constants::AMDGCN_WAVE_SIZE;
+
+            auto     srcLaneAddr = static_cast<int32_t>((index % WaveSize) * 4u);
+            uint32_t result      = E8M0::NanCode;
+
+#pragma unroll
+            for(uint32_t i = 0; i < RegCount; i++)
+            {
+                auto scale = static_cast<uint32_t>(__builtin_amdgcn_ds_bpermute(
+                    srcLaneAddr, static_cast<int32_t>(scales.data[i])));
+                result = (index / WaveSize == i) ? scale : result;
+            }
+            return result;
+        }
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SCALED_MMA_HPP
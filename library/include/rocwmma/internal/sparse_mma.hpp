@@ -0,0 +1,396 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_MMA_HPP
+#define ROCWMMA_SPARSE_MMA_HPP
+
+#include "layout/layout.hpp"
+#include "mapping_util.hpp"
+#include "mfma.hpp"
+#include "pack_util.hpp"
+#include "sparse_util.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        /*! \class amdgcn_smfmac
+        *  \brief  Builtin wrapper for sparse mfma instructions. A holds the kept
+        *  values of 2:4 sparse groups and idx their 2-bit positions.
+        *  @tparam InputT Datatype of inputs A and B
+        *  @tparam ComputeT Datatype of accumulator
+        *  @tparam BlockM M-dimension of mma block
+        *  @tparam BlockN N-dimension of mma block
+        *  @tparam GfxTarget The current gfx family target of interest being compiled
+        *  @tparam TargetEnable Enabler for the current target if supported
+        */
+        template <typename InputT,
+                  typename ComputeT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  typename GfxTarget = conditional_t<(bool)ROCWMMA_ARCH_GFX9, Gfx9, Unsupported>,
+                  typename TargetEnable = GfxTarget>
+        struct amdgcn_smfmac
+        {
+            constexpr static MfmaCtrlFlags Cbsz = MfmaCtrlFlags::DEFAULT;
+            constexpr static MfmaCtrlFlags Abid = MfmaCtrlFlags::DEFAULT;
+
+        private:
+            using Layout        = Sparse24Layout<InputT, BlockM>;
+            using PackTraitsIn  = PackTraits<InputT>;
+            using PackTraitsAcc = PackTraits<ComputeT>;
+
+            constexpr static uint32_t InputASize = Layout::ValuesPerLane / PackTraitsIn::PackRatio;
+            constexpr static uint32_t InputBSize = 2u * Layout::DenseVW / PackTraitsIn::PackRatio;
+            constexpr static uint32_t AccumSize
+                = BlockM * BlockN / (Constants::AMDGCN_WAVE_SIZE * PackTraitsAcc::PackRatio);
+
+        public:
+            constexpr static uint32_t KPerMma = Layout::KPerMma;
+
+            using ARegsT = VecT<typename PackTraitsIn::PackedT, InputASize>;
+            using BRegsT = VecT<typename PackTraitsIn::PackedT, InputBSize>;
+            using CRegsT = VecT<typename PackTraitsAcc::PackedT, AccumSize>;
+            using DRegsT = VecT<typename PackTraitsAcc::PackedT, AccumSize>;
+
+            ROCWMMA_DEVICE static inline auto
+                exec(ARegsT const& regsA, BRegsT const& regsB, CRegsT const& regsC, uint32_t idx)
+                    -> DRegsT
+            {
+                return regsC;
+            }
+        };
+
+#if ROCWMMA_ARCH_GFX94X
+
+        // fp16
+        template <typename GfxTarget>
+        struct amdgcn_smfmac<float16_t, float32_t, 16u, 16u, GfxTarget, enable_gfx9_t<GfxTarget>>
+        {
+            constexpr static uint32_t      KPerMma = 32u;
+            constexpr static MfmaCtrlFlags Cbsz    = MfmaCtrlFlags::DEFAULT;
+            constexpr static MfmaCtrlFlags Abid    = MfmaCtrlFlags::DEFAULT;
+
+            // Packed register types
+            using ARegsT = VRegF32x2;
+            using BRegsT = VRegF32x4;
+            using CRegsT = AccRegF32x4;
+            using DRegsT = AccRegF32x4;
+
+            ROCWMMA_DEVICE static inline auto
+                exec(ARegsT const& regsA, BRegsT const& regsB, CRegsT const& regsC, uint32_t idx)
+                    -> DRegsT
+            {
+                using TypeA = VRegF16x4;
+                using TypeB = VRegF16x8;
+
+                DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x32_f16(
+                    ((TypeA const&)(regsA)).data,
+                    ((TypeB const&)(regsB)).data,
+                    regsC.data,
+                    (int)idx,
+                    (int)Cbsz,
+                    (int)Abid)};
+                return result;
+            }
+        };
+
+        template <typename GfxTarget>
+        struct amdgcn_smfmac<float16_t, float32_t, 32u, 32u, GfxTarget, enable_gfx9_t<GfxTarget>>
+        {
+            constexpr static uint32_t      KPerMma = 16u;
+            constexpr static MfmaCtrlFlags Cbsz    = MfmaCtrlFlags::DEFAULT;
+            constexpr static MfmaCtrlFlags Abid    = MfmaCtrlFlags::DEFAULT;
+
+            // Packed register types
+            using ARegsT = VRegF32x2;
+            using BRegsT = VRegF32x4;
+            using CRegsT = AccRegF32x16;
+            using DRegsT = AccRegF32x16;
+
+            ROCWMMA_DEVICE static inline auto
+                exec(ARegsT const& regsA, BRegsT const& regsB, CRegsT const& regsC, uint32_t idx)
+                    -> DRegsT
+            {
+                using TypeA = VRegF16x4;
+                using TypeB = VRegF16x8;
+
+                DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x16_f16(
+                    ((TypeA const&)(regsA)).data,
+                    ((TypeB const&)(regsB)).data,
+                    regsC.data,
+                    (int)idx,
+                    (int)Cbsz,
+                    (int)Abid)};
+                return result;
+            }
+        };
+
+        // bf16
+        template <typename GfxTarget>
+        struct amdgcn_smfmac<bfloat16_t, float32_t, 16u, 16u, GfxTarget, enable_gfx9_t<GfxTarget>>
+        {
+            constexpr static uint32_t      KPerMma = 32u;
+            constexpr static MfmaCtrlFlags Cbsz    = MfmaCtrlFlags::DEFAULT;
+            constexpr static MfmaCtrlFlags Abid    = MfmaCtrlFlags::DEFAULT;
+
+            // Packed register types
+            using ARegsT = VRegF32x2;
+            using BRegsT = VRegF32x4;
+            using CRegsT = AccRegF32x4;
+            using DRegsT = AccRegF32x4;
+
+            ROCWMMA_DEVICE static inline auto
+                exec(ARegsT const& regsA, BRegsT const& regsB, CRegsT const& regsC, uint32_t idx)
+                    -> DRegsT
+            {
+                using TypeA = VecT<int16_t, 4>;
+                using TypeB = VecT<int16_t, 8>;
+
+                DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x32_bf16(
+                    ((TypeA const&)(regsA)).data,
+                    ((TypeB const&)(regsB)).data,
+                    regsC.data,
+                    (int)idx,
+                    (int)Cbsz,
+                    (int)Abid)};
+                return result;
+            }
+        };
+
+        template <typename GfxTarget>
+        struct amdgcn_smfmac<bfloat16_t, float32_t, 32u, 32u, GfxTarget, enable_gfx9_t<GfxTarget>>
+        {
+            constexpr static uint32_t      KPerMma = 16u;
+            constexpr static MfmaCtrlFlags Cbsz    = MfmaCtrlFlags::DEFAULT;
+            constexpr static MfmaCtrlFlags Abid    = MfmaCtrlFlags::DEFAULT;
+
+            // Packed register types
+            using ARegsT = VRegF32x2;
+            using BRegsT = VRegF32x4;
+            using CRegsT = AccRegF32x16;
+            using DRegsT = AccRegF32x16;
+
+            ROCWMMA_DEVICE static inline auto
+                exec(ARegsT const& regsA, BRegsT const& regsB, CRegsT const& regsC, uint32_t idx)
+                    -> DRegsT
+            {
+                using TypeA = VecT<int16_t, 4>;
+                using TypeB = VecT<int16_t, 8>;
+
+                DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x16_bf16(
+                    ((TypeA const&)(regsA)).data,
+                    ((TypeB const&)(regsB)).data,
+                    regsC.data,
+                    (int)idx,
+                    (int)Cbsz,
+                    (int)Abid)};
+                return result;
+            }
+        };
+
+        // i8
+        template <typename GfxTarget>
+        struct amdgcn_smfmac<int8_t, int32_t, 16u, 16u, GfxTarget, enable_gfx9_t<GfxTarget>>
+        {
+            constexpr static uint32_t      KPerMma = 64u;
+            constexpr static MfmaCtrlFlags Cbsz    = MfmaCtrlFlags::DEFAULT;
+            constexpr static MfmaCtrlFlags Abid    = MfmaCtrlFlags::DEFAULT;
+
+            // Packed register types
+            using ARegsT = VRegI32x2;
+            using BRegsT = VRegI32x4;
+            using CRegsT = AccRegI32x4;
+            using DRegsT = AccRegI32x4;
+
+            ROCWMMA_DEVICE static inline auto
+                exec(ARegsT const& regsA, BRegsT const& regsB, CRegsT const& regsC, uint32_t idx)
+                    -> DRegsT
+            {
+                DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_i32_16x16x64_i8(
+                    regsA.data, regsB.data, regsC.data, (int)idx, (int)Cbsz, (int)Abid)};
+                return result;
+            }
+        };
+
+        template <typename GfxTarget>
+        struct amdgcn_smfmac<int8_t, int32_t, 32u, 32u, GfxTarget, enable_gfx9_t<GfxTarget>>
+        {
+            constexpr static uint32_t      KPerMma = 32u;
+            constexpr static MfmaCtrlFlags Cbsz    = MfmaCtrlFlags::DEFAULT;
+            constexpr static MfmaCtrlFlags Abid    = MfmaCtrlFlags::DEFAULT;
+
+            // Packed register types
+            using ARegsT = VRegI32x2;
+            using BRegsT = VRegI32x4;
+            using CRegsT = AccRegI32x16;
+            using DRegsT = AccRegI32x16;
+
+            ROCWMMA_DEVICE static inline auto
+                exec(ARegsT const& regsA, BRegsT const& regsB, CRegsT const& regsC, uint32_t idx)
+                    -> DRegsT
+            {
+                DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_i32_32x32x32_i8(
+                    regsA.data, regsB.data, regsC.data, (int)idx, (int)Cbsz, (int)Abid)};
+                return result;
+            }
+        };
+
+#endif // ROCWMMA_ARCH_GFX94X
+
+        ///
+        /// Loads the compressed values and metadata of a 2:4 sparse matrix_a
+        /// fragment into the sparse mma register order of Sparse24Layout. Each
+        /// lane reads the kept values of its groups and gathers their nibbles
+        /// into one index register per sparse mma.
+        ///
+        template <uint32_t BlockM, uint32_t BlockK, typename DataT, typename DataLayoutT>
+        struct SparseLoad
+        {
+            using Layout     = Sparse24Layout<DataT, BlockM>;
+            using DataLayout = DataLayout::template Array1d<DataLayoutT>;
+
+            constexpr static uint32_t Steps = BlockK / Layout::KPerMma;
+
+            static_assert(BlockK % Layout::KPerMma == 0u,
+                          "BlockK must be a multiple of the sparse mma K");
+
+            template <typename ValuesT, typename MetadataT>
+            ROCWMMA_DEVICE static inline void exec(ValuesT&       values,
+                                                   MetadataT&     metadata,
+                                                   DataT const*   data,
+                                                   uint32_t       ldv,
+                                                   uint8_t const* meta,
+                                                   uint32_t       ldmeta)
+            {
+                auto lane      = laneId();
+                auto row       = lane % BlockM;
+                auto laneGroup = lane / BlockM;
+
+#pragma unroll
+                for(uint32_t step = 0u; step < Steps; step++)
+                {
+                    uint32_t indices = 0u;
+
+#pragma unroll
+                    for(uint32_t i = 0u; i < Layout::GroupsPerLane; i++)
+                    {
+                        auto group = Layout::groupK(step, laneGroup, i) / Sparse24::GroupSize;
+                        auto col   = group * Sparse24::KeptPerGroup;
+                        auto index = (step * Layout::GroupsPerLane + i) * Sparse24::KeptPerGroup;
+
+#pragma unroll
+                        for(uint32_t j = 0u; j < Sparse24::KeptPerGroup; j++)
+                        {
+                            auto offset
+                                = DataLayout::fromMatrixCoord(make_coord2d(row, col + j), ldv);
+                            values.data[index + j] = data[offset];
+                        }
+
+                        auto byte = meta[DataLayout::fromMatrixCoord(
+                            make_coord2d(row, group / Sparse24::GroupsPerByte), ldmeta)];
+                        indices |= Sparse24::nibble(byte, group) << (i * Sparse24::NibbleBits);
+                    }
+
+                    metadata.data[step] = indices;
+                }
+            }
+        };
+
+        ///
+        /// Sparse mma of a 2:4 sparse matrix_a fragment with a dense matrix_b
+        /// fragment, one smfmac per KPerMma. The packed B registers of two
+        /// consecutive dense mfma blocks form the B operand of each smfmac.
+        ///
+        template <uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename InputT,
+                  typename ComputeT>
+        struct SparseMma
+        {
+            using Smfmac = amdgcn_smfmac<InputT, ComputeT, BlockM, BlockN>;
+            using PackA  = PackUtil<InputT>;
+
+            constexpr static uint32_t Steps = BlockK / Smfmac::KPerMma;
+
+            template <typename ValuesT, typename MetadataT, typename RegsB, typename RegsC>
+            ROCWMMA_DEVICE static inline auto exec(ValuesT const&   values,
+                                                   MetadataT const& metadata,
+                                                   RegsB const&     regsB,
+                                                   RegsC const&     regsC)
+            {
+                constexpr uint32_t SizeA = VecTraits<typename Smfmac::ARegsT>::size();
+                constexpr uint32_t SizeB = VecTraits<typename Smfmac::BRegsT>::size();
+
+                static_assert(VecTraits<RegsB>::size() == Steps * SizeB,
+                              "B register count does not match the sparse mma");
+
+                auto packedA = PackA::pack(values);
+
+                static_assert(VecTraits<decltype(packedA)>::size() == Steps * SizeA,
+                              "A register count does not match the sparse mma");
+
+                typename Smfmac::CRegsT accum = regsC;
+
+#pragma unroll
+                for(uint32_t step = 0u; step < Steps; step++)
+                {
+                    typename Smfmac::ARegsT stepA;
+                    typename Smfmac::BRegsT stepB;
+
+#pragma unroll
+                    for(uint32_t i = 0u; i < SizeA; i++)
+                    {
+                        stepA.data[i] = packedA.data[step * SizeA + i];
+                    }
+
+#pragma unroll
+                    for(uint32_t i = 0u; i < SizeB; i++)
+                    {
+                        stepB.data[i] = regsB.data[step * SizeB + i];
+                    }
+
+                    accum = Smfmac::exec(stepA, stepB, accum, metadata.data[step]);
+                }
+
+                return accum;
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SPARSE_MMA_HPP
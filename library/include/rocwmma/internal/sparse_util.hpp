@@ -0,0 +1,249 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_UTIL_HPP
+#define ROCWMMA_SPARSE_UTIL_HPP
+
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        ///
+        /// 2:4 structured sparsity: each aligned group of four elements along K
+        /// keeps at most two non-zeros. A group compresses to its two kept values
+        /// in K order, and a metadata nibble idx0 | (idx1 << 2) holding their
+        /// positions in the group, with idx0 < idx1.
+        ///
+        /// In memory, an M x K matrix compresses to an M x K/2 values matrix
+        /// and an M x K/8 uint8_t metadata matrix, both in the layout of the
+        /// dense matrix. Group g of a row holds values at columns 2g and 2g + 1
+        /// and its nibble in bits [4 * (g % 2), 4 * (g % 2) + 4) of byte g / 2.
+        ///
+        struct Sparse24
+        {
+            constexpr static uint32_t GroupSize     = 4u;
+            constexpr static uint32_t KeptPerGroup  = 2u;
+            constexpr static uint32_t IndexBits     = 2u;
+            constexpr static uint32_t NibbleBits    = 4u;
+            constexpr static uint32_t GroupsPerByte = 2u;
+
+            // Dense elements described by one metadata byte
+            constexpr static uint32_t KPerMetadataByte = GroupSize * GroupsPerByte;
+
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t encode(uint32_t idx0,
+                                                                        uint32_t idx1)
+            {
+                return (idx0 & 0x3u) | ((idx1 & 0x3u) << IndexBits);
+            }
+
+            // Position in the group of kept value i of a nibble
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t index(uint32_t nibble, uint32_t i)
+            {
+                return (nibble >> (i * IndexBits)) & 0x3u;
+            }
+
+            // Nibble of group g from the metadata byte holding it
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t nibble(uint32_t byte, uint32_t g)
+            {
+                return (byte >> ((g % GroupsPerByte) * NibbleBits)) & 0xFu;
+            }
+
+            template <typename DataLayoutT>
+            ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+                offset(uint32_t row, uint32_t col, uint32_t ld)
+            {
+                return is_same<DataLayoutT, row_major>::value
+                           ? static_cast<uint64_t>(row) * ld + col
+                           : static_cast<uint64_t>(col) * ld + row;
+            }
+
+            ///
+            /// Keeps the two largest magnitudes of a group, ties to the lower
+            /// position, so that any group with at most two non-zeros round
+            /// trips exactly. Returns the group's nibble.
+            ///
+            template <typename DataT>
+            ROCWMMA_HOST_DEVICE static inline uint32_t select(DataT const (&group)[GroupSize])
+            {
+                float32_t mag[GroupSize];
+                for(uint32_t i = 0u; i < GroupSize; i++)
+                {
+                    auto value = static_cast<float32_t>(group[i]);
+                    mag[i]     = value < 0.0f ? -value : value;
+                }
+
+                uint32_t first = 0u;
+                for(uint32_t i = 1u; i < GroupSize; i++)
+                {
+                    first = mag[i] > mag[first] ? i : first;
+                }
+
+                uint32_t second = first == 0u ? 1u : 0u;
+                for(uint32_t i = second + 1u; i < GroupSize; i++)
+                {
+                    second = (i != first && mag[i] > mag[second]) ? i : second;
+                }
+
+                return first < second ? encode(first, second) : encode(second, first);
+            }
+        };
+
+        ///
+        /// Lane mapping of the sparse mfma A operand for BlockMN x BlockMN
+        /// blocks. Each sparse mma consumes the B registers of two consecutive
+        /// dense mfma blocks, so lane group l / BlockMN holds DenseVW contiguous
+        /// K of each. The A lane with the same row and group holds the kept
+        /// values of the 2:4 groups over those K, GroupsPerLane per mma, with
+        /// group i's nibble in bits [4 * i, 4 * i + 4) of its index register.
+        /// Sparse mfma is wave64 only.
+        ///
+        template <typename DataT, uint32_t BlockMN>
+        struct Sparse24Layout
+        {
+            static_assert(BlockMN == 16u || BlockMN == 32u, "Sparse blocks must be 16 or 32");
+            static_assert(sizeof(DataT) == 1u || sizeof(DataT) == 2u,
+                          "Sparse mma inputs must be 8 or 16 bit");
+
+            constexpr static uint32_t WaveSize = 64u;
+
+            // K of the dense mfma block of the same input type
+            constexpr static uint32_t DenseKPerMma
+                = (BlockMN == 16u ? 16u : 8u) * (sizeof(DataT) == 1u ? 2u : 1u);
+
+            // Dense K covered by one sparse mma
+            constexpr static uint32_t KPerMma = 2u * DenseKPerMma;
+
+            constexpr static uint32_t LaneGroups     = WaveSize / BlockMN;
+            constexpr static uint32_t DenseVW        = DenseKPerMma / LaneGroups;
+            constexpr static uint32_t GroupsPerChunk = DenseVW / Sparse24::GroupSize;
+            constexpr static uint32_t GroupsPerLane  = 2u * GroupsPerChunk;
+            constexpr static uint32_t ValuesPerLane  = GroupsPerLane * Sparse24::KeptPerGroup;
+
+            static_assert(DenseVW % Sparse24::GroupSize == 0u,
+                          "Lane K extent must hold whole groups");
+
+            // First dense K of group i of a lane group, in sparse mma step
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                groupK(uint32_t step, uint32_t laneGroup, uint32_t i)
+            {
+                return (2u * step + i / GroupsPerChunk) * DenseKPerMma + laneGroup * DenseVW
+                       + (i % GroupsPerChunk) * Sparse24::GroupSize;
+            }
+        };
+
+        ///
+        /// Compresses an m x k dense matrix into 2:4 values and metadata.
+        /// Groups with more than two non-zeros are pruned to their two largest
+        /// magnitudes. k must be a multiple of 8.
+        ///
+        template <typename DataT, typename DataLayoutT>
+        inline void sparse24Compress(uint32_t     m,
+                                     uint32_t     k,
+                                     DataT const* dense,
+                                     uint32_t     ldd,
+                                     DataT*       values,
+                                     uint32_t     ldv,
+                                     uint8_t*     metadata,
+                                     uint32_t     ldmeta)
+        {
+            using S = Sparse24;
+
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t byteCol = 0u; byteCol < k / S::KPerMetadataByte; byteCol++)
+                {
+                    uint32_t byte = 0u;
+                    for(uint32_t j = 0u; j < S::GroupsPerByte; j++)
+                    {
+                        auto g = byteCol * S::GroupsPerByte + j;
+
+                        DataT group[S::GroupSize];
+                        for(uint32_t i = 0u; i < S::GroupSize; i++)
+                        {
+                            auto col = g * S::GroupSize + i;
+                            group[i] = dense[S::offset<DataLayoutT>(row, col, ldd)];
+                        }
+
+                        auto nibble = S::select(group);
+                        for(uint32_t i = 0u; i < S::KeptPerGroup; i++)
+                        {
+                            values[S::offset<DataLayoutT>(row, g * S::KeptPerGroup + i, ldv)]
+                                = group[S::index(nibble, i)];
+                        }
+                        byte |= nibble << (j * S::NibbleBits);
+                    }
+                    metadata[S::offset<DataLayoutT>(row, byteCol, ldmeta)]
+                        = static_cast<uint8_t>(byte);
+                }
+            }
+        }
+
+        ///
+        /// Expands 2:4 values and metadata back into an m x k dense matrix,
+        /// with zeros in the pruned positions.
+        ///
+        template <typename DataT, typename DataLayoutT>
+        inline void sparse24Decompress(uint32_t       m,
+                                       uint32_t       k,
+                                       DataT const*   values,
+                                       uint32_t       ldv,
+                                       uint8_t const* metadata,
+                                       uint32_t       ldmeta,
+                                       DataT*         dense,
+                                       uint32_t       ldd)
+        {
+            using S = Sparse24;
+
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t g = 0u; g < k / S::GroupSize; g++)
+                {
+                    auto byte
+                        = metadata[S::offset<DataLayoutT>(row, g / S::GroupsPerByte, ldmeta)];
+                    auto nibble = S::nibble(byte, g);
+
+                    for(uint32_t i = 0u; i < S::GroupSize; i++)
+                    {
+                        dense[S::offset<DataLayoutT>(row, g * S::GroupSize + i, ldd)]
+                            = static_cast<DataT>(0);
+                    }
+                    for(uint32_t i = 0u; i < S::KeptPerGroup; i++)
+                    {
+                        auto col = g * S::GroupSize + S::index(nibble, i);
+                        dense[S::offset<DataLayoutT>(row, col, ldd)]
+                            = values[S::offset<DataLayoutT>(row, g * S::KeptPerGroup + i, ldv)];
+                    }
+                }
+            }
+        }
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SPARSE_UTIL_HPP
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_STOCHASTIC_ROUNDING_HPP
+#define ROCWMMA_STOCHASTIC_ROUNDING_HPP
+
+#include "types.hpp"
+
+#include "float_conversion.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        ///
+        /// Philox4x32-10 counter-based random number generator
+        /// (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11).
+        /// Each (counter, key) pair maps to four independent 32-bit random words,
+        /// so any element of the stream can be drawn directly on host or device.
+        ///
+        struct Philox4x32
+        {
+            struct Block
+            {
+                uint32_t data[4];
+            };
+
+            constexpr static uint32_t Rounds = 10u;
+            constexpr static uint32_t M0     = 0xD2511F53u;
+            constexpr static uint32_t M1     = 0xCD9E8D57u;
+            constexpr static uint32_t W0     = 0x9E3779B9u;
+            constexpr static uint32_t W1     = 0xBB67AE85u;
+
+            ROCWMMA_HOST_DEVICE constexpr static inline Block
+                exec(Block counter, uint32_t key0, uint32_t key1)
+            {
+                for(uint32_t round = 0u; round < Rounds; round++)
+                {
+                    auto prod0 = static_cast<uint64_t>(M0) * counter.data[0];
+                    auto prod1 = static_cast<uint64_t>(M1) * counter.data[2];
+
+                    counter = Block{{static_cast<uint32_t>(prod1 >> 32u) ^ counter.data[1] ^ key0,
+                                     static_cast<uint32_t>(prod1),
+                                     static_cast<uint32_t>(prod0 >> 32u) ^ counter.data[3] ^ key1,
+                                     static_cast<uint32_t>(prod0)}};
+
+                    key0 += W0;
+                    key1 += W1;
+                }
+                return counter;
+            }
+        };
+
+        ///
+        /// Random stream used for stochastic rounding of fragment elements.
+        /// Element e of lane l draws word (e % 4) of the Philox block at counter
+        /// {e / 4, l, offset.lo, offset.hi} with key {seed.lo, seed.hi}.
+        ///
+        ROCWMMA_HOST_DEVICE constexpr inline Philox4x32::Block
+            stochasticRoundingBlock(uint64_t seed, uint64_t offset, uint32_t lane, uint32_t group)
+        {
+            return Philox4x32::exec(Philox4x32::Block{{group,
+                                                       lane,
+                                                       static_cast<uint32_t>(offset),
+                                                       static_cast<uint32_t>(offset >> 32u)}},
+                                    static_cast<uint32_t>(seed),
+                                    static_cast<uint32_t>(seed >> 32u));
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t
+            stochasticRoundingWord(uint64_t seed, uint64_t offset, uint32_t lane, uint32_t element)
+        {
+            return stochasticRoundingBlock(seed, offset, lane, element / 4u).data[element % 4u];
+        }
+
+        ///
+        /// Stochastic rounding of fp32 bits to an 8-bit float format: the dropped
+        /// mantissa bits are added to the low bits of the random word, then
+        /// truncated. Targets below the normal range are first shifted to the
+        /// subnormal scale with truncation, as in the hardware conversions.
+        /// Out-of-range values saturate to the largest finite value; NaN maps to
+        /// the format's NaN and FNUZ formats have no negative zero.
+        ///
+        template <uint32_t ExpBits, uint32_t MantBits, uint32_t Bias, bool Fnuz>
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t stochasticRoundFp8(uint32_t bits,
+                                                                         uint32_t rng)
+        {
+            constexpr uint32_t Drop     = 23u - MantBits;
+            constexpr uint32_t DropMask = (1u << Drop) - 1u;
+            constexpr uint32_t MaxCode  = Fnuz ? 0x7Fu : (ExpBits == 4u ? 0x7Eu : 0x7Bu);
+            constexpr uint32_t MaxBits  = (((MaxCode >> MantBits) + 127u - Bias) << 23u)
+                                         | ((MaxCode & ((1u << MantBits) - 1u)) << Drop);
+
+            auto sign = (bits >> 24u) & 0x80u;
+            auto abs  = bits & 0x7FFFFFFFu;
+
+            if(abs > 0x7F800000u)
+            {
+                return Fnuz ? 0x80u : (sign | 0x7Fu);
+            }
+
+            abs = abs > MaxBits ? MaxBits : abs;
+
+            // Denormal inputs share the exponent of the smallest normal
+            auto exp  = abs >> 23u;
+            auto mant = abs & 0x7FFFFFu;
+            if(exp != 0u)
+            {
+                mant |= 0x800000u;
+            }
+            else
+            {
+                exp = 1u;
+            }
+
+            uint32_t code      = 0u;
+            auto     targetExp = static_cast<int32_t>(exp) - 127 + static_cast<int32_t>(Bias);
+            if(targetExp >= 1)
+            {
+                // Mantissa carry propagates into the exponent field
+                code = ((static_cast<uint32_t>(targetExp) - 1u) << MantBits)
+                       + ((mant + (rng & DropMask)) >> Drop);
+            }
+            else
+            {
+                auto shift = static_cast<uint32_t>(1 - targetExp);
+                mant       = shift < 32u ? (mant >> shift) : 0u;
+                code       = (mant + (rng & DropMask)) >> Drop;
+            }
+
+            if(Fnuz && code == 0u)
+            {
+                sign = 0u;
+            }
+
+            return sign | code;
+        }
+
+        ///
+        /// Stochastic rounding of fp32 bits to bf16. NaN is kept as in the
+        /// nearest-even hip_bfloat16 conversion, and overflow rounds to Inf.
+        ///
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t stochasticRoundBf16(uint32_t bits,
+                                                                          uint32_t rng)
+        {
+            if((bits & 0x7FFFFFFFu) > 0x7F800000u)
+            {
+                return (bits | ((bits & 0xFFFFu) ? 0x10000u : 0u)) >> 16u;
+            }
+            return (bits + (rng & 0xFFFFu)) >> 16u;
+        }
+
+        ///
+        /// Output types supporting stochastic rounding from float32_t
+        ///
+        template <typename OutputT>
+        struct StochasticRoundingTraits
+        {
+            constexpr static bool Supported = false;
+        };
+
+        template <uint32_t ExpBits, uint32_t MantBits, uint32_t Bias, bool Fnuz>
+        struct StochasticRoundingTraitsFp8
+        {
+            constexpr static bool Supported = true;
+
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t round(uint32_t bits, uint32_t rng)
+            {
+                return stochasticRoundFp8<ExpBits, MantBits, Bias, Fnuz>(bits, rng);
+            }
+        };
+
+#if !defined(ENABLE_OCP_HIPRTC) || ENABLE_OCP_HIPRTC
+        template <>
+        struct StochasticRoundingTraits<float8_t> : StochasticRoundingTraitsFp8<4u, 3u, 7u, false>
+        {
+            ROCWMMA_FP8_VISIBILITY static inline float8_t fromBits(uint32_t bits)
+            {
+                return make_hip_fp8_e4m3_from_bits(static_cast<__hip_fp8_storage_t>(bits));
+            }
+        };
+
+        template <>
+        struct StochasticRoundingTraits<bfloat8_t> : StochasticRoundingTraitsFp8<5u, 2u, 15u, false>
+        {
+            ROCWMMA_FP8_VISIBILITY static inline bfloat8_t fromBits(uint32_t bits)
+            {
+                return make_hip_fp8_e5m2_from_bits(static_cast<__hip_fp8_storage_t>(bits));
+            }
+        };
+
+#endif // !defined(ENABLE_OCP_HIPRTC) || ENABLE_OCP_HIPRTC
+
+#if !defined(ENABLE_FNUZ_HIPRTC) || ENABLE_FNUZ_HIPRTC
+        template <>
+        struct StochasticRoundingTraits<float8_fnuz_t>
+            : StochasticRoundingTraitsFp8<4u, 3u, 8u, true>
+        {
+            ROCWMMA_FP8_FNUZ_VISIBILITY static inline float8_fnuz_t fromBits(uint32_t bits)
+            {
+                return make_hip_fp8_e4m3_fnuz_from_bits(static_cast<__hip_fp8_storage_t>(bits));
+            }
+        };
+
+        template <>
+        struct StochasticRoundingTraits<bfloat8_fnuz_t>
+            : StochasticRoundingTraitsFp8<5u, 2u, 16u, true>
+        {
+            ROCWMMA_FP8_FNUZ_VISIBILITY static inline bfloat8_fnuz_t fromBits(uint32_t bits)
+            {
+                return make_hip_fp8_e5m2_fnuz_from_bits(static_cast<__hip_fp8_storage_t>(bits));
+            }
+        };
+
+#endif // !defined(ENABLE_FNUZ_HIPRTC) || ENABLE_FNUZ_HIPRTC
+
+        template <>
+        struct StochasticRoundingTraits<bfloat16_t>
+        {
+            constexpr static bool Supported = true;
+
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t round(uint32_t bits, uint32_t rng)
+            {
+                return stochasticRoundBf16(bits, rng);
+            }
+
+            ROCWMMA_HOST_DEVICE static inline bfloat16_t fromBits(uint32_t bits)
+            {
+                bfloat16_t result;
+                result.data = static_cast<uint16_t>(bits);
+                return result;
+            }
+        };
+
+        ///
+        /// Rounds value to OutputT using the random word rng, with the bit model
+        /// above on the host and every device target. The cvt_sr_fp8/bf8
+        /// instructions of gfx94x and gfx12 are not used until they are shown
+        /// to match the model bit for bit (see stochastic_rounding_sync_test).
+        ///
+        template <typename OutputT>
+        ROCWMMA_HOST_DEVICE inline OutputT stochasticRound(float32_t value, uint32_t rng)
+        {
+            using Traits = StochasticRoundingTraits<OutputT>;
+            static_assert(Traits::Supported, "Stochastic rounding not supported for OutputT");
+
+            return Traits::fromBits(Traits::round(fp32_to_bits(value), rng));
+        }
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_STOCHASTIC_ROUNDING_HPP
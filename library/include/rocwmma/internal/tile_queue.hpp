@@ -0,0 +1,269 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_TILE_QUEUE_HPP
+#define ROCWMMA_TILE_QUEUE_HPP
+
+#if !defined(__HIPCC_RTC__)
+#include <atomic>
+#endif // !defined(__HIPCC_RTC__)
+
+#include "types.hpp"
+
+namespace rocwmma
+{
+    //! @struct tile_chunk
+    //! @brief Contiguous range [begin, end) of linear tile indices claimed from a tile_queue.
+    struct tile_chunk
+    {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    //! @struct tile_group
+    //! @brief Tile grid of one problem in a grouped (or single) workload.
+    //! Tiles of the group have linear indices [tile_begin, tile_begin + tiles_x * tiles_y),
+    //! with x fastest, matching the blockIdx order of a non-persistent launch.
+    //! @var tile_begin Linear index of the group's first tile (tiles of all previous groups)
+    //! @var tiles_x Macro tiles of the group in the x (M) direction
+    //! @var tiles_y Macro tiles of the group in the y (N) direction
+    struct tile_group
+    {
+        uint32_t tile_begin;
+        uint32_t tiles_x;
+        uint32_t tiles_y;
+    };
+
+    //! @struct tile_coord
+    //! @brief Group and macro-tile coordinate of a linear tile index. (x, y) takes the place of
+    //! the workgroup coordinate (blockIdx.x, blockIdx.y) in a global mapping.
+    struct tile_coord
+    {
+        uint32_t group;
+        uint32_t x;
+        uint32_t y;
+    };
+
+    namespace detail
+    {
+        ///
+        /// Tiles are split evenly into contiguous shards, each with its own
+        /// claim counter. Shard s owns [begin(s), end(s)) and its counter holds
+        /// the tiles claimed so far, which may run past the shard size.
+        ///
+        struct TileQueueShards
+        {
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                begin(uint32_t tileCount, uint32_t shardCount, uint32_t shard)
+            {
+                return static_cast<uint32_t>(static_cast<uint64_t>(tileCount) * shard / shardCount);
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr static inline uint32_t
+                end(uint32_t tileCount, uint32_t shardCount, uint32_t shard)
+            {
+                return begin(tileCount, shardCount, shard + 1u);
+            }
+
+            // Chunk at claimed counter value of a shard, empty once the shard is drained
+            ROCWMMA_HOST_DEVICE constexpr static inline tile_chunk chunk(uint32_t tileCount,
+                                                                         uint32_t shardCount,
+                                                                         uint32_t shard,
+                                                                         uint32_t claimed,
+                                                                         uint32_t chunkSize)
+            {
+                auto first = begin(tileCount, shardCount, shard);
+                auto last  = end(tileCount, shardCount, shard);
+                if(claimed >= last - first)
+                {
+                    return tile_chunk{last, last};
+                }
+
+                // Last chunk of a shard may be partial
+                auto chunkEnd
+                    = last - first - claimed < chunkSize ? last : first + claimed + chunkSize;
+                return tile_chunk{first + claimed, chunkEnd};
+            }
+        };
+
+        // Relaxed counter access: claims only need atomicity, tiles are
+        // independent and their data is published by the kernel boundary.
+        ROCWMMA_DEVICE inline uint32_t tileQueueFetchAdd(uint32_t* counter, uint32_t value)
+        {
+            return atomicAdd(counter, value);
+        }
+
+        ROCWMMA_DEVICE inline uint32_t tileQueueLoad(uint32_t* counter)
+        {
+            return __hip_atomic_load(counter, __ATOMIC_RELAXED, __HIP_MEMORY_SCOPE_AGENT);
+        }
+
+#if !defined(__HIPCC_RTC__)
+        inline uint32_t tileQueueFetchAdd(std::atomic<uint32_t>* counter, uint32_t value)
+        {
+            return counter->fetch_add(value, std::memory_order_relaxed);
+        }
+
+        inline uint32_t tileQueueLoad(std::atomic<uint32_t>* counter)
+        {
+            return counter->load(std::memory_order_relaxed);
+        }
+#endif // !defined(__HIPCC_RTC__)
+
+    } // namespace detail
+
+    //! @struct tile_queue
+    //! @brief Lock-free work-stealing queue of linear tile indices [0, tile_count).
+    //! Tiles are split into shard_count contiguous shards, each with an atomic claim counter.
+    //! Workers claim chunk_size tiles at a time from their home shard, then steal chunks from
+    //! the following shards once it is drained. Every tile is claimed exactly once per reset.
+    //! @tparam CounterT uint32_t for device queues (counters in global memory, zeroed before
+    //! each launch), or std::atomic<uint32_t> for the host queue with the same claim order
+    //! @var counters Array of shard_count claim counters
+    //! @var tile_count Total tiles in the queue
+    //! @var shard_count Number of shards, e.g. the CU count so that each CU has a home shard
+    //! @var chunk_size Tiles per claim
+    //! @note Create queues with make_tile_queue, which rejects zero shard_count and chunk_size.
+    template <typename CounterT>
+    struct tile_queue
+    {
+        CounterT* counters;
+        uint32_t  tile_count;
+        uint32_t  shard_count;
+        uint32_t  chunk_size;
+
+        //! @param worker_id Worker index, e.g. CU or workgroup id
+        //! @returns Home shard of the worker
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t home_shard(uint32_t worker_id) const
+        {
+            return worker_id % shard_count;
+        }
+
+        //! Claims the next chunk, starting at shard and stealing from the following
+        //! shards once it is drained. shard is left at the shard the chunk came from,
+        //! so the next claim resumes there.
+        //! @param shard Shard to claim from first
+        //! @param chunk Claimed chunk
+        //! @returns False once all shards are drained
+        ROCWMMA_HOST_DEVICE inline bool claim(uint32_t& shard, tile_chunk& chunk) const
+        {
+            using Shards = detail::TileQueueShards;
+
+            for(uint32_t tries = 0u; tries < shard_count; tries++)
+            {
+                auto size = Shards::end(tile_count, shard_count, shard)
+                            - Shards::begin(tile_count, shard_count, shard);
+
+                // Skip drained shards without growing their counters
+                if(detail::tileQueueLoad(counters + shard) < size)
+                {
+                    auto claimed = detail::tileQueueFetchAdd(counters + shard, chunk_size);
+                    chunk = Shards::chunk(tile_count, shard_count, shard, claimed, chunk_size);
+                    if(chunk.begin < chunk.end)
+                    {
+                        return true;
+                    }
+                }
+                shard = (shard + 1u) % shard_count;
+            }
+            return false;
+        }
+
+        //! Zeroes the counters. Not thread safe: use between runs of the queue.
+        ROCWMMA_HOST_DEVICE inline void reset() const
+        {
+            for(uint32_t i = 0u; i < shard_count; i++)
+            {
+                counters[i] = 0u;
+            }
+        }
+    };
+
+    //! Creates a tile queue over shard_count claim counters. The counters are not zeroed.
+    //! @param queue Queue to create, left unchanged on failure
+    //! @param counters Array of shard_count claim counters
+    //! @param tile_count Total tiles in the queue
+    //! @param shard_count Number of shards
+    //! @param chunk_size Tiles per claim
+    //! @returns False if shard_count or chunk_size is zero: home shards are taken modulo
+    //! shard_count, and empty claims would never drain the queue
+    template <typename CounterT>
+    ROCWMMA_HOST_DEVICE constexpr inline bool make_tile_queue(tile_queue<CounterT>& queue,
+                                                              CounterT*             counters,
+                                                              uint32_t              tile_count,
+                                                              uint32_t              shard_count,
+                                                              uint32_t              chunk_size)
+    {
+        if(shard_count == 0u || chunk_size == 0u)
+        {
+            return false;
+        }
+
+        queue = tile_queue<CounterT>{counters, tile_count, shard_count, chunk_size};
+        return true;
+    }
+
+    //! @param groups Tile groups, in increasing tile_begin order
+    //! @param group_count Number of groups
+    //! @returns Total number of tiles of the groups
+    ROCWMMA_HOST_DEVICE constexpr inline uint32_t tile_count(tile_group const* groups,
+                                                             uint32_t          group_count)
+    {
+        return group_count == 0u ? 0u
+                                 : groups[group_count - 1u].tile_begin
+                                       + groups[group_count - 1u].tiles_x
+                                             * groups[group_count - 1u].tiles_y;
+    }
+
+    //! Maps a linear tile index to its group and macro-tile coordinate.
+    //! @param groups Tile groups, in increasing tile_begin order, with groups[0].tile_begin = 0
+    //! @param group_count Number of groups
+    //! @param tile Linear tile index, less than tile_count(groups, group_count)
+    ROCWMMA_HOST_DEVICE constexpr inline tile_coord
+        locate_tile(tile_group const* groups, uint32_t group_count, uint32_t tile)
+    {
+        // Last group with tile_begin <= tile
+        uint32_t lo = 0u;
+        uint32_t hi = group_count;
+        while(hi - lo > 1u)
+        {
+            auto mid = lo + (hi - lo) / 2u;
+            if(groups[mid].tile_begin <= tile)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        auto local = tile - groups[lo].tile_begin;
+        return tile_coord{lo, local % groups[lo].tiles_x, local / groups[lo].tiles_x};
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TILE_QUEUE_HPP
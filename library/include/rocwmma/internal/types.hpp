@@ -113,6 +113,17 @@ namespace rocwmma
 
     using xfloat32_t = rocwmma_xfloat32;
 
+    // Packed 4-bit integers, two per byte: the lower-indexed element in the low nibble
+    struct int4x2_t
+    {
+        uint8_t data;
+    };
+
+    struct uint4x2_t
+    {
+        uint8_t data;
+    };
+
     /** @}*/
 
 } // namespace rocwmma
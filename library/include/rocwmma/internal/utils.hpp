@@ -27,6 +27,7 @@
 #define ROCWMMA_UTILS_HPP
 
 #include "api_fwd.hpp"
+#include "complex.hpp"
 #include "types.hpp"
 
 #include "utility/apply.hpp"
@@ -310,6 +311,24 @@ namespace rocwmma
         return "u64";
     }
 
+    template <>
+    constexpr const char* dataTypeToString<complex_float16_t>()
+    {
+        return "cf16";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<complex_float32_t>()
+    {
+        return "cf32";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<complex_float64_t>()
+    {
+        return "cf64";
+    }
+
     template <>
     constexpr const char* dataTypeToString<row_major>()
     {
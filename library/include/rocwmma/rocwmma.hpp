@@ -27,8 +27,10 @@
 #define ROCWMMA_API_HPP
 
 #include "internal/accessors.hpp"
+#include "internal/complex.hpp"
 #include "internal/io_traits.hpp"
 #include "internal/pack_util.hpp"
+#include "internal/sparse_util.hpp"
 #include "internal/types.hpp"
 
 /**
@@ -109,6 +111,42 @@ namespace rocwmma
         mem_col_major
     };
 
+    //! @struct stochastic_rounding
+    //! @brief Parameters of the counter-based (Philox4x32-10) random stream used for stochastic rounding.
+    //! Element i of a fragment in lane l draws word (i % 4) of the block at counter {i / 4, l, offset} with key seed.
+    //! @var seed Random stream key
+    //! @var offset Stream offset. Use a distinct offset per fragment and wave (e.g. tile index and step) to keep streams independent.
+    struct stochastic_rounding
+    {
+        uint64_t seed;
+        uint64_t offset;
+    };
+
+    //! @struct int4_zero_points
+    //! @brief Zero-points subtracted while unpacking packed 4-bit data into an int8_t fragment: value = q - zero_point.
+    //! There is one zero-point per row of matrix_a (column of matrix_b) for the group of K covering the fragment. Zero-points form
+    //! an M x (K / GroupSize) (matrix_a) or (K / GroupSize) x N (matrix_b) matrix in the fragment's data layout. A null pointer selects zero-points of 0.
+    //! @var zero_points Pointer to the zero-point of the fragment's first row (matrix_a) or column (matrix_b) in its group
+    //! @var ld Leading dimension size of the zero-point matrix
+    struct int4_zero_points
+    {
+        uint8_t const* zero_points;
+        uint32_t       ld;
+    };
+
+    //! @struct int4_dequantization
+    //! @brief Zero-points and scales applied while unpacking packed 4-bit data into a float16_t fragment: value = (q - zero_point) * scale.
+    //! Zero-points and scales are laid out as in int4_zero_points, sharing the leading dimension. Null pointers select zero-points of 0 and scales of 1.
+    //! @var zero_points Pointer to the zero-point of the fragment's first row (matrix_a) or column (matrix_b) in its group
+    //! @var scales Pointer to the scale of the fragment's first row (matrix_a) or column (matrix_b) in its group
+    //! @var ld Leading dimension size of the zero-point and scale matrices
+    struct int4_dequantization
+    {
+        uint8_t const*   zero_points;
+        float16_t const* scales;
+        uint32_t         ld;
+    };
+
     //! @class fragment
     //! @brief rocWMMA fragment class. This is the primary object used in block-wise decomposition of the matrix multiply-accumulate (mma)
     //! problem space. In general, fragment data is associated with a matrix context (matrix_a, matrix_b or accumulator), a block size (BlockM/N/K),
@@ -201,6 +239,146 @@ namespace rocwmma
         using element_type                     = DataT;
     };
 
+    //! @class scaled_fragment
+    //! @brief Input fragment (matrix_a or matrix_b) carrying OCP microscaling (MX) E8M0 block scales alongside its data.
+    //! Each row of a matrix_a fragment (column of a matrix_b fragment) has one scale for the fragment's K extent, which must lie within one
+    //! scale block of ScaleBlockK elements. An E8M0 scale e encodes 2^(e - 127) and 0xFF is NaN. Scales are loaded by load_matrix_sync and
+    //! applied by mma_sync.
+    //!
+    //! @tparam MatrixT fragment context: matrix_a or matrix_b
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT datatype, e.g. float8_t (E4M3) or bfloat8_t (E5M2)
+    //! @tparam DataLayoutT in-memory layout of both the data and the scales as col_major or row_major
+    //! @tparam ScaleBlockK K extent covered by each scale
+    //!
+    //! @note Scale index i is held in register i / WaveSize of lane i % WaveSize.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ScaleBlockK = 32u>
+    class __align__(4) scaled_fragment
+        : public fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>
+    {
+    public:
+        struct ScaleTraits
+        {
+            //! Scales per fragment: one per row of matrix_a or column of matrix_b
+            constexpr static uint32_t Count = is_same<MatrixT, matrix_a>::value ? BlockM : BlockN;
+
+            //! Registers per lane holding the scales
+            constexpr static uint32_t RegCount
+                = (Count + Constants::AMDGCN_WAVE_SIZE - 1u) / Constants::AMDGCN_WAVE_SIZE;
+
+            //! Scales storage view. Each register holds one zero-extended E8M0 scale.
+            using StorageT = VecT<uint32_t, RegCount>;
+
+            static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                          "Scaled fragments must be matrix_a or matrix_b");
+            static_assert(!is_same<DataLayoutT, void>::value,
+                          "Scaled fragments must provide a data layout");
+            static_assert(ScaleBlockK % BlockK == 0u,
+                          "Fragment K extent must lie within one scale block");
+        };
+
+        //! @param index Row (matrix_a) or column (matrix_b) index within the fragment
+        //! @returns The E8M0 scale at the given index. Must be called by all lanes of the wave.
+        ROCWMMA_DEVICE inline uint32_t scale(uint32_t index) const;
+
+        //! Scales storage
+        typename ScaleTraits::StorageT mScales;
+    };
+
+    //! @class sparse_fragment
+    //! @brief 2:4 structured-sparse matrix_a fragment for the sparse mma instructions of gfx94x. Each aligned group of four elements
+    //! along K keeps two values, stored compressed with a 2-bit position index each. BlockK is the dense K extent of the fragment.
+    //!
+    //! @tparam MatrixT fragment context: matrix_a
+    //! @tparam BlockM/N/K block dimensions. BlockM and BlockN must be equal, 16 or 32.
+    //! @tparam DataT datatype: float16_t, bfloat16_t or int8_t
+    //! @tparam DataLayoutT in-memory layout of both the compressed values and the metadata as col_major or row_major
+    //!
+    //! @note BlockK must be a multiple of the sparse mma K: 32 (16 x 16) or 16 (32 x 32) for 16-bit data, and twice that for int8_t.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    class __align__(4) sparse_fragment
+    {
+    public:
+        struct Traits
+        {
+            //! Lane mapping of the sparse mma A operand
+            using Layout = detail::Sparse24Layout<DataT, BlockM>;
+
+            //! Sparse mma per fragment
+            constexpr static uint32_t Steps = BlockK / Layout::KPerMma;
+
+            //! Compressed values per lane
+            constexpr static uint32_t Size = Steps * Layout::ValuesPerLane;
+
+            //! Compressed values storage
+            using StorageT = VecT<DataT, Size>;
+
+            //! Metadata storage: one index register per sparse mma
+            using MetadataT = VecT<uint32_t, Steps>;
+
+            static_assert(is_same<MatrixT, matrix_a>::value, "Sparse fragments must be matrix_a");
+            static_assert(BlockM == BlockN, "Sparse fragments must be square blocks");
+            static_assert(is_same<DataT, float16_t>::value || is_same<DataT, bfloat16_t>::value
+                              || is_same<DataT, int8_t>::value,
+                          "Sparse fragments must be float16_t, bfloat16_t or int8_t");
+            static_assert(!is_same<DataLayoutT, void>::value,
+                          "Sparse fragments must provide a data layout");
+            static_assert(BlockK % Layout::KPerMma == 0u,
+                          "BlockK must be a multiple of the sparse mma K");
+        };
+
+        //! Compressed values storage
+        typename Traits::StorageT mValues;
+
+        //! Metadata storage
+        typename Traits::MetadataT mMetadata;
+    };
+
+    //! @class complex_fragment
+    //! @brief Complex fragment with split real / imag registers: each part is a fragment of the real datatype, with the register layout of
+    //! a native fragment. Complex mma_sync decomposes over the real mma of the parts, so any datatype with real mma support may be used.
+    //!
+    //! @tparam MatrixT fragment context
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam DataT real datatype of each part: float16_t, float32_t or float64_t
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major. Required for loads and stores.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT = void>
+    class __align__(4) complex_fragment
+    {
+    public:
+        struct Traits
+        {
+            //! Fragment of each part
+            using PartT = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+            static_assert(is_same<DataT, float16_t>::value || is_same<DataT, float32_t>::value
+                              || is_same<DataT, float64_t>::value,
+                          "Complex fragments must be float16_t, float32_t or float64_t");
+        };
+
+        //! Real part
+        typename Traits::PartT mReal;
+
+        //! Imaginary part
+        typename Traits::PartT mImag;
+    };
+
     //! Fills the entire fragment with the desired value.
     //! @param frag Fragment of type MatrixT with its associated block sizes, data type and layout
     //! @param value Fill value of type DataT
@@ -287,6 +465,68 @@ namespace rocwmma
                           uint32_t                                                ldm,
                           layout_t                                                layout);
 
+    //! Converts each fragment element to the destination datatype with round-to-nearest-even.
+    //! @param dst Destination fragment with datatype DstT
+    //! @param src Source fragment with datatype SrcT
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DstT Destination datatype
+    //! @tparam SrcT Source datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DstT,
+              typename SrcT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        convert_fragment(fragment<MatrixT, BlockM, BlockN, BlockK, DstT, DataLayoutT>&       dst,
+                         fragment<MatrixT, BlockM, BlockN, BlockK, SrcT, DataLayoutT> const& src);
+
+    //! Converts each float32_t fragment element to the destination datatype with stochastic rounding.
+    //! Supported destination datatypes are float8_t, bfloat8_t, float8_fnuz_t, bfloat8_fnuz_t and bfloat16_t. fp8 results saturate to the
+    //! largest finite value. Results match the host rounding model bit for bit on every target.
+    //! @param dst Destination fragment with datatype DstT
+    //! @param src Source fragment with datatype float32_t
+    //! @param sr Random stream parameters
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DstT Destination datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DstT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void convert_fragment(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DstT, DataLayoutT>&            dst,
+        fragment<MatrixT, BlockM, BlockN, BlockK, float32_t, DataLayoutT> const& src,
+        stochastic_rounding const&                                               sr);
+
+    //! Stores a float32_t fragment to the data pointer of datatype DataT, with stochastic rounding of each element.
+    //! See convert_fragment() for supported datatypes.
+    //! @param data Data pointer to global/local memory
+    //! @param frag Fragment of type MatrixT with its associated block sizes, float32_t datatype and layout
+    //! @param ldm Leading dimension size
+    //! @param sr Random stream parameters
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype in memory
+    //! @tparam DataLayoutT in-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_sync(
+        DataT*                                                                   data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, float32_t, DataLayoutT> const& frag,
+        uint32_t                                                                 ldm,
+        stochastic_rounding const&                                               sr);
+
     //! Performs the Multiply-Accumulate operation on the fragments A, B, C and D (D = A * B + C)
     //! @param d Accumulator output D
     //! @param a Input fragment A
@@ -297,6 +537,8 @@ namespace rocwmma
     //! @tparam ComputeT Datatype of accumulator fragment C / D
     //! @tparam LayoutA/B/C/D In-memory layout of frag as col_major or row_major
     //! @note Frag c = d is valid
+    //! @note There are no mma instructions for mixed A / B datatypes. For mixed inputs, load the narrower operand into a fragment of
+    //! the wider datatype with the converting load_matrix_sync, which upcasts in registers.
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -313,6 +555,377 @@ namespace rocwmma
                  fragment<matrix_b, BlockM, BlockN, BlockK, InputTB, LayoutB> const&      b,
                  fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
 
+    //! Loads the data and E8M0 scales of a scaled fragment. Scales of matrix_a form an M x (K / ScaleBlockK) matrix and scales of matrix_b
+    //! form a (K / ScaleBlockK) x N matrix, both in the same layout as the data.
+    //! @param frag Scaled fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Data pointer to global or local memory
+    //! @param ldm Leading dimension size of the data
+    //! @param scales Pointer to the scale of the first row (matrix_a) or column (matrix_b) of the fragment, in its scale block
+    //! @param lds Leading dimension size of the scales
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam ScaleBlockK K extent covered by each scale
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ScaleBlockK>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        scaled_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT, ScaleBlockK>& frag,
+        const DataT*                                                                       data,
+        uint32_t                                                                           ldm,
+        const uint8_t*                                                                     scales,
+        uint32_t                                                                           lds);
+
+    //! Loads packed 4-bit integers (int4x2_t or uint4x2_t, two per byte) into an int8_t fragment for the int8 mma path. int4 values are
+    //! sign-extended and zero-points are subtracted. Packed dwords are unpacked in registers with byte permutes.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, int8_t data type and layout
+    //! @param data Packed data pointer to global or local memory, addressing an even element
+    //! @param ldm Leading dimension size in elements. Must be a multiple of 8 for aligned dword loads.
+    //! @param zp Zero-points of the fragment
+    //! @tparam MatrixT Fragment context: matrix_a or matrix_b
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam PackedT Packed datatype: int4x2_t or uint4x2_t
+    //! @note Group scales cannot be applied in int8 registers: apply them to the int32 accumulator, or use the float16_t path.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, int8_t, DataLayoutT>& frag,
+                         PackedT const*                                                  data,
+                         uint32_t                                                        ldm,
+                         int4_zero_points const&                                         zp);
+
+    //! Loads packed 4-bit integers (int4x2_t or uint4x2_t, two per byte) into a float16_t fragment for the f16 mma path, applying
+    //! zero-points and scales. Packed dwords are unpacked in registers with byte permutes into f16 words encoding 1024 + q.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, float16_t data type and layout
+    //! @param data Packed data pointer to global or local memory, addressing an even element
+    //! @param ldm Leading dimension size in elements. Must be a multiple of 8 for aligned dword loads.
+    //! @param dq Zero-points and scales of the fragment
+    //! @tparam MatrixT Fragment context: matrix_a or matrix_b
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam PackedT Packed datatype: int4x2_t or uint4x2_t
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, float16_t, DataLayoutT>& frag,
+                         PackedT const*                                                     data,
+                         uint32_t                                                           ldm,
+                         int4_dequantization const&                                         dq);
+
+    //! Loads SrcT data into a fragment of a wider datatype DataT, converting each element in registers after the load. The fragment
+    //! holds the same elements in the same order as a native load of DataT data, so it may be passed directly to mma_sync. This enables
+    //! mixed input GEMMs such as float16_t x int8_t or bfloat16_t x float8_t without a separate conversion pass.
+    //! @param frag Fragment of type MatrixT with its associated block sizes, DataT data type and layout
+    //! @param data Data pointer of type SrcT to global or local memory
+    //! @param ldm Leading dimension size in elements
+    //! @tparam MatrixT Fragment context: matrix_a or matrix_b
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Fragment datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    //! @tparam SrcT In-memory datatype. Must be no wider than DataT.
+    //! @note Conversions go through float32_t. Conversions from int8_t and from 8-bit floats to float16_t or bfloat16_t are exact.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename SrcT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         SrcT const*                                                    data,
+                         uint32_t                                                       ldm);
+
+    //! Performs the block-scaled Multiply-Accumulate operation D = (2^(sA - 127) * 2^(sB - 127)) * (A * B) + C, where sA and sB are the
+    //! E8M0 scales of each row of A and each column of B. Targets without block-scaled mma instructions compute the unscaled product
+    //! and apply the scales to each result in registers.
+    //! @param d Accumulator output D
+    //! @param a Scaled input fragment A
+    //! @param b Scaled input fragment B
+    //! @param c Input accumulator fragment C
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam InputT A/B Datatype of input frags A and B
+    //! @tparam LayoutA/B/C/D In-memory layout of frag as col_major or row_major
+    //! @tparam ScaleBlockK K extent covered by each scale
+    //! @note Frag c = d is valid
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputTA,
+              typename InputTB,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              uint32_t ScaleBlockK>
+    ROCWMMA_DEVICE void mma_sync(
+        fragment<accumulator, BlockM, BlockN, BlockK, float32_t, LayoutD>&                     d,
+        scaled_fragment<matrix_a, BlockM, BlockN, BlockK, InputTA, LayoutA, ScaleBlockK> const& a,
+        scaled_fragment<matrix_b, BlockM, BlockN, BlockK, InputTB, LayoutB, ScaleBlockK> const& b,
+        fragment<accumulator, BlockM, BlockN, BlockK, float32_t, LayoutC> const&               c);
+
+    //! Loads the compressed values and metadata of a 2:4 sparse fragment, as written by compress_sparse_2_4.
+    //! @param frag Sparse fragment with its associated block sizes, data type and layout
+    //! @param values Compressed values of the fragment in global or local memory: an M x (K / 2) matrix
+    //! @param ldv Leading dimension size of the values
+    //! @param metadata Metadata of the fragment in global or local memory: an M x (K / 8) uint8_t matrix
+    //! @param ldmeta Leading dimension size of the metadata
+    //! @tparam MatrixT Fragment context: matrix_a
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout of the values and metadata as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        sparse_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        DataT const*                                                          values,
+        uint32_t                                                              ldv,
+        uint8_t const*                                                        metadata,
+        uint32_t                                                              ldmeta);
+
+    //! Performs the Multiply-Accumulate operation D = A * B + C with a 2:4 sparse fragment A, using the sparse mma instructions of
+    //! gfx94x. Each sparse mma consumes the registers of two dense mma blocks of B.
+    //! @param d Accumulator output D
+    //! @param a Sparse input fragment A
+    //! @param b Dense input fragment B
+    //! @param c Input accumulator fragment C
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam InputT Datatype of input frags A and B
+    //! @tparam ComputeT Datatype of accumulator fragment C / D: float32_t for 16-bit inputs, int32_t for int8_t
+    //! @tparam LayoutA/B/C/D In-memory layout of frag as col_major or row_major
+    //! @note Frag c = d is valid
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&         d,
+                 sparse_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const& a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&        b,
+                 fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const&   c);
+
+    //! Compresses a 2:4 structured-sparse m x k matrix into compressed values and metadata. Group g of four elements along K of each
+    //! row keeps two values, at columns 2g and 2g + 1 of the values, and the nibble idx0 | (idx1 << 2) of their positions, with
+    //! idx0 < idx1, in bits 4 * (g % 2) of byte g / 2 of the metadata. Groups with more than two non-zeros keep their two largest
+    //! magnitudes.
+    //! @param m Rows of the dense matrix
+    //! @param k Columns of the dense matrix. Must be a multiple of 8.
+    //! @param dense Dense host matrix
+    //! @param ldd Leading dimension size of the dense matrix
+    //! @param values Host m x (k / 2) matrix of compressed values
+    //! @param ldv Leading dimension size of the values
+    //! @param metadata Host m x (k / 8) matrix of metadata bytes
+    //! @param ldmeta Leading dimension size of the metadata
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout of all three matrices as col_major or row_major
+    template <typename DataT, typename DataLayoutT>
+    ROCWMMA_HOST void compress_sparse_2_4(uint32_t     m,
+                                          uint32_t     k,
+                                          DataT const* dense,
+                                          uint32_t     ldd,
+                                          DataT*       values,
+                                          uint32_t     ldv,
+                                          uint8_t*     metadata,
+                                          uint32_t     ldmeta);
+
+    //! Expands compressed 2:4 values and metadata into a dense m x k matrix, with zeros in the pruned positions.
+    //! @param m Rows of the dense matrix
+    //! @param k Columns of the dense matrix. Must be a multiple of 8.
+    //! @param values Host m x (k / 2) matrix of compressed values
+    //! @param ldv Leading dimension size of the values
+    //! @param metadata Host m x (k / 8) matrix of metadata bytes
+    //! @param ldmeta Leading dimension size of the metadata
+    //! @param dense Dense host matrix
+    //! @param ldd Leading dimension size of the dense matrix
+    //! @tparam DataT Datatype
+    //! @tparam DataLayoutT In-memory layout of all three matrices as col_major or row_major
+    template <typename DataT, typename DataLayoutT>
+    ROCWMMA_HOST void decompress_sparse_2_4(uint32_t       m,
+                                            uint32_t       k,
+                                            DataT const*   values,
+                                            uint32_t       ldv,
+                                            uint8_t const* metadata,
+                                            uint32_t       ldmeta,
+                                            DataT*         dense,
+                                            uint32_t       ldd);
+
+    //! Fills both parts of a complex fragment with the desired value.
+    //! @param frag Complex fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param value Complex fill value
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Real datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        fill_fragment(complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                      complex_t<DataT>                                                       value);
+
+    //! Loads a complex fragment from interleaved complex data, as laid out by std::complex or hipFloatComplex arrays. Each vector of
+    //! complex elements is read at once and split into the real and imaginary parts in registers.
+    //! @param frag Complex fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param data Interleaved data pointer to global or local memory
+    //! @param ldm Leading dimension size in complex elements
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Real datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        complex_t<DataT> const*                                                data,
+        uint32_t                                                               ldm);
+
+    //! Loads a complex fragment from planar data: separate real and imaginary matrices with the same leading dimension.
+    //! @param frag Complex fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param real Real part data pointer to global or local memory
+    //! @param imag Imaginary part data pointer to global or local memory
+    //! @param ldm Leading dimension size of both parts
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Real datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        DataT const*                                                           real,
+        DataT const*                                                           imag,
+        uint32_t                                                               ldm);
+
+    //! Stores a complex fragment as interleaved complex data. See load_matrix_sync() for the layout.
+    //! @param data Interleaved data pointer to global or local memory
+    //! @param frag Complex fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size in complex elements
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Real datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_sync(
+        complex_t<DataT>*                                                            data,
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                                     ldm);
+
+    //! Stores a complex fragment as planar data: separate real and imaginary matrices with the same leading dimension.
+    //! @param real Real part data pointer to global or local memory
+    //! @param imag Imaginary part data pointer to global or local memory
+    //! @param frag Complex fragment of type MatrixT with its associated block sizes, data type and layout
+    //! @param ldm Leading dimension size of both parts
+    //! @tparam MatrixT Fragment context
+    //! @tparam BlockM/N/K Block dimensions
+    //! @tparam DataT Real datatype
+    //! @tparam DataLayoutT In-memory layout as col_major or row_major
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_sync(
+        DataT*                                                                       real,
+        DataT*                                                                       imag,
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                                     ldm);
+
+    //! Performs the complex Multiply-Accumulate operation D = A * B + C with the 4M algorithm: four real mma of the parts.
+    //! @param d Complex accumulator output D
+    //! @param a Complex input fragment A
+    //! @param b Complex input fragment B
+    //! @param c Complex input accumulator fragment C
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam InputT Real datatype of input frags A and B
+    //! @tparam ComputeT Real datatype of accumulator fragment C / D
+    //! @tparam LayoutA/B/C/D In-memory layout of frag as col_major or row_major
+    //! @note Frag c = d is valid
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 complex_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+                 complex_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
+
+    //! Performs the complex Multiply-Accumulate operation D = A * B + C with the chosen algorithm. complex_mma_4m uses four real mma
+    //! of the parts. complex_mma_3m (Gauss) uses three real mma and element-wise adds, trading 25% of the mma for the adds and for the
+    //! rounding of A.real + A.imag and B.real + B.imag in InputT.
+    //! @param d Complex accumulator output D
+    //! @param a Complex input fragment A
+    //! @param b Complex input fragment B
+    //! @param c Complex input accumulator fragment C
+    //! @param algo Algorithm tag: complex_mma_4m or complex_mma_3m
+    //! @tparam BlockM/N/K block dimensions
+    //! @tparam InputT Real datatype of input frags A and B
+    //! @tparam ComputeT Real datatype of accumulator fragment C / D
+    //! @tparam LayoutA/B/C/D In-memory layout of frag as col_major or row_major. complex_mma_3m requires LayoutC = LayoutD.
+    //! @tparam AlgoT Algorithm
+    //! @note Frag c = d is valid
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename AlgoT>
+    ROCWMMA_DEVICE void mma_sync(
+        complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+        complex_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+        complex_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+        complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c,
+        AlgoT const&                                                                    algo);
+
     //! Synchronization point for all wavefronts in a workgroup. Guarantees pending reads / writes to LDS are flushed.
     ROCWMMA_DEVICE void synchronize_workgroup();
 
@@ -30,11 +30,15 @@
 
 #include "internal/accessors.hpp"
 #include "internal/blend.hpp"
+#include "internal/block_scale.hpp"
 #include "internal/broadcast.hpp"
+#include "internal/complex_io.hpp"
 #include "internal/constants.hpp"
 #include "internal/convert.hpp"
+#include "internal/convert_load.hpp"
 #include "internal/dpp.hpp"
 #include "internal/flow_control.hpp"
+#include "internal/int4_load.hpp"
 #include "internal/io_config.hpp"
 #include "internal/io_layout.hpp"
 #include "internal/io_shape.hpp"
@@ -48,6 +52,8 @@
 #include "internal/opaque_store.hpp"
 #include "internal/pack_util.hpp"
 #include "internal/permute.hpp"
+#include "internal/scaled_mma.hpp"
+#include "internal/sparse_mma.hpp"
 #include "internal/swizzle.hpp"
 #include "internal/transforms.hpp"
 #include "internal/types.hpp"
@@ -197,6 +203,20 @@ namespace rocwmma
         return num_elements;
     }
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ScaleBlockK>
+    ROCWMMA_DEVICE inline uint32_t
+        scaled_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT, ScaleBlockK>::scale(
+            uint32_t index) const
+    {
+        return detail::blockScaleLookup(mScales, index);
+    }
+
     template <typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -270,6 +290,104 @@ namespace rocwmma
         }
     }
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              uint32_t ScaleBlockK>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        scaled_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT, ScaleBlockK>& frag,
+        const DataT*                                                                       data,
+        uint32_t                                                                           ldm,
+        const uint8_t*                                                                     scales,
+        uint32_t                                                                           lds)
+    {
+        using FragT       = decay_t<decltype(frag)>;
+        using ScaleTraits = typename FragT::ScaleTraits;
+        using ScaleLayout = DataLayout::template Array1d<DataLayoutT>;
+
+        using BaseFragT = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+        load_matrix_sync(static_cast<BaseFragT&>(frag), data, ldm);
+
+        // One scale per lane and register: rows of matrix_a, cols of matrix_b
+        auto lane = detail::laneId();
+
+#pragma unroll
+        for(uint32_t i = 0; i < ScaleTraits::RegCount; i++)
+        {
+            auto index = i * Constants::AMDGCN_WAVE_SIZE + lane;
+            auto coord = is_same<MatrixT, matrix_a>::value ? make_coord2d(index, 0u)
+                                                           : make_coord2d(0u, index);
+
+            frag.mScales.data[i] = index < ScaleTraits::Count
+                                       ? static_cast<uint32_t>(
+                                           scales[ScaleLayout::fromMatrixCoord(coord, lds)])
+                                       : detail::E8M0::NanCode;
+        }
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, int8_t, DataLayoutT>& frag,
+                         PackedT const*                                                  data,
+                         uint32_t                                                        ldm,
+                         int4_zero_points const&                                         zp)
+    {
+        using Loader = Int4Load<MatrixT, BlockM, BlockN, BlockK, int8_t, DataLayoutT, PackedT>;
+
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information for packed 4-bit data");
+
+        Loader::exec(frag.mAccess, data, ldm, {zp.zero_points, nullptr, zp.ld});
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataLayoutT,
+              typename PackedT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, float16_t, DataLayoutT>& frag,
+                         PackedT const*                                                     data,
+                         uint32_t                                                           ldm,
+                         int4_dequantization const&                                         dq)
+    {
+        using Loader = Int4Load<MatrixT, BlockM, BlockN, BlockK, float16_t, DataLayoutT, PackedT>;
+
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information for packed 4-bit data");
+
+        Loader::exec(frag.mAccess, data, ldm, {dq.zero_points, dq.scales, dq.ld});
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename SrcT>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                         SrcT const*                                                    data,
+                         uint32_t                                                       ldm)
+    {
+        using Loader = ConvertLoad<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT, SrcT>;
+
+        static_assert(!is_same<DataLayoutT, void>::value,
+                      "Must provide layout information for converting loads");
+
+        Loader::exec(frag.mAccess, data, ldm);
+    }
+
     template <typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -320,6 +438,66 @@ namespace rocwmma
         }
     }
 
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DstT,
+              typename SrcT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        convert_fragment(fragment<MatrixT, BlockM, BlockN, BlockK, DstT, DataLayoutT>&       dst,
+                         fragment<MatrixT, BlockM, BlockN, BlockK, SrcT, DataLayoutT> const& src)
+    {
+        using DstFragT = decay_t<decltype(dst)>;
+        using SrcFragT = decay_t<decltype(src)>;
+
+        // Sanity check
+        static_assert(DstFragT::num_elements == SrcFragT::num_elements,
+                      "Fragment element counts do not match");
+
+        dst.mAccess = Convert<SrcT, DstT>::exec(src.mAccess);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DstT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void convert_fragment(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DstT, DataLayoutT>&            dst,
+        fragment<MatrixT, BlockM, BlockN, BlockK, float32_t, DataLayoutT> const& src,
+        stochastic_rounding const&                                               sr)
+    {
+        using DstFragT = decay_t<decltype(dst)>;
+        using SrcFragT = decay_t<decltype(src)>;
+
+        // Sanity check
+        static_assert(DstFragT::num_elements == SrcFragT::num_elements,
+                      "Fragment element counts do not match");
+
+        dst.mAccess
+            = ConvertSR<float32_t, DstT>::exec(src.mAccess, sr.seed, sr.offset, detail::laneId());
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_sync(
+        DataT*                                                                   data,
+        fragment<MatrixT, BlockM, BlockN, BlockK, float32_t, DataLayoutT> const& frag,
+        uint32_t                                                                 ldm,
+        stochastic_rounding const&                                               sr)
+    {
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> converted;
+        convert_fragment(converted, frag, sr);
+        store_matrix_sync(data, converted, ldm);
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -363,6 +541,297 @@ namespace rocwmma
 
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputTA,
+              typename InputTB,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              uint32_t ScaleBlockK>
+    ROCWMMA_DEVICE void mma_sync(
+        fragment<accumulator, BlockM, BlockN, BlockK, float32_t, LayoutD>&                     d,
+        scaled_fragment<matrix_a, BlockM, BlockN, BlockK, InputTA, LayoutA, ScaleBlockK> const& a,
+        scaled_fragment<matrix_b, BlockM, BlockN, BlockK, InputTB, LayoutB, ScaleBlockK> const& b,
+        fragment<accumulator, BlockM, BlockN, BlockK, float32_t, LayoutC> const&               c)
+    {
+        using MmaConfig = MmaConfig<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputTA,
+                                    InputTB,
+                                    float32_t,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        // Transforms
+        using XA = typename MmaConfig::PreMmaXFormA;
+        using XB = typename MmaConfig::PreMmaXFormB;
+        using XC = typename MmaConfig::PreMmaXFormC;
+        using XD = typename MmaConfig::PostMmaXFormD;
+
+        // PackUtil
+        using PackA = typename MmaConfig::PackA;
+        using PackB = typename MmaConfig::PackB;
+        using PackC = typename MmaConfig::PackC;
+        using PackD = typename MmaConfig::PackD;
+
+        using Mma    = typename MmaConfig::Mma;
+        using Coords = detail::AccumMmaCoords<BlockM, BlockN, BlockK>;
+
+        // None of the supported targets have block-scaled mma instructions:
+        // take the unscaled block product, then dequantize each result in
+        // registers with the scales of its row and column before adding C.
+        fragment<accumulator, BlockM, BlockN, BlockK, float32_t, LayoutC> zero;
+        fill_fragment(zero, 0.0f);
+
+        auto accum  = PackD::unpack(Mma::exec(PackA::pack(XA::exec(a.mAccess)),
+                                             PackB::pack(XB::exec(b.mAccess)),
+                                             PackC::pack(XC::exec(zero.mAccess))));
+        auto accumC = XC::exec(c.mAccess);
+        auto coords = Coords::exec();
+
+        static_assert(VecTraits<decltype(accum)>::size() == VecTraits<decltype(coords)>::size(),
+                      "Accumulator and coordinate sizes do not match");
+
+#pragma unroll
+        for(uint32_t i = 0; i < VecTraits<decltype(accum)>::size(); i++)
+        {
+            // Coordinates are encoded as col * BlockM + row
+            auto coord = static_cast<uint32_t>(coords.data[i]);
+            auto scaled = detail::applyBlockScale(
+                accum.data[i], a.scale(coord % BlockM), b.scale(coord / BlockM));
+            accum.data[i] = scaled + accumC.data[i];
+        }
+
+        d.mAccess = XD::exec(accum);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        sparse_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        DataT const*                                                          values,
+        uint32_t                                                              ldv,
+        uint8_t const*                                                        metadata,
+        uint32_t                                                              ldmeta)
+    {
+        using Loader = detail::SparseLoad<BlockM, BlockK, DataT, DataLayoutT>;
+
+        Loader::exec(frag.mValues, frag.mMetadata, values, ldv, metadata, ldmeta);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&         d,
+                 sparse_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const& a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&        b,
+                 fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const&   c)
+    {
+        using MmaConfig = MmaConfig<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    InputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        // Transforms
+        using XB = typename MmaConfig::PreMmaXFormB;
+        using XC = typename MmaConfig::PreMmaXFormC;
+        using XD = typename MmaConfig::PostMmaXFormD;
+
+        // PackUtil
+        using PackB = typename MmaConfig::PackB;
+        using PackC = typename MmaConfig::PackC;
+        using PackD = typename MmaConfig::PackD;
+
+        using Mma = detail::SparseMma<BlockM, BlockN, BlockK, InputT, ComputeT>;
+
+        // Sparse mma B operands are pairs of dense mma blocks of B
+        static_assert(MmaConfig::MmaDimN == BlockN, "Sparse mma requires a single block of B");
+        using SparseComputeT = conditional_t<is_same<InputT, int8_t>::value, int32_t, float32_t>;
+        static_assert(is_same<ComputeT, SparseComputeT>::value,
+                      "Sparse mma accumulates in float32_t, or int32_t for int8_t inputs");
+
+        // A is loaded in sparse mma order and needs no layout transform
+        d.mAccess = XD::exec(PackD::unpack(Mma::exec(a.mValues,
+                                                     a.mMetadata,
+                                                     PackB::pack(XB::exec(b.mAccess)),
+                                                     PackC::pack(XC::exec(c.mAccess)))));
+    }
+
+    template <typename DataT, typename DataLayoutT>
+    ROCWMMA_HOST void compress_sparse_2_4(uint32_t     m,
+                                          uint32_t     k,
+                                          DataT const* dense,
+                                          uint32_t     ldd,
+                                          DataT*       values,
+                                          uint32_t     ldv,
+                                          uint8_t*     metadata,
+                                          uint32_t     ldmeta)
+    {
+        detail::sparse24Compress<DataT, DataLayoutT>(
+            m, k, dense, ldd, values, ldv, metadata, ldmeta);
+    }
+
+    template <typename DataT, typename DataLayoutT>
+    ROCWMMA_HOST void decompress_sparse_2_4(uint32_t       m,
+                                            uint32_t       k,
+                                            DataT const*   values,
+                                            uint32_t       ldv,
+                                            uint8_t const* metadata,
+                                            uint32_t       ldmeta,
+                                            DataT*         dense,
+                                            uint32_t       ldd)
+    {
+        detail::sparse24Decompress<DataT, DataLayoutT>(
+            m, k, values, ldv, metadata, ldmeta, dense, ldd);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void
+        fill_fragment(complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+                      complex_t<DataT>                                                       value)
+    {
+        fill_fragment(frag.mReal, value.real);
+        fill_fragment(frag.mImag, value.imag);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        complex_t<DataT> const*                                                data,
+        uint32_t                                                               ldm)
+    {
+        using Loader = ComplexLoad<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+        Loader::exec(frag.mReal.mAccess, frag.mImag.mAccess, data, ldm);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>& frag,
+        DataT const*                                                           real,
+        DataT const*                                                           imag,
+        uint32_t                                                               ldm)
+    {
+        load_matrix_sync(frag.mReal, real, ldm);
+        load_matrix_sync(frag.mImag, imag, ldm);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_sync(
+        complex_t<DataT>*                                                            data,
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                                     ldm)
+    {
+        using Storer = ComplexStore<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+
+        Storer::exec(data, frag.mReal.mAccess, frag.mImag.mAccess, ldm);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    ROCWMMA_DEVICE void store_matrix_sync(
+        DataT*                                                                       real,
+        DataT*                                                                       imag,
+        complex_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT> const& frag,
+        uint32_t                                                                     ldm)
+    {
+        store_matrix_sync(real, frag.mReal, ldm);
+        store_matrix_sync(imag, frag.mImag, ldm);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 complex_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+                 complex_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c)
+    {
+        mma_sync(d, a, b, c, complex_mma_4m{});
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename AlgoT>
+    ROCWMMA_DEVICE void mma_sync(
+        complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+        complex_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+        complex_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+        complex_fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c,
+        AlgoT const&                                                                    algo)
+    {
+        using ComplexMma = detail::ComplexMma<AlgoT>;
+
+        // Real mma of the parts
+        auto mma = [](auto& dPart, auto const& aPart, auto const& bPart, auto const& cPart) {
+            mma_sync(dPart, aPart, bPart, cPart);
+        };
+
+        ComplexMma::template exec<detail::ElementwiseOps>(
+            d.mReal, d.mImag, a.mReal, a.mImag, b.mReal, b.mImag, c.mReal, c.mImag, mma);
+    }
+
     ROCWMMA_DEVICE void synchronize_workgroup()
     {
         __syncthreads();
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_TILE_QUEUE_API_HPP
+#define ROCWMMA_TILE_QUEUE_API_HPP
+
+#include "internal/tile_queue.hpp"
+#include "rocwmma.hpp"
+
+//! rocWMMA tile queue API complements the rocWMMA API with dynamic tile scheduling for
+//! persistent kernels. Instead of one workgroup per output tile, a fixed number of
+//! workgroups repeatedly claim chunks of tiles from a lock-free tile_queue until it is
+//! drained, so that workgroups finishing early take over tiles from slower ones.
+//!
+//! Tiles are linear indices over one or more tile_group grids (e.g. the problems of a
+//! grouped GEMM). locate_tile maps a tile index to its group and macro-tile coordinate,
+//! which replaces the workgroup coordinate (blockIdx) in a global mapping.
+//!
+//! \n
+//! **tile_queue**
+//!
+//! Tiles are split into contiguous shards, one atomic claim counter each. Workers
+//! claim chunk_size tiles at a time from a home shard (e.g. per CU), keeping
+//! neighbouring tiles and their shared A / B data together, and steal from the
+//! following shards once the home shard is drained. The same queue runs on the host
+//! over std::atomic counters for testing.
+//!
+//! \n
+//! **Persistent loop**
+//!
+//! @code
+//! auto shard = home_shard_sync(queue);
+//! tile_chunk chunk;
+//! while(claim_tile_chunk_sync(queue, shard, chunk))
+//! {
+//!     for(auto tile = chunk.begin; tile < chunk.end; tile++)
+//!     {
+//!         auto coord = locate_tile(groups, groupCount, tile);
+//!         // Compute macro tile (coord.x, coord.y) of problem coord.group
+//!     }
+//! }
+//! @endcode
+//!
+//! Queues are created on the host with make_tile_queue, which rejects zero shards or
+//! chunk sizes. Device counters must be zeroed before each launch (e.g. hipMemsetAsync).
+
+namespace rocwmma
+{
+    //! Home shard of the calling workgroup, from the hardware CU it runs on.
+    //! @param queue Device tile queue
+    //! @returns Home shard, uniform across the workgroup
+    ROCWMMA_DEVICE uint32_t home_shard_sync(tile_queue<uint32_t> const& queue);
+
+    //! Claims the next chunk of tiles for the whole workgroup. One thread claims and
+    //! broadcasts the chunk through LDS, so all threads must call it.
+    //! @param queue Device tile queue
+    //! @param shard Shard to claim from first, updated to the shard the chunk came from
+    //! @param chunk Claimed chunk, uniform across the workgroup
+    //! @returns False once the queue is drained
+    ROCWMMA_DEVICE bool claim_tile_chunk_sync(tile_queue<uint32_t> const& queue,
+                                              uint32_t&                   shard,
+                                              tile_chunk&                 chunk);
+
+} // namespace rocwmma
+
+#include "rocwmma_tile_queue_impl.hpp"
+
+#endif // ROCWMMA_TILE_QUEUE_API_HPP
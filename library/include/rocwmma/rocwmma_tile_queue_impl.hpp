@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_TILE_QUEUE_API_IMPL_HPP
+#define ROCWMMA_TILE_QUEUE_API_IMPL_HPP
+
+#include "rocwmma_tile_queue.hpp"
+
+namespace rocwmma
+{
+    ROCWMMA_DEVICE inline uint32_t home_shard_sync(tile_queue<uint32_t> const& queue)
+    {
+        // All waves of a workgroup run on the same CU
+        return queue.home_shard(__smid());
+    }
+
+    ROCWMMA_DEVICE inline bool claim_tile_chunk_sync(tile_queue<uint32_t> const& queue,
+                                                     uint32_t&                   shard,
+                                                     tile_chunk&                 chunk)
+    {
+        __shared__ tile_chunk sChunk;
+        __shared__ uint32_t   sShard;
+
+        if(threadIdx.x == 0u && threadIdx.y == 0u && threadIdx.z == 0u)
+        {
+            if(!queue.claim(shard, sChunk))
+            {
+                sChunk = tile_chunk{0u, 0u};
+            }
+            sShard = shard;
+        }
+        synchronize_workgroup();
+
+        chunk = sChunk;
+        shard = sShard;
+
+        // LDS is re-written by the next claim
+        synchronize_workgroup();
+
+        return chunk.begin < chunk.end;
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TILE_QUEUE_API_IMPL_HPP
@@ -35,6 +35,7 @@
 #include <rocwmma/rocwmma.hpp>
 
 #include "common.hpp"
+#include "hiprtc_jit.hpp"
 
 using rocwmma::bfloat16_t;
 using rocwmma::float16_t;
@@ -174,8 +175,6 @@ __global__ void gemm_rocwmma_d(uint32_t         m,
 }
 )";
 
-char const* src = source.c_str();
-
 int main()
 {
     /// Determine the rocm path to use for build
@@ -192,36 +191,16 @@ int main()
     ComputeT alpha = 2.1f;
     ComputeT beta  = 2.1f;
 
-    hiprtcProgram prog;
-    CHECK_HIPRTC_ERROR(hiprtcCreateProgram(&prog, src, nullptr, 0, nullptr, nullptr));
-    hiprtcResult result;
-    hiprtcResult logResult;
-    const char*  opts[] = {"-D__HIP_PLATFORM_AMD__", "--std=c++17", rocWMMAIncludePath.c_str()};
-
-    result = hiprtcCompileProgram(prog, sizeof(opts) / sizeof(opts[0]), opts);
-    if(result != HIPRTC_SUCCESS)
-    {
-        std::cout << "HipRTC compile failed." << std::endl;
-        std::cout << result << std::endl;
-        std::string s_error = hiprtcGetErrorString(result);
-        std::cout << s_error << std::endl;
-        std::size_t log_size;
-        CHECK_HIPRTC_ERROR(hiprtcGetProgramLogSize(prog, &log_size));
-        std::cout << "Log Size: " << log_size << std::endl;
-        std::string log;
-
-        log.reserve(log_size);
-        CHECK_HIPRTC_ERROR(hiprtcGetProgramLog(prog, &log[0]));
-
-        std::cout << log.c_str() << std::endl;
-        exit(EXIT_FAILURE);
-    }
+    // Compiled code objects are cached on disk, keyed by source, options,
+    // device arch and toolchain version. Re-runs skip hipRTC entirely.
+    rocwmma::CodeObjectCache cache(rocwmma::CodeObjectCache::defaultDirectory());
 
-    std::size_t code_size;
-    CHECK_HIPRTC_ERROR(hiprtcGetCodeSize(prog, &code_size));
-    std::vector<char> code(code_size);
+    auto code = rocwmma::hiprtcCompileCached(
+        source, {"-D__HIP_PLATFORM_AMD__", "--std=c++17", rocWMMAIncludePath}, cache);
 
-    CHECK_HIPRTC_ERROR(hiprtcGetCode(prog, code.data()));
+    auto cacheStats = cache.stats();
+    std::cout << "Code object cache " << (cacheStats.hits ? "hit" : "miss") << ": "
+              << cache.directory() << std::endl;
 
     hipModule_t   module;
     hipFunction_t func;
@@ -394,7 +373,6 @@ int main()
     std::cout << "Finished!" << std::endl;
 
     CHECK_HIP_ERROR(hipModuleUnload(module));
-    CHECK_HIPRTC_ERROR(hiprtcDestroyProgram(&prog));
 
     return 0;
 }
@@ -0,0 +1,394 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_SAMPLES_HIPRTC_CACHE_HPP
+#define ROCWMMA_SAMPLES_HIPRTC_CACHE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+// Persistent cache of JIT compiled code objects.
+// This layer has no HIP dependency: the compiler is injected as a callable,
+// so hashing, storage and eviction can be exercised without a device.
+namespace rocwmma
+{
+    // 64-bit FNV-1a
+    inline uint64_t fnv1a64(void const* data, size_t bytes, uint64_t hash = 0xcbf29ce484222325ull)
+    {
+        auto const* bytePtr = static_cast<unsigned char const*>(data);
+        for(size_t i = 0; i < bytes; ++i)
+        {
+            hash ^= bytePtr[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    inline uint64_t fnv1a64(std::string const& str, uint64_t hash = 0xcbf29ce484222325ull)
+    {
+        // Length prefix keeps concatenated fields unambiguous
+        uint64_t size = str.size();
+        hash          = fnv1a64(&size, sizeof(size), hash);
+        return fnv1a64(str.data(), str.size(), hash);
+    }
+
+    ///
+    /// Everything that determines the compiled binary.
+    ///
+    struct CodeObjectKey
+    {
+        std::string              source;
+        std::vector<std::string> options;
+        std::string              arch;
+        std::string              version;
+
+        uint64_t sourceHash() const
+        {
+            return fnv1a64(source);
+        }
+
+        // Readable description of the key, stored with the binary so that
+        // hash collisions are detected on load.
+        std::string descriptor() const
+        {
+            std::ostringstream stream;
+            stream << "source=" << std::hex << sourceHash() << std::dec << "/" << source.size()
+                   << "\narch=" << arch << "\nversion=" << version;
+            for(auto const& option : options)
+            {
+                stream << "\noption=" << option;
+            }
+            return stream.str();
+        }
+
+        uint64_t hash() const
+        {
+            auto result = fnv1a64(source);
+            result      = fnv1a64(arch, result);
+            result      = fnv1a64(version, result);
+            for(auto const& option : options)
+            {
+                result = fnv1a64(option, result);
+            }
+            return result;
+        }
+    };
+
+    ///
+    /// On-disk store of code objects, one file per key.
+    ///
+    /// - Writes go to a unique temporary file that is renamed into place,
+    ///   so concurrent readers and writers in other processes never see a
+    ///   partial binary. Two processes missing on the same key both compile
+    ///   and the last rename wins with an identical result.
+    /// - Hits refresh the file modification time, which orders entries for
+    ///   LRU eviction once the directory exceeds its size budget.
+    ///
+    class CodeObjectCache
+    {
+    public:
+        using CodeT     = std::vector<char>;
+        using CompilerT = std::function<CodeT(CodeObjectKey const&)>;
+
+        struct Stats
+        {
+            uint64_t hits;
+            uint64_t misses;
+            uint64_t evictions;
+        };
+
+        static constexpr char const* Extension = ".co";
+
+        explicit CodeObjectCache(std::filesystem::path directory,
+                                 uint64_t              maxBytes = 256ull * 1024ull * 1024ull)
+            : mDirectory(std::move(directory))
+            , mMaxBytes(maxBytes)
+            , mHits(0)
+            , mMisses(0)
+            , mEvictions(0)
+        {
+            std::error_code ec;
+            std::filesystem::create_directories(mDirectory, ec);
+        }
+
+        // ROCWMMA_JIT_CACHE_DIR, then $XDG_CACHE_HOME/rocwmma, then ~/.cache/rocwmma,
+        // then the system temporary directory.
+        static std::filesystem::path defaultDirectory()
+        {
+            if(auto dir = std::getenv("ROCWMMA_JIT_CACHE_DIR"))
+            {
+                return dir;
+            }
+            if(auto dir = std::getenv("XDG_CACHE_HOME"))
+            {
+                return std::filesystem::path(dir) / "rocwmma";
+            }
+            if(auto dir = std::getenv("HOME"))
+            {
+                return std::filesystem::path(dir) / ".cache" / "rocwmma";
+            }
+            return std::filesystem::temp_directory_path() / "rocwmma";
+        }
+
+        std::filesystem::path const& directory() const
+        {
+            return mDirectory;
+        }
+
+        std::filesystem::path entryPath(CodeObjectKey const& key) const
+        {
+            char name[17];
+            snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key.hash()));
+            return mDirectory / (std::string(name) + Extension);
+        }
+
+        // Returns the cached binary, or nothing if absent, unreadable or stale.
+        std::optional<CodeT> load(CodeObjectKey const& key)
+        {
+            auto          path = entryPath(key);
+            std::ifstream file(path, std::ios::binary);
+            if(!file)
+            {
+                return std::nullopt;
+            }
+
+            std::string magic(sizeof(Magic) - 1, '\0');
+            uint64_t    descriptorSize = 0, codeSize = 0;
+            file.read(&magic[0], magic.size());
+            file.read(reinterpret_cast<char*>(&descriptorSize), sizeof(descriptorSize));
+            if(!file || magic != Magic || descriptorSize > MaxDescriptorSize)
+            {
+                return std::nullopt;
+            }
+
+            std::string descriptor(descriptorSize, '\0');
+            file.read(&descriptor[0], descriptorSize);
+            file.read(reinterpret_cast<char*>(&codeSize), sizeof(codeSize));
+            if(!file || descriptor != key.descriptor())
+            {
+                return std::nullopt;
+            }
+
+            // A corrupt size must not drive the allocation: the code can't
+            // be larger than what remains of the file after the header.
+            std::error_code ec;
+            auto            fileSize   = std::filesystem::file_size(path, ec);
+            auto            headerSize = static_cast<uint64_t>(file.tellg());
+            if(ec || fileSize < headerSize || codeSize > fileSize - headerSize)
+            {
+                return std::nullopt;
+            }
+
+            CodeT code(codeSize);
+            file.read(code.data(), codeSize);
+            if(!file || file.gcount() != static_cast<std::streamsize>(codeSize))
+            {
+                return std::nullopt;
+            }
+
+            // Refresh recency for LRU. Another process may have evicted
+            // the entry meanwhile, which is harmless.
+            std::filesystem::last_write_time(
+                path, std::filesystem::file_time_type::clock::now(), ec);
+
+            return code;
+        }
+
+        // Atomically publishes a binary for the key, then enforces the size budget.
+        bool store(CodeObjectKey const& key, CodeT const& code)
+        {
+            auto path = entryPath(key);
+            auto temp = temporaryPath(path);
+
+            {
+                std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+                if(!file)
+                {
+                    return false;
+                }
+
+                auto     descriptor     = key.descriptor();
+                uint64_t descriptorSize = descriptor.size();
+                uint64_t codeSize       = code.size();
+
+                file.write(Magic, sizeof(Magic) - 1);
+                file.write(reinterpret_cast<char const*>(&descriptorSize), sizeof(descriptorSize));
+                file.write(descriptor.data(), descriptorSize);
+                file.write(reinterpret_cast<char const*>(&codeSize), sizeof(codeSize));
+                file.write(code.data(), codeSize);
+                file.flush();
+
+                if(!file)
+                {
+                    std::error_code ec;
+                    std::filesystem::remove(temp, ec);
+                    return false;
+                }
+            }
+
+            std::error_code ec;
+            std::filesystem::rename(temp, path, ec);
+            if(ec)
+            {
+                std::filesystem::remove(temp, ec);
+                return false;
+            }
+
+            evict();
+            return true;
+        }
+
+        // Cached binary on hit, otherwise compile and publish.
+        CodeT getOrCompile(CodeObjectKey const& key, CompilerT const& compiler)
+        {
+            if(auto code = load(key))
+            {
+                ++mHits;
+                return std::move(*code);
+            }
+
+            ++mMisses;
+            auto code = compiler(key);
+            store(key, code);
+            return code;
+        }
+
+        // Remove least recently used entries until the directory fits the budget.
+        // Also clears temporaries abandoned by crashed writers.
+        void evict()
+        {
+            struct Entry
+            {
+                std::filesystem::path           path;
+                std::filesystem::file_time_type time;
+                uint64_t                        size;
+            };
+
+            std::vector<Entry> entries;
+            uint64_t           totalBytes = 0;
+            std::error_code    ec;
+
+            auto now = std::filesystem::file_time_type::clock::now();
+            for(auto const& it : std::filesystem::directory_iterator(mDirectory, ec))
+            {
+                auto const& path = it.path();
+                auto        time = std::filesystem::last_write_time(path, ec);
+                if(ec)
+                {
+                    continue;
+                }
+
+                if(path.filename().string().find(".tmp.") != std::string::npos)
+                {
+                    if(now - time > StaleTemporaryAge)
+                    {
+                        std::filesystem::remove(path, ec);
+                    }
+                    continue;
+                }
+
+                if(path.extension() != Extension)
+                {
+                    continue;
+                }
+
+                auto size = std::filesystem::file_size(path, ec);
+                if(!ec)
+                {
+                    entries.push_back({path, time, size});
+                    totalBytes += size;
+                }
+            }
+
+            if(totalBytes <= mMaxBytes)
+            {
+                return;
+            }
+
+            std::sort(entries.begin(), entries.end(), [](Entry const& lhs, Entry const& rhs) {
+                return lhs.time < rhs.time;
+            });
+
+            for(auto const& entry : entries)
+            {
+                if(totalBytes <= mMaxBytes)
+                {
+                    break;
+                }
+
+                // Concurrent evictions may race on the same file
+                if(std::filesystem::remove(entry.path, ec))
+                {
+                    ++mEvictions;
+                }
+                totalBytes -= entry.size;
+            }
+        }
+
+        Stats stats() const
+        {
+            return {mHits.load(), mMisses.load(), mEvictions.load()};
+        }
+
+    private:
+        static constexpr char     Magic[]           = "RWCO0001";
+        static constexpr uint64_t MaxDescriptorSize = 1ull << 20;
+        static constexpr auto     StaleTemporaryAge = std::chrono::hours(1);
+
+        std::filesystem::path temporaryPath(std::filesystem::path const& path)
+        {
+            static std::atomic<uint64_t> counter(0);
+
+            std::ostringstream suffix;
+            suffix << ".tmp." << getpid() << "." << std::this_thread::get_id() << "."
+                   << counter++;
+            return path.string() + suffix.str();
+        }
+
+        std::filesystem::path mDirectory;
+        uint64_t              mMaxBytes;
+
+        std::atomic<uint64_t> mHits, mMisses, mEvictions;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SAMPLES_HIPRTC_CACHE_HPP
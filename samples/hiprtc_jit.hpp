@@ -0,0 +1,114 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_SAMPLES_HIPRTC_JIT_HPP
+#define ROCWMMA_SAMPLES_HIPRTC_JIT_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+
+#include <rocwmma/rocwmma-version.hpp>
+
+#include "common.hpp"
+#include "hiprtc_cache.hpp"
+
+namespace rocwmma
+{
+    // Full arch name of the current device, including target features
+    inline std::string hiprtcDeviceArch()
+    {
+        hipDevice_t     handle;
+        hipDeviceProp_t props;
+
+        CHECK_HIP_ERROR(hipGetDevice(&handle));
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&props, handle));
+
+        return std::string(props.gcnArchName);
+    }
+
+    // rocWMMA and hipRTC versions. Headers included by the source are not
+    // hashed, so any toolchain or library update must invalidate entries.
+    inline std::string hiprtcToolchainVersion()
+    {
+        int major, minor;
+        CHECK_HIPRTC_ERROR(hiprtcVersion(&major, &minor));
+        return rocwmma_get_version() + "/hiprtc-" + std::to_string(major) + "."
+               + std::to_string(minor);
+    }
+
+    // Compile the key's source with hipRTC for the current device
+    inline std::vector<char> hiprtcCompile(CodeObjectKey const& key)
+    {
+        hiprtcProgram prog;
+        CHECK_HIPRTC_ERROR(
+            hiprtcCreateProgram(&prog, key.source.c_str(), nullptr, 0, nullptr, nullptr));
+
+        std::vector<const char*> opts;
+        for(auto const& option : key.options)
+        {
+            opts.push_back(option.c_str());
+        }
+
+        auto result = hiprtcCompileProgram(prog, opts.size(), opts.data());
+        if(result != HIPRTC_SUCCESS)
+        {
+            std::cout << "HipRTC compile failed." << std::endl;
+            std::cout << hiprtcGetErrorString(result) << std::endl;
+
+            std::size_t logSize;
+            CHECK_HIPRTC_ERROR(hiprtcGetProgramLogSize(prog, &logSize));
+            std::string log(logSize, '\0');
+            CHECK_HIPRTC_ERROR(hiprtcGetProgramLog(prog, &log[0]));
+
+            std::cout << log.c_str() << std::endl;
+            exit(EXIT_FAILURE);
+        }
+
+        std::size_t codeSize;
+        CHECK_HIPRTC_ERROR(hiprtcGetCodeSize(prog, &codeSize));
+        std::vector<char> code(codeSize);
+        CHECK_HIPRTC_ERROR(hiprtcGetCode(prog, code.data()));
+        CHECK_HIPRTC_ERROR(hiprtcDestroyProgram(&prog));
+
+        return code;
+    }
+
+    // Returns a code object for the current device, compiling only on cache miss
+    inline std::vector<char> hiprtcCompileCached(std::string const&              source,
+                                                 std::vector<std::string> const& options,
+                                                 CodeObjectCache&                cache)
+    {
+        CodeObjectKey key{source, options, hiprtcDeviceArch(), hiprtcToolchainVersion()};
+        return cache.getOrCompile(key, hiprtcCompile);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SAMPLES_HIPRTC_JIT_HPP
@@ -13,7 +13,7 @@ if [ -d "$build_dir" ]; then
   # setup output directory for benchmarks
   mkdir -p "$output_dir"
 
-  gemm_bench=("gemm_PGR0_LB0_MP0_SB_NC" "gemm_PGR0_LB0_MP0_MB_NC" "gemm_PGR1_LB2_MP0_MB_CP_BLK" "gemm_PGR1_LB2_MP0_MB_CP_WG" "gemm_PGR1_LB2_MP0_MB_CP_WV")
+  gemm_bench=("gemm_PGR0_LB0_MP0_SB_NC" "gemm_PGR0_LB0_MP0_MB_NC" "gemm_PGR1_LB2_MP0_MB_CP_BLK" "gemm_PGR1_LB2_MP0_MB_CP_WG" "gemm_PGR1_LB2_MP0_MB_CP_WV" "gemm_sparse_PGR0_LB0_MP0_SB_NC" "gemm_complex_PGR0_LB0_MP0_SB_NC")
 
   # run benchmarks
   for f in ${gemm_bench[@]}; do
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_ARCH_PROFILE_HPP
+#define ROCWMMA_ARCH_PROFILE_HPP
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rocwmma
+{
+    ///
+    /// Static description of a target, used by host-side models that must
+    /// work without a device (cost models, planners) and by HipDevice for
+    /// figures the runtime does not report.
+    /// Figures are nominal peaks for one device (or one GCD).
+    ///
+    struct ArchProfile
+    {
+        std::string name;
+        uint32_t    waveSize;
+        uint32_t    cuCount;
+        uint32_t    simdsPerCu;
+        uint32_t    maxWavesPerSimd;
+        uint32_t    vgprsPerSimd; // 32-bit registers per lane, shared by resident waves
+        uint32_t    agprsPerSimd; // Separate accumulation registers (0 = unified)
+        uint32_t    maxVgprsPerWave; // Addressable by one wave (per file if separate)
+        uint32_t    ldsBytesPerCu;
+        uint32_t    maxLdsBytesPerWorkgroup;
+        uint32_t    maxThreadsPerWorkgroup;
+        uint32_t    clockMhz;
+        double      memBandwidthGBs;
+
+        // Dense matrix core peak, keyed by input type (as in dataTypeToString)
+        std::map<std::string, double> peakTFlops;
+
+        double peakTFlopsFor(std::string const& inputT) const
+        {
+            auto it = peakTFlops.find(inputT);
+            return it == peakTFlops.end() ? 0.0 : it->second;
+        }
+    };
+
+    inline std::vector<ArchProfile> const& archProfiles()
+    {
+        // clang-format off
+        static const std::vector<ArchProfile> profiles = {
+            {"gfx908", 64u, 120u, 4u, 10u, 512u, 512u, 256u, 65536u, 65536u, 1024u, 1502u, 1228.8,
+             {{"i8", 184.6}, {"f16", 184.6}, {"h16", 184.6}, {"bf16", 92.3}, {"f32", 46.1}}},
+            {"gfx90a", 64u, 110u, 4u, 8u, 512u, 0u, 512u, 65536u, 65536u, 1024u, 1700u, 1638.4,
+             {{"i8", 191.5}, {"f16", 191.5}, {"h16", 191.5}, {"bf16", 191.5}, {"f32", 47.9},
+              {"f64", 47.9}}},
+            {"gfx942", 64u, 304u, 4u, 8u, 512u, 0u, 512u, 65536u, 65536u, 1024u, 2100u, 5300.0,
+             {{"i8", 2614.9}, {"f8(fnuz)", 2614.9}, {"bf8(fnuz)", 2614.9}, {"f16", 1307.4},
+              {"h16", 1307.4}, {"bf16", 1307.4}, {"xf32", 653.7}, {"f32", 163.4}, {"f64", 81.7}}},
+            {"gfx1100", 32u, 96u, 2u, 16u, 1536u, 0u, 256u, 65536u, 65536u, 1024u, 2500u, 960.0,
+             {{"i8", 122.8}, {"f16", 122.8}, {"h16", 122.8}, {"bf16", 122.8}}},
+            {"gfx1201", 32u, 64u, 2u, 16u, 1536u, 0u, 256u, 65536u, 65536u, 1024u, 2970u, 644.6,
+             {{"i8", 389.3}, {"f8", 389.3}, {"bf8", 389.3}, {"f16", 194.7}, {"h16", 194.7},
+              {"bf16", 194.7}}},
+        };
+        // clang-format on
+        return profiles;
+    }
+
+    // Look up a profile by target name. Feature suffixes are ignored
+    // (e.g. gfx90a:sramecc+:xnack-).
+    inline std::optional<ArchProfile> findArchProfile(std::string const& arch)
+    {
+        auto name = arch.substr(0, arch.find(':'));
+        for(auto const& profile : archProfiles())
+        {
+            if(profile.name == name)
+            {
+                return profile;
+            }
+        }
+        return std::nullopt;
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_ARCH_PROFILE_HPP
@@ -0,0 +1,92 @@
+# Build-time and binary-size benchmark of the shared test harness.
+#
+# Configures two fresh build trees of the tests, one compiling the harness
+# into every test (ROCWMMA_BUILD_SHARED_TEST_HARNESS=OFF) and one linking the
+# per-suite harness libraries (ON), with identical GPU targets, build type and
+# parallelism. Each tree is built from scratch and timed; the size of the
+# built test executables and harness libraries is summed. Reports both
+# configurations and their ratio.
+#
+# python3 BuildBenchmark.py --source /path/to/rocWMMA --gpu_targets gfx942 --jobs 32
+# python3 BuildBenchmark.py --source . --targets rocwmma_gemm_tests_validate --report build.csv
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+parser = argparse.ArgumentParser(description='Compare test build time and size with and without the shared harness')
+parser.add_argument('--source', default='.', help='path to the rocWMMA source tree')
+parser.add_argument('--build_dir', default='build_bench', help='directory for the benchmark build trees')
+parser.add_argument('--gpu_targets', default='gfx942', help='GPU_TARGETS of both builds')
+parser.add_argument('--jobs', type=int, default=os.cpu_count(), help='parallel build jobs')
+parser.add_argument('--targets', nargs='*', default=[], help='build only these targets (default: all)')
+parser.add_argument('--cmake_args', nargs='*', default=[], help='extra -D options for both builds')
+parser.add_argument('--report', help='also write the results to this csv file')
+parser.add_argument('--keep', action='store_true', help='keep the build trees')
+args = parser.parse_args()
+
+Configs = (("compiled", "OFF"), ("shared", "ON"))
+
+def run(command, cwd=None):
+    print(' '.join(command))
+    result = subprocess.run(command, cwd=cwd)
+    if result.returncode != 0:
+        print("FAILED: " + ' '.join(command))
+        sys.exit(1)
+
+# Test executables and harness libraries: any executable or shared object
+# under the test tree, excluding gtest and CMake's own probes
+def builtSizes(buildDir):
+    sizes = {}
+    for path in glob.glob(os.path.join(buildDir, 'test', '**', '*'), recursive=True):
+        if not os.path.isfile(path) or os.path.islink(path) or '/_deps/' in path or '/CMakeFiles/' in path:
+            continue
+        if path.endswith('.so') or (os.access(path, os.X_OK) and '.' not in os.path.basename(path)):
+            sizes[os.path.relpath(path, buildDir)] = os.path.getsize(path)
+    return sizes
+
+results = []
+for name, harness in Configs:
+    buildDir = os.path.abspath(os.path.join(args.build_dir, name))
+    if os.path.exists(buildDir):
+        shutil.rmtree(buildDir)
+    os.makedirs(buildDir)
+
+    # Sources from the same tree and the same settings; only the harness differs
+    run(['cmake', '-S', os.path.abspath(args.source), '-B', buildDir,
+         '-DROCWMMA_BUILD_TESTS=ON',
+         '-DROCWMMA_BUILD_SHARED_TEST_HARNESS=' + harness,
+         '-DGPU_TARGETS=' + args.gpu_targets,
+         '-DCMAKE_BUILD_TYPE=Release'] + ['-D' + option for option in args.cmake_args])
+
+    # gtest is the same in both, so it is built before timing
+    run(['cmake', '--build', buildDir, '-j', str(args.jobs), '--target', 'gtest'])
+
+    command = ['cmake', '--build', buildDir, '-j', str(args.jobs)]
+    for target in args.targets:
+        command += ['--target', target]
+    start = time.perf_counter()
+    run(command)
+    buildSec = time.perf_counter() - start
+
+    sizes = builtSizes(buildDir)
+    results.append((name, buildSec, sum(sizes.values()), len(sizes)))
+    if not args.keep:
+        shutil.rmtree(buildDir)
+
+lines = ["Config, Harness, Build(s), Size(MB), Binaries"]
+for (name, buildSec, totalBytes, count), (_, harness) in zip(results, Configs):
+    lines.append("%s, %s, %.1f, %.1f, %d" % (name, harness, buildSec, totalBytes / 1048576.0, count))
+
+(_, baseSec, baseBytes, _), (_, sharedSec, sharedBytes, _) = results
+lines.append("")
+lines.append("Build time ratio (shared/compiled): %.2f" % (sharedSec / baseSec if baseSec else 0.0))
+lines.append("Binary size ratio (shared/compiled): %.2f" % (float(sharedBytes) / baseBytes if baseBytes else 0.0))
+
+print('\n'.join(lines))
+if args.report:
+    with open(args.report, 'w') as reportFile:
+        reportFile.write('\n'.join(lines) + '\n')
@@ -0,0 +1,245 @@
+# Compile-time report of rocWMMA headers from clang -ftime-trace output.
+#
+# Each argument is name=trace_dir, one per benchmark configuration, where the
+# directory holds the traces of every compiler pass of that configuration
+# (host and each GPU target). Per configuration, reports front-end and
+# back-end time, template instantiation counts, and a per-header breakdown
+# of parse time and instantiation time. With --budget, configurations are
+# checked against their limits and the script exits with 1 on a regression.
+# Configurations without a recorded entry are checked for information only,
+# until --update-budget records them from a real build.
+#
+# python3 CompileTimeReport.py --budget budget.json name=traces/name ...
+# python3 CompileTimeReport.py --budget budget.json --update-budget 1.05 name=traces/name ...
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+from collections import defaultdict
+
+InstantiateEvents = ("InstantiateClass", "InstantiateFunction")
+
+parser = argparse.ArgumentParser(description='Report and budget rocWMMA header compile-time costs')
+parser.add_argument('configs', nargs='+', help='name=trace_dir of each benchmark configuration')
+parser.add_argument('--budget', help='path to the budget json')
+parser.add_argument('--check', action='store_true', help='only check the budget, without the breakdown')
+parser.add_argument('--report', help='also write the report to this file')
+parser.add_argument('--top', type=int, default=15, help='rows of each breakdown')
+parser.add_argument('--update-budget', type=float, metavar='HEADROOM',
+                    help='record per-config instantiation limits from this run, scaled by HEADROOM (e.g. 1.05)')
+args = parser.parse_args()
+
+# Device passes write their traces under temporary names, e.g.
+# compile_bench-hip-amdgcn-amd-amdhsa-gfx942-3f9a1c.json. Rebuilds add new
+# files, so only the newest trace of each pass counts.
+def passKey(path):
+    return re.sub(r'-[0-9a-zA-Z]{6}$', '', os.path.splitext(os.path.basename(path))[0])
+
+def latestTraces(traceDir):
+    latest = {}
+    for path in glob.glob(os.path.join(traceDir, '*.json')):
+        key = passKey(path)
+        if key not in latest or os.path.getmtime(path) > os.path.getmtime(latest[key]):
+            latest[key] = path
+    return sorted(latest.items())
+
+# Library headers are reported from rocwmma/, everything else by file name
+def headerName(path):
+    path = path.replace('\\', '/')
+    index = path.rfind('/rocwmma/')
+    return path[index + 1:] if index >= 0 else os.path.basename(path)
+
+def templateName(detail):
+    return detail.split('<', 1)[0].strip()
+
+# Exclusive time of nested events on one thread: each event minus its children
+def exclusiveTimes(events):
+    events = sorted(events, key=lambda e: (e['ts'], -e['dur']))
+    exclusive = [e['dur'] for e in events]
+    stack = []
+    for i, event in enumerate(events):
+        while stack and events[stack[-1]]['ts'] + events[stack[-1]]['dur'] <= event['ts']:
+            stack.pop()
+        if stack:
+            exclusive[stack[-1]] -= event['dur']
+        stack.append(i)
+    return zip(events, exclusive)
+
+class PassStats:
+    def __init__(self):
+        self.frontendMs = 0.0
+        self.backendMs = 0.0
+        self.totalMs = 0.0
+        self.instantiations = 0
+        self.passInstantiations = 0
+        self.headerParseMs = defaultdict(float)
+        self.headerIncludes = defaultdict(int)
+        self.headerInstantiateMs = defaultdict(float)
+        self.templateMs = defaultdict(float)
+        self.templateCount = defaultdict(int)
+
+def readPass(path):
+    with open(path) as traceFile:
+        trace = json.load(traceFile)
+    events = trace['traceEvents'] if isinstance(trace, dict) else trace
+
+    stats = PassStats()
+    totals = {}
+    sources = defaultdict(list)
+    instantiations = defaultdict(list)
+    instantiateCounts = defaultdict(int)
+    for event in events:
+        name = event.get('name', '')
+        if event.get('ph') != 'X':
+            continue
+        if name.startswith('Total '):
+            totals[name[6:]] = event
+        elif name == 'Source':
+            sources[event.get('tid')].append(event)
+        elif name in InstantiateEvents:
+            instantiations[event.get('tid')].append(event)
+            instantiateCounts[name] += 1
+
+    def totalMs(name):
+        return totals[name]['dur'] / 1000.0 if name in totals else 0.0
+
+    stats.frontendMs = totalMs('Frontend')
+    stats.backendMs = totalMs('Backend')
+    stats.totalMs = totalMs('ExecuteCompiler')
+
+    # Summary events carry the full count, even for events under the granularity
+    for name in InstantiateEvents:
+        if name in totals and 'count' in totals[name].get('args', {}):
+            stats.instantiations += int(totals[name]['args']['count'])
+        else:
+            stats.instantiations += instantiateCounts[name]
+
+    for threadEvents in sources.values():
+        for event, exclusive in exclusiveTimes(threadEvents):
+            header = headerName(event.get('args', {}).get('detail', ''))
+            stats.headerParseMs[header] += exclusive / 1000.0
+            stats.headerIncludes[header] += 1
+
+    for threadEvents in instantiations.values():
+        for event, exclusive in exclusiveTimes(threadEvents):
+            eventArgs = event.get('args', {})
+            name = templateName(eventArgs.get('detail', ''))
+            stats.templateMs[name] += exclusive / 1000.0
+            stats.templateCount[name] += 1
+            # Newer clang records where the template is declared
+            if 'file' in eventArgs:
+                stats.headerInstantiateMs[headerName(eventArgs['file'])] += exclusive / 1000.0
+    return stats
+
+def mergePasses(passes):
+    merged = PassStats()
+    for stats in passes:
+        merged.frontendMs += stats.frontendMs
+        merged.backendMs += stats.backendMs
+        merged.totalMs += stats.totalMs
+        merged.instantiations += stats.instantiations
+        merged.passInstantiations = max(merged.passInstantiations, stats.instantiations)
+        for table in ('headerParseMs', 'headerIncludes', 'headerInstantiateMs', 'templateMs', 'templateCount'):
+            for key, value in getattr(stats, table).items():
+                getattr(merged, table)[key] += value
+    return merged
+
+def topRows(table, count):
+    return sorted(table.items(), key=lambda item: item[1], reverse=True)[:count]
+
+lines = []
+def emit(line=''):
+    lines.append(line)
+    print(line)
+
+configs = []
+for config in args.configs:
+    name, _, traceDir = config.partition('=')
+    traces = latestTraces(traceDir)
+    if not traces:
+        print("No traces for " + name + " in " + traceDir + ": build the compile benchmark first")
+        sys.exit(1)
+    passes = [(key, readPass(path)) for key, path in traces]
+    configs.append((name, passes, mergePasses([stats for _, stats in passes])))
+
+# Summary over all passes of each configuration
+emit("Config, Passes, Frontend(ms), Backend(ms), Total(ms), Instantiations")
+for name, passes, merged in configs:
+    emit("%s, %d, %.1f, %.1f, %.1f, %d" % (name, len(passes), merged.frontendMs, merged.backendMs,
+                                            merged.totalMs, merged.instantiations))
+
+if not args.check:
+    for name, passes, merged in configs:
+        emit()
+        emit("# " + name)
+        for key, stats in passes:
+            emit("Pass %s: frontend %.1f ms, backend %.1f ms, %d instantiations"
+                 % (key, stats.frontendMs, stats.backendMs, stats.instantiations))
+
+        emit()
+        emit("Header, Includes, Parse(ms, exclusive)" + (", Instantiate(ms)" if merged.headerInstantiateMs else ""))
+        for header, parseMs in topRows(merged.headerParseMs, args.top):
+            row = "%s, %d, %.1f" % (header, merged.headerIncludes[header], parseMs)
+            if merged.headerInstantiateMs:
+                row += ", %.1f" % merged.headerInstantiateMs.get(header, 0.0)
+            emit(row)
+
+        emit()
+        emit("Template, Instantiations, Time(ms, exclusive)")
+        for template, templateMs in topRows(merged.templateMs, args.top):
+            emit("%s, %d, %.1f" % (template, merged.templateCount[template], templateMs))
+
+if args.report:
+    with open(args.report, 'w') as reportFile:
+        reportFile.write('\n'.join(lines) + '\n')
+
+if not args.budget:
+    sys.exit(0)
+
+# Budget: per configuration limits over "default". Instantiation counts are
+# deterministic for a compiler version, so each configuration records its own:
+# pass_instantiations is the largest single pass and does not depend on the
+# number of GPU targets. Times depend on the machine, so their limits stay
+# loose in "default" and are never recorded per configuration.
+Limits = (("frontend_ms", "frontendMs"), ("total_ms", "totalMs"), ("instantiations", "instantiations"),
+          ("pass_instantiations", "passInstantiations"))
+RecordedLimits = (("pass_instantiations", "passInstantiations"),)
+
+if args.update_budget:
+    budget = {"default": {}, "configs": {}}
+    if os.path.exists(args.budget):
+        with open(args.budget) as budgetFile:
+            budget = json.load(budgetFile)
+    for name, passes, merged in configs:
+        budget.setdefault("configs", {})[name] = {
+            key: int(getattr(merged, field) * args.update_budget + 0.5) for key, field in RecordedLimits}
+    with open(args.budget, 'w') as budgetFile:
+        json.dump(budget, budgetFile, indent=4, sort_keys=True)
+        budgetFile.write('\n')
+    print("Updated " + args.budget)
+    sys.exit(0)
+
+with open(args.budget) as budgetFile:
+    budget = json.load(budgetFile)
+
+failures = 0
+print()
+for name, passes, merged in configs:
+    recorded = name in budget.get("configs", {})
+    limits = dict(budget.get("default", {}))
+    limits.update(budget.get("configs", {}).get(name, {}))
+    for key, field in Limits:
+        if key not in limits:
+            continue
+        value = getattr(merged, field)
+        if value > limits[key] and not recorded:
+            print("ADVISORY %s: %s %.1f exceeds unrecorded budget %.1f" % (name, key, value, limits[key]))
+        elif value > limits[key]:
+            failures += 1
+            print("FAILED %s: %s %.1f exceeds budget %.1f" % (name, key, value, limits[key]))
+        else:
+            print("PASSED %s: %s %.1f of %.1f" % (name, key, value, limits[key]))
+
+sys.exit(1 if failures else 0)
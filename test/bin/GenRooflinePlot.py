@@ -0,0 +1,45 @@
+# pip install pandas
+# python -m pip install -U matplotlib
+import matplotlib
+matplotlib.use('Agg')
+import matplotlib.pyplot as plt
+import numpy as np
+import pandas as pd
+import argparse
+import sys
+parser = argparse.ArgumentParser(description='Generate a roofline plot from the data written by --roofline')
+parser.add_argument('--csv_fp', help='path to the roofline csv file')
+parser.add_argument('--plot_fp', default='roofline.png', help='path to write the plot to')
+parser.add_argument('--labels', action='store_true', help='annotate each point with its kernel')
+args = parser.parse_args()
+
+if(len(sys.argv) < 2):
+  print("Please provide all arguments, csv_fp - path to the roofline csv file and plot_fp - path of the plot")
+  exit(0)
+df = pd.read_csv(args.csv_fp, skipinitialspace=True)
+df.columns = df.columns.str.strip()
+df = df[df["AI(Flops/Byte)"] > 0]
+
+# One device per run: draw its roofs once
+peakGFlops = df["PeakGFlops/s"].max()
+peakGBs = df["PeakGB/s"].max()
+ai = df["AI(Flops/Byte)"]
+x = np.logspace(np.log10(min(ai.min(), 1.0) / 2.0), np.log10(max(ai.max(), peakGFlops / peakGBs) * 2.0), 256)
+
+fig, ax = plt.subplots()
+ax.loglog(x, np.minimum(peakGFlops, x * peakGBs), color='black', label='Roofline')
+ax.axvline(peakGFlops / peakGBs, color='grey', linestyle=':', label='Ridge')
+
+for bound, marker in [("memory", 'o'), ("compute", '^')]:
+    dfBound = df[df["Bound"] == bound]
+    ax.scatter(dfBound["AI(Flops/Byte)"], dfBound["GFlops/s"], marker=marker, s=12, label=bound + " bound")
+    if args.labels:
+        for _, row in dfBound.iterrows():
+            ax.annotate(row["Kernel"], (row["AI(Flops/Byte)"], row["GFlops/s"]), fontsize='xx-small')
+
+ax.set_xlabel("Arithmetic intensity (Flops/Byte)")
+ax.set_ylabel("GFlops/s")
+ax.set_title("Roofline: " + str(peakGFlops) + " GFlops/s, " + str(peakGBs) + " GB/s", fontsize='small')
+ax.legend(loc='best', fontsize='small')
+plt.savefig(args.plot_fp)
+plt.close()
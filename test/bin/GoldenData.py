@@ -0,0 +1,134 @@
+# Golden data files of the tests: inspect, verify and wrap raw arrays.
+#
+# The container is described in test/golden_data.hpp: a fixed header with the
+# datatype, shape, strides and checksum of the array, then the packed data
+# from the first page boundary. Raw little endian arrays are wrapped with
+# their type and shape; regenerating goldens from the CPU references is done
+# by the C++ writers of each suite (e.g. dlrm_golden_writer).
+#
+# python3 GoldenData.py info test/dlrm/data/*.golden
+# python3 GoldenData.py verify test/dlrm/data/*.golden
+# python3 GoldenData.py wrap --dtype f16 --shape 64,27,128 input_fp16 input_fp16.golden
+import argparse
+import os
+import struct
+import sys
+
+Magic = b'RWGOLDEN'
+FormatVersion = 1
+MaxRank = 4
+DataAlignment = 4096
+
+# magic, version, rank, dataType, elementBytes, shape, strides, dataOffset, dataBytes, checksum
+HeaderFormat = '<8sII16sQ%dQ%dQQQQ' % (MaxRank, MaxRank)
+
+# As dataTypeToString
+ElementBytes = {'f8': 1, 'bf8': 1, 'f16': 2, 'h16': 2, 'bf16': 2, 'f32': 4, 'xf32': 4, 'f64': 8,
+                'i8': 1, 'u8': 1, 'i16': 2, 'u16': 2, 'i32': 4, 'u32': 4, 'i64': 8, 'u64': 8}
+
+Mask = (1 << 64) - 1
+
+# FNV-1a over little endian 64 bit words, then the tail bytes, as golden_data.hpp
+def checksum(data):
+    hash = 0xcbf29ce484222325
+    words = len(data) // 8
+    for word in struct.unpack_from('<%dQ' % words, data):
+        hash = ((hash ^ word) * 0x100000001b3) & Mask
+    for byte in data[words * 8:]:
+        hash = ((hash ^ byte) * 0x100000001b3) & Mask
+    return hash
+
+def readHeader(path):
+    with open(path, 'rb') as goldenFile:
+        raw = goldenFile.read(struct.calcsize(HeaderFormat))
+    if len(raw) < struct.calcsize(HeaderFormat):
+        raise ValueError("truncated header")
+    fields = struct.unpack(HeaderFormat, raw)
+    magic, version, rank, dataType, elementBytes = fields[:5]
+    if magic != Magic or version != FormatVersion or not 1 <= rank <= MaxRank:
+        raise ValueError("not a version %d golden data file" % FormatVersion)
+    return {'dataType': dataType.rstrip(b'\0').decode(),
+            'elementBytes': elementBytes,
+            'shape': list(fields[5:5 + rank]),
+            'strides': list(fields[5 + MaxRank:5 + MaxRank + rank]),
+            'dataOffset': fields[5 + 2 * MaxRank],
+            'dataBytes': fields[6 + 2 * MaxRank],
+            'checksum': fields[7 + 2 * MaxRank]}
+
+def readData(path, header):
+    with open(path, 'rb') as goldenFile:
+        goldenFile.seek(header['dataOffset'])
+        return goldenFile.read(header['dataBytes'])
+
+def write(path, dataType, shape, data):
+    count = 1
+    strides = [0] * len(shape)
+    for i in reversed(range(len(shape))):
+        strides[i] = count
+        count *= shape[i]
+    if count * ElementBytes[dataType] != len(data):
+        raise ValueError("%d bytes do not hold %s of %s" % (len(data), 'x'.join(map(str, shape)), dataType))
+
+    pad = [0] * (MaxRank - len(shape))
+    header = struct.pack(HeaderFormat, Magic, FormatVersion, len(shape), dataType.encode(),
+                         ElementBytes[dataType], *(shape + pad + strides + pad),
+                         DataAlignment, len(data), checksum(data))
+
+    # Temporary and rename, as the C++ writer
+    tmpPath = path + '.tmp.' + str(os.getpid())
+    with open(tmpPath, 'wb') as goldenFile:
+        goldenFile.write(header)
+        goldenFile.write(b'\0' * (DataAlignment - len(header)))
+        goldenFile.write(data)
+    os.replace(tmpPath, path)
+
+parser = argparse.ArgumentParser(description='Inspect, verify and wrap rocWMMA golden data files')
+subparsers = parser.add_subparsers(dest='command', required=True)
+infoParser = subparsers.add_parser('info', help='print the header of each file')
+infoParser.add_argument('files', nargs='+')
+verifyParser = subparsers.add_parser('verify', help='check the size and checksum of each file')
+verifyParser.add_argument('files', nargs='+')
+wrapParser = subparsers.add_parser('wrap', help='wrap a raw little endian array')
+wrapParser.add_argument('--dtype', required=True, choices=sorted(ElementBytes), help='element type')
+wrapParser.add_argument('--shape', required=True, help='comma separated, outermost first')
+wrapParser.add_argument('raw', help='raw input file')
+wrapParser.add_argument('output', help='golden data file to write')
+args = parser.parse_args()
+
+if args.command == 'wrap':
+    with open(args.raw, 'rb') as rawFile:
+        data = rawFile.read()
+    shape = [int(extent) for extent in args.shape.split(',')]
+    if not 1 <= len(shape) <= MaxRank:
+        print("Rank must be 1 to %d" % MaxRank)
+        sys.exit(1)
+    write(args.output, args.dtype, shape, data)
+    sys.exit(0)
+
+failures = 0
+for path in args.files:
+    try:
+        header = readHeader(path)
+    except (OSError, ValueError) as error:
+        failures += 1
+        print("FAILED %s: %s" % (path, error))
+        continue
+
+    if args.command == 'info':
+        print("%s: %s, shape %s, strides %s, %d bytes at %d, checksum %016x"
+              % (path, header['dataType'], 'x'.join(map(str, header['shape'])),
+                 ','.join(map(str, header['strides'])), header['dataBytes'],
+                 header['dataOffset'], header['checksum']))
+        continue
+
+    data = readData(path, header)
+    if len(data) != header['dataBytes']:
+        failures += 1
+        print("FAILED %s: truncated data" % path)
+    elif checksum(data) != header['checksum']:
+        failures += 1
+        print("FAILED %s: checksum mismatch" % path)
+    else:
+        print("PASSED %s" % path)
+
+sys.exit(1 if failures else 0)
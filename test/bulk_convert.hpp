@@ -0,0 +1,865 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_BULK_CONVERT_HPP
+#define ROCWMMA_TEST_BULK_CONVERT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define ROCWMMA_BULK_CONVERT_X86 1
+#else
+#define ROCWMMA_BULK_CONVERT_X86 0
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ROCWMMA_BULK_CONVERT_NEON 1
+#else
+#define ROCWMMA_BULK_CONVERT_NEON 0
+#endif
+
+// Array conversions between float and the narrow float formats used by the
+// tests (fp8 / bf8 in OCP and FNUZ flavours, f16, bf16 and xf32), for host
+// data preparation and validation. Conversions work on storage bits, so this
+// header does not depend on HIP; common.hpp maps the rocWMMA types onto it.
+//
+// Each conversion has a scalar definition (encodeScalar / decodeScalar) and
+// array paths that must match it bit for bit: a portable loop, and
+// AVX2 / AVX-512 (selected at runtime) or NEON implementations.
+namespace rocwmma
+{
+    namespace BulkConvert
+    {
+        enum struct Format : uint32_t
+        {
+            F8, // OCP e4m3
+            Bf8, // OCP e5m2
+            F8Fnuz, // e4m3, bias 8
+            Bf8Fnuz, // e5m2, bias 16
+            F16,
+            Bf16,
+            Xf32, // e8m10, stored as float
+        };
+
+        enum struct Rounding : uint32_t
+        {
+            NearestEven,
+            TowardZero
+        };
+
+        // Out of range values clamp to the largest finite value (Finite), or
+        // become Inf, or NaN for formats without Inf (None).
+        // NaN inputs always give NaN.
+        enum struct Saturation : uint32_t
+        {
+            Finite,
+            None
+        };
+
+        enum struct Isa : uint32_t
+        {
+            Portable,
+            Avx2,
+            Avx512,
+            Neon
+        };
+
+        ///
+        /// Bit layout of each format. Codes are sign | exponent | mantissa,
+        /// right aligned; xf32 codes are the top 19 bits of its float storage.
+        ///
+        template <Format F>
+        struct FormatTraits;
+
+        template <>
+        struct FormatTraits<Format::F8>
+        {
+            using StorageT = uint8_t;
+            enum : uint32_t
+            {
+                ExpBits  = 4u,
+                MantBits = 3u,
+                Bias     = 7u,
+                Fnuz     = false,
+                HasInf   = false,
+                MaxCode  = 0x7Eu,
+                InfCode  = 0x7Fu, // Overflow without Inf is NaN
+                NanCode  = 0x7Fu,
+            };
+        };
+
+        template <>
+        struct FormatTraits<Format::Bf8>
+        {
+            using StorageT = uint8_t;
+            enum : uint32_t
+            {
+                ExpBits  = 5u,
+                MantBits = 2u,
+                Bias     = 15u,
+                Fnuz     = false,
+                HasInf   = true,
+                MaxCode  = 0x7Bu,
+                InfCode  = 0x7Cu,
+                NanCode  = 0x7Fu,
+            };
+        };
+
+        template <>
+        struct FormatTraits<Format::F8Fnuz>
+        {
+            using StorageT = uint8_t;
+            enum : uint32_t
+            {
+                ExpBits  = 4u,
+                MantBits = 3u,
+                Bias     = 8u,
+                Fnuz     = true,
+                HasInf   = false,
+                MaxCode  = 0x7Fu,
+                InfCode  = 0x80u,
+                NanCode  = 0x80u,
+            };
+        };
+
+        template <>
+        struct FormatTraits<Format::Bf8Fnuz>
+        {
+            using StorageT = uint8_t;
+            enum : uint32_t
+            {
+                ExpBits  = 5u,
+                MantBits = 2u,
+                Bias     = 16u,
+                Fnuz     = true,
+                HasInf   = false,
+                MaxCode  = 0x7Fu,
+                InfCode  = 0x80u,
+                NanCode  = 0x80u,
+            };
+        };
+
+        template <>
+        struct FormatTraits<Format::F16>
+        {
+            using StorageT = uint16_t;
+            enum : uint32_t
+            {
+                ExpBits  = 5u,
+                MantBits = 10u,
+                Bias     = 15u,
+                Fnuz     = false,
+                HasInf   = true,
+                MaxCode  = 0x7BFFu,
+                InfCode  = 0x7C00u,
+                NanCode  = 0x7E00u, // Quiet, upper payload bits kept
+            };
+        };
+
+        template <>
+        struct FormatTraits<Format::Bf16>
+        {
+            using StorageT = uint16_t;
+            enum : uint32_t
+            {
+                ExpBits  = 8u,
+                MantBits = 7u,
+                Bias     = 127u,
+                Fnuz     = false,
+                HasInf   = true,
+                MaxCode  = 0x7F7Fu,
+                InfCode  = 0x7F80u,
+                NanCode  = 0x7F80u, // Payload kept
+            };
+        };
+
+        template <>
+        struct FormatTraits<Format::Xf32>
+        {
+            using StorageT = float;
+            enum : uint32_t
+            {
+                ExpBits  = 8u,
+                MantBits = 10u,
+                Bias     = 127u,
+                Fnuz     = false,
+                HasInf   = true,
+                MaxCode  = 0x3FBFFu,
+                InfCode  = 0x3FC00u,
+                NanCode  = 0x3FC00u, // Payload kept
+            };
+        };
+
+        namespace detail
+        {
+            template <Format F>
+            using StorageT = typename FormatTraits<F>::StorageT;
+
+            inline uint32_t floatBits(float value)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return bits;
+            }
+
+            inline float bitsFloat(uint32_t bits)
+            {
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            template <Format F>
+            inline uint32_t storageBits(StorageT<F> value)
+            {
+                if constexpr(F == Format::Xf32)
+                {
+                    return floatBits(value) >> 13u;
+                }
+                else
+                {
+                    return value;
+                }
+            }
+
+            template <Format F>
+            inline StorageT<F> bitsStorage(uint32_t code)
+            {
+                if constexpr(F == Format::Xf32)
+                {
+                    return bitsFloat(code << 13u);
+                }
+                else
+                {
+                    return static_cast<StorageT<F>>(code);
+                }
+            }
+
+            template <Format F>
+            struct Layout
+            {
+                using Traits = FormatTraits<F>;
+
+                static constexpr uint32_t Shift     = 23u - Traits::MantBits;
+                static constexpr uint32_t SignShift = Traits::ExpBits + Traits::MantBits;
+                static constexpr uint32_t MagMask   = (1u << SignShift) - 1u;
+
+                // Smallest biased float exponent that is normal in F
+                static constexpr uint32_t MinNormalExp = 128u - Traits::Bias;
+
+                // Float exponent re-bias, applied to the float bits (wraps)
+                static constexpr uint32_t Rebias = (Traits::Bias - 127u) << 23u;
+
+                // Dropped bits beyond this round to zero in either mode
+                static constexpr uint32_t MaxDropped = 25u;
+
+                // NaN and Inf payloads are kept by formats with a full float exponent
+                static constexpr bool WideExp = Traits::ExpBits == 8u;
+            };
+
+            // NaN code magnitude for a NaN input |x|
+            template <Format F, Rounding R>
+            constexpr uint32_t nanCode(uint32_t abs)
+            {
+                using L = Layout<F>;
+                if constexpr(L::WideExp)
+                {
+                    // As the scalar bf16 / xf32 conversions: rounding keeps a
+                    // NaN by setting the lowest kept bit, truncation drops bits.
+                    constexpr uint32_t Low = (1u << L::Shift) - 1u;
+                    if constexpr(R == Rounding::NearestEven)
+                    {
+                        return (abs | ((abs & Low) ? (1u << L::Shift) : 0u)) >> L::Shift;
+                    }
+                    else
+                    {
+                        return abs >> L::Shift;
+                    }
+                }
+                else if constexpr(F == Format::F16)
+                {
+                    return FormatTraits<F>::NanCode | ((abs & 0x7FFFFFu) >> L::Shift);
+                }
+                else
+                {
+                    return FormatTraits<F>::NanCode;
+                }
+            }
+
+        } // namespace detail
+
+        ///
+        /// Scalar definitions of the conversions
+        ///
+        template <Format F, Rounding R = Rounding::NearestEven, Saturation S = Saturation::Finite>
+        constexpr uint32_t encodeScalar(uint32_t x)
+        {
+            using Traits = FormatTraits<F>;
+            using L      = detail::Layout<F>;
+
+            uint32_t sign = x >> 31u;
+            uint32_t abs  = x & 0x7FFFFFFFu;
+            uint32_t fexp = abs >> 23u;
+            uint32_t code = 0u;
+
+            // Truncation never overflows to Inf
+            constexpr uint32_t OverflowCode
+                = (S == Saturation::Finite || R == Rounding::TowardZero) ? Traits::MaxCode
+                                                                         : Traits::InfCode;
+
+            if(abs > 0x7F800000u)
+            {
+                code = detail::nanCode<F, R>(abs);
+            }
+            else if(abs == 0x7F800000u)
+            {
+                code = S == Saturation::Finite ? Traits::MaxCode : Traits::InfCode;
+            }
+            else
+            {
+                if(fexp >= L::MinNormalExp)
+                {
+                    code = abs + L::Rebias;
+                    if constexpr(R == Rounding::NearestEven)
+                    {
+                        code += (1u << (L::Shift - 1u)) - 1u + ((code >> L::Shift) & 1u);
+                    }
+                    code >>= L::Shift;
+                }
+                else
+                {
+                    uint32_t mant    = (abs & 0x7FFFFFu) | (fexp ? 0x800000u : 0u);
+                    uint32_t dropped = L::Shift + L::MinNormalExp - std::max(fexp, 1u);
+                    dropped          = std::min(dropped, L::MaxDropped);
+
+                    code = mant >> dropped;
+                    if constexpr(R == Rounding::NearestEven)
+                    {
+                        uint32_t rem  = mant & ((1u << dropped) - 1u);
+                        uint32_t half = 1u << (dropped - 1u);
+                        code += (rem > half || (rem == half && (code & 1u))) ? 1u : 0u;
+                    }
+                }
+
+                if(code > Traits::MaxCode)
+                {
+                    code = OverflowCode;
+                }
+            }
+
+            // FNUZ has no negative zero, and a single NaN
+            if constexpr(Traits::Fnuz)
+            {
+                return (code != 0u && code < 0x80u) ? code | (sign << L::SignShift) : code;
+            }
+            else
+            {
+                return code | (sign << L::SignShift);
+            }
+        }
+
+        template <Format F>
+        constexpr uint32_t decodeScalar(uint32_t code)
+        {
+            using Traits = FormatTraits<F>;
+            using L      = detail::Layout<F>;
+
+            uint32_t sign = (code >> L::SignShift) & 1u;
+            uint32_t mag  = code & L::MagMask;
+            uint32_t exp  = mag >> Traits::MantBits;
+            uint32_t mant = mag & ((1u << Traits::MantBits) - 1u);
+
+            constexpr uint32_t QuietNan = 0x7FC00000u;
+            constexpr uint32_t ExpMask  = (1u << Traits::ExpBits) - 1u;
+
+            if constexpr(L::WideExp)
+            {
+                return code << L::Shift;
+            }
+            else if constexpr(Traits::Fnuz)
+            {
+                if(code == Traits::NanCode)
+                {
+                    return QuietNan;
+                }
+            }
+            else if constexpr(Traits::HasInf)
+            {
+                if(exp == ExpMask)
+                {
+                    return (sign << 31u) | (mant ? QuietNan | (mant << L::Shift) : 0x7F800000u);
+                }
+            }
+            else
+            {
+                if(mag == Traits::NanCode)
+                {
+                    return (sign << 31u) | QuietNan;
+                }
+            }
+
+            if(exp == 0u)
+            {
+                // Subnormal: normalize into the float exponent range
+                if(mant == 0u)
+                {
+                    return sign << 31u;
+                }
+                uint32_t lead = 0u;
+                while(!(mant & (1u << Traits::MantBits)))
+                {
+                    mant <<= 1u;
+                    ++lead;
+                }
+                exp  = 1u - lead;
+                mant = mant & ((1u << Traits::MantBits) - 1u);
+                return (sign << 31u) | ((exp + 127u - Traits::Bias) << 23u) | (mant << L::Shift);
+            }
+            return (sign << 31u) | ((exp + 127u - Traits::Bias) << 23u) | (mant << L::Shift);
+        }
+
+        namespace detail
+        {
+            // Float value of every 8-bit code
+            template <Format F>
+            inline float const* decodeTable()
+            {
+                static_assert(sizeof(StorageT<F>) == 1u, "Tables are for 8-bit formats");
+                static const auto table = [] {
+                    std::array<float, 256u> values{};
+                    for(uint32_t code = 0u; code < 256u; ++code)
+                    {
+                        values[code] = bitsFloat(decodeScalar<F>(code));
+                    }
+                    return values;
+                }();
+                return table.data();
+            }
+
+            template <Format F, Rounding R, Saturation S>
+            inline void
+                encodePortable(float const* in, StorageT<F>* out, size_t begin, size_t end)
+            {
+                for(size_t i = begin; i < end; ++i)
+                {
+                    out[i] = bitsStorage<F>(encodeScalar<F, R, S>(floatBits(in[i])));
+                }
+            }
+
+            template <Format F>
+            inline void decodePortable(StorageT<F> const* in, float* out, size_t begin, size_t end)
+            {
+                if constexpr(sizeof(StorageT<F>) == 1u)
+                {
+                    auto table = decodeTable<F>();
+                    for(size_t i = begin; i < end; ++i)
+                    {
+                        out[i] = table[in[i]];
+                    }
+                }
+                else if constexpr(F == Format::Xf32)
+                {
+                    std::copy(in + begin, in + end, out + begin);
+                }
+                else
+                {
+                    for(size_t i = begin; i < end; ++i)
+                    {
+                        out[i] = bitsFloat(decodeScalar<F>(storageBits<F>(in[i])));
+                    }
+                }
+            }
+
+#if ROCWMMA_BULK_CONVERT_X86
+
+            inline bool cpuSupports(Isa isa)
+            {
+                static const bool avx2   = __builtin_cpu_supports("avx2");
+                static const bool avx512 = __builtin_cpu_supports("avx512f");
+                static const bool f16c   = __builtin_cpu_supports("f16c");
+                return isa == Isa::Portable || (isa == Isa::Avx2 && avx2 && f16c)
+                       || (isa == Isa::Avx512 && avx512 && avx2 && f16c);
+            }
+
+            // encodeScalar on 8 lanes, in place
+            template <Format F, Rounding R, Saturation S>
+            __attribute__((target("avx2"))) inline void encodeLanesAvx2(__m256i& lanes)
+            {
+                using Traits = FormatTraits<F>;
+                using L      = Layout<F>;
+
+                constexpr uint32_t OverflowCode
+                    = (S == Saturation::Finite || R == Rounding::TowardZero) ? Traits::MaxCode
+                                                                             : Traits::InfCode;
+                constexpr uint32_t InfResult
+                    = S == Saturation::Finite ? Traits::MaxCode : Traits::InfCode;
+
+                auto zero     = _mm256_setzero_si256();
+                auto one      = _mm256_set1_epi32(1);
+                auto inf      = _mm256_set1_epi32(0x7F800000);
+                auto mantMask = _mm256_set1_epi32(0x7FFFFF);
+                auto maxCode  = _mm256_set1_epi32(Traits::MaxCode);
+
+                auto sign = _mm256_srli_epi32(lanes, 31);
+                auto abs  = _mm256_and_si256(lanes, _mm256_set1_epi32(0x7FFFFFFF));
+                auto fexp = _mm256_srli_epi32(abs, 23);
+
+                auto isNan    = _mm256_cmpgt_epi32(abs, inf);
+                auto isInf    = _mm256_cmpeq_epi32(abs, inf);
+                auto isNormal = _mm256_cmpgt_epi32(fexp, _mm256_set1_epi32(L::MinNormalExp - 1u));
+
+                // Normal in F
+                auto normal = _mm256_add_epi32(abs, _mm256_set1_epi32(L::Rebias));
+                if constexpr(R == Rounding::NearestEven)
+                {
+                    auto odd  = _mm256_and_si256(_mm256_srli_epi32(normal, L::Shift), one);
+                    auto bias = _mm256_set1_epi32((1u << (L::Shift - 1u)) - 1u);
+                    normal    = _mm256_add_epi32(_mm256_add_epi32(normal, bias), odd);
+                }
+                normal = _mm256_srli_epi32(normal, L::Shift);
+
+                // Subnormal in F
+                auto hidden  = _mm256_and_si256(_mm256_cmpgt_epi32(fexp, zero),
+                                               _mm256_set1_epi32(0x800000));
+                auto mant    = _mm256_or_si256(_mm256_and_si256(abs, mantMask), hidden);
+                auto dropped = _mm256_sub_epi32(_mm256_set1_epi32(L::Shift + L::MinNormalExp),
+                                                _mm256_max_epi32(fexp, one));
+                dropped      = _mm256_min_epi32(dropped, _mm256_set1_epi32(L::MaxDropped));
+                auto sub     = _mm256_srlv_epi32(mant, dropped);
+                if constexpr(R == Rounding::NearestEven)
+                {
+                    auto mask = _mm256_sub_epi32(_mm256_sllv_epi32(one, dropped), one);
+                    auto rem  = _mm256_and_si256(mant, mask);
+                    auto half = _mm256_sllv_epi32(one, _mm256_sub_epi32(dropped, one));
+                    auto odd  = _mm256_cmpeq_epi32(_mm256_and_si256(sub, one), one);
+                    auto tie  = _mm256_and_si256(_mm256_cmpeq_epi32(rem, half), odd);
+                    auto up   = _mm256_or_si256(_mm256_cmpgt_epi32(rem, half), tie);
+                    sub       = _mm256_sub_epi32(sub, up);
+                }
+
+                auto code = _mm256_blendv_epi8(sub, normal, isNormal);
+                code      = _mm256_blendv_epi8(
+                    code, _mm256_set1_epi32(OverflowCode), _mm256_cmpgt_epi32(code, maxCode));
+                code = _mm256_blendv_epi8(code, _mm256_set1_epi32(InfResult), isInf);
+
+                // NaN codes
+                auto nan = _mm256_set1_epi32(Traits::NanCode);
+                if constexpr(L::WideExp)
+                {
+                    auto kept = abs;
+                    if constexpr(R == Rounding::NearestEven)
+                    {
+                        auto low  = _mm256_and_si256(abs, _mm256_set1_epi32((1u << L::Shift) - 1u));
+                        auto keep = _mm256_andnot_si256(_mm256_cmpeq_epi32(low, zero),
+                                                        _mm256_set1_epi32(1u << L::Shift));
+                        kept      = _mm256_or_si256(abs, keep);
+                    }
+                    nan = _mm256_srli_epi32(kept, L::Shift);
+                }
+                else if constexpr(F == Format::F16)
+                {
+                    auto payload = _mm256_srli_epi32(_mm256_and_si256(abs, mantMask), L::Shift);
+                    nan          = _mm256_or_si256(nan, payload);
+                }
+                code = _mm256_blendv_epi8(code, nan, isNan);
+
+                auto signBits = _mm256_slli_epi32(sign, L::SignShift);
+                if constexpr(Traits::Fnuz)
+                {
+                    // Signed unless zero or NaN
+                    auto isZero    = _mm256_cmpeq_epi32(code, zero);
+                    auto isNanCode = _mm256_cmpeq_epi32(code, _mm256_set1_epi32(Traits::NanCode));
+                    signBits = _mm256_andnot_si256(_mm256_or_si256(isZero, isNanCode), signBits);
+                }
+                lanes = _mm256_or_si256(code, signBits);
+            }
+
+            template <Format F, Rounding R, Saturation S>
+            __attribute__((target("avx2,f16c"))) inline void
+                encodeAvx2(float const* in, StorageT<F>* out, size_t begin, size_t end)
+            {
+                size_t i = begin;
+                if constexpr(F == Format::F16 && R == Rounding::NearestEven
+                             && S == Saturation::None)
+                {
+                    // Hardware IEEE conversion
+                    for(; i + 8u <= end; i += 8u)
+                    {
+                        auto half = _mm256_cvtps_ph(_mm256_loadu_ps(in + i),
+                                                    _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+                    }
+                }
+                else
+                {
+                    for(; i + 8u <= end; i += 8u)
+                    {
+                        auto code = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+                        encodeLanesAvx2<F, R, S>(code);
+                        if constexpr(F == Format::Xf32)
+                        {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                                                _mm256_slli_epi32(code, 13));
+                        }
+                        else
+                        {
+                            // Narrow to 16 bits, then to 8 bits, within each 128-bit lane
+                            auto packed = _mm256_packus_epi32(code, code);
+                            if constexpr(sizeof(StorageT<F>) == 1u)
+                            {
+                                packed = _mm256_packus_epi16(packed, packed);
+                                packed = _mm256_permutevar8x32_epi32(
+                                    packed, _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+                                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                                                 _mm256_castsi256_si128(packed));
+                            }
+                            else
+                            {
+                                packed = _mm256_permute4x64_epi64(packed, 0x08);
+                                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                                                 _mm256_castsi256_si128(packed));
+                            }
+                        }
+                    }
+                }
+                encodePortable<F, R, S>(in, out, i, end);
+            }
+
+            template <Format F>
+            __attribute__((target("avx2,f16c"))) inline void
+                decodeAvx2(StorageT<F> const* in, float* out, size_t begin, size_t end)
+            {
+                size_t i = begin;
+                if constexpr(sizeof(StorageT<F>) == 1u)
+                {
+                    auto table = decodeTable<F>();
+                    for(; i + 8u <= end; i += 8u)
+                    {
+                        auto codes = _mm256_cvtepu8_epi32(
+                            _mm_loadl_epi64(reinterpret_cast<__m128i const*>(in + i)));
+                        _mm256_storeu_ps(out + i, _mm256_i32gather_ps(table, codes, 4));
+                    }
+                }
+                else if constexpr(F == Format::F16)
+                {
+                    for(; i + 8u <= end; i += 8u)
+                    {
+                        auto half = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+                        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+                    }
+                }
+                else if constexpr(F == Format::Bf16)
+                {
+                    for(; i + 8u <= end; i += 8u)
+                    {
+                        auto bf16 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+                        auto bits = _mm256_slli_epi32(_mm256_cvtepu16_epi32(bf16), 16);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), bits);
+                    }
+                }
+                decodePortable<F>(in, out, i, end);
+            }
+
+            template <Format F>
+            __attribute__((target("avx512f,avx2,f16c"))) inline void
+                decodeAvx512(StorageT<F> const* in, float* out, size_t begin, size_t end)
+            {
+                size_t i = begin;
+                if constexpr(sizeof(StorageT<F>) == 1u)
+                {
+                    auto table = decodeTable<F>();
+                    for(; i + 16u <= end; i += 16u)
+                    {
+                        auto codes = _mm512_cvtepu8_epi32(
+                            _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i)));
+                        _mm512_storeu_ps(out + i, _mm512_i32gather_ps(codes, table, 4));
+                    }
+                }
+                else if constexpr(F == Format::F16)
+                {
+                    for(; i + 16u <= end; i += 16u)
+                    {
+                        auto half = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+                        _mm512_storeu_ps(out + i, _mm512_cvtph_ps(half));
+                    }
+                }
+                decodeAvx2<F>(in, out, i, end);
+            }
+
+#else
+
+            inline bool cpuSupports(Isa isa)
+            {
+                return isa == Isa::Portable || (ROCWMMA_BULK_CONVERT_NEON && isa == Isa::Neon);
+            }
+
+#endif // ROCWMMA_BULK_CONVERT_X86
+
+#if ROCWMMA_BULK_CONVERT_NEON
+
+            template <Format F, Rounding R, Saturation S>
+            inline void encodeNeon(float const* in, StorageT<F>* out, size_t begin, size_t end)
+            {
+                size_t i = begin;
+                if constexpr(F == Format::F16 && R == Rounding::NearestEven
+                             && S == Saturation::None)
+                {
+                    for(; i + 4u <= end; i += 4u)
+                    {
+                        auto half = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(in + i)));
+                        vst1_u16(out + i, half);
+                    }
+                }
+                encodePortable<F, R, S>(in, out, i, end);
+            }
+
+            template <Format F>
+            inline void decodeNeon(StorageT<F> const* in, float* out, size_t begin, size_t end)
+            {
+                size_t i = begin;
+                if constexpr(F == Format::F16)
+                {
+                    for(; i + 4u <= end; i += 4u)
+                    {
+                        vst1q_f32(out + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(in + i))));
+                    }
+                }
+                else if constexpr(F == Format::Bf16)
+                {
+                    for(; i + 4u <= end; i += 4u)
+                    {
+                        auto bits = vshll_n_u16(vld1_u16(in + i), 16);
+                        vst1q_f32(out + i, vreinterpretq_f32_u32(bits));
+                    }
+                }
+                decodePortable<F>(in, out, i, end);
+            }
+
+#endif // ROCWMMA_BULK_CONVERT_NEON
+
+            // Split large arrays over threads, in cache sized chunks
+            template <typename FuncT>
+            inline void forChunks(size_t count, FuncT&& func)
+            {
+                constexpr size_t ChunkSize = 1u << 16u;
+
+                auto chunks = static_cast<int64_t>((count + ChunkSize - 1u) / ChunkSize);
+#pragma omp parallel for
+                for(int64_t c = 0; c < chunks; ++c)
+                {
+                    auto begin = static_cast<size_t>(c) * ChunkSize;
+                    func(begin, std::min(begin + ChunkSize, count));
+                }
+            }
+
+        } // namespace detail
+
+        // Whether an instruction set path is built and usable on this CPU
+        inline bool isaSupported(Isa isa)
+        {
+            return detail::cpuSupports(isa);
+        }
+
+        inline Isa bestIsa()
+        {
+            for(auto isa : {Isa::Avx512, Isa::Avx2, Isa::Neon})
+            {
+                if(isaSupported(isa))
+                {
+                    return isa;
+                }
+            }
+            return Isa::Portable;
+        }
+
+        ///
+        /// Array conversions. Unsupported instruction sets fall back to the
+        /// portable path.
+        ///
+        template <Format F, Rounding R = Rounding::NearestEven, Saturation S = Saturation::Finite>
+        inline void fromFloat(float const*                          in,
+                              typename FormatTraits<F>::StorageT* out,
+                              size_t                                count,
+                              Isa                                   isa = bestIsa())
+        {
+            isa = isaSupported(isa) ? isa : Isa::Portable;
+            detail::forChunks(count, [=](size_t begin, size_t end) {
+#if ROCWMMA_BULK_CONVERT_X86
+                if(isa == Isa::Avx2 || isa == Isa::Avx512)
+                {
+                    return detail::encodeAvx2<F, R, S>(in, out, begin, end);
+                }
+#endif
+#if ROCWMMA_BULK_CONVERT_NEON
+                if(isa == Isa::Neon)
+                {
+                    return detail::encodeNeon<F, R, S>(in, out, begin, end);
+                }
+#endif
+                detail::encodePortable<F, R, S>(in, out, begin, end);
+            });
+        }
+
+        template <Format F>
+        inline void toFloat(typename FormatTraits<F>::StorageT const* in,
+                            float*                                      out,
+                            size_t                                      count,
+                            Isa                                         isa = bestIsa())
+        {
+            isa = isaSupported(isa) ? isa : Isa::Portable;
+            detail::forChunks(count, [=](size_t begin, size_t end) {
+#if ROCWMMA_BULK_CONVERT_X86
+                if(isa == Isa::Avx512)
+                {
+                    return detail::decodeAvx512<F>(in, out, begin, end);
+                }
+                if(isa == Isa::Avx2)
+                {
+                    return detail::decodeAvx2<F>(in, out, begin, end);
+                }
+#endif
+#if ROCWMMA_BULK_CONVERT_NEON
+                if(isa == Isa::Neon)
+                {
+                    return detail::decodeNeon<F>(in, out, begin, end);
+                }
+#endif
+                detail::decodePortable<F>(in, out, begin, end);
+            });
+        }
+
+    } // namespace BulkConvert
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_BULK_CONVERT_HPP
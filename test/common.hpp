@@ -31,6 +31,7 @@
 #warning("Building tests with hfloat16_t requires !HIP_NO_HALF && !__HIP_NO_HALF_CONVERSIONS__. Proceeding without hfloat16_t")
 #endif // !ROCWMMA_NO_HALF && __HIP_NO_HALF_CONVERSIONS__
 
+#include <algorithm>
 #include <iostream>
 #include <mutex>
 #include <tuple>
@@ -41,6 +42,8 @@
 
 #include "test_config.hpp"
 
+#include "bulk_convert.hpp"
+#include "compare_result.hpp"
 #include "device/common.hpp"
 
 #ifndef CHECK_HIP_ERROR
@@ -116,6 +119,149 @@ namespace rocwmma
 
     } // namespace quirks
 
+    ///
+    /// Bulk host conversions of the narrow float types (see bulk_convert.hpp).
+    /// Rounding and saturation match each type's own conversion from float.
+    ///
+    template <typename DataT>
+    struct BulkConvertTraits
+    {
+        static constexpr bool Supported = false;
+    };
+
+    template <BulkConvert::Format F, BulkConvert::Rounding R, BulkConvert::Saturation S>
+    struct BulkConvertTraitsBase
+    {
+        static constexpr bool                    Supported  = true;
+        static constexpr BulkConvert::Format     Format     = F;
+        static constexpr BulkConvert::Rounding   Rounding   = R;
+        static constexpr BulkConvert::Saturation Saturation = S;
+    };
+
+    template <>
+    struct BulkConvertTraits<float8_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::F8,
+                                BulkConvert::Rounding::NearestEven,
+                                BulkConvert::Saturation::Finite>
+    {
+    };
+
+    template <>
+    struct BulkConvertTraits<bfloat8_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::Bf8,
+                                BulkConvert::Rounding::NearestEven,
+                                BulkConvert::Saturation::Finite>
+    {
+    };
+
+    template <>
+    struct BulkConvertTraits<float8_fnuz_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::F8Fnuz,
+                                BulkConvert::Rounding::NearestEven,
+                                BulkConvert::Saturation::Finite>
+    {
+    };
+
+    template <>
+    struct BulkConvertTraits<bfloat8_fnuz_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::Bf8Fnuz,
+                                BulkConvert::Rounding::NearestEven,
+                                BulkConvert::Saturation::Finite>
+    {
+    };
+
+    template <>
+    struct BulkConvertTraits<float16_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::F16,
+                                BulkConvert::Rounding::NearestEven,
+                                BulkConvert::Saturation::None>
+    {
+    };
+
+#if !ROCWMMA_TESTS_NO_HALF
+    template <>
+    struct BulkConvertTraits<hfloat16_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::F16,
+                                BulkConvert::Rounding::NearestEven,
+                                BulkConvert::Saturation::None>
+    {
+    };
+#endif // !ROCWMMA_TESTS_NO_HALF
+
+    template <>
+    struct BulkConvertTraits<bfloat16_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::Bf16,
+                                BulkConvert::Rounding::NearestEven,
+                                BulkConvert::Saturation::None>
+    {
+    };
+
+    // xfloat32_t truncates when constructed from float
+    template <>
+    struct BulkConvertTraits<xfloat32_t>
+        : BulkConvertTraitsBase<BulkConvert::Format::Xf32,
+                                BulkConvert::Rounding::TowardZero,
+                                BulkConvert::Saturation::None>
+    {
+    };
+
+    template <typename DataT>
+    inline void convertFromFloat(float const* in, DataT* out, size_t count)
+    {
+        using Traits   = BulkConvertTraits<DataT>;
+        using StorageT = typename BulkConvert::FormatTraits<Traits::Format>::StorageT;
+        static_assert(sizeof(StorageT) == sizeof(DataT), "Storage size mismatch");
+
+        BulkConvert::fromFloat<Traits::Format, Traits::Rounding, Traits::Saturation>(
+            in, reinterpret_cast<StorageT*>(out), count);
+    }
+
+    template <typename DataT>
+    inline void convertToFloat(DataT const* in, float* out, size_t count)
+    {
+        using Traits   = BulkConvertTraits<DataT>;
+        using StorageT = typename BulkConvert::FormatTraits<Traits::Format>::StorageT;
+        static_assert(sizeof(StorageT) == sizeof(DataT), "Storage size mismatch");
+
+        BulkConvert::toFloat<Traits::Format>(reinterpret_cast<StorageT const*>(in), out, count);
+    }
+
+    ///
+    /// Read-only host view of matrix values as double, for validation.
+    /// Narrow float types are converted up front in bulk; other types
+    /// convert through float on access.
+    ///
+    template <typename DataT>
+    class CompareView
+    {
+    public:
+        CompareView(DataT const* data, size_t count)
+            : mData(data)
+        {
+            if constexpr(BulkConvertTraits<DataT>::Supported)
+            {
+                mValues.resize(count);
+                convertToFloat(data, mValues.data(), count);
+            }
+        }
+
+        double operator[](size_t index) const
+        {
+            if constexpr(BulkConvertTraits<DataT>::Supported)
+            {
+                return static_cast<double>(mValues[index]);
+            }
+            else
+            {
+                return static_cast<double>(static_cast<float>(mData[index]));
+            }
+        }
+
+    private:
+        DataT const*       mData;
+        std::vector<float> mValues;
+    };
+
     template <typename Layout>
     struct MatrixUtil
     {
@@ -253,6 +399,21 @@ namespace rocwmma
             auto index = std::is_same<Layout, row_major>::value ? rowMjr : colMjr;
             auto ld    = std::is_same<Layout, row_major>::value ? n : m;
 
+            // Narrow float types are filled in float, then converted in bulk
+            constexpr bool Staged = BulkConvertTraits<DataT>::Supported;
+            using FillT           = std::conditional_t<Staged, float, DataT>;
+
+            std::vector<float> staging(Staged ? static_cast<size_t>(m) * n : 0u);
+            FillT*             values = nullptr;
+            if constexpr(Staged)
+            {
+                values = staging.data();
+            }
+            else
+            {
+                values = mat;
+            }
+
 #pragma omp parallel for
             for(int i = 0; i < m; ++i) // row
             {
@@ -260,13 +421,18 @@ namespace rocwmma
                 for(int j = 0; j < n; ++j) // col
                 {
                     // Count up in integers, in ascending order for each row.
-                    auto value = (i * n + j) % 5;
-                    auto idx   = index(i, j, ld);
-                    mat[idx]   = ((value % 3) && std::is_signed<DataT>::value)
-                                     ? -static_cast<DataT>(value)
-                                     : static_cast<DataT>(value);
+                    auto value  = (i * n + j) % 5;
+                    auto idx    = index(i, j, ld);
+                    values[idx] = ((value % 3) && std::is_signed<DataT>::value)
+                                      ? -static_cast<FillT>(value)
+                                      : static_cast<FillT>(value);
                 }
             }
+
+            if constexpr(Staged)
+            {
+                convertFromFloat(staging.data(), mat, staging.size());
+            }
         }
 
         template <typename DataT>
@@ -357,8 +523,6 @@ namespace rocwmma
         // Convert to float first then to double.
         auto toDoubleA
             = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-        auto toDoubleB
-            = [](TypeB const& val) { return static_cast<double>(static_cast<float>(val)); };
 
         auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return row * ld + col; };
         auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return col * ld + row; };
@@ -366,6 +530,13 @@ namespace rocwmma
         auto indexA = std::is_same<LayoutA, row_major>::value ? rowMjr : colMjr;
         auto indexB = std::is_same<LayoutB, row_major>::value ? rowMjr : colMjr;
 
+        // Extent of each matrix touched by the comparison
+        auto spanA = (m && n) ? static_cast<size_t>(indexA(m - 1, n - 1, lda)) + 1u : 0u;
+        auto spanB = (m && n) ? static_cast<size_t>(indexB(m - 1, n - 1, ldb)) + 1u : 0u;
+
+        CompareView<TypeA> viewA(matrixA, spanA);
+        CompareView<TypeB> viewB(matrixB, spanB);
+
         bool       isInf = false;
         bool       isNaN = false;
         std::mutex writeMutex;
@@ -376,11 +547,11 @@ namespace rocwmma
 #pragma omp parallel for
             for(int j = 0; j < n; ++j) // Col
             {
-                auto valA = matrixA[indexA(i, j, lda)];
-                auto valB = matrixB[indexB(i, j, ldb)];
+                auto valA = viewA[indexA(i, j, lda)];
+                auto valB = viewB[indexB(i, j, ldb)];
 
-                auto numerator = fabs(toDoubleA(valA) - toDoubleB(valB));
-                auto divisor   = fabs(toDoubleA(valA)) + fabs(toDoubleB(valB)) + 1.0;
+                auto numerator = fabs(valA - valB);
+                auto divisor   = fabs(valA) + fabs(valB) + 1.0;
 
                 if(std::isinf(numerator) || std::isinf(divisor))
                 {
@@ -457,8 +628,9 @@ namespace rocwmma
         // Convert to float first then to double.
         auto toDoubleA
             = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-        auto toDoubleB
-            = [](TypeB const& val) { return static_cast<double>(static_cast<float>(val)); };
+
+        CompareView<TypeA> viewA(matrixA, static_cast<size_t>(m) * n);
+        CompareView<TypeB> viewB(matrixB, static_cast<size_t>(m) * n);
 
         bool       isInf = false;
         bool       isNaN = false;
@@ -467,11 +639,11 @@ namespace rocwmma
 #pragma omp parallel for
         for(int i = 0; i < m * n; ++i) // Row
         {
-            auto valA = matrixA[i];
-            auto valB = matrixB[i];
+            auto valA = viewA[i];
+            auto valB = viewB[i];
 
-            auto numerator = fabs(toDoubleA(valA) - toDoubleB(valB));
-            auto divisor   = fabs(toDoubleA(valA)) + fabs(toDoubleB(valB)) + 1.0;
+            auto numerator = fabs(valA - valB);
+            auto divisor   = fabs(valA) + fabs(valB) + 1.0;
 
             if(std::isinf(numerator) || std::isinf(divisor))
             {
@@ -645,6 +817,61 @@ namespace rocwmma
         return std::make_pair(retval, maxRelativeError);
     }
 
+    // Device implementation of the comparator. Only the reduced result is
+    // copied back to host.
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    CompareResult compareEqualReduceLaunchKernel(TypeA const* matrixA,
+                                                 TypeB const* matrixB,
+                                                 uint32_t     m,
+                                                 uint32_t     n,
+                                                 uint32_t     lda,
+                                                 uint32_t     ldb,
+                                                 double       tolerance = 10.0)
+    {
+        constexpr uint32_t BlockSize = 256u;
+        constexpr uint32_t MaxBlocks = 1024u;
+
+        auto blockDim = dim3(BlockSize, 1, 1);
+        auto gridDim  = dim3(std::min(ceilDiv(m * n, BlockSize), MaxBlocks), 1, 1);
+
+        CompareAccumulator* d_result;
+        CompareAccumulator  result = compareAccumulatorInit();
+        CHECK_HIP_ERROR(hipMalloc(&d_result, sizeof(CompareAccumulator)));
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_result, &result, sizeof(CompareAccumulator), hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL((compareEqualReduceKernel<TypeA, TypeB, LayoutA, LayoutB, BlockSize>),
+                           gridDim,
+                           blockDim,
+                           0,
+                           0,
+                           matrixA,
+                           matrixB,
+                           d_result,
+                           m,
+                           n,
+                           lda,
+                           ldb,
+                           compareThreshold<TypeA>(tolerance));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&result, d_result, sizeof(CompareAccumulator), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipFree(d_result));
+
+        return compareFinalize(result, n);
+    }
+
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    inline CompareResult compareEqualReduceLaunchKernel(
+        TypeA const* matrixA, TypeB const* matrixB, uint32_t m, uint32_t n, double tolerance = 10.0)
+    {
+        uint32_t lda = std::is_same<LayoutA, row_major>::value ? n : m;
+        uint32_t ldb = std::is_same<LayoutB, row_major>::value ? n : m;
+
+        return compareEqualReduceLaunchKernel<TypeA, TypeB, LayoutA, LayoutB>(
+            matrixA, matrixB, m, n, lda, ldb, tolerance);
+    }
+
     // compareEqual kernel wrapper for batched matrices
     template <typename TypeA, typename TypeB>
     std::pair<bool, double> compareEqualLaunchKernel(
@@ -0,0 +1,308 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_COMPARE_RESULT_HPP
+#define ROCWMMA_TEST_COMPARE_RESULT_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include <rocwmma/internal/complex.hpp>
+#include <rocwmma/internal/config.hpp>
+
+namespace rocwmma
+{
+    struct row_major;
+    struct col_major;
+
+    ///
+    /// Partial state of an element-wise comparison between two M x N matrices.
+    /// Accumulators are merged associatively, so the same state is reduced by
+    /// host threads or device workgroups and yields identical results.
+    ///
+    struct CompareAccumulator
+    {
+        enum : uint32_t
+        {
+            FlagNaN = 1u,
+            FlagInf = 2u
+        };
+
+        static constexpr unsigned long long NoFailure = ~0ull;
+
+        // Max finite relative error seen
+        double maxRelativeError;
+
+        // Smallest row-major (row * n + col) index that failed
+        unsigned long long firstFailIdx;
+
+        // FlagNaN | FlagInf
+        uint32_t flags;
+    };
+
+    ROCWMMA_HOST_DEVICE inline CompareAccumulator compareAccumulatorInit()
+    {
+        return CompareAccumulator{0.0, CompareAccumulator::NoFailure, 0u};
+    }
+
+    // Accumulate relative error numerator / divisor of one element.
+    // Elements producing NaN / Inf or exceeding the threshold are failures.
+    ROCWMMA_HOST_DEVICE inline void compareAccumulateError(CompareAccumulator& acc,
+                                                           unsigned long long  idx,
+                                                           double              numerator,
+                                                           double              divisor,
+                                                           double              threshold)
+    {
+        bool failed = false;
+
+        if(std::isinf(numerator) || std::isinf(divisor))
+        {
+            acc.flags |= CompareAccumulator::FlagInf;
+            failed = true;
+        }
+        else
+        {
+            auto relativeError = numerator / divisor;
+            if(std::isnan(relativeError))
+            {
+                acc.flags |= CompareAccumulator::FlagNaN;
+                failed = true;
+            }
+            else
+            {
+                acc.maxRelativeError
+                    = relativeError > acc.maxRelativeError ? relativeError : acc.maxRelativeError;
+                failed = relativeError > threshold;
+            }
+        }
+
+        if(failed && idx < acc.firstFailIdx)
+        {
+            acc.firstFailIdx = idx;
+        }
+    }
+
+    // Accumulate relative error |a - b| / (|a| + |b| + 1) of one element.
+    ROCWMMA_HOST_DEVICE inline void compareAccumulate(CompareAccumulator& acc,
+                                                      unsigned long long  idx,
+                                                      double              valA,
+                                                      double              valB,
+                                                      double              threshold)
+    {
+        compareAccumulateError(
+            acc, idx, fabs(valA - valB), fabs(valA) + fabs(valB) + 1.0, threshold);
+    }
+
+    // Complex elements use the modulus in place of the absolute value
+    ROCWMMA_HOST_DEVICE inline void compareAccumulate(CompareAccumulator&      acc,
+                                                      unsigned long long       idx,
+                                                      complex_t<double> const& valA,
+                                                      complex_t<double> const& valB,
+                                                      double                   threshold)
+    {
+        auto diff = valA - valB;
+        compareAccumulateError(acc,
+                               idx,
+                               hypot(diff.real, diff.imag),
+                               hypot(valA.real, valA.imag) + hypot(valB.real, valB.imag) + 1.0,
+                               threshold);
+    }
+
+    ROCWMMA_HOST_DEVICE inline void compareMerge(CompareAccumulator&       dst,
+                                                 CompareAccumulator const& src)
+    {
+        dst.maxRelativeError = src.maxRelativeError > dst.maxRelativeError ? src.maxRelativeError
+                                                                           : dst.maxRelativeError;
+        dst.firstFailIdx
+            = src.firstFailIdx < dst.firstFailIdx ? src.firstFailIdx : dst.firstFailIdx;
+        dst.flags |= src.flags;
+    }
+
+    ///
+    /// Final outcome of a comparison, common to the host and device comparators.
+    ///
+    struct CompareResult
+    {
+        static constexpr uint32_t NoFailure = ~0u;
+
+        bool     passed           = true;
+        double   maxRelativeError = 0.0;
+        bool     hasNaN           = false;
+        bool     hasInf           = false;
+        uint32_t failRow          = NoFailure;
+        uint32_t failCol          = NoFailure;
+
+        bool hasFailure() const
+        {
+            return failRow != NoFailure;
+        }
+    };
+
+    // Matrix dims are needed to recover the coordinates of the first failure
+    inline CompareResult compareFinalize(CompareAccumulator const& acc, uint32_t n)
+    {
+        CompareResult result;
+        result.hasNaN = (acc.flags & CompareAccumulator::FlagNaN) != 0u;
+        result.hasInf = (acc.flags & CompareAccumulator::FlagInf) != 0u;
+        result.passed = acc.firstFailIdx == CompareAccumulator::NoFailure;
+
+        if(result.hasInf)
+        {
+            result.maxRelativeError = std::numeric_limits<double>::infinity();
+        }
+        else if(result.hasNaN)
+        {
+            result.maxRelativeError = std::numeric_limits<double>::signaling_NaN();
+        }
+        else
+        {
+            result.maxRelativeError = acc.maxRelativeError;
+        }
+
+        if(!result.passed)
+        {
+            result.failRow = static_cast<uint32_t>(acc.firstFailIdx / n);
+            result.failCol = static_cast<uint32_t>(acc.firstFailIdx % n);
+        }
+
+        return result;
+    }
+
+    inline std::ostream& operator<<(std::ostream& stream, CompareResult const& result)
+    {
+        stream << "Max relative error: " << result.maxRelativeError;
+        if(result.hasNaN)
+        {
+            stream << " (NaN)";
+        }
+        if(result.hasInf)
+        {
+            stream << " (Inf)";
+        }
+        if(result.hasFailure())
+        {
+            stream << ", first failure at (" << result.failRow << ", " << result.failCol << ")";
+        }
+        return stream;
+    }
+
+    // Real datatype of compared elements. Complex elements are compared
+    // in the precision of their parts.
+    template <typename T>
+    struct CompareScalar
+    {
+        using Type = T;
+    };
+
+    template <typename T>
+    struct CompareScalar<complex_t<T>>
+    {
+        using Type = T;
+    };
+
+    // Value of an element for comparison.
+    // Some types don't have direct conversion to double.
+    // Convert to float first then to double.
+    template <typename T>
+    inline double compareValue(T const& val)
+    {
+        return static_cast<double>(static_cast<float>(val));
+    }
+
+    template <typename T>
+    inline complex_t<double> compareValue(complex_t<T> const& val)
+    {
+        return complex_t<double>(compareValue(val.real), compareValue(val.imag));
+    }
+
+    // Failure threshold for a comparison in units of TypeA epsilon.
+    template <typename TypeA>
+    inline double compareThreshold(double tolerance)
+    {
+        using ScalarT = typename CompareScalar<TypeA>::Type;
+        return compareValue(std::numeric_limits<ScalarT>::epsilon()) * tolerance;
+    }
+
+    // Host implementation of the comparator. Matrices may have different layouts.
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    CompareResult compareEqualHost(TypeA const* matrixA,
+                                   TypeB const* matrixB,
+                                   uint32_t     m,
+                                   uint32_t     n,
+                                   uint32_t     lda,
+                                   uint32_t     ldb,
+                                   double       tolerance = 10.0)
+    {
+        auto rowMjr = [](uint64_t row, uint64_t col, uint64_t ld) { return row * ld + col; };
+        auto colMjr = [](uint64_t row, uint64_t col, uint64_t ld) { return col * ld + row; };
+
+        auto indexA = std::is_same<LayoutA, row_major>::value ? rowMjr : colMjr;
+        auto indexB = std::is_same<LayoutB, row_major>::value ? rowMjr : colMjr;
+
+        auto threshold = compareThreshold<TypeA>(tolerance);
+        auto result    = compareAccumulatorInit();
+
+#pragma omp parallel
+        {
+            auto local = compareAccumulatorInit();
+
+#pragma omp for
+            for(int i = 0; i < static_cast<int>(m); ++i) // Row
+            {
+                for(uint32_t j = 0; j < n; ++j) // Col
+                {
+                    compareAccumulate(local,
+                                      static_cast<unsigned long long>(i) * n + j,
+                                      compareValue(matrixA[indexA(i, j, lda)]),
+                                      compareValue(matrixB[indexB(i, j, ldb)]),
+                                      threshold);
+                }
+            }
+
+#pragma omp critical
+            compareMerge(result, local);
+        }
+
+        return compareFinalize(result, n);
+    }
+
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    inline CompareResult compareEqualHost(
+        TypeA const* matrixA, TypeB const* matrixB, uint32_t m, uint32_t n, double tolerance = 10.0)
+    {
+        uint32_t lda = std::is_same<LayoutA, row_major>::value ? n : m;
+        uint32_t ldb = std::is_same<LayoutB, row_major>::value ? n : m;
+
+        return compareEqualHost<TypeA, TypeB, LayoutA, LayoutB>(
+            matrixA, matrixB, m, n, lda, ldb, tolerance);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_COMPARE_RESULT_HPP
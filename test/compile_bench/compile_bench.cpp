@@ -0,0 +1,205 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Compile-time benchmark translation unit.
+// Each configuration of test/compile_bench/CMakeLists.txt builds this file
+// with its own fragment config, so that -ftime-trace of the build measures
+// what the headers cost one typical kernel: the cooperative global read /
+// local write of a macro tile with layout transforms, local reads, mma and
+// the epilogue. Nothing here is ever launched.
+
+// Silence warnings for calls on unsupported architectures.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#include <rocwmma/rocwmma_transforms.hpp>
+#pragma GCC diagnostic pop
+
+#include "gemm/gemm_predicates_base.hpp"
+
+namespace rocwmma
+{
+    namespace CompileBench
+    {
+        using InputT   = ROCWMMA_COMPILE_BENCH_INPUT_T;
+        using OutputT  = ROCWMMA_COMPILE_BENCH_OUTPUT_T;
+        using ComputeT = ROCWMMA_COMPILE_BENCH_COMPUTE_T;
+        using LayoutA  = ROCWMMA_COMPILE_BENCH_LAYOUT_A;
+        using LayoutB  = ROCWMMA_COMPILE_BENCH_LAYOUT_B;
+
+        using LayoutC   = row_major;
+        using LayoutLds = col_major;
+
+        constexpr uint32_t BlockM  = ROCWMMA_COMPILE_BENCH_BLOCK_M;
+        constexpr uint32_t BlockN  = ROCWMMA_COMPILE_BENCH_BLOCK_N;
+        constexpr uint32_t BlockK  = ROCWMMA_COMPILE_BENCH_BLOCK_K;
+        constexpr uint32_t BlocksX = 2u;
+        constexpr uint32_t BlocksY = 2u;
+
+        // 2 x 2 waves
+        constexpr uint32_t WaveSize = Constants::AMDGCN_WAVE_SIZE;
+        constexpr uint32_t TBlockX  = 2u * WaveSize;
+        constexpr uint32_t TBlockY  = 2u;
+        constexpr uint32_t WavesX   = TBlockX / WaveSize;
+        constexpr uint32_t WavesY   = TBlockY;
+
+        constexpr uint32_t MacroTileX = WavesX * BlocksX * BlockM;
+        constexpr uint32_t MacroTileY = WavesY * BlocksY * BlockN;
+
+        using Guard = GemmPredicatesBase<BlockM,
+                                         BlockN,
+                                         BlockK,
+                                         InputT,
+                                         OutputT,
+                                         ComputeT,
+                                         BlocksX,
+                                         BlocksY,
+                                         TBlockX,
+                                         TBlockY,
+                                         WaveSize,
+                                         Constants::AMDGCN_CURRENT_ARCH_ID>;
+
+        using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+        using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+        using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutC>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT>;
+
+        // Macro tile buffers and their lds images (B transposed)
+        using GRBuffA = fragment<matrix_a, MacroTileX, BlockN, BlockK, InputT, LayoutA>;
+        using GRBuffB = fragment<matrix_b, BlockM, MacroTileY, BlockK, InputT, LayoutB>;
+        using LRFragA = ApplyDataLayout_t<FragA, LayoutLds>;
+        using LRFragB = ApplyDataLayout_t<ApplyTranspose_t<FragB>, LayoutLds>;
+
+    } // namespace CompileBench
+
+    using namespace CompileBench;
+
+    __global__ void __launch_bounds__(256) compile_bench_kernel(uint32_t       k,
+                                                                InputT const*  a,
+                                                                InputT const*  b,
+                                                                OutputT const* c,
+                                                                OutputT*       d,
+                                                                uint32_t       lda,
+                                                                uint32_t       ldb,
+                                                                uint32_t       ldc,
+                                                                uint32_t       ldd,
+                                                                ComputeT       alpha,
+                                                                ComputeT       beta)
+    {
+        if constexpr(Guard::enableBuild())
+        {
+            HIP_DYNAMIC_SHARED(void*, localMemPtr);
+            auto* ldsA = reinterpret_cast<InputT*>(localMemPtr);
+            auto* ldsB = ldsA + MacroTileX * BlockK;
+
+            constexpr auto waveCount = WavesX * WavesY;
+            auto           waveCoord = make_coord2d(threadIdx.x / WaveSize, threadIdx.y);
+            auto           waveIndex = get<0>(waveCoord) * WavesY + get<1>(waveCoord);
+
+            using MappingA = GetDataLayout_t<GRBuffA>;
+            using MappingB = GetDataLayout_t<GRBuffB>;
+            using MappingC = GetDataLayout_t<FragC>;
+            using ShapeA   = GetIOShape_t<LRFragA>;
+            using ShapeB   = GetIOShape_t<LRFragB>;
+
+            FragAcc fragsAcc[BlocksX][BlocksY];
+            for(uint32_t i = 0; i < BlocksX; i++)
+            {
+                for(uint32_t j = 0; j < BlocksY; j++)
+                {
+                    fill_fragment(fragsAcc[i][j], static_cast<ComputeT>(0));
+                }
+            }
+
+            for(uint32_t kStep = 0; kStep < k; kStep += BlockK)
+            {
+                // Cooperative global read, then local write in the lds layout
+                GRBuffA grBuffA;
+                GRBuffB grBuffB;
+                load_matrix_coop_sync<waveCount>(
+                    grBuffA, a + MappingA::fromMatrixCoord(make_coord2d(0u, kStep), lda), lda,
+                    waveIndex);
+                load_matrix_coop_sync<waveCount>(
+                    grBuffB, b + MappingB::fromMatrixCoord(make_coord2d(kStep, 0u), ldb), ldb,
+                    waveIndex);
+
+                store_matrix_coop_sync<waveCount>(
+                    ldsA, applyDataLayout<LayoutLds, waveCount>(grBuffA), BlockK, waveIndex);
+                store_matrix_coop_sync<waveCount>(
+                    ldsB,
+                    applyDataLayout<LayoutLds, waveCount>(applyTranspose(grBuffB)),
+                    BlockK,
+                    waveIndex);
+                synchronize_workgroup();
+
+                // Local reads back to the mma layouts
+                FragA fragsA[BlocksX];
+                FragB fragsB[BlocksY];
+                for(uint32_t i = 0; i < BlocksX; i++)
+                {
+                    LRFragA tmp;
+                    load_matrix_sync(tmp, ldsA + i * ShapeA::BlockHeight * BlockK, BlockK);
+                    fragsA[i] = applyDataLayout<LayoutA>(tmp);
+                }
+                for(uint32_t j = 0; j < BlocksY; j++)
+                {
+                    LRFragB tmp;
+                    load_matrix_sync(tmp, ldsB + j * ShapeB::BlockHeight * BlockK, BlockK);
+                    fragsB[j] = applyDataLayout<LayoutB>(applyTranspose(tmp));
+                }
+
+                for(uint32_t i = 0; i < BlocksX; i++)
+                {
+                    for(uint32_t j = 0; j < BlocksY; j++)
+                    {
+                        mma_sync(fragsAcc[i][j], fragsA[i], fragsB[j], fragsAcc[i][j]);
+                    }
+                }
+                synchronize_workgroup();
+            }
+
+            // Epilogue: D = alpha * acc + beta * C
+            for(uint32_t i = 0; i < BlocksX; i++)
+            {
+                for(uint32_t j = 0; j < BlocksY; j++)
+                {
+                    auto  blockCoord = make_coord2d(i * BlockM, j * BlockN);
+                    FragC fragC;
+                    load_matrix_sync(fragC, c + MappingC::fromMatrixCoord(blockCoord, ldc), ldc);
+                    for(uint32_t e = 0; e < fragC.num_elements; e++)
+                    {
+                        fragC.x[e] = static_cast<OutputT>(
+                            alpha * fragsAcc[i][j].x[e]
+                            + beta * static_cast<ComputeT>(fragC.x[e]));
+                    }
+                    store_matrix_sync(d + MappingC::fromMatrixCoord(blockCoord, ldd), fragC, ldd);
+                }
+            }
+        }
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_CONV_GLOBAL_MAPPING_HPP
+#define ROCWMMA_CONV_GLOBAL_MAPPING_HPP
+
+#include <type_traits>
+
+#include "conv_problem.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// Implicit GEMM view of a forward convolution. Each group is a GEMM
+    /// D (M x N) = A (M x K) * B (K x N) where:
+    /// M: output pixels (n, y, x), in output order
+    /// N: filters of the group
+    /// K: filter taps, in the order the filter layout stores them:
+    ///    (r, s, c) for nhwc and (c, r, s) for nchw
+    ///
+    /// With that K order, B is the group's filter slice read as a col_major
+    /// K x N matrix with ld = K, so it loads like any GEMM operand. A is
+    /// never formed: its element addresses are computed on the fly from the
+    /// output pixel and filter tap, with -1 for taps in the padding.
+    ///
+    template <typename LayoutT>
+    struct ConvGlobalMapping
+    {
+        using Tensor = ConvTensorLayout<LayoutT>;
+
+        struct PixelCoord
+        {
+            uint32_t n, y, x;
+        };
+
+        struct TapCoord
+        {
+            uint32_t c, r, s;
+        };
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t gemmM(ConvProblem const& p)
+        {
+            return p.n * p.outH() * p.outW();
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t gemmN(ConvProblem const& p)
+        {
+            return p.groupK();
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t gemmK(ConvProblem const& p)
+        {
+            return p.groupC() * p.r * p.s;
+        }
+
+        // Output pixel of GEMM row
+        ROCWMMA_HOST_DEVICE constexpr static inline PixelCoord pixelCoord(ConvProblem const& p,
+                                                                          uint32_t           row)
+        {
+            auto pixels = p.outH() * p.outW();
+            auto rem    = row % pixels;
+            return {row / pixels, rem / p.outW(), rem % p.outW()};
+        }
+
+        // Filter tap of GEMM K index
+        ROCWMMA_HOST_DEVICE constexpr static inline TapCoord tapCoord(ConvProblem const& p,
+                                                                      uint32_t           kIdx)
+        {
+            if constexpr(std::is_same_v<LayoutT, nhwc>)
+            {
+                auto rs = kIdx / p.groupC();
+                return {kIdx % p.groupC(), rs / p.s, rs % p.s};
+            }
+            else
+            {
+                auto rs = kIdx % (p.r * p.s);
+                return {kIdx / (p.r * p.s), rs / p.s, rs % p.s};
+            }
+        }
+
+        // Input element of A(row, kIdx) in group, or -1 in the padding
+        ROCWMMA_HOST_DEVICE constexpr static inline int64_t
+            inputOffset(ConvProblem const& p, uint32_t group, uint32_t row, uint32_t kIdx)
+        {
+            auto pixel = pixelCoord(p, row);
+            auto tap   = tapCoord(p, kIdx);
+
+            auto y = static_cast<int32_t>(pixel.y * p.strideH + tap.r * p.dilationH)
+                     - static_cast<int32_t>(p.padH);
+            auto x = static_cast<int32_t>(pixel.x * p.strideW + tap.s * p.dilationW)
+                     - static_cast<int32_t>(p.padW);
+
+            if(y < 0 || x < 0 || y >= static_cast<int32_t>(p.h) || x >= static_cast<int32_t>(p.w))
+            {
+                return -1;
+            }
+
+            return static_cast<int64_t>(Tensor::input(p,
+                                                      pixel.n,
+                                                      group * p.groupC() + tap.c,
+                                                      static_cast<uint32_t>(y),
+                                                      static_cast<uint32_t>(x)));
+        }
+
+        // Filter slice of group as a col_major gemmK x gemmN matrix
+        ROCWMMA_HOST_DEVICE constexpr static inline uint32_t filterLd(ConvProblem const& p)
+        {
+            return gemmK(p);
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t filterBase(ConvProblem const& p,
+                                                                        uint32_t           group)
+        {
+            return static_cast<uint64_t>(group) * p.groupK() * gemmK(p);
+        }
+
+        // Filter element of B(kIdx, col) in group
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            filterOffset(ConvProblem const& p, uint32_t group, uint32_t kIdx, uint32_t col)
+        {
+            return filterBase(p, group) + static_cast<uint64_t>(col) * filterLd(p) + kIdx;
+        }
+
+        // Output element of D(row, col) in group
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            outputOffset(ConvProblem const& p, uint32_t group, uint32_t row, uint32_t col)
+        {
+            auto pixel = pixelCoord(p, row);
+            return Tensor::output(p, pixel.n, group * p.groupK() + col, pixel.y, pixel.x);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_CONV_GLOBAL_MAPPING_HPP
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONV_KERNEL_BASE_HPP
+#define CONV_KERNEL_BASE_HPP
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <rocwmma/internal/constants.hpp>
+
+#include "conv_problem.hpp"
+#include "conv_resource.hpp"
+#include "hip_device.hpp"
+#include "roofline.hpp"
+
+namespace rocwmma
+{
+
+    // Basic structure to hold runtime problem
+    // parameters
+    struct ProblemParams
+    {
+        std::pair<int64_t, int64_t> threadBlockSize;
+        ConvProblem                 problem;
+    };
+
+    // Typeless Kernel interface to use with testing harness.
+    struct KernelI
+    {
+        KernelI() {}
+        virtual ~KernelI(){};
+
+        virtual void          setup(ProblemParams const& problem)                 = 0;
+        virtual void          exec()                                              = 0;
+        virtual void          validateResults()                                   = 0;
+        virtual void          reportResults()                                     = 0;
+        virtual void          tearDown()                                          = 0;
+        virtual HipResource*  getResource()                                       = 0;
+        virtual std::ostream& printHeader(std::ostream& stream = std::cout) const = 0;
+        virtual std::ostream& printKernel(std::ostream& stream = std::cout) const = 0;
+
+        static bool sHeaderPrinted;
+    };
+
+    inline std::ostream& operator<<(std::ostream& stream, KernelI const& kernel)
+    {
+        kernel.printHeader(stream);
+        kernel.printKernel(stream);
+        return stream;
+    }
+
+    // Typed forward convolution kernel that provides the basis for conv tests.
+    // Each group of the convolution is an implicit GEMM, where every wave
+    // computes one BlockM x BlockN output tile.
+    // This class provides common implementation code.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    struct ConvKernelBase : public KernelI
+    {
+    protected: // Types
+        // Shared access to conv storage
+        using DataStorage = ConvResource<InputT, OutputT>;
+        // Using Hip device backend
+        using DeviceInfo = HipDevice;
+
+        // Interface to device kernel
+        using KernelFunc = void (*)(ConvProblem, // problem
+                                    InputT const* __restrict, // input
+                                    InputT const* __restrict, // filter
+                                    OutputT* __restrict); // output
+
+    protected:
+        ConvKernelBase();
+        virtual ~ConvKernelBase();
+
+        // Kernels MUST provide the device kernel function.
+        virtual KernelFunc kernelImpl() const = 0;
+
+        // Kernel launch parameters
+        virtual uint32_t ldsUsage() const;
+        virtual dim3     gridDim() const;
+        virtual dim3     blockDim() const;
+
+        // Kernel run checks.
+        // True = run test
+        // False = skip test
+        virtual bool checkDevice() const;
+        virtual bool checkSizes() const;
+        virtual bool checkLds() const;
+
+        // Reset all members to default values
+        virtual void reset();
+
+        // Modeled global traffic of one run in bytes, for the roofline columns
+        virtual double modeledBytes() const;
+
+    public:
+        // KernelI interface fulfillment
+        virtual void          setup(ProblemParams const& problem) override;
+        virtual void          exec() override;
+        virtual void          validateResults() override;
+        virtual void          reportResults() override;
+        virtual void          tearDown() override;
+        virtual HipResource*  getResource() override;
+        virtual std::ostream& printHeader(std::ostream& stream = std::cout) const override;
+        virtual std::ostream& printKernel(std::ostream& stream = std::cout) const override;
+
+    protected:
+        // Problem params for kernel
+        uint32_t    mTBlockX, mTBlockY;
+        ConvProblem mProblem;
+
+        // Implicit GEMM sizes of one group
+        uint32_t mGemmM, mGemmN, mGemmK;
+
+        // Execution flow control
+        uint32_t mRepeats;
+        bool     mRunFlag          = true;
+        bool     mValidationResult = false;
+        double   mMaxRelativeError;
+
+        // Performance
+        float64_t mTotalGFlops, mMeasuredTFlopsPerSec;
+        float64_t mElapsedTimeMs;
+        int32_t   mEfficiency;
+        Roofline  mRoofline;
+    };
+
+} // namespace rocwmma
+
+#include "conv_kernel_base_impl.hpp"
+
+#endif // CONV_KERNEL_BASE_HPP
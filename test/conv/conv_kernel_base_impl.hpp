@@ -0,0 +1,644 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONV_KERNEL_BASE_IMPL_HPP
+#define CONV_KERNEL_BASE_IMPL_HPP
+
+#include <cmath>
+#include <functional>
+#include <tuple>
+
+#include <hip/hip_ext.h>
+#include <hip/hip_runtime.h>
+#include <hip/hip_runtime_api.h>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/constants.hpp>
+#include <rocwmma/internal/utils.hpp>
+
+#include "../common.hpp"
+#include "conv_global_mapping.hpp"
+#include "conv_kernel_base.hpp"
+#include "performance.hpp"
+#include "rocwmma_options.hpp"
+
+#if ROCWMMA_VALIDATION_TESTS
+#include "reference.hpp" // Vanilla CPU kernel
+#endif // ROCWMMA_VALIDATION_TESTS
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    ConvKernelBase<BlockM,
+                   BlockN,
+                   BlockK,
+                   InputT,
+                   OutputT,
+                   ComputeT,
+                   LayoutT>::ConvKernelBase()
+    {
+        reset();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    ConvKernelBase<BlockM,
+                   BlockN,
+                   BlockK,
+                   InputT,
+                   OutputT,
+                   ComputeT,
+                   LayoutT>::~ConvKernelBase()
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    uint32_t ConvKernelBase<BlockM,
+                            BlockN,
+                            BlockK,
+                            InputT,
+                            OutputT,
+                            ComputeT,
+                            LayoutT>::ldsUsage() const
+    {
+        // Per wave: gathered A tile and staged output tile.
+        // Per wave row: the filter tile its waves load cooperatively.
+        auto wavesX = mTBlockX / DeviceInfo::instance()->warpSize();
+        auto waves  = wavesX * mTBlockY;
+        return waves * BlockM * BlockK * sizeof(InputT)
+               + mTBlockY * BlockK * BlockN * sizeof(InputT)
+               + waves * BlockM * BlockN * sizeof(OutputT);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    dim3 ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::gridDim() const
+    {
+        auto wavesX = mTBlockX / DeviceInfo::instance()->warpSize();
+        return dim3(ceilDiv(mGemmM, BlockM * wavesX),
+                    ceilDiv(mGemmN, BlockN * mTBlockY),
+                    mProblem.groups);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    dim3 ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::blockDim() const
+    {
+        return dim3(mTBlockX, mTBlockY);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    bool ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::checkDevice() const
+    {
+        auto& deviceInfo = DeviceInfo::instance();
+        auto  deviceArch = deviceInfo->getGcnArch();
+
+        // Arch
+        auto isGfx908 = deviceArch == DeviceInfo::GFX908;
+        auto isGfx11  = (deviceArch == DeviceInfo::GFX1100) || (deviceArch == DeviceInfo::GFX1101)
+                       || (deviceArch == DeviceInfo::GFX1102);
+
+        auto isGfx12 = (deviceArch == DeviceInfo::GFX1200) || (deviceArch == DeviceInfo::GFX1201);
+
+        // Datatypes
+        auto isF64 = std::is_same<InputT, float64_t>::value;
+
+#if !ROCWMMA_TESTS_NO_HALF
+        auto isH16 = std::is_same<InputT, hfloat16_t>::value;
+#else
+        auto isH16 = false;
+#endif // !ROCWMMA_NO_HALF
+        auto isF16  = std::is_same<InputT, float16_t>::value || isH16;
+        auto isBF16 = (std::is_same<InputT, bfloat16_t>::value);
+        auto isI8   = (std::is_same<InputT, int8_t>::value);
+
+        // Block size
+        auto is16x16 = (BlockM == 16 && BlockN == 16);
+
+        // No unsupported devices
+        bool unsupportedDeviceCheck = !(deviceArch == DeviceInfo::UNSUPPORTED_ARCH);
+
+        // gfx908 doesn't support f64
+        bool gfx908F64Check = !(isGfx908 && isF64);
+
+        // gfx11 only supports f16, i8 and bf16 inputs with block size 16
+        bool gfx11Check = !(isGfx11 && ((!isF16 && !isBF16 && !isI8) || !is16x16));
+
+        // gfx12 only supports f16, i8 and bf16 inputs with block size 16
+        bool gfx12Check = !(isGfx12 && ((!isF16 && !isBF16 && !isI8) || !is16x16));
+
+        return unsupportedDeviceCheck && gfx908F64Check && gfx11Check && gfx12Check;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    bool ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::checkSizes() const
+    {
+        // The kernel has no bounds checks: tiles must divide the implicit GEMM.
+        auto warpSize = static_cast<uint32_t>(DeviceInfo::instance()->warpSize());
+        auto wavesX   = mTBlockX / warpSize;
+
+        return mProblem.isValid() && (mTBlockX % warpSize == 0) && (wavesX > 0)
+               && (mGemmM % (BlockM * wavesX) == 0) && (mGemmN % (BlockN * mTBlockY) == 0)
+               && (mGemmK % BlockK == 0);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    bool ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::checkLds() const
+    {
+        return ldsUsage() <= DeviceInfo::instance()->sharedMemSize();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    void ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::reset()
+    {
+        mTBlockX = mTBlockY = 0;
+        mProblem            = ConvProblem{};
+        mGemmM = mGemmN = mGemmK = 0;
+        mRepeats =
+#if ROCWMMA_VALIDATION_TESTS
+            1;
+#else
+            5;
+#endif // ROCWMMA_VALIDATION_TESTS
+
+        mRunFlag = true;
+
+        mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
+        mElapsedTimeMs                       = 0.0;
+        mEfficiency                          = -1;
+        mRoofline                            = Roofline();
+
+        mValidationResult = false;
+        mMaxRelativeError = 0.0;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    HipResource* ConvKernelBase<BlockM,
+                                BlockN,
+                                BlockK,
+                                InputT,
+                                OutputT,
+                                ComputeT,
+                                LayoutT>::getResource()
+    {
+        return DataStorage::instance().get();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    double ConvKernelBase<BlockM,
+                          BlockN,
+                          BlockK,
+                          InputT,
+                          OutputT,
+                          ComputeT,
+                          LayoutT>::modeledBytes() const
+    {
+        // Implicit GEMM of each group, tiled as gridDim(). The gathered input
+        // counts every element a tile loads, as the filter taps overlap.
+        auto wavesX = mTBlockX / DeviceInfo::instance()->warpSize();
+        return tiledGemmBytes(mGemmM,
+                              mGemmN,
+                              mGemmK,
+                              BlockM * wavesX,
+                              BlockN * mTBlockY,
+                              sizeof(InputT),
+                              sizeof(InputT),
+                              0.0,
+                              sizeof(OutputT))
+               * mProblem.groups;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    std::ostream& ConvKernelBase<BlockM,
+                                 BlockN,
+                                 BlockK,
+                                 InputT,
+                                 OutputT,
+                                 ComputeT,
+                                 LayoutT>::printHeader(std::ostream& stream) const
+    {
+        stream << "BlkM, BlkN, BlkK, "
+               << "InputT, OutputT, ComputeT, "
+               << "Layout, "
+               << "N, C, H, W, K, R, S, "
+               << "StrideH, StrideW, PadH, PadW, DilationH, DilationW, Groups, "
+               << "TBlkX, TBlkY, "
+#if ROCWMMA_VALIDATION_TESTS
+               << "maxRelativeDiff, "
+#endif // ROCWMMA_VALIDATION_TESTS
+               << "elapsedMs, "
+               << "Problem Size(GFlops), "
+               << "TFlops/s, "
+               << "Efficiency(%), ";
+        return printRooflineHeader(stream) << "Result" << std::endl;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    std::ostream& ConvKernelBase<BlockM,
+                                 BlockN,
+                                 BlockK,
+                                 InputT,
+                                 OutputT,
+                                 ComputeT,
+                                 LayoutT>::printKernel(std::ostream& stream) const
+    {
+        auto const& p = mProblem;
+
+        stream << BlockM << ", " << BlockN << ", " << BlockK << ", "
+               << dataTypeToString<InputT>() << ", " << dataTypeToString<OutputT>() << ", "
+               << dataTypeToString<ComputeT>() << ", "
+               << (std::is_same<LayoutT, nhwc>::value ? "NHWC" : "NCHW") << ", " << p.n << ", "
+               << p.c << ", " << p.h << ", " << p.w << ", " << p.k << ", " << p.r << ", " << p.s
+               << ", " << p.strideH << ", " << p.strideW << ", " << p.padH << ", " << p.padW
+               << ", " << p.dilationH << ", " << p.dilationW << ", " << p.groups << ", "
+               << mTBlockX << ", " << mTBlockY << ", ";
+
+        if(!mRunFlag)
+        {
+            stream
+#if ROCWMMA_VALIDATION_TESTS
+                << "n/a, "
+#endif // ROCWMMA_VALIDATION_TESTS
+                << "n/a, n/a, n/a, n/a, ";
+            return printRooflineSkipped(stream) << "SKIPPED" << std::endl;
+        }
+        else
+        {
+            stream
+#if ROCWMMA_VALIDATION_TESTS
+                << mMaxRelativeError << ", "
+#endif // ROCWMMA_VALIDATION_TESTS
+                << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec << ", "
+                << mEfficiency << ", ";
+            return printRoofline(stream, mRoofline)
+#if ROCWMMA_VALIDATION_TESTS
+                   << (mValidationResult ? "PASSED" : "FAILED")
+#else
+                   << "BENCH"
+#endif // ROCWMMA_VALIDATION_TESTS
+                   << std::endl;
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    void ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::setup(ProblemParams const& problem)
+    {
+        // Reset the flags in case of multiple runs
+        mRunFlag = true;
+
+        // Format incoming problem parameters
+        std::tie(mTBlockX, mTBlockY)
+            = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.threadBlockSize)),
+                       static_cast<uint32_t const&>(std::get<1>(problem.threadBlockSize)));
+        mProblem = problem.problem;
+
+        using Mapping = ConvGlobalMapping<LayoutT>;
+        mGemmM        = Mapping::gemmM(mProblem);
+        mGemmN        = Mapping::gemmN(mProblem);
+        mGemmK        = Mapping::gemmK(mProblem);
+
+        mRunFlag &= checkDevice();
+        mRunFlag &= checkSizes();
+        mRunFlag &= checkLds();
+
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+
+            // Initialize tensor storage
+            dataInstance->resizeStorage(mProblem);
+
+            // Initialize tensor data on device and transfer to host for validation
+            MatrixUtil<row_major>::fillLaunchKernel(
+                dataInstance->deviceInput().get(), 1u, mProblem.inputElements());
+            MatrixUtil<row_major>::fillLaunchKernel(
+                dataInstance->deviceFilter().get(), 1u, mProblem.filterElements());
+#if ROCWMMA_VALIDATION_TESTS
+            dataInstance->copyDeviceToHostInputs();
+#endif // ROCWMMA_VALIDATION_TESTS
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    void ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::exec()
+    {
+        if(mRunFlag)
+        {
+            std::function<void()> convKernel = [this]() {
+                auto& dataInstance = DataStorage::instance();
+                hipExtLaunchKernelGGL((this->kernelImpl()),
+                                      (this->gridDim()),
+                                      (this->blockDim()),
+                                      (this->ldsUsage()),
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      0,
+                                      mProblem,
+                                      dataInstance->deviceInput().get(),
+                                      dataInstance->deviceFilter().get(),
+                                      dataInstance->deviceOutput().get());
+            };
+
+            hipEvent_t startEvent, stopEvent;
+            CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+            CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+            CHECK_HIP_ERROR(hipEventRecord(startEvent));
+            for(uint32_t i = 0; i < mRepeats; ++i)
+            {
+                convKernel();
+            }
+            CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+            auto timeMs = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+
+            // Calculate efficiency
+            auto& deviceInfo = DeviceInfo::instance();
+
+            auto devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<InputT>();
+
+            // All groups together: M x (N * groups) x K
+            auto totalN = mGemmN * mProblem.groups;
+
+            mElapsedTimeMs        = float64_t(timeMs);
+            mTotalGFlops          = calculateGFlops(mGemmM, totalN, mGemmK);
+            mMeasuredTFlopsPerSec = calculateTFlopsPerSec(mGemmM, totalN, mGemmK, mElapsedTimeMs)
+                                    * static_cast<float64_t>(mRepeats);
+
+            mEfficiency = round(mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+
+            // Place the kernel on the roofline of the device
+            auto devicePeakGBs = deviceInfo->peakBandwidthGBs();
+            auto runTimeMs     = mElapsedTimeMs / static_cast<float64_t>(mRepeats);
+            mRoofline          = calculateRoofline(
+                mTotalGFlops, modeledBytes(), runTimeMs, devicePeakGFlopsPerSec, devicePeakGBs);
+
+            if(!RocwmmaOptions::instance()->rooflinePlot().empty())
+            {
+                auto const&       p = mProblem;
+                std::stringstream label;
+                label << "ConvFwd, " << BlockM << "x" << BlockN << "x" << BlockK << ", " << p.n
+                      << "x" << p.c << "x" << p.h << "x" << p.w << " * " << p.k << "x" << p.r
+                      << "x" << p.s << " g" << p.groups << ", " << dataTypeToString<InputT>();
+                appendRooflinePlotData(RocwmmaOptions::instance()->rooflinePlot(),
+                                       label.str(),
+                                       mTotalGFlops,
+                                       runTimeMs,
+                                       mRoofline,
+                                       devicePeakGFlopsPerSec,
+                                       devicePeakGBs);
+            }
+
+            CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+            CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+#if ROCWMMA_VALIDATION_TESTS
+            // Run reference CPU kernel
+            auto& dataInstance = DataStorage::instance();
+            conv_fwd_CPU<InputT, OutputT, ComputeT, LayoutT>(mProblem,
+                                                             dataInstance->hostInput().get(),
+                                                             dataInstance->hostFilter().get(),
+                                                             dataInstance->hostOutputRef().get());
+#endif // ROCWMMA_VALIDATION_TESTS
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    void ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::validateResults()
+    {
+#if ROCWMMA_VALIDATION_TESTS
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+            auto  elements     = mProblem.outputElements();
+
+            auto reference = dataInstance->template allocDevice<OutputT>(elements);
+            dataInstance->copyData(reference, dataInstance->hostOutputRef(), elements);
+
+            std::tie(mValidationResult, mMaxRelativeError)
+                = compareEqualLaunchKernel<OutputT, OutputT>(
+                    dataInstance->deviceOutput().get(), reference.get(), 1u, elements, 1u);
+
+            EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+        }
+#endif // ROCWMMA_VALIDATION_TESTS
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    void ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::reportResults()
+    {
+        if(!KernelI::sHeaderPrinted)
+        {
+            printHeader();
+            KernelI::sHeaderPrinted = true;
+        }
+        printKernel();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    void ConvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutT>::tearDown()
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // CONV_KERNEL_BASE_IMPL_HPP
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_CONV_PROBLEM_HPP
+#define ROCWMMA_CONV_PROBLEM_HPP
+
+#include <rocwmma/internal/types.hpp>
+
+namespace rocwmma
+{
+    // Activation and output tensor layouts. Filters follow the activation
+    // layout: KRSC for nhwc and KCRS for nchw, with C the channels of a group.
+    struct nhwc
+    {
+    };
+
+    struct nchw
+    {
+    };
+
+    // Forward convolution of an N x C x H x W input with K filters of
+    // C / groups x R x S. Input channels and filters are split evenly into
+    // groups, and filters of group g only see input channels of group g.
+    struct ConvProblem
+    {
+        uint32_t n, c, h, w;
+        uint32_t k, r, s;
+        uint32_t strideH, strideW;
+        uint32_t padH, padW;
+        uint32_t dilationH, dilationW;
+        uint32_t groups;
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t outH() const
+        {
+            return (h + 2u * padH - dilationH * (r - 1u) - 1u) / strideH + 1u;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t outW() const
+        {
+            return (w + 2u * padW - dilationW * (s - 1u) - 1u) / strideW + 1u;
+        }
+
+        // Input channels / filters of one group
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t groupC() const
+        {
+            return c / groups;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t groupK() const
+        {
+            return k / groups;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint64_t inputElements() const
+        {
+            return static_cast<uint64_t>(n) * c * h * w;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint64_t filterElements() const
+        {
+            return static_cast<uint64_t>(k) * groupC() * r * s;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint64_t outputElements() const
+        {
+            return static_cast<uint64_t>(n) * k * outH() * outW();
+        }
+
+        // Non-zero sizes, even groups and a dilated filter that fits the padded input
+        ROCWMMA_HOST_DEVICE constexpr inline bool isValid() const
+        {
+            return n > 0u && c > 0u && h > 0u && w > 0u && k > 0u && r > 0u && s > 0u
+                   && strideH > 0u && strideW > 0u && dilationH > 0u && dilationW > 0u
+                   && groups > 0u && c % groups == 0u && k % groups == 0u
+                   && h + 2u * padH >= dilationH * (r - 1u) + 1u
+                   && w + 2u * padW >= dilationW * (s - 1u) + 1u;
+        }
+    };
+
+    // Element offsets of the input, filter and output tensors.
+    // Filter channel c is relative to the group.
+    template <typename LayoutT>
+    struct ConvTensorLayout;
+
+    template <>
+    struct ConvTensorLayout<nhwc>
+    {
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            input(ConvProblem const& p, uint32_t n, uint32_t c, uint32_t y, uint32_t x)
+        {
+            return ((static_cast<uint64_t>(n) * p.h + y) * p.w + x) * p.c + c;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            filter(ConvProblem const& p, uint32_t k, uint32_t c, uint32_t r, uint32_t s)
+        {
+            return ((static_cast<uint64_t>(k) * p.r + r) * p.s + s) * p.groupC() + c;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            output(ConvProblem const& p, uint32_t n, uint32_t k, uint32_t y, uint32_t x)
+        {
+            return ((static_cast<uint64_t>(n) * p.outH() + y) * p.outW() + x) * p.k + k;
+        }
+    };
+
+    template <>
+    struct ConvTensorLayout<nchw>
+    {
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            input(ConvProblem const& p, uint32_t n, uint32_t c, uint32_t y, uint32_t x)
+        {
+            return ((static_cast<uint64_t>(n) * p.c + c) * p.h + y) * p.w + x;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            filter(ConvProblem const& p, uint32_t k, uint32_t c, uint32_t r, uint32_t s)
+        {
+            return ((static_cast<uint64_t>(k) * p.groupC() + c) * p.r + r) * p.s + s;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr static inline uint64_t
+            output(ConvProblem const& p, uint32_t n, uint32_t k, uint32_t y, uint32_t x)
+        {
+            return ((static_cast<uint64_t>(n) * p.k + k) * p.outH() + y) * p.outW() + x;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_CONV_PROBLEM_HPP
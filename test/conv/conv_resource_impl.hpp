@@ -0,0 +1,195 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONV_RESOURCE_IMPL_HPP
+#define CONV_RESOURCE_IMPL_HPP
+
+#include "conv_resource.hpp"
+
+namespace rocwmma
+{
+
+    template <typename InputT, typename OutputT>
+    ConvResource<InputT, OutputT>::ConvResource()
+        : mDeviceInput(Base::template allocDevice<InputT>(0))
+        , mDeviceFilter(Base::template allocDevice<InputT>(0))
+        , mDeviceOutput(Base::template allocDevice<OutputT>(0))
+        , mHostInput(Base::template allocHost<InputT>(0))
+        , mHostFilter(Base::template allocHost<InputT>(0))
+        , mHostOutput(Base::template allocHost<OutputT>(0))
+        , mHostOutputRef(Base::template allocHost<OutputT>(0))
+        , mCurrentElementCount({0, 0, 0})
+        , mMaxCapacity({0, 0, 0})
+    {
+    }
+
+    template <typename InputT, typename OutputT>
+    ConvResource<InputT, OutputT>::ConvResource(ConvResource<InputT, OutputT>&& rhs)
+        : HipResource()
+        , mDeviceInput(std::move(rhs.mDeviceInput))
+        , mDeviceFilter(std::move(rhs.mDeviceFilter))
+        , mDeviceOutput(std::move(rhs.mDeviceOutput))
+        , mHostInput(std::move(rhs.mHostInput))
+        , mHostFilter(std::move(rhs.mHostFilter))
+        , mHostOutput(std::move(rhs.mHostOutput))
+        , mHostOutputRef(std::move(rhs.mHostOutputRef))
+        , mCurrentElementCount(rhs.mCurrentElementCount)
+        , mMaxCapacity(rhs.mMaxCapacity)
+    {
+    }
+
+    template <typename InputT, typename OutputT>
+    template <typename T>
+    inline void
+        ConvResource<InputT, OutputT>::conditionalReallocDeviceHostPair(DevicePtrT<T>& devicePtr,
+                                                                        HostPtrT<T>&   hostPtr,
+                                                                        int64_t&       currentMax,
+                                                                        int64_t        newSize)
+    {
+        if(currentMax < newSize)
+        {
+            Base::reallocDeviceHostPair(devicePtr, hostPtr, newSize);
+            currentMax = newSize;
+        }
+    }
+
+    template <typename InputT, typename OutputT>
+    void ConvResource<InputT, OutputT>::copyHostToDeviceAll()
+    {
+        Base::copyData(mDeviceInput, mHostInput, std::get<Input>(mCurrentElementCount));
+        Base::copyData(mDeviceFilter, mHostFilter, std::get<Filter>(mCurrentElementCount));
+    }
+
+    template <typename InputT, typename OutputT>
+    void ConvResource<InputT, OutputT>::copyDeviceToHostInputs()
+    {
+        Base::copyData(mHostInput, mDeviceInput, std::get<Input>(mCurrentElementCount));
+        Base::copyData(mHostFilter, mDeviceFilter, std::get<Filter>(mCurrentElementCount));
+    }
+
+    template <typename InputT, typename OutputT>
+    void ConvResource<InputT, OutputT>::copyDeviceToHostOutput()
+    {
+        Base::copyData(mHostOutput, mDeviceOutput, std::get<Output>(mCurrentElementCount));
+    }
+
+    template <typename InputT, typename OutputT>
+    void ConvResource<InputT, OutputT>::resizeStorage(ConvProblem const& problem)
+    {
+        resizeStorage(std::make_tuple(static_cast<int64_t>(problem.inputElements()),
+                                      static_cast<int64_t>(problem.filterElements()),
+                                      static_cast<int64_t>(problem.outputElements())));
+    }
+
+    template <typename InputT, typename OutputT>
+    void ConvResource<InputT, OutputT>::resizeStorage(ElementCount const& newElementCounts)
+    {
+        conditionalReallocDeviceHostPair(mDeviceInput,
+                                         mHostInput,
+                                         std::get<Input>(mMaxCapacity),
+                                         std::get<Input>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceFilter,
+                                         mHostFilter,
+                                         std::get<Filter>(mMaxCapacity),
+                                         std::get<Filter>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceOutput,
+                                         mHostOutput,
+                                         std::get<Output>(mMaxCapacity),
+                                         std::get<Output>(newElementCounts));
+
+        Base::reallocHost(mHostOutputRef, std::get<Output>(newElementCounts));
+
+        mCurrentElementCount = newElementCounts;
+    }
+
+    template <typename InputT, typename OutputT>
+    void ConvResource<InputT, OutputT>::reset()
+    {
+        Base::reallocDeviceHostPair(mDeviceInput, mHostInput, 0);
+        Base::reallocDeviceHostPair(mDeviceFilter, mHostFilter, 0);
+        Base::reallocDeviceHostPair(mDeviceOutput, mHostOutput, 0);
+        Base::reallocHost(mHostOutputRef, 0);
+        mCurrentElementCount = {0, 0, 0};
+        mMaxCapacity         = {0, 0, 0};
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::hostInput() -> HostPtrT<InputT>&
+    {
+        return mHostInput;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::hostFilter() -> HostPtrT<InputT>&
+    {
+        return mHostFilter;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::hostOutput() -> HostPtrT<OutputT>&
+    {
+        return mHostOutput;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::hostOutputRef() -> HostPtrT<OutputT>&
+    {
+        return mHostOutputRef;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::deviceInput() -> DevicePtrT<InputT>&
+    {
+        return mDeviceInput;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::deviceFilter() -> DevicePtrT<InputT>&
+    {
+        return mDeviceFilter;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::deviceOutput() -> DevicePtrT<OutputT>&
+    {
+        return mDeviceOutput;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::currentElementCount() const -> ElementCount
+    {
+        return mCurrentElementCount;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto ConvResource<InputT, OutputT>::maxCapacity() const -> ElementCount
+    {
+        return mMaxCapacity;
+    }
+
+} // namespace rocwmma
+
+#endif // CONV_RESOURCE_IMPL_HPP
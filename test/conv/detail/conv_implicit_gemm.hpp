@@ -0,0 +1,98 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONV_IMPLICIT_GEMM_DETAIL_HPP
+#define CONV_IMPLICIT_GEMM_DETAIL_HPP
+
+#include "conv_kernel_base.hpp"
+#include "device/conv_implicit_gemm_fwd.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    struct ConvImplicitGemmKernel final
+        : public ConvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT, LayoutT>
+    {
+    private:
+        using Base = ConvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT, LayoutT>;
+
+    public:
+        ConvImplicitGemmKernel() {}
+        ~ConvImplicitGemmKernel() final {}
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                convImplicitGemmFwd<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT, LayoutT>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct ConvImplicitGemmGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT   = 0,
+            OutputT  = 1,
+            ComputeT = 2,
+            BlockM   = 3,
+            BlockN   = 4,
+            BlockK   = 5,
+            LayoutT  = 6
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = ConvImplicitGemmKernel<std::tuple_element_t<BlockM, TestParamsT>::value,
+                                         std::tuple_element_t<BlockN, TestParamsT>::value,
+                                         std::tuple_element_t<BlockK, TestParamsT>::value,
+                                         std::tuple_element_t<InputT, TestParamsT>,
+                                         std::tuple_element_t<OutputT, TestParamsT>,
+                                         std::tuple_element_t<ComputeT, TestParamsT>,
+                                         std::tuple_element_t<LayoutT, TestParamsT>>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // CONV_IMPLICIT_GEMM_DETAIL_HPP
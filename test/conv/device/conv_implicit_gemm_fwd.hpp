@@ -0,0 +1,157 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONV_IMPLICIT_GEMM_FWD_HPP
+#define CONV_IMPLICIT_GEMM_FWD_HPP
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#pragma GCC diagnostic pop
+
+#include "conv_global_mapping.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// Forward convolution as an implicit GEMM per group (blockIdx.z).
+    /// Each wave computes one BlockM x BlockN output tile, waves in x
+    /// stepping through output pixels and waves in y through filters.
+    ///
+    /// Per BlockK step:
+    /// - Each wave gathers its BlockM x BlockK A tile from the input
+    ///   tensor into LDS, with addresses from the global mapping and zeros
+    ///   for taps in the padding.
+    /// - Waves of the same row share a filter tile: they load it with
+    ///   load_matrix_coop_sync straight from the filter tensor and store
+    ///   it to LDS for all of them.
+    ///
+    /// The output tile is staged through LDS and scattered to the output
+    /// tensor. Sizes must be tile multiples, as checked by the host.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutT>
+    __global__ void __launch_bounds__(256) convImplicitGemmFwd(ConvProblem problem,
+                                                               InputT const* __restrict input,
+                                                               InputT const* __restrict filter,
+                                                               OutputT* __restrict output)
+    {
+        using Mapping = ConvGlobalMapping<LayoutT>;
+
+        using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, row_major>;
+        using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, col_major>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, row_major>;
+        using FragOut = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, row_major>;
+
+        constexpr auto WaveSize = Constants::AMDGCN_WAVE_SIZE;
+
+        // Wave grid of the workgroup
+        auto wavesX  = blockDim.x / WaveSize;
+        auto wavesY  = blockDim.y;
+        auto waveX   = threadIdx.x / WaveSize;
+        auto waveY   = threadIdx.y;
+        auto waveIdx = waveY * wavesX + waveX;
+        auto laneId  = threadIdx.x % WaveSize;
+
+        // Implicit GEMM tile of this wave
+        auto group = blockIdx.z;
+        auto row0  = (blockIdx.x * wavesX + waveX) * BlockM;
+        auto col0  = (blockIdx.y * wavesY + waveY) * BlockN;
+
+        // LDS: A tiles per wave, B tiles per wave row, output tiles per wave
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto* ldsBase = reinterpret_cast<InputT*>(localMemPtr);
+        auto* ldsA    = ldsBase + waveIdx * BlockM * BlockK;
+        auto* ldsB    = ldsBase + wavesX * wavesY * BlockM * BlockK + waveY * BlockK * BlockN;
+        auto* ldsOut  = reinterpret_cast<OutputT*>(ldsBase + wavesX * wavesY * BlockM * BlockK
+                                                  + wavesY * BlockK * BlockN)
+                       + waveIdx * BlockM * BlockN;
+
+        // Filter slice of the group is a col_major gemmK x gemmN matrix
+        auto  ldb   = Mapping::filterLd(problem);
+        auto* addrB
+            = filter + Mapping::filterBase(problem, group) + static_cast<uint64_t>(col0) * ldb;
+
+        auto fragAcc = FragAcc();
+        fill_fragment(fragAcc, static_cast<ComputeT>(0));
+
+        auto gemmK = Mapping::gemmK(problem);
+        for(uint32_t k0 = 0u; k0 < gemmK; k0 += BlockK)
+        {
+            // Gather A: output pixels x filter taps
+            for(uint32_t i = laneId; i < BlockM * BlockK; i += WaveSize)
+            {
+                auto offset
+                    = Mapping::inputOffset(problem, group, row0 + i / BlockK, k0 + i % BlockK);
+                ldsA[i] = offset < 0 ? static_cast<InputT>(0) : input[offset];
+            }
+
+            // Share B across the wave row
+            auto fragB = FragB();
+            load_matrix_coop_sync(fragB, addrB + k0, ldb, waveX, wavesX);
+            store_matrix_coop_sync(ldsB, fragB, BlockK, waveX, wavesX);
+
+            synchronize_workgroup();
+
+            auto fragA = FragA();
+            load_matrix_sync(fragA, ldsA, BlockK);
+            load_matrix_sync(fragB, ldsB, BlockK);
+            mma_sync(fragAcc, fragA, fragB, fragAcc);
+
+            // LDS is re-written next step
+            synchronize_workgroup();
+        }
+
+        auto fragOut = FragOut();
+#pragma unroll
+        for(int i = 0; i < fragOut.num_elements; ++i)
+        {
+            fragOut.x[i] = static_cast<OutputT>(fragAcc.x[i]);
+        }
+        store_matrix_sync(ldsOut, fragOut, BlockN);
+
+        synchronize_workgroup();
+
+        // Scatter D rows to their output pixels
+        for(uint32_t i = laneId; i < BlockM * BlockN; i += WaveSize)
+        {
+            output[Mapping::outputOffset(problem, group, row0 + i / BlockN, col0 + i % BlockN)]
+                = ldsOut[i];
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // CONV_IMPLICIT_GEMM_FWD_HPP
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef CONV_TEST_PARAMS_HPP
+#define CONV_TEST_PARAMS_HPP
+
+#include <tuple>
+#include <vector>
+
+#include <rocwmma/internal/types.hpp>
+
+#include "../common.hpp"
+#include "conv_kernel_base.hpp"
+#include "kernel_generator.hpp"
+
+namespace rocwmma
+{
+    struct ConvTestParams
+    {
+        // Types of parameters
+        using KernelT      = std::shared_ptr<KernelI>;
+        using ThreadBlockT = std::pair<int64_t, int64_t>;
+        using ProblemT     = ConvProblem;
+
+        // InputT, OutputT, ComputeT
+        using DataTypes = std::tuple<std::tuple<float16_t, float32_t, float32_t>,
+                                     std::tuple<bfloat16_t, float32_t, float32_t>,
+                                     std::tuple<float32_t, float32_t, float32_t>>;
+
+        // BlockM, BlockN, BlockK
+        using BlockSizes = std::tuple<std::tuple<I<16>, I<16>, I<16>>,
+                                      std::tuple<I<16>, I<16>, I<32>>,
+                                      std::tuple<I<32>, I<32>, I<16>>>;
+
+        using Layouts = std::tuple<std::tuple<nhwc>, std::tuple<nchw>>;
+
+        // n, c, h, w, k, r, s, strideH, strideW, padH, padW, dilationH, dilationW, groups
+        static inline std::vector<ProblemT> problems()
+        {
+            return {
+                {2u, 32u, 16u, 16u, 64u, 3u, 3u, 1u, 1u, 1u, 1u, 1u, 1u, 1u}, // 3x3, same
+                {4u, 32u, 32u, 32u, 64u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 1u, 1u}, // 3x3, stride 2
+                {2u, 32u, 16u, 16u, 32u, 3u, 3u, 1u, 1u, 2u, 2u, 2u, 2u, 1u}, // 3x3, dilation 2
+                {2u, 64u, 8u, 8u, 64u, 3u, 3u, 1u, 1u, 1u, 1u, 1u, 1u, 2u}, // grouped
+                {4u, 64u, 8u, 8u, 64u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 1u}, // 1x1
+                {8u, 128u, 28u, 28u, 128u, 3u, 3u, 1u, 1u, 1u, 1u, 1u, 1u, 1u}, // resnet-like
+            };
+        }
+
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            return {{warpSize, 1}, {warpSize * 2, 2}};
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // CONV_TEST_PARAMS_HPP
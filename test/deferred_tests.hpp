@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEFERRED_TESTS_HPP
+#define ROCWMMA_DEFERRED_TESTS_HPP
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace rocwmma
+{
+    ///
+    /// Tests that only exist in an optional run mode (--pipeline, --tune or
+    /// --dry-run). Suites queue them during static initialization and
+    /// main() registers the queued tests of each enabled mode once the
+    /// options are parsed, so regular runs don't list them as skipped.
+    ///
+    class DeferredTests
+    {
+    public:
+        enum struct Mode
+        {
+            Pipelined,
+            Tuned,
+            DryRun
+        };
+
+        using BodyT = std::function<void()>;
+
+        // Returns true so that the result can initialize a static at namespace scope
+        static bool add(Mode        mode,
+                        char const* suiteName,
+                        std::string testName,
+                        char const* file,
+                        int         line,
+                        BodyT       body)
+        {
+            entries().push_back(
+                {mode, suiteName, std::move(testName), file, line, std::move(body)});
+            return true;
+        }
+
+        // Must run before RUN_ALL_TESTS()
+        static void registerTests(Mode mode)
+        {
+            for(auto const& entry : entries())
+            {
+                if(entry.mode != mode)
+                {
+                    continue;
+                }
+
+                auto body = entry.body;
+                ::testing::RegisterTest(entry.suiteName,
+                                        entry.testName.c_str(),
+                                        nullptr,
+                                        nullptr,
+                                        entry.file,
+                                        entry.line,
+                                        [body]() -> ::testing::Test* { return new Test(body); });
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            Mode        mode;
+            char const* suiteName;
+            std::string testName;
+            char const* file;
+            int         line;
+            BodyT       body;
+        };
+
+        class Test : public ::testing::Test
+        {
+        public:
+            explicit Test(BodyT body)
+                : mBody(std::move(body))
+            {
+            }
+
+            void TestBody() override
+            {
+                mBody();
+            }
+
+        private:
+            BodyT mBody;
+        };
+
+        static std::vector<Entry>& entries()
+        {
+            static std::vector<Entry> sEntries;
+            return sEntries;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEFERRED_TESTS_HPP
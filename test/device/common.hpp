@@ -30,6 +30,8 @@
 #include <rocwmma/internal/types.hpp>
 #include <rocwmma/rocwmma.hpp>
 
+#include "compare_result.hpp"
+
 namespace rocwmma
 {
     template <typename T>
@@ -39,6 +41,13 @@ namespace rocwmma
         return static_cast<double>(val);
     }
 
+    // Complex elements convert part-wise
+    template <typename T>
+    __device__ inline complex_t<float64_t> toDouble(complex_t<T> const& val)
+    {
+        return complex_t<float64_t>(toDouble(val.real), toDouble(val.imag));
+    }
+
     __device__ inline uint32_t rowMjr(uint32_t row, uint32_t col, uint32_t ld)
     {
         return row * ld + col;
@@ -165,6 +174,66 @@ namespace rocwmma
         }
     }
 
+    // Single-pass comparison of two M x N matrices of any types and layouts.
+    // Each workgroup reduces its partial result in LDS and merges it into the
+    // global result with atomics, so no per-element error storage is needed.
+    template <typename TypeA,
+              typename TypeB,
+              typename LayoutA,
+              typename LayoutB,
+              uint32_t BlockSize>
+    __global__ __launch_bounds__(BlockSize) void compareEqualReduceKernel(
+        TypeA const*        matrixA,
+        TypeB const*        matrixB,
+        CompareAccumulator* result,
+        uint32_t            m,
+        uint32_t            n,
+        uint32_t            lda,
+        uint32_t            ldb,
+        float64_t           threshold)
+    {
+        __shared__ CompareAccumulator partials[BlockSize];
+
+        auto     local    = compareAccumulatorInit();
+        uint64_t elements = static_cast<uint64_t>(m) * n;
+        uint64_t stride   = static_cast<uint64_t>(gridDim.x) * blockDim.x;
+
+        for(uint64_t idx = blockIdx.x * blockDim.x + threadIdx.x; idx < elements; idx += stride)
+        {
+            uint32_t rowIdx = idx / n;
+            uint32_t colIdx = idx % n;
+
+            uint32_t indexA = std::is_same<LayoutA, row_major>::value
+                                  ? rowMjr(rowIdx, colIdx, lda)
+                                  : colMjr(rowIdx, colIdx, lda);
+            uint32_t indexB = std::is_same<LayoutB, row_major>::value
+                                  ? rowMjr(rowIdx, colIdx, ldb)
+                                  : colMjr(rowIdx, colIdx, ldb);
+
+            compareAccumulate(
+                local, idx, toDouble(matrixA[indexA]), toDouble(matrixB[indexB]), threshold);
+        }
+
+        partials[threadIdx.x] = local;
+        synchronize_workgroup();
+
+        for(uint32_t i = BlockSize >> 1; i > 0; i = i >> 1)
+        {
+            if(threadIdx.x < i)
+            {
+                compareMerge(partials[threadIdx.x], partials[threadIdx.x + i]);
+            }
+            synchronize_workgroup();
+        }
+
+        if(threadIdx.x == 0)
+        {
+            atomicMax(&result->maxRelativeError, partials[0].maxRelativeError);
+            atomicMin(&result->firstFailIdx, partials[0].firstFailIdx);
+            atomicOr(&result->flags, partials[0].flags);
+        }
+    }
+
     // fill kernel for M x N matrix with padding
     template <typename DataT, typename Layout>
     __global__ void fillWithPaddingKernel(
@@ -59,6 +59,20 @@ namespace rocwmma
         {
             return typename Base::KernelTrilFunc(trilReconstruct<DataT>);
         }
+
+    protected:
+        // The forward pass stages the whole fp32 interaction in global memory
+        // and reads its lower triangle back for the output
+        double modeledBytes() const final
+        {
+            auto bytes = Base::modeledBytes();
+            if(Base::passDirection == DlrmDirection_t::Forward)
+            {
+                auto m = static_cast<double>(Base::mM);
+                bytes += (m * m + m * (m - 1.0) / 2.0) * sizeof(float32_t) * Base::mB;
+            }
+            return bytes;
+        }
     };
 
     // This is the GeneratorImpl class
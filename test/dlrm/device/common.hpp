@@ -62,6 +62,24 @@ namespace rocwmma
             *dst = src;
     }
 
+    // Packed interaction features rounded up to whole tiles. The fused top MLP
+    // kernels consume the interaction in TILE_DIM steps: its pad features are
+    // zero in LDS, and the layer weights carry zero rows up to this count.
+    template <uint TILE_DIM>
+    __host__ __device__ constexpr inline uint fusedPaddedFeatures(uint features)
+    {
+        return (features + TILE_DIM - 1u) / TILE_DIM * TILE_DIM;
+    }
+
+    // Row stride of the packed interaction of one sample, as staged in LDS by
+    // the fused top MLP kernels. The 16 byte pad shifts consecutive samples
+    // across LDS banks while keeping rows aligned for vector access.
+    template <typename DataT>
+    __host__ __device__ constexpr inline uint fusedInteractionLd(uint paddedFeatures)
+    {
+        return paddedFeatures + 16u / sizeof(DataT);
+    }
+
     template <typename T, uint THREADBLOCK_SIZE>
     __global__ __launch_bounds__(THREADBLOCK_SIZE) void allclose_kernel(T*     a,
                                                                         T*     b,
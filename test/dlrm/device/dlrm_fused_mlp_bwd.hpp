@@ -0,0 +1,203 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_FUSED_MLP_BWD_HPP
+#define DLRM_FUSED_MLP_BWD_HPP
+
+#include <rocwmma/internal/utils.hpp>
+
+#include "./common.hpp"
+
+namespace rocwmma
+{
+
+    // Backward of dlrmFusedMlpFwd for the input gradients.
+    // Each workgroup takes TILE_DIM samples: the interaction gradient
+    // topGrad x weights^T is staged in LDS in packed form, its bottom MLP
+    // features are the bottom MLP gradient, and the reverse bmm reads the
+    // symmetric tril of each sample straight from there. Neither the
+    // interaction gradient nor the reconstructed m x m tril reach global memory.
+    // weights is padded as for dlrmFusedMlpFwd: the pad features get a zero
+    // gradient in LDS that is never read back.
+    template <typename DataT, uint TILE_DIM>
+    __global__ void __launch_bounds__(128, 1) dlrmFusedMlpBwd(const DataT* __restrict input,
+                                                              const DataT* __restrict weights,
+                                                              const DataT* __restrict topGrad,
+                                                              DataT* __restrict grad,
+                                                              DataT* __restrict bottomMlpGrad,
+                                                              uint m,
+                                                              uint k,
+                                                              uint n,
+                                                              uint b,
+                                                              uint inputBatchOffset)
+    {
+        using FragA   = fragment<matrix_a, TILE_DIM, TILE_DIM, TILE_DIM, DataT, row_major>;
+        using FragB   = fragment<matrix_b, TILE_DIM, TILE_DIM, TILE_DIM, DataT, row_major>;
+        using FragWT  = fragment<matrix_b, TILE_DIM, TILE_DIM, TILE_DIM, DataT, col_major>;
+        using FragC   = fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, DataT>;
+        using FragAcc = fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, float32_t>;
+
+        auto features       = k + ((m * (m - 1)) >> 1);
+        auto paddedFeatures = fusedPaddedFeatures<TILE_DIM>(features);
+        auto ldsLd          = fusedInteractionLd<DataT>(paddedFeatures);
+        auto waveCount      = blockDim.x / Constants::AMDGCN_WAVE_SIZE;
+        auto waveIdx        = threadIdx.x / Constants::AMDGCN_WAVE_SIZE;
+        auto laneIdx        = threadIdx.x % Constants::AMDGCN_WAVE_SIZE;
+        auto sampleBase     = blockIdx.y * TILE_DIM;
+
+        // LDS holds the packed interaction gradient of the samples, one row
+        // each, followed by a tile per wave to unpack the tril
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto* ldsInteractionGrad = reinterpret_cast<DataT*>(localMemPtr);
+        auto* ldsScratch = ldsInteractionGrad + TILE_DIM * ldsLd + waveIdx * TILE_DIM * TILE_DIM;
+
+        // Interaction gradient: waves take feature tiles of topGrad x weights^T
+        for(uint feature = waveIdx * TILE_DIM; feature < paddedFeatures;
+            feature += waveCount * TILE_DIM)
+        {
+            auto fragAcc = FragAcc();
+            fill_fragment(fragAcc, static_cast<float32_t>(0));
+
+            // A steps BlockK through the samples' top gradient rows,
+            // B through the weights rows of the features
+            auto* addrA = topGrad + sampleBase * n;
+            auto* addrB = weights + feature * n;
+
+            for(uint step = 0; step < n / TILE_DIM; step++)
+            {
+                auto fragA = FragA();
+                auto fragB = FragWT();
+
+                load_matrix_sync(fragA, addrA, n);
+                load_matrix_sync(fragB, addrB, n);
+                mma_sync(fragAcc, fragA, fragB, fragAcc);
+
+                addrA += TILE_DIM;
+                addrB += TILE_DIM;
+            }
+
+            auto fragC = FragC();
+
+#pragma unroll
+            for(int i = 0; i < fragC.num_elements; i++)
+            {
+                fragC.x[i] = static_cast<DataT>(fragAcc.x[i]);
+            }
+
+            store_matrix_sync(ldsInteractionGrad + feature, fragC, ldsLd, mem_row_major);
+
+            // Bottom MLP features pass their gradient through
+            if(feature < k)
+            {
+                store_matrix_sync(
+                    bottomMlpGrad + sampleBase * k + feature, fragC, k, mem_row_major);
+            }
+        }
+
+        // Wait for LDS write before accessing
+        synchronize_workgroup();
+
+        // Reverse bmm of each sample: waves take output tiles of the m x k
+        // gradient. Loop counts are uniform over the waves to keep the
+        // barriers aligned.
+        auto tilesM     = m / TILE_DIM;
+        auto tilesK     = k / TILE_DIM;
+        auto items      = TILE_DIM * tilesM * tilesK;
+        auto iterations = (items + waveCount - 1) / waveCount;
+
+        for(uint iter = 0; iter < iterations; iter++)
+        {
+            auto item  = iter * waveCount + waveIdx;
+            auto valid = item < items;
+
+            auto sample = item / (tilesM * tilesK);
+            auto tileI  = (item / tilesK) % tilesM;
+            auto tileK  = item % tilesK;
+
+            auto* rowGrad         = ldsInteractionGrad + sample * ldsLd + k;
+            auto* inputWithOffset = input + (sampleBase + sample) * inputBatchOffset;
+
+            auto fragAcc = FragAcc();
+            fill_fragment(fragAcc, static_cast<float32_t>(0));
+
+            for(uint tileH = 0; tileH < tilesM; tileH++)
+            {
+                // Unpack the tril tile (tileI, tileH) with its transposed copy
+                // above the diagonal and zeros on it
+                if(valid)
+                {
+                    for(uint i = laneIdx; i < TILE_DIM * TILE_DIM; i += Constants::AMDGCN_WAVE_SIZE)
+                    {
+                        auto row = tileI * TILE_DIM + i / TILE_DIM;
+                        auto col = tileH * TILE_DIM + i % TILE_DIM;
+
+                        ldsScratch[i] = (row > col)   ? rowGrad[((row * (row - 1)) >> 1) + col]
+                                        : (row < col) ? rowGrad[((col * (col - 1)) >> 1) + row]
+                                                      : static_cast<DataT>(0);
+                    }
+                }
+
+                // Wait for LDS write before accessing
+                synchronize_workgroup();
+
+                if(valid)
+                {
+                    auto fragA = FragA();
+                    auto fragB = FragB();
+
+                    load_matrix_sync(fragA, ldsScratch, TILE_DIM);
+                    load_matrix_sync(fragB,
+                                     inputWithOffset + tileH * TILE_DIM * k + tileK * TILE_DIM,
+                                     k);
+                    mma_sync(fragAcc, fragA, fragB, fragAcc);
+                }
+
+                // Wait for the scratch to be read before re-use
+                synchronize_workgroup();
+            }
+
+            if(valid)
+            {
+                auto fragC = FragC();
+
+#pragma unroll
+                for(int i = 0; i < fragC.num_elements; i++)
+                {
+                    fragC.x[i] = static_cast<DataT>(fragAcc.x[i]);
+                }
+
+                auto* gradWithOffset = grad + (sampleBase + sample) * inputBatchOffset;
+                store_matrix_sync(gradWithOffset + tileI * TILE_DIM * k + tileK * TILE_DIM,
+                                  fragC,
+                                  k,
+                                  mem_row_major);
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // DLRM_FUSED_MLP_BWD_HPP
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_FUSED_MLP_FWD_HPP
+#define DLRM_FUSED_MLP_FWD_HPP
+
+#include <rocwmma/internal/utils.hpp>
+
+#include "./common.hpp"
+
+namespace rocwmma
+{
+
+    // Interaction fused with the first layer of the top MLP.
+    // Each workgroup takes TILE_DIM samples: it builds their packed interaction
+    // (the bottom MLP row, then the lower triangle of each m x m dot product)
+    // in LDS and multiplies it with the layer weights (features x n, row major)
+    // straight from there. The interaction is never written to global memory.
+    // Each wave produces TILES_N output tiles of the TILE_DIM x n layer output.
+    // Features are padded to whole tiles, so weights holds
+    // fusedPaddedFeatures<TILE_DIM>(features) rows, the pad rows zero.
+    template <typename DataT, uint TILE_DIM, uint TILES_N>
+    __global__ void __launch_bounds__(128, 1) dlrmFusedMlpFwd(const DataT* __restrict input,
+                                                              const DataT* __restrict weights,
+                                                              DataT* __restrict output,
+                                                              uint m,
+                                                              uint k,
+                                                              uint n,
+                                                              uint b,
+                                                              uint inputBatchOffset)
+    {
+        using FragA     = fragment<matrix_a, TILE_DIM, TILE_DIM, TILE_DIM, DataT, row_major>;
+        using FragB     = fragment<matrix_b, TILE_DIM, TILE_DIM, TILE_DIM, DataT, row_major>;
+        using FragGramB = fragment<matrix_b, TILE_DIM, TILE_DIM, TILE_DIM, DataT, col_major>;
+        using FragC     = fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, DataT>;
+        using FragAcc   = fragment<accumulator, TILE_DIM, TILE_DIM, TILE_DIM, float32_t>;
+
+        auto features       = k + ((m * (m - 1)) >> 1);
+        auto paddedFeatures = fusedPaddedFeatures<TILE_DIM>(features);
+        auto ldsLd          = fusedInteractionLd<DataT>(paddedFeatures);
+        auto waveCount      = blockDim.x / Constants::AMDGCN_WAVE_SIZE;
+        auto waveIdx        = threadIdx.x / Constants::AMDGCN_WAVE_SIZE;
+        auto laneIdx        = threadIdx.x % Constants::AMDGCN_WAVE_SIZE;
+        auto sampleBase     = blockIdx.y * TILE_DIM;
+
+        // LDS holds the packed interaction of the samples, one row each,
+        // followed by an fp32 tile per wave to unpack the dot products
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto* ldsInteraction = reinterpret_cast<DataT*>(localMemPtr);
+        auto* ldsScratch     = reinterpret_cast<float32_t*>(ldsInteraction + TILE_DIM * ldsLd)
+                           + waveIdx * TILE_DIM * TILE_DIM;
+
+        // Bottom MLP features come first
+        for(uint i = threadIdx.x; i < TILE_DIM * k; i += blockDim.x)
+        {
+            auto sample = i / k;
+            auto col    = i % k;
+            ldsInteraction[sample * ldsLd + col]
+                = input[(sampleBase + sample) * inputBatchOffset + col];
+        }
+
+        // Pad features are zero, as are their weights rows
+        auto padCount = paddedFeatures - features;
+        for(uint i = threadIdx.x; i < TILE_DIM * padCount; i += blockDim.x)
+        {
+            ldsInteraction[(i / padCount) * ldsLd + features + i % padCount]
+                = static_cast<DataT>(0);
+        }
+
+        // Dot product tiles on or below the diagonal, for every sample.
+        // Loop counts are uniform over the waves to keep the barriers aligned.
+        auto tilesM     = m / TILE_DIM;
+        auto pairs      = (tilesM * (tilesM + 1)) >> 1;
+        auto items      = TILE_DIM * pairs;
+        auto iterations = (items + waveCount - 1) / waveCount;
+
+        for(uint iter = 0; iter < iterations; iter++)
+        {
+            auto item  = iter * waveCount + waveIdx;
+            auto valid = item < items;
+
+            uint sample = 0, tileI = 0, tileJ = 0;
+            if(valid)
+            {
+                sample    = item / pairs;
+                auto pair = item % pairs;
+                while(((tileI + 1) * (tileI + 2)) / 2 <= pair)
+                {
+                    tileI++;
+                }
+                tileJ = pair - ((tileI * (tileI + 1)) >> 1);
+
+                auto fragAcc = FragAcc();
+                fill_fragment(fragAcc, static_cast<float32_t>(0));
+
+                // A steps BlockK through rows tileI, B through rows tileJ
+                auto* inputWithOffset = input + (sampleBase + sample) * inputBatchOffset;
+                auto* addrA           = inputWithOffset + tileI * TILE_DIM * k;
+                auto* addrB           = inputWithOffset + tileJ * TILE_DIM * k;
+
+                for(uint step = 0; step < k / TILE_DIM; step++)
+                {
+                    auto fragA = FragA();
+                    auto fragB = FragGramB();
+
+                    load_matrix_sync(fragA, addrA, k);
+                    load_matrix_sync(fragB, addrB, k);
+                    mma_sync(fragAcc, fragA, fragB, fragAcc);
+
+                    addrA += TILE_DIM;
+                    addrB += TILE_DIM;
+                }
+
+                store_matrix_sync(ldsScratch, fragAcc, TILE_DIM, mem_row_major);
+            }
+
+            // Wait for LDS write before accessing
+            synchronize_workgroup();
+
+            // Pack the lower triangular of the tile into the sample's row
+            if(valid)
+            {
+                for(uint i = laneIdx; i < TILE_DIM * TILE_DIM; i += Constants::AMDGCN_WAVE_SIZE)
+                {
+                    auto row = tileI * TILE_DIM + i / TILE_DIM;
+                    auto col = tileJ * TILE_DIM + i % TILE_DIM;
+                    if(row > col)
+                    {
+                        ldsInteraction[sample * ldsLd + k + ((row * (row - 1)) >> 1) + col]
+                            = static_cast<DataT>(ldsScratch[i]);
+                    }
+                }
+            }
+
+            // Wait for the scratch to be read before re-use
+            synchronize_workgroup();
+        }
+
+        // Top MLP layer over the staged interaction
+        auto colBase = (blockIdx.x * waveCount + waveIdx) * TILES_N * TILE_DIM;
+
+        FragAcc fragsAcc[TILES_N];
+        for(uint t = 0; t < TILES_N; t++)
+        {
+            fill_fragment(fragsAcc[t], static_cast<float32_t>(0));
+        }
+
+        for(uint feature = 0; feature < paddedFeatures; feature += TILE_DIM)
+        {
+            auto fragA = FragA();
+            load_matrix_sync(fragA, ldsInteraction + feature, ldsLd);
+
+            for(uint t = 0; t < TILES_N; t++)
+            {
+                auto col = colBase + t * TILE_DIM;
+                if(col < n)
+                {
+                    auto fragB = FragB();
+                    load_matrix_sync(fragB, weights + feature * n + col, n);
+                    mma_sync(fragsAcc[t], fragA, fragB, fragsAcc[t]);
+                }
+            }
+        }
+
+        // Store the layer output
+        for(uint t = 0; t < TILES_N; t++)
+        {
+            auto col = colBase + t * TILE_DIM;
+            if(col < n)
+            {
+                auto fragC = FragC();
+
+#pragma unroll
+                for(int i = 0; i < fragC.num_elements; i++)
+                {
+                    fragC.x[i] = static_cast<DataT>(fragsAcc[t].x[i]);
+                }
+
+                store_matrix_sync(output + sampleBase * n + col, fragC, n, mem_row_major);
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // DLRM_FUSED_MLP_FWD_HPP
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_FUSED_MLP_KERNEL_BASE_HPP
+#define DLRM_FUSED_MLP_KERNEL_BASE_HPP
+
+#include "dlrm_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Typed DLRM kernel of the interaction fused with the first top MLP layer.
+    // Shares the KernelI workflow and reporting of DlrmKernelBase, with the
+    // layer weights and top gradient added to the problem.
+    template <uint32_t TileSize, typename DataT>
+    struct DlrmFusedMlpKernelBase : public KernelI
+    {
+    protected: // Types
+        // Shared access to DLRM storage
+        using DataStorage = DlrmResource<DataT>;
+        // Using Hip device backend
+        using DeviceInfo = HipDevice;
+
+        // Interface to forward device kernel
+        using KernelFwdFunc = void (*)(const DataT* __restrict, // input
+                                       const DataT* __restrict, // weights
+                                       DataT* __restrict, // output
+                                       uint32_t, // m
+                                       uint32_t, // k
+                                       uint32_t, // n
+                                       uint32_t, // b
+                                       uint32_t); // inputBatchOffset
+
+        // Interface to backwards device kernel
+        using KernelBwdFunc = void (*)(const DataT* __restrict, // input
+                                       const DataT* __restrict, // weights
+                                       const DataT* __restrict, // topGrad
+                                       DataT* __restrict, // grad
+                                       DataT* __restrict, // bottomMlpGrad
+                                       uint32_t, // m
+                                       uint32_t, // k
+                                       uint32_t, // n
+                                       uint32_t, // b
+                                       uint32_t); // inputBatchOffset
+
+        // Output tiles of the top MLP layer per wave in the forward pass
+        static constexpr uint32_t TilesPerWaveN = 8;
+
+    protected:
+        DlrmFusedMlpKernelBase();
+        virtual ~DlrmFusedMlpKernelBase();
+
+        // Kernels MUST provide the device kernel function.
+        virtual KernelFwdFunc kernelFwdImpl() const = 0;
+        virtual KernelBwdFunc kernelBwdImpl() const = 0;
+
+        // Packed interaction features rounded up to whole tiles
+        uint32_t paddedFeatures() const;
+
+        // Kernel launch parameters
+        virtual uint32_t ldsUsage() const;
+        virtual dim3     gridDim() const;
+        virtual dim3     blockDim() const;
+
+        // Kernel run checks.
+        // True = run test
+        // False = skip test
+        virtual bool checkDevice() const;
+        virtual bool checkSizes() const;
+        virtual bool checkLds() const;
+
+        // Reset all members to default values
+        virtual void reset();
+
+        // Modeled global traffic of one run in bytes, for the roofline columns
+        virtual double modeledBytes() const;
+
+    public:
+        // KernelI interface fulfillment
+        virtual void          setup(ProblemParams const& problem) override;
+        virtual void          exec() override;
+        virtual void          validateResults() override;
+        virtual void          reportResults() override;
+        virtual void          tearDown() override;
+        virtual HipResource*  getResource() override;
+        virtual std::ostream& printHeader(std::ostream& stream = std::cout) const override;
+        virtual std::ostream& printKernel(std::ostream& stream = std::cout) const override;
+
+    protected:
+        // Problem params for kernel
+        uint32_t mTBlockX, mTBlockY;
+        uint32_t mM, mK, mN, mB;
+
+        // Packed interaction features per sample
+        uint32_t mFeatures;
+
+        // Execution flow control
+        uint32_t mRepeats;
+        bool     mRunFlag          = true;
+        bool     mValidationResult = false;
+        double   mMaxRelativeError;
+
+        DlrmDirection_t passDirection = DlrmDirection_t::Forward;
+
+        // Performance
+        float64_t mTotalGFlops, mMeasuredTFlopsPerSec;
+        float64_t mElapsedTimeMs;
+        int32_t   mEfficiency;
+        Roofline  mRoofline;
+    };
+
+} // namespace rocwmma
+
+#include "dlrm_fused_mlp_kernel_base_impl.hpp"
+
+#endif // DLRM_FUSED_MLP_KERNEL_BASE_HPP
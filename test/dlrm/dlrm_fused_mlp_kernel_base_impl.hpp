@@ -0,0 +1,556 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_FUSED_MLP_KERNEL_BASE_IMPL_HPP
+#define DLRM_FUSED_MLP_KERNEL_BASE_IMPL_HPP
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <tuple>
+
+#include <hip/hip_ext.h>
+#include <hip/hip_runtime.h>
+#include <hip/hip_runtime_api.h>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/constants.hpp>
+#include <rocwmma/internal/utils.hpp>
+
+#include "../common.hpp"
+#include "./common.hpp"
+#include "device/common.hpp"
+#include "dlrm_fused_mlp_kernel_base.hpp"
+#include "performance.hpp"
+#include "rocwmma_options.hpp"
+
+// Library includes
+
+#if ROCWMMA_VALIDATION_TESTS
+#include "reference.hpp" // Vanilla CPU kernel
+#endif // ROCWMMA_VALIDATION_TESTS
+
+namespace rocwmma
+{
+
+    template <uint32_t TileSize, typename DataT>
+    DlrmFusedMlpKernelBase<TileSize, DataT>::DlrmFusedMlpKernelBase()
+    {
+        reset();
+    }
+    template <uint32_t TileSize, typename DataT>
+    DlrmFusedMlpKernelBase<TileSize, DataT>::~DlrmFusedMlpKernelBase()
+    {
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    uint32_t DlrmFusedMlpKernelBase<TileSize, DataT>::paddedFeatures() const
+    {
+        return fusedPaddedFeatures<TileSize>(mFeatures);
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    uint32_t DlrmFusedMlpKernelBase<TileSize, DataT>::ldsUsage() const
+    {
+        // Packed interaction (or its gradient) of TileSize samples, then one
+        // unpacking tile per wave: fp32 dot products forward, DataT tril backward
+        auto waves       = mTBlockX / DeviceInfo::instance()->warpSize();
+        auto interaction = TileSize * fusedInteractionLd<DataT>(paddedFeatures()) * sizeof(DataT);
+        auto scratchSize = passDirection == DlrmDirection_t::Forward ? sizeof(float32_t)
+                                                                     : sizeof(DataT);
+        return interaction + waves * TileSize * TileSize * scratchSize;
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    dim3 DlrmFusedMlpKernelBase<TileSize, DataT>::gridDim() const
+    {
+        auto waves = mTBlockX / DeviceInfo::instance()->warpSize();
+
+        if(passDirection == DlrmDirection_t::Forward)
+        {
+            return dim3(ceilDiv(mN, TileSize * TilesPerWaveN * waves), mB / TileSize);
+        }
+        else
+        {
+            return dim3(1, mB / TileSize);
+        }
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    dim3 DlrmFusedMlpKernelBase<TileSize, DataT>::blockDim() const
+    {
+        return dim3(mTBlockX);
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    bool DlrmFusedMlpKernelBase<TileSize, DataT>::checkDevice() const
+    {
+        auto& deviceInfo = DeviceInfo::instance();
+        auto  deviceArch = deviceInfo->getGcnArch();
+
+        // Arch
+        auto isGfx908 = deviceArch == DeviceInfo::GFX908;
+        auto isGfx11  = (deviceArch == DeviceInfo::GFX1100) || (deviceArch == DeviceInfo::GFX1101)
+                       || (deviceArch == DeviceInfo::GFX1102);
+
+        auto isGfx12 = (deviceArch == DeviceInfo::GFX1200) || (deviceArch == DeviceInfo::GFX1201);
+
+        // Datatypes
+        auto isF64 = std::is_same<DataT, float64_t>::value;
+
+#if !ROCWMMA_TESTS_NO_HALF
+        auto isH16 = std::is_same<DataT, hfloat16_t>::value;
+#else
+        auto isH16 = false;
+#endif // !ROCWMMA_NO_HALF
+        auto isF16  = std::is_same<DataT, float16_t>::value || isH16;
+        auto isBF16 = (std::is_same<DataT, bfloat16_t>::value);
+        auto isI8   = (std::is_same<DataT, int8_t>::value);
+
+        // Block size
+        auto is16x16 = (TileSize == 16);
+
+        // No unsupported devices
+        bool unsupportedDeviceCheck = !(deviceArch == DeviceInfo::UNSUPPORTED_ARCH);
+
+        // gfx908 doesn't support f64
+        bool gfx908F64Check = !(isGfx908 && isF64);
+
+        // gfx11 only supports f16, i8 and bf16 inputs with block size 16
+        bool gfx11Check = !(isGfx11 && ((!isF16 && !isBF16 && !isI8) || !is16x16));
+
+        // gfx12 only supports f16, i8 and bf16 inputs with block size 16
+        bool gfx12Check = !(isGfx12 && ((!isF16 && !isBF16 && !isI8) || !is16x16));
+
+        return unsupportedDeviceCheck && gfx908F64Check && gfx11Check && gfx12Check;
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    bool DlrmFusedMlpKernelBase<TileSize, DataT>::checkSizes() const
+    {
+        // Whole tiles of samples and layer outputs. The interaction features
+        // need not be: the kernels pad them to whole tiles with zero weights.
+        return (mM >= TileSize && (mM % TileSize == 0) && mK >= TileSize && (mK % TileSize == 0)
+                && mN >= TileSize && (mN % TileSize == 0) && mB >= TileSize
+                && (mB % TileSize == 0) && (mTBlockX % TileSize == 0));
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    bool DlrmFusedMlpKernelBase<TileSize, DataT>::checkLds() const
+    {
+        return ldsUsage() <= DeviceInfo::instance()->sharedMemSize();
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    void DlrmFusedMlpKernelBase<TileSize, DataT>::reset()
+    {
+        mTBlockX = mTBlockY = 0;
+        mM = mK = mN = mB = 0;
+        mFeatures         = 0;
+        mRepeats =
+#if ROCWMMA_VALIDATION_TESTS
+            1;
+#else
+            5;
+#endif // ROCWMMA_VALIDATION_TESTS
+
+        mRunFlag = true;
+
+        mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
+        mElapsedTimeMs                       = 0.0;
+        mEfficiency                          = -1;
+        mRoofline                            = Roofline();
+
+        passDirection = DlrmDirection_t::Forward;
+
+        mValidationResult = false;
+        mMaxRelativeError = 0.0;
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    HipResource* DlrmFusedMlpKernelBase<TileSize, DataT>::getResource()
+    {
+        return DataStorage::instance().get();
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    double DlrmFusedMlpKernelBase<TileSize, DataT>::modeledBytes() const
+    {
+        // Each workgroup reads the weights once for its TileSize samples.
+        // The packed interaction only lives in LDS, so unlike the unfused
+        // interaction and GEMM it adds no global traffic.
+        auto m        = static_cast<double>(mM);
+        auto k        = static_cast<double>(mK);
+        auto n        = static_cast<double>(mN);
+        auto b        = static_cast<double>(mB);
+        auto weights  = static_cast<double>(paddedFeatures()) * n * b / TileSize;
+        auto elements = 0.0;
+
+        if(passDirection == DlrmDirection_t::Forward)
+        {
+            // Input, weights and the layer output
+            elements = m * k * b + weights + n * b;
+        }
+        else
+        {
+            // Input, weights and top gradient, then the gradient and the
+            // bottom MLP gradient
+            elements = m * k * b + weights + n * b + m * k * b + k * b;
+        }
+        return elements * sizeof(DataT);
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    std::ostream& DlrmFusedMlpKernelBase<TileSize, DataT>::printHeader(std::ostream& stream) const
+    {
+        stream << "TileSize, "
+               << "DataT, "
+               << "Direction, "
+               << "MatM, MatK, MatN, MatB, "
+#if ROCWMMA_VALIDATION_TESTS
+               << "maxRelativeDiff, "
+               << "tolerance, "
+#endif // ROCWMMA_VALIDATION_TESTS
+               << "elapsedMs, "
+               << "Problem Size(GFlops), "
+               << "TFlops/s, "
+               << "Efficiency(%), ";
+        return printRooflineHeader(stream) << "Result" << std::endl;
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    std::ostream& DlrmFusedMlpKernelBase<TileSize, DataT>::printKernel(std::ostream& stream) const
+    {
+        if(!mRunFlag)
+        {
+            stream << TileSize << ", " << dataTypeToString<DataT>() << ", "
+                   << (passDirection == DlrmDirection_t::Forward ? "Forwards" : "Backwards") << ", "
+                   << mM << ", " << mK << ", " << mN << ", " << mB << ", "
+
+#if ROCWMMA_VALIDATION_TESTS
+                   << "n/a, "
+#endif // ROCWMMA_VALIDATION_TESTS
+                   << "n/a, n/a, n/a, n/a, ";
+            return printRooflineSkipped(stream) << "SKIPPED" << std::endl;
+        }
+        else
+        {
+            stream << TileSize << ", " << dataTypeToString<DataT>() << ", "
+                   << (passDirection == DlrmDirection_t::Forward ? "Forwards" : "Backwards") << ", "
+                   << mM << ", " << mK << ", " << mN << ", " << mB << ", "
+
+#if ROCWMMA_VALIDATION_TESTS
+                   << mMaxRelativeError << ", "
+#endif // ROCWMMA_VALIDATION_TESTS
+                   << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
+                   << ", " << mEfficiency << ", ";
+            return printRoofline(stream, mRoofline)
+#if ROCWMMA_VALIDATION_TESTS
+                   << (mValidationResult ? "PASSED" : "FAILED")
+#else
+                   << "BENCH"
+#endif // ROCWMMA_VALIDATION_TESTS
+                   << std::endl;
+        }
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    void DlrmFusedMlpKernelBase<TileSize, DataT>::setup(ProblemParams const& problem)
+    {
+        // Reset the flags in case of multiple runs
+        mRunFlag = true;
+
+        // Format incoming problem parameters
+        std::tie(mTBlockX, mTBlockY)
+            = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.threadBlockSize)),
+                       static_cast<uint32_t const&>(std::get<1>(problem.threadBlockSize)));
+        std::tie(mM, mK, mB)
+            = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.problemSize)),
+                       static_cast<uint32_t const&>(std::get<1>(problem.problemSize)),
+                       static_cast<uint32_t const&>(std::get<2>(problem.problemSize)));
+        mN = static_cast<uint32_t>(problem.topMlpSize);
+
+        mFeatures = ((mM * (mM - 1)) / 2) + mK;
+
+        // Determine whether to run forward or backward pass
+        passDirection = problem.passDirection;
+
+        mRunFlag &= checkDevice();
+        mRunFlag &= checkSizes();
+        mRunFlag &= checkLds();
+
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+
+            // Initialize matrix storage: weights are padded to whole tiles of features
+            dataInstance->resizeFusedStorage(
+                problem.problemSize, problem.topMlpSize, paddedFeatures());
+
+            // Initialize matrix data on device and transfer to host for validation.
+            // The weights pad rows stay zero.
+            auto weightElements = static_cast<int64_t>(mFeatures) * mN;
+            auto padElements    = static_cast<int64_t>(paddedFeatures() - mFeatures) * mN;
+            MatrixUtil<row_major>::fillLaunchKernel(dataInstance->deviceInput().get(), mM, mK, mB);
+            MatrixUtil<row_major>::fillLaunchKernel(
+                dataInstance->deviceWeights().get(), mFeatures, mN, 1);
+            CHECK_HIP_ERROR(hipMemset(dataInstance->deviceWeights().get() + weightElements,
+                                      0,
+                                      padElements * sizeof(DataT)));
+            if(passDirection == DlrmDirection_t::Forward)
+            {
+#if ROCWMMA_VALIDATION_TESTS
+                dataInstance->copyDeviceToHostFusedFwdInput();
+#endif // ROCWMMA_VALIDATION_TESTS
+            }
+            else
+            {
+                MatrixUtil<row_major>::fillLaunchKernel(
+                    dataInstance->deviceTopGrad().get(), 1, mN, mB);
+#if ROCWMMA_VALIDATION_TESTS
+                dataInstance->copyDeviceToHostFusedBwdInput();
+#endif // ROCWMMA_VALIDATION_TESTS
+            }
+        }
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    void DlrmFusedMlpKernelBase<TileSize, DataT>::exec()
+    {
+        if(mRunFlag)
+        {
+            uint inputBatchOffset = mM * mK;
+
+            std::function<void()> dlrmKernel;
+            if(passDirection == DlrmDirection_t::Forward)
+            {
+                dlrmKernel = [this, inputBatchOffset]() {
+                    auto& dataInstance = DataStorage::instance();
+                    hipExtLaunchKernelGGL((this->kernelFwdImpl()),
+                                          (this->gridDim()),
+                                          (this->blockDim()),
+                                          (this->ldsUsage()),
+                                          0,
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          dataInstance->deviceInput().get(),
+                                          dataInstance->deviceWeights().get(),
+                                          dataInstance->deviceTopOutput().get(),
+                                          mM,
+                                          mK,
+                                          mN,
+                                          mB,
+                                          inputBatchOffset);
+                };
+            }
+            else
+            {
+                dlrmKernel = [this, inputBatchOffset]() {
+                    auto& dataInstance = DataStorage::instance();
+                    hipExtLaunchKernelGGL((this->kernelBwdImpl()),
+                                          (this->gridDim()),
+                                          (this->blockDim()),
+                                          (this->ldsUsage()),
+                                          0,
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          dataInstance->deviceInput().get(),
+                                          dataInstance->deviceWeights().get(),
+                                          dataInstance->deviceTopGrad().get(),
+                                          dataInstance->deviceGrad().get(),
+                                          dataInstance->deviceBottomMlpGrad().get(),
+                                          mM,
+                                          mK,
+                                          mN,
+                                          mB,
+                                          inputBatchOffset);
+                };
+            }
+
+            hipEvent_t startEvent, stopEvent;
+            CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+            CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+            CHECK_HIP_ERROR(hipEventRecord(startEvent));
+            for(uint32_t i = 0; i < mRepeats; ++i)
+            {
+                dlrmKernel();
+            }
+            CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+            auto timeMs = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+
+            // Calculate efficiency
+            auto& deviceInfo = DeviceInfo::instance();
+
+            auto devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<DataT>();
+
+            // Interaction bmm and layer GEMM forward; the transposed layer GEMM
+            // and reverse bmm backward
+            mElapsedTimeMs = float64_t(timeMs);
+            mTotalGFlops
+                = (passDirection == DlrmDirection_t::Forward)
+                      ? calculateGFlops(mM * mM, mB, mK) + calculateGFlops(mB, mN, mFeatures)
+                      : calculateGFlops(mB, mFeatures, mN) + calculateGFlops(mM * mK, mB, mM);
+            mMeasuredTFlopsPerSec
+                = mTotalGFlops / mElapsedTimeMs * static_cast<float64_t>(mRepeats);
+
+            mEfficiency = round(mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+
+            // Place the kernel on the roofline of the device
+            auto devicePeakGBs = deviceInfo->peakBandwidthGBs();
+            auto runTimeMs     = mElapsedTimeMs / static_cast<float64_t>(mRepeats);
+            mRoofline          = calculateRoofline(
+                mTotalGFlops, modeledBytes(), runTimeMs, devicePeakGFlopsPerSec, devicePeakGBs);
+
+            if(!RocwmmaOptions::instance()->rooflinePlot().empty())
+            {
+                std::stringstream label;
+                label << "DlrmFusedMlp"
+                      << (passDirection == DlrmDirection_t::Forward ? "Fwd" : "Bwd") << ", "
+                      << TileSize << ", " << mM << "x" << mK << "x" << mN << "x" << mB << ", "
+                      << dataTypeToString<DataT>();
+                appendRooflinePlotData(RocwmmaOptions::instance()->rooflinePlot(),
+                                       label.str(),
+                                       mTotalGFlops,
+                                       runTimeMs,
+                                       mRoofline,
+                                       devicePeakGFlopsPerSec,
+                                       devicePeakGBs);
+            }
+
+            CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+            CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+#if ROCWMMA_VALIDATION_TESTS
+
+            // Run reference CPU kernel
+            auto& dataInstance = DataStorage::instance();
+            if(passDirection == DlrmDirection_t::Forward)
+            {
+                dlrm_fused_mlp_fwd_CPU<DataT>(dataInstance->hostInput().get(),
+                                              dataInstance->hostWeights().get(),
+                                              dataInstance->hostTopOutputRef().get(),
+                                              mM,
+                                              mK,
+                                              mN,
+                                              mB);
+            }
+            else
+            {
+                dlrm_fused_mlp_bwd_CPU<DataT>(dataInstance->hostInput().get(),
+                                              dataInstance->hostWeights().get(),
+                                              dataInstance->hostTopGrad().get(),
+                                              dataInstance->hostBottomMlpGradRef().get(),
+                                              dataInstance->hostGradRef().get(),
+                                              mM,
+                                              mK,
+                                              mN,
+                                              mB);
+            }
+#endif // ROCWMMA_VALIDATION_TESTS
+        }
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    void DlrmFusedMlpKernelBase<TileSize, DataT>::validateResults()
+    {
+#if ROCWMMA_VALIDATION_TESTS
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+            if(passDirection == DlrmDirection_t::Forward)
+            {
+                auto reference = dataInstance->template allocDevice<DataT>(mN * mB);
+                dataInstance->copyData(reference, dataInstance->hostTopOutputRef(), mN * mB);
+
+                // The interaction is rounded to DataT before the layer in both,
+                // but its dot products may round differently
+                std::tie(mValidationResult, mMaxRelativeError)
+                    = compareEqualLaunchKernel<DataT, DataT>(dataInstance->deviceTopOutput().get(),
+                                                             reference.get(),
+                                                             1,
+                                                             mN,
+                                                             mB,
+                                                             10.0);
+
+                EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+            }
+            else
+            {
+                // Copy reference output gradient to device
+                auto reference0 = dataInstance->template allocDevice<DataT>(mM * mK * mB);
+                dataInstance->copyData(reference0, dataInstance->hostGradRef(), mM * mK * mB);
+
+                std::tie(mValidationResult, mMaxRelativeError)
+                    = compareEqualLaunchKernel<DataT, DataT>(
+                        dataInstance->deviceGrad().get(), reference0.get(), mM, mK, mB);
+
+                EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+
+                double maxRelativeError = mMaxRelativeError;
+
+                // Copy reference bottom mlp gradient to device
+                auto reference1 = dataInstance->template allocDevice<DataT>(mK * mB);
+                dataInstance->copyData(reference1, dataInstance->hostBottomMlpGradRef(), mK * mB);
+
+                std::tie(mValidationResult, mMaxRelativeError)
+                    = compareEqualLaunchKernel<DataT, DataT>(
+                        dataInstance->deviceBottomMlpGrad().get(), reference1.get(), 1, mK, mB);
+
+                EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+
+                mMaxRelativeError
+                    = (maxRelativeError > mMaxRelativeError) ? maxRelativeError : mMaxRelativeError;
+            }
+        }
+#endif
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    void DlrmFusedMlpKernelBase<TileSize, DataT>::reportResults()
+    {
+        if(!KernelI::sHeaderPrinted)
+        {
+            printHeader();
+            KernelI::sHeaderPrinted = true;
+        }
+        printKernel();
+    }
+
+    template <uint32_t TileSize, typename DataT>
+    void DlrmFusedMlpKernelBase<TileSize, DataT>::tearDown()
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // DLRM_FUSED_MLP_KERNEL_BASE_IMPL_HPP
@@ -36,6 +36,7 @@
 #include "common.hpp"
 #include "dlrm_resource.hpp"
 #include "hip_device.hpp"
+#include "roofline.hpp"
 
 namespace rocwmma
 {
@@ -54,6 +55,8 @@ namespace rocwmma
         std::pair<int64_t, int64_t>           threadBlockSize;
         std::tuple<int64_t, int64_t, int64_t> problemSize;
         DlrmDirection_t                       passDirection;
+        // Outputs of the fused top MLP layer, unused by the interaction alone
+        int64_t topMlpSize = 0;
     };
 
     // Typeless Kernel interface to use with testing harness.
@@ -148,6 +151,9 @@ namespace rocwmma
         // Reset all members to default values
         virtual void reset();
 
+        // Modeled global traffic of one run in bytes, for the roofline columns
+        virtual double modeledBytes() const;
+
     public:
         // KernelI interface fulfillment
         virtual void          setup(ProblemParams const& problem) override;
@@ -179,6 +185,7 @@ namespace rocwmma
         float64_t mTotalGFlops, mMeasuredTFlopsPerSec;
         float64_t mElapsedTimeMs;
         int32_t   mEfficiency;
+        Roofline  mRoofline;
     };
 
 } // namespace rocwmma
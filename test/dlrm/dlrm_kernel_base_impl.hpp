@@ -48,6 +48,7 @@
 #include "./common.hpp"
 #include "dlrm_kernel_base.hpp"
 #include "performance.hpp"
+#include "rocwmma_options.hpp"
 
 // Library includes
 
@@ -172,6 +173,7 @@ namespace rocwmma
         mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
         mElapsedTimeMs                       = 0.0;
         mEfficiency                          = -1;
+        mRoofline                            = Roofline();
 
         passDirection = DlrmDirection_t::Forward;
 
@@ -185,10 +187,37 @@ namespace rocwmma
         return DataStorage::instance().get();
     }
 
+    template <uint32_t TileSize, typename DataT>
+    double DlrmKernelBase<TileSize, DataT>::modeledBytes() const
+    {
+        // Each wave computes one TileSize x TileSize block of the interaction
+        auto tilesM   = static_cast<double>(ceilDiv(mM, TileSize));
+        auto tilesK   = static_cast<double>(ceilDiv(mK, TileSize));
+        auto m        = static_cast<double>(mM);
+        auto k        = static_cast<double>(mK);
+        auto tril     = m * (m - 1.0) / 2.0;
+        auto elements = 0.0;
+
+        if(passDirection == DlrmDirection_t::Forward)
+        {
+            // Input rows for both operands of each tile, the bottom MLP copy and
+            // the lower triangle of the output
+            elements = tilesM * tilesM * 2.0 * TileSize * k + 2.0 * k + tril;
+        }
+        else
+        {
+            // Tril reconstruction of the acc from the upstream gradient, then acc
+            // and input reads of each gradient tile, the gradient and the bottom
+            // MLP gradient copy
+            elements = tril + m * m + tilesM * tilesK * 2.0 * TileSize * m + m * k + 2.0 * k;
+        }
+        return elements * sizeof(DataT) * mB;
+    }
+
     template <uint32_t TileSize, typename DataT>
     std::ostream& DlrmKernelBase<TileSize, DataT>::printHeader(std::ostream& stream) const
     {
-        return stream << "TileSize, "
+        stream << "TileSize, "
                       << "DataT, "
                       << "Direction, "
                       << "MatM, MatK, MatB, "
@@ -199,7 +228,8 @@ namespace rocwmma
                       << "elapsedMs, "
                       << "Problem Size(GFlops), "
                       << "TFlops/s, "
-                      << "Efficiency(%)" << std::endl;
+                      << "Efficiency(%), ";
+        return printRooflineHeader(stream) << "Result" << std::endl;
     }
 
     template <uint32_t TileSize, typename DataT>
@@ -207,32 +237,34 @@ namespace rocwmma
     {
         if(!mRunFlag)
         {
-            return stream << TileSize << ", " << dataTypeToString<DataT>() << ", "
-                          << (passDirection == DlrmDirection_t::Forward ? "Forwards" : "Backwards")
-                          << ", " << mM << ", " << mK << ", " << mB << ", "
+            stream << TileSize << ", " << dataTypeToString<DataT>() << ", "
+                   << (passDirection == DlrmDirection_t::Forward ? "Forwards" : "Backwards") << ", "
+                   << mM << ", " << mK << ", " << mB << ", "
 
 #if ROCWMMA_VALIDATION_TESTS
-                          << "n/a, "
+                   << "n/a, "
 #endif // ROCWMMA_VALIDATION_TESTS
-                          << "n/a, n/a, n/a, n/a, SKIPPED" << std::endl;
+                   << "n/a, n/a, n/a, n/a, ";
+            return printRooflineSkipped(stream) << "SKIPPED" << std::endl;
         }
         else
         {
-            return stream << TileSize << ", " << dataTypeToString<DataT>() << ", "
-                          << (passDirection == DlrmDirection_t::Forward ? "Forwards" : "Backwards")
-                          << ", " << mM << ", " << mK << ", " << mB << ", "
+            stream << TileSize << ", " << dataTypeToString<DataT>() << ", "
+                   << (passDirection == DlrmDirection_t::Forward ? "Forwards" : "Backwards") << ", "
+                   << mM << ", " << mK << ", " << mB << ", "
 
 #if ROCWMMA_VALIDATION_TESTS
-                          << mMaxRelativeError << ", "
+                   << mMaxRelativeError << ", "
 #endif // ROCWMMA_VALIDATION_TESTS
-                          << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
-                          << ", " << mEfficiency << ", "
+                   << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
+                   << ", " << mEfficiency << ", ";
+            return printRoofline(stream, mRoofline)
 #if ROCWMMA_VALIDATION_TESTS
-                          << (mValidationResult ? "PASSED" : "FAILED")
+                   << (mValidationResult ? "PASSED" : "FAILED")
 #else
-                          << "BENCH"
+                   << "BENCH"
 #endif // ROCWMMA_VALIDATION_TESTS
-                          << std::endl;
+                   << std::endl;
         }
     }
 
@@ -420,6 +452,28 @@ namespace rocwmma
 
             mEfficiency = round(mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
 
+            // Place the kernel on the roofline of the device
+            auto devicePeakGBs = deviceInfo->peakBandwidthGBs();
+            auto runTimeMs     = mElapsedTimeMs / static_cast<float64_t>(mRepeats);
+            mRoofline          = calculateRoofline(
+                mTotalGFlops, modeledBytes(), runTimeMs, devicePeakGFlopsPerSec, devicePeakGBs);
+
+            if(!RocwmmaOptions::instance()->rooflinePlot().empty())
+            {
+                std::stringstream label;
+                label << "Dlrm"
+                      << (passDirection == DlrmDirection_t::Forward ? "Fwd" : "Bwd") << ", "
+                      << TileSize << ", " << mM << "x" << mK << "x" << mB << ", "
+                      << dataTypeToString<DataT>();
+                appendRooflinePlotData(RocwmmaOptions::instance()->rooflinePlot(),
+                                       label.str(),
+                                       mTotalGFlops,
+                                       runTimeMs,
+                                       mRoofline,
+                                       devicePeakGFlopsPerSec,
+                                       devicePeakGBs);
+            }
+
             CHECK_HIP_ERROR(hipEventDestroy(startEvent));
             CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
 
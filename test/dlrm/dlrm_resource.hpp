@@ -74,6 +74,11 @@ namespace rocwmma
         // Input, UpstreamGrad, Acc, Grad, BottomMlpGrad
         using ElementCountBwd = std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t>;
 
+        // Fused top MLP data sizes
+        // Input, Weights, Top, Grad, BottomMlpGrad, TopGrad
+        using ElementCountFused
+            = std::tuple<int64_t, int64_t, int64_t, int64_t, int64_t, int64_t>;
+
         enum : uint32_t
         {
             // Forward pass data size indices
@@ -86,6 +91,11 @@ namespace rocwmma
             Grad          = 3,
             BottomMlpGrad = 4,
 
+            // Fused top MLP data size indices
+            Weights = 1,
+            Top     = 2,
+            TopGrad = 5,
+
             // Problem size indices
             M = 0,
             K = 1,
@@ -122,6 +132,15 @@ namespace rocwmma
         void resizeBwdStorage(ProblemSize const& size);
         void resizeBwdStorage(ElementCountBwd const& size);
 
+        // Fused pass storage, for a top MLP layer of topMlpSize outputs.
+        // The layer weights hold weightRows >= the packed interaction features.
+        void copyDeviceToHostFusedFwdInput();
+        void copyDeviceToHostFusedBwdInput();
+        void resizeFusedStorage(ProblemSize const& size,
+                                int64_t            topMlpSize,
+                                int64_t            weightRows);
+        void resizeFusedStorage(ElementCountFused const& size);
+
         // Forward pass data
         HostPtrT<DataT>&     hostInput();
         HostPtrT<DataT>&     hostOutput();
@@ -145,11 +164,23 @@ namespace rocwmma
         DevicePtrT<DataT>& deviceBottomMlpGrad();
         DevicePtrT<DataT>& deviceAccBwd();
 
+        // Fused top MLP data
+        HostPtrT<DataT>& hostWeights();
+        HostPtrT<DataT>& hostTopOutput();
+        HostPtrT<DataT>& hostTopOutputRef();
+        HostPtrT<DataT>& hostTopGrad();
+
+        DevicePtrT<DataT>& deviceWeights();
+        DevicePtrT<DataT>& deviceTopOutput();
+        DevicePtrT<DataT>& deviceTopGrad();
+
         // Data sizes
-        ElementCountFwd currentElementCountFwd() const;
-        ElementCountBwd currentElementCountBwd() const;
-        ElementCountFwd maxFwdCapacity() const;
-        ElementCountBwd maxBwdCapacity() const;
+        ElementCountFwd   currentElementCountFwd() const;
+        ElementCountBwd   currentElementCountBwd() const;
+        ElementCountFused currentElementCountFused() const;
+        ElementCountFwd   maxFwdCapacity() const;
+        ElementCountBwd   maxBwdCapacity() const;
+        ElementCountFused maxFusedCapacity() const;
 
         // Reset sizes
         void reset() final;
@@ -166,11 +197,17 @@ namespace rocwmma
         HostPtrT<DataT>   mHostUpstreamGrad, mHostGrad, mHostGradRef, mHostBottomMlpGrad,
             mHostBottomMlpGradRef, mHostAccBwd;
 
+        // Fused top MLP data
+        DevicePtrT<DataT> mDeviceWeights, mDeviceTopOutput, mDeviceTopGrad;
+        HostPtrT<DataT>   mHostWeights, mHostTopOutput, mHostTopOutputRef, mHostTopGrad;
+
         ElementCountFwd mCurrentElementCountFwd;
-        ElementCountBwd mCurrentElementCountBwd;
+        ElementCountBwd   mCurrentElementCountBwd;
+        ElementCountFused mCurrentElementCountFused;
 
-        ElementCountFwd mMaxFwdCapacity;
-        ElementCountBwd mMaxBwdCapacity;
+        ElementCountFwd   mMaxFwdCapacity;
+        ElementCountBwd   mMaxBwdCapacity;
+        ElementCountFused mMaxFusedCapacity;
     };
 
 } // namespace rocwmma
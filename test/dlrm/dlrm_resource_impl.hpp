@@ -51,10 +51,19 @@ namespace rocwmma
         , mHostBottomMlpGrad(Base::template allocHost<DataT>(0))
         , mHostBottomMlpGradRef(Base::template allocHost<DataT>(0))
         , mHostAccBwd(Base::template allocHost<DataT>(0))
+        , mDeviceWeights(Base::template allocDevice<DataT>(0))
+        , mDeviceTopOutput(Base::template allocDevice<DataT>(0))
+        , mDeviceTopGrad(Base::template allocDevice<DataT>(0))
+        , mHostWeights(Base::template allocHost<DataT>(0))
+        , mHostTopOutput(Base::template allocHost<DataT>(0))
+        , mHostTopOutputRef(Base::template allocHost<DataT>(0))
+        , mHostTopGrad(Base::template allocHost<DataT>(0))
         , mCurrentElementCountFwd({0, 0, 0, DummyT()})
         , mCurrentElementCountBwd({0, 0, 0, 0, 0})
+        , mCurrentElementCountFused({0, 0, 0, 0, 0, 0})
         , mMaxFwdCapacity({0, 0, 0, DummyT()})
         , mMaxBwdCapacity({0, 0, 0, 0, 0})
+        , mMaxFusedCapacity({0, 0, 0, 0, 0, 0})
     {
     }
 
@@ -78,10 +87,19 @@ namespace rocwmma
         , mHostBottomMlpGrad(std::move(rhs.mHostBottomMlpGrad))
         , mHostBottomMlpGradRef(std::move(rhs.mHostBottomMlpGradRef))
         , mHostAccBwd(std::move(rhs.mHostAccBwd))
+        , mDeviceWeights(std::move(rhs.mDeviceWeights))
+        , mDeviceTopOutput(std::move(rhs.mDeviceTopOutput))
+        , mDeviceTopGrad(std::move(rhs.mDeviceTopGrad))
+        , mHostWeights(std::move(rhs.mHostWeights))
+        , mHostTopOutput(std::move(rhs.mHostTopOutput))
+        , mHostTopOutputRef(std::move(rhs.mHostTopOutputRef))
+        , mHostTopGrad(std::move(rhs.mHostTopGrad))
         , mCurrentElementCountFwd(rhs.mCurrentElementCountFwd)
         , mCurrentElementCountBwd(rhs.mCurrentElementCountBwd)
+        , mCurrentElementCountFused(rhs.mCurrentElementCountFused)
         , mMaxFwdCapacity(rhs.mMaxFwdCapacity)
         , mMaxBwdCapacity(rhs.mMaxBwdCapacity)
+        , mMaxFusedCapacity(rhs.mMaxFusedCapacity)
     {
     }
 
@@ -223,6 +241,69 @@ namespace rocwmma
         mCurrentElementCountBwd = newElementCounts;
     }
 
+    template <typename DataT>
+    void DlrmResource<DataT>::copyDeviceToHostFusedFwdInput()
+    {
+        Base::copyData(mHostInput, mDeviceInput, std::get<Input>(mCurrentElementCountFused));
+        Base::copyData(mHostWeights, mDeviceWeights, std::get<Weights>(mCurrentElementCountFused));
+    }
+
+    template <typename DataT>
+    void DlrmResource<DataT>::copyDeviceToHostFusedBwdInput()
+    {
+        copyDeviceToHostFusedFwdInput();
+        Base::copyData(mHostTopGrad, mDeviceTopGrad, std::get<TopGrad>(mCurrentElementCountFused));
+    }
+
+    template <typename DataT>
+    void DlrmResource<DataT>::resizeFusedStorage(ProblemSize const& size,
+                                                 int64_t            topMlpSize,
+                                                 int64_t            weightRows)
+    {
+        resizeFusedStorage(
+            std::make_tuple(std::get<M>(size) * std::get<K>(size) * std::get<B>(size), // Input
+                            weightRows * topMlpSize, // Weights
+                            std::get<B>(size) * topMlpSize, // Top
+                            std::get<M>(size) * std::get<K>(size) * std::get<B>(size), // Grad
+                            std::get<K>(size) * std::get<B>(size), // BottomMlpGrad
+                            std::get<B>(size) * topMlpSize)); // TopGrad
+    }
+
+    template <typename DataT>
+    void DlrmResource<DataT>::resizeFusedStorage(ElementCountFused const& newElementCounts)
+    {
+        conditionalReallocDeviceHostPair(mDeviceInput,
+                                         mHostInput,
+                                         std::get<Input>(mMaxFusedCapacity),
+                                         std::get<Input>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceWeights,
+                                         mHostWeights,
+                                         std::get<Weights>(mMaxFusedCapacity),
+                                         std::get<Weights>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceTopOutput,
+                                         mHostTopOutput,
+                                         std::get<Top>(mMaxFusedCapacity),
+                                         std::get<Top>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceGrad,
+                                         mHostGrad,
+                                         std::get<Grad>(mMaxFusedCapacity),
+                                         std::get<Grad>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceBottomMlpGrad,
+                                         mHostBottomMlpGrad,
+                                         std::get<BottomMlpGrad>(mMaxFusedCapacity),
+                                         std::get<BottomMlpGrad>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceTopGrad,
+                                         mHostTopGrad,
+                                         std::get<TopGrad>(mMaxFusedCapacity),
+                                         std::get<TopGrad>(newElementCounts));
+
+        Base::reallocHost(mHostTopOutputRef, std::get<Top>(newElementCounts));
+        Base::reallocHost(mHostGradRef, std::get<Grad>(newElementCounts));
+        Base::reallocHost(mHostBottomMlpGradRef, std::get<BottomMlpGrad>(newElementCounts));
+
+        mCurrentElementCountFused = newElementCounts;
+    }
+
     template <typename DataT>
     void DlrmResource<DataT>::reset()
     {
@@ -233,10 +314,15 @@ namespace rocwmma
         Base::reallocDeviceHostPair(mDeviceGrad, mHostGrad, 0);
         Base::reallocDeviceHostPair(mDeviceBottomMlpGrad, mHostBottomMlpGrad, 0);
         Base::reallocDeviceHostPair(mDeviceAccBwd, mHostAccBwd, 0);
-        mCurrentElementCountFwd = {0, 0, 0, DummyT()};
-        mCurrentElementCountBwd = {0, 0, 0, 0, 0};
-        mMaxFwdCapacity         = {0, 0, 0, DummyT()};
-        mMaxBwdCapacity         = {0, 0, 0, 0, 0};
+        Base::reallocDeviceHostPair(mDeviceWeights, mHostWeights, 0);
+        Base::reallocDeviceHostPair(mDeviceTopOutput, mHostTopOutput, 0);
+        Base::reallocDeviceHostPair(mDeviceTopGrad, mHostTopGrad, 0);
+        mCurrentElementCountFwd   = {0, 0, 0, DummyT()};
+        mCurrentElementCountBwd   = {0, 0, 0, 0, 0};
+        mCurrentElementCountFused = {0, 0, 0, 0, 0, 0};
+        mMaxFwdCapacity           = {0, 0, 0, DummyT()};
+        mMaxBwdCapacity           = {0, 0, 0, 0, 0};
+        mMaxFusedCapacity         = {0, 0, 0, 0, 0, 0};
     }
 
     template <typename DataT>
@@ -341,6 +427,48 @@ namespace rocwmma
         return mDeviceAccBwd;
     }
 
+    template <typename DataT>
+    auto DlrmResource<DataT>::hostWeights() -> HostPtrT<DataT>&
+    {
+        return mHostWeights;
+    }
+
+    template <typename DataT>
+    auto DlrmResource<DataT>::hostTopOutput() -> HostPtrT<DataT>&
+    {
+        return mHostTopOutput;
+    }
+
+    template <typename DataT>
+    auto DlrmResource<DataT>::hostTopOutputRef() -> HostPtrT<DataT>&
+    {
+        return mHostTopOutputRef;
+    }
+
+    template <typename DataT>
+    auto DlrmResource<DataT>::hostTopGrad() -> HostPtrT<DataT>&
+    {
+        return mHostTopGrad;
+    }
+
+    template <typename DataT>
+    auto DlrmResource<DataT>::deviceWeights() -> DevicePtrT<DataT>&
+    {
+        return mDeviceWeights;
+    }
+
+    template <typename DataT>
+    auto DlrmResource<DataT>::deviceTopOutput() -> DevicePtrT<DataT>&
+    {
+        return mDeviceTopOutput;
+    }
+
+    template <typename DataT>
+    auto DlrmResource<DataT>::deviceTopGrad() -> DevicePtrT<DataT>&
+    {
+        return mDeviceTopGrad;
+    }
+
     template <typename DataT>
     auto DlrmResource<DataT>::currentElementCountFwd() const -> ElementCountFwd
     {
@@ -353,6 +481,12 @@ namespace rocwmma
         return mCurrentElementCountBwd;
     }
 
+    template <typename DataT>
+    auto DlrmResource<DataT>::currentElementCountFused() const -> ElementCountFused
+    {
+        return mCurrentElementCountFused;
+    }
+
     template <typename DataT>
     auto DlrmResource<DataT>::maxFwdCapacity() const -> ElementCountFwd
     {
@@ -365,6 +499,12 @@ namespace rocwmma
         return mMaxBwdCapacity;
     }
 
+    template <typename DataT>
+    auto DlrmResource<DataT>::maxFusedCapacity() const -> ElementCountFused
+    {
+        return mMaxFusedCapacity;
+    }
+
 } // namespace rocwmma
 
 #endif // DLRM_GEMM_RESOURCE_IMPL_HPP
@@ -24,6 +24,7 @@
  *
  *******************************************************************************/
 
+#include "deferred_tests.hpp"
 #include "detail/dlrm_dot_lds.hpp"
 #include "dlrm_dot_test.hpp"
 #include "dlrm_test_params.hpp"
@@ -77,7 +78,22 @@ TEST_P(DlrmDotLdsTestBasic, RunKernel)
 INSTANTIATE_TEST_SUITE_P(
     DlrmKernelTests,
     DlrmDotLdsTestBasic,
-    ::testing::Combine(::testing::ValuesIn(rocwmma::TestParams::kernels()),
-                       ::testing::ValuesIn(rocwmma::TestParams::threadBlocks()),
-                       ::testing::ValuesIn(rocwmma::TestParams::problemSizes()),
-                       ::testing::ValuesIn(rocwmma::TestParams::passDirections())));
+    ::testing::Combine(
+        ::testing::ValuesIn(rocwmma::TestParams::kernels()),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, threadBlocks)),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, problemSizes)),
+        ::testing::ValuesIn(rocwmma::TestParams::passDirections())));
+
+[[maybe_unused]] static bool const DlrmDotLdsTestBasic_Pipelined = rocwmma::DeferredTests::add(
+    rocwmma::DeferredTests::Mode::Pipelined,
+    "DlrmKernelTests",
+    "DlrmDotLdsTestBasic_Pipelined",
+    __FILE__,
+    __LINE__,
+    []() {
+        rocwmma::DlrmDotTest::RunKernelsPipelined(
+            rocwmma::TestParams::kernels(),
+            ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, threadBlocks),
+            ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, problemSizes),
+            rocwmma::TestParams::passDirections());
+    });
@@ -26,6 +26,7 @@
 
 #include "dlrm_dot_test.hpp"
 #include "detail/dlrm_dot.hpp"
+#include "deferred_tests.hpp"
 #include "dlrm_test_params.hpp"
 #include "kernel_generator.hpp"
 
@@ -73,7 +74,22 @@ TEST_P(DlrmDotTestBasic, RunKernel)
 INSTANTIATE_TEST_SUITE_P(
     DlrmKernelTests,
     DlrmDotTestBasic,
-    ::testing::Combine(::testing::ValuesIn(rocwmma::TestParams::kernels()),
-                       ::testing::ValuesIn(rocwmma::TestParams::threadBlocks()),
-                       ::testing::ValuesIn(rocwmma::TestParams::problemSizes()),
-                       ::testing::ValuesIn(rocwmma::TestParams::passDirections())));
+    ::testing::Combine(
+        ::testing::ValuesIn(rocwmma::TestParams::kernels()),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, threadBlocks)),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, problemSizes)),
+        ::testing::ValuesIn(rocwmma::TestParams::passDirections())));
+
+[[maybe_unused]] static bool const DlrmDotTestBasic_Pipelined = rocwmma::DeferredTests::add(
+    rocwmma::DeferredTests::Mode::Pipelined,
+    "DlrmKernelTests",
+    "DlrmDotTestBasic_Pipelined",
+    __FILE__,
+    __LINE__,
+    []() {
+        rocwmma::DlrmDotTest::RunKernelsPipelined(
+            rocwmma::TestParams::kernels(),
+            ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, threadBlocks),
+            ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, problemSizes),
+            rocwmma::TestParams::passDirections());
+    });
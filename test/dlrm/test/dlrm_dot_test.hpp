@@ -30,7 +30,9 @@
 #include <gtest/gtest.h>
 
 #include "dlrm_kernel_base.hpp"
+#include "dlrm_pipelined_test.hpp"
 #include "dlrm_test_params.hpp"
+#include "rocwmma_options.hpp"
 
 namespace rocwmma
 {
@@ -45,8 +47,19 @@ namespace rocwmma
                                                          typename DlrmTestParams::ProblemSizeT,
                                                          typename DlrmTestParams::PassDirectionT>>;
 
+        using KernelT        = typename DlrmTestParams::KernelT;
+        using ThreadBlockT   = typename DlrmTestParams::ThreadBlockT;
+        using ProblemSizeT   = typename DlrmTestParams::ProblemSizeT;
+        using PassDirectionT = typename DlrmTestParams::PassDirectionT;
+
         void SetUp() override
         {
+            // The pipelined suite covers these kernels
+            if(RocwmmaOptions::instance()->pipelineDepth() > 0u)
+            {
+                GTEST_SKIP();
+            }
+
             // Construct ProblemParams from
             // incoming gtest parameterization
             auto param         = Base::GetParam();
@@ -95,6 +108,26 @@ namespace rocwmma
             auto kernel = std::get<0>(param);
             kernel->tearDown();
         }
+
+        // Runs every combination of the suite's parameters through the KernelPipeline
+        static void RunKernelsPipelined(std::vector<KernelT> const&        kernels,
+                                        std::vector<ThreadBlockT> const&   threadBlocks,
+                                        std::vector<ProblemSizeT> const&   problemSizes,
+                                        std::vector<PassDirectionT> const& passDirections)
+        {
+            auto problems = std::vector<ProblemParams>();
+            for(auto const& threadBlock : threadBlocks)
+            {
+                for(auto const& problemSize : problemSizes)
+                {
+                    for(auto const& passDirection : passDirections)
+                    {
+                        problems.push_back({threadBlock, problemSize, passDirection});
+                    }
+                }
+            }
+            runDlrmKernelsPipelined(kernels, problems);
+        }
     };
     // pass enum template values through Base::<name>
 
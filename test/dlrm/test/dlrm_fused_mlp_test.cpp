@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "dlrm_fused_mlp_test.hpp"
+#include "detail/dlrm_fused_mlp.hpp"
+#include "deferred_tests.hpp"
+#include "dlrm_test_params.hpp"
+#include "kernel_generator.hpp"
+
+namespace rocwmma
+{
+    struct TestParams : public DlrmTestParams
+    {
+        // Types: 32 and 16 bit float
+        // Block Sizes: 16 x 16 x 16
+        // The packed interaction of a tile of samples is staged in LDS, which
+        // bounds the feature count, so the sizes stay small.
+        using Base         = DlrmTestParams;
+        using Types        = typename Base::DataTypes;
+        using TileSizes    = std::tuple<std::tuple<I<16>>>;
+        using KernelParams = typename CombineLists<Types, TileSizes>::Result;
+
+        using GeneratorImpl   = DlrmFusedMlpGenerator;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        // M, K, BatchSize
+        // M = 16 packs k + 120 features, padded to whole tiles in the kernels
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return {{16, 32, 64}, {16, 128, 64}, {32, 32, 64}, {32, 128, 64}, {32, 128, 256}};
+        }
+
+        static inline std::vector<TopMlpSizeT> topMlpSizes()
+        {
+            return {64, 256};
+        }
+    };
+
+} // namespace rocwmma
+
+class DlrmFusedMlpTestBasic : public rocwmma::DlrmFusedMlpTest
+{
+};
+
+TEST_P(DlrmFusedMlpTestBasic, RunKernel)
+{
+    static bool ranWarmup = false;
+    if(!ranWarmup)
+    {
+        this->Warmup();
+        ranWarmup = true;
+    }
+    this->RunKernel();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DlrmKernelTests,
+    DlrmFusedMlpTestBasic,
+    ::testing::Combine(
+        ::testing::ValuesIn(rocwmma::TestParams::kernels()),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, threadBlocks)),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, problemSizes)),
+        ::testing::ValuesIn(rocwmma::TestParams::passDirections()),
+        ::testing::ValuesIn(rocwmma::TestParams::topMlpSizes())));
+
+[[maybe_unused]] static bool const DlrmFusedMlpTestBasic_Pipelined = rocwmma::DeferredTests::add(
+    rocwmma::DeferredTests::Mode::Pipelined,
+    "DlrmKernelTests",
+    "DlrmFusedMlpTestBasic_Pipelined",
+    __FILE__,
+    __LINE__,
+    []() {
+        rocwmma::DlrmFusedMlpTest::RunKernelsPipelined(
+            rocwmma::TestParams::kernels(),
+            ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, threadBlocks),
+            ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, problemSizes),
+            rocwmma::TestParams::passDirections(),
+            rocwmma::TestParams::topMlpSizes());
+    });
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_FUSED_MLP_TEST_HPP
+#define DLRM_FUSED_MLP_TEST_HPP
+
+#include <gtest/gtest.h>
+
+#include "dlrm_fused_mlp_kernel_base.hpp"
+#include "dlrm_pipelined_test.hpp"
+#include "dlrm_test_params.hpp"
+#include "rocwmma_options.hpp"
+
+namespace rocwmma
+{
+    struct DlrmFusedMlpTest
+        : public ::testing::TestWithParam<std::tuple<typename DlrmTestParams::KernelT,
+                                                     typename DlrmTestParams::ThreadBlockT,
+                                                     typename DlrmTestParams::ProblemSizeT,
+                                                     typename DlrmTestParams::PassDirectionT,
+                                                     typename DlrmTestParams::TopMlpSizeT>>
+    {
+        using Base = ::testing::TestWithParam<std::tuple<typename DlrmTestParams::KernelT,
+                                                         typename DlrmTestParams::ThreadBlockT,
+                                                         typename DlrmTestParams::ProblemSizeT,
+                                                         typename DlrmTestParams::PassDirectionT,
+                                                         typename DlrmTestParams::TopMlpSizeT>>;
+
+        using KernelT        = typename DlrmTestParams::KernelT;
+        using ThreadBlockT   = typename DlrmTestParams::ThreadBlockT;
+        using ProblemSizeT   = typename DlrmTestParams::ProblemSizeT;
+        using PassDirectionT = typename DlrmTestParams::PassDirectionT;
+        using TopMlpSizeT    = typename DlrmTestParams::TopMlpSizeT;
+
+        void SetUp() override
+        {
+            // The pipelined suite covers these kernels
+            if(RocwmmaOptions::instance()->pipelineDepth() > 0u)
+            {
+                GTEST_SKIP();
+            }
+
+            // Construct ProblemParams from
+            // incoming gtest parameterization
+            auto param         = Base::GetParam();
+            auto kernel        = std::get<0>(param);
+            auto threadBlock   = std::get<1>(param);
+            auto problemSize   = std::get<2>(param);
+            auto passDirection = std::get<3>(param);
+            auto topMlpSize    = std::get<4>(param);
+
+            // Cleanup previously used resources if data types change
+            static KernelI* sLastKernelRun = nullptr;
+            if(sLastKernelRun && sLastKernelRun->getResource() != kernel->getResource())
+            {
+                sLastKernelRun->getResource()->reset();
+            }
+            sLastKernelRun = kernel.get();
+
+            ProblemParams params = {threadBlock, problemSize, passDirection, topMlpSize};
+
+            // Walk through kernel workflow
+            kernel->setup(params);
+        }
+
+        virtual void RunKernel()
+        {
+            // Construct ProblemParams from
+            // incoming gtest parameterization
+            auto param  = Base::GetParam();
+            auto kernel = std::get<0>(param);
+            kernel->exec();
+            kernel->validateResults();
+            kernel->reportResults();
+        }
+
+        virtual void Warmup()
+        {
+            auto param  = Base::GetParam();
+            auto kernel = std::get<0>(param);
+            kernel->exec();
+        }
+
+        void TearDown() override
+        {
+            // Construct ProblemParams from
+            // incoming gtest parameterization
+            auto param  = Base::GetParam();
+            auto kernel = std::get<0>(param);
+            kernel->tearDown();
+        }
+
+        // Runs every combination of the suite's parameters through the KernelPipeline
+        static void RunKernelsPipelined(std::vector<KernelT> const&        kernels,
+                                        std::vector<ThreadBlockT> const&   threadBlocks,
+                                        std::vector<ProblemSizeT> const&   problemSizes,
+                                        std::vector<PassDirectionT> const& passDirections,
+                                        std::vector<TopMlpSizeT> const&    topMlpSizes)
+        {
+            auto problems = std::vector<ProblemParams>();
+            for(auto const& threadBlock : threadBlocks)
+            {
+                for(auto const& problemSize : problemSizes)
+                {
+                    for(auto const& passDirection : passDirections)
+                    {
+                        for(auto const& topMlpSize : topMlpSizes)
+                        {
+                            problems.push_back(
+                                {threadBlock, problemSize, passDirection, topMlpSize});
+                        }
+                    }
+                }
+            }
+            runDlrmKernelsPipelined(kernels, problems);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // DLRM_FUSED_MLP_TEST_HPP
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef DLRM_PIPELINED_TEST_HPP
+#define DLRM_PIPELINED_TEST_HPP
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "dlrm_kernel_base.hpp"
+#include "dlrm_test_params.hpp"
+#include "kernel_pipeline.hpp"
+#include "rocwmma_options.hpp"
+
+namespace rocwmma
+{
+    // Runs every kernel over every problem through the KernelPipeline.
+    // Validation compares against the shared DlrmResource, so it stays in the
+    // issue stage; reports and teardown are deferred and come out in
+    // submission order.
+    inline void runDlrmKernelsPipelined(std::vector<DlrmTestParams::KernelT> const& kernels,
+                                        std::vector<ProblemParams> const&           problems)
+    {
+        auto depth = RocwmmaOptions::instance()->pipelineDepth();
+        if(depth == 0u)
+        {
+            GTEST_SKIP();
+        }
+
+        struct Job
+        {
+            DlrmTestParams::KernelT kernel;
+            ProblemParams           params;
+        };
+
+        // Same ordering as the parameterized suites
+        auto jobs = std::vector<Job>();
+        for(auto const& kernel : kernels)
+        {
+            for(auto const& problem : problems)
+            {
+                jobs.push_back({kernel, problem});
+            }
+        }
+
+        typename KernelPipeline<Job>::Stages stages;
+        stages.issue = [](Job& job) {
+            // Cleanup previously used resources if data types change
+            static KernelI* sLastKernelRun = nullptr;
+            if(sLastKernelRun && sLastKernelRun->getResource() != job.kernel->getResource())
+            {
+                sLastKernelRun->getResource()->reset();
+            }
+            sLastKernelRun = job.kernel.get();
+
+            job.kernel->setup(job.params);
+            job.kernel->exec();
+            job.kernel->validateResults();
+        };
+        stages.report = [](Job& job) {
+            job.kernel->reportResults();
+            job.kernel->tearDown();
+        };
+        stages.resourceKey = [](Job const& job) -> void const* { return job.kernel.get(); };
+
+        KernelPipeline<Job> pipeline(depth, depth);
+        pipeline.run(jobs, stages);
+    }
+
+} // namespace rocwmma
+
+#endif // DLRM_PIPELINED_TEST_HPP
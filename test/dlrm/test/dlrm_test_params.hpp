@@ -46,6 +46,7 @@ namespace rocwmma
         using ThreadBlockT   = std::pair<int64_t, int64_t>;
         using ProblemSizeT   = std::tuple<int64_t, int64_t, int64_t>;
         using PassDirectionT = DlrmDirection_t;
+        using TopMlpSizeT    = int64_t;
         using TestMappingLds = std::tuple<std::tuple<LdsRF>>;
 
         using DataTypes = std::tuple<std::tuple<float32_t>, std::tuple<float16_t>>;
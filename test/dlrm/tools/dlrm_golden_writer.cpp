@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Regenerates the DLRM golden data from the CPU references.
+//
+// The goldens of each type are the interaction output of input_<type> and
+// the input and bottom MLP gradients of input_grad_<type>. Given a problem
+// size, fresh inputs of that size are written first, from a fixed seed.
+//
+// dlrm_golden_writer <data_dir>
+// dlrm_golden_writer <data_dir> <m> <k> <batch>
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <rocwmma/internal/types.hpp>
+
+#include "golden_data.hpp"
+#include "reference.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        template <typename DataT>
+        std::vector<DataT> randomData(uint64_t count, uint32_t seed)
+        {
+            std::mt19937                          generator(seed);
+            std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+            std::vector<DataT> data(count);
+            for(auto& value : data)
+            {
+                value = static_cast<DataT>(distribution(generator));
+            }
+            return data;
+        }
+
+        template <typename DataT>
+        void writeInputs(std::string const& dir,
+                         std::string const& suffix,
+                         uint64_t           m,
+                         uint64_t           k,
+                         uint64_t           batch)
+        {
+            auto features = ((m * (m - 1)) / 2) + k;
+
+            auto input = randomData<DataT>(batch * m * k, 1u);
+            auto grad  = randomData<DataT>(batch * features, 2u);
+            GoldenData::writeGoldenFile(
+                dir + "/input_" + suffix + ".golden", input.data(), {batch, m, k});
+            GoldenData::writeGoldenFile(
+                dir + "/input_grad_" + suffix + ".golden", grad.data(), {batch, features});
+        }
+
+        template <typename DataT>
+        bool writeGoldens(std::string const& dir, std::string const& suffix)
+        {
+            GoldenData::MappedGoldenFile input(dir + "/input_" + suffix + ".golden");
+            GoldenData::MappedGoldenFile grad(dir + "/input_grad_" + suffix + ".golden");
+            if(!input.isOpen() || !grad.isOpen() || input.rank() != 3u || grad.rank() != 2u)
+            {
+                std::cerr << "Missing or invalid " << suffix << " inputs in " << dir << std::endl;
+                return false;
+            }
+
+            auto shape    = input.shape();
+            auto batch    = shape[0];
+            auto m        = shape[1];
+            auto k        = shape[2];
+            auto features = ((m * (m - 1)) / 2) + k;
+            if(grad.shape() != std::vector<uint64_t>{batch, features})
+            {
+                std::cerr << "input_grad_" << suffix << " does not match input_" << suffix
+                          << std::endl;
+                return false;
+            }
+
+            std::vector<DataT> output(batch * features);
+            dlrm_fwd_CPU<DataT>(input.view<DataT>(), output.data(), m, k, batch);
+            GoldenData::writeGoldenFile(
+                dir + "/output_" + suffix + ".golden", output.data(), {batch, features});
+
+            std::vector<DataT> inputGrad(batch * m * k);
+            std::vector<DataT> bottomMlpGrad(batch * k);
+            dlrm_bwd_CPU<DataT>(input.view<DataT>(),
+                                grad.view<DataT>(),
+                                bottomMlpGrad.data(),
+                                inputGrad.data(),
+                                m,
+                                k,
+                                batch);
+            GoldenData::writeGoldenFile(
+                dir + "/output_input_grad_" + suffix + ".golden", inputGrad.data(), {batch, m, k});
+            GoldenData::writeGoldenFile(dir + "/output_mlp_input_grad_" + suffix + ".golden",
+                                        bottomMlpGrad.data(),
+                                        {batch, k});
+
+            std::cout << "Wrote " << suffix << " goldens of " << m << "x" << k << "x" << batch
+                      << " to " << dir << std::endl;
+            return true;
+        }
+    }
+} // namespace rocwmma
+
+int main(int argc, char** argv)
+{
+    if(argc != 2 && argc != 5)
+    {
+        std::cerr << "Usage: " << argv[0] << " <data_dir> [<m> <k> <batch>]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string dir = argv[1];
+    if(argc == 5)
+    {
+        auto m     = std::stoull(argv[2]);
+        auto k     = std::stoull(argv[3]);
+        auto batch = std::stoull(argv[4]);
+        rocwmma::writeInputs<rocwmma::float32_t>(dir, "fp32", m, k, batch);
+        rocwmma::writeInputs<rocwmma::float16_t>(dir, "fp16", m, k, batch);
+    }
+
+    auto written = rocwmma::writeGoldens<rocwmma::float32_t>(dir, "fp32")
+                   && rocwmma::writeGoldens<rocwmma::float16_t>(dir, "fp16");
+    return written ? EXIT_SUCCESS : EXIT_FAILURE;
+}
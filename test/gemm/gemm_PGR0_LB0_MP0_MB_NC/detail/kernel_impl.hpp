@@ -122,16 +122,13 @@ namespace rocwmma
 
         dim3 gridDim() const final
         {
-            return dim3(ceilDiv(Base::mM,
-                                BlockM * BlocksX * Base::mTBlockX
-                                    / Base::DeviceInfo::instance()->warpSize()),
+            return dim3(ceilDiv(Base::mM, BlockM * BlocksX * Base::mTBlockX / Base::mWaveSize),
                         ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY));
         }
 
         bool checkSizes() const final
         {
-            return ((BlockM * BlocksX * Base::mTBlockX / Base::DeviceInfo::instance()->warpSize())
-                    <= Base::mM)
+            return ((BlockM * BlocksX * Base::mTBlockX / Base::mWaveSize) <= Base::mM)
                    && ((BlockN * BlocksY * Base::mTBlockY) <= Base::mN) && (BlockK <= Base::mK);
         }
 
@@ -154,6 +151,15 @@ namespace rocwmma
         {
             return Base::printKernel(stream << BlocksX << ", " << BlocksY << ", ");
         }
+
+        bool tuningCandidate(GemmTuning::Problem&   problem,
+                             GemmTuning::Candidate& candidate) const final
+        {
+            candidate.kernel  = "PGR0_LB0_MP0_MB_NC";
+            candidate.blocksX = BlocksX;
+            candidate.blocksY = BlocksY;
+            return Base::tuningCandidate(problem, candidate);
+        }
     };
 
 } // namespace rocwmma
@@ -67,7 +67,7 @@ namespace rocwmma
 
         static inline std::vector<ThreadBlockT> threadBlocks()
         {
-            auto warpSize = HipDevice::instance()->warpSize();
+            auto warpSize = Base::targetWaveSize();
             return {
                 //{warpSize, 1},
                 {warpSize * 2, 2},
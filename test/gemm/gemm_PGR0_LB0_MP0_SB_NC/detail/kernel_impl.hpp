@@ -123,6 +123,13 @@ namespace rocwmma
         {
             return Base::template dispatchKernelFunc<TestKernelFunc>();
         }
+
+        bool tuningCandidate(GemmTuning::Problem&   problem,
+                             GemmTuning::Candidate& candidate) const final
+        {
+            candidate.kernel = "PGR0_LB0_MP0_SB_NC";
+            return Base::tuningCandidate(problem, candidate);
+        }
     };
 
 } // namespace rocwmma
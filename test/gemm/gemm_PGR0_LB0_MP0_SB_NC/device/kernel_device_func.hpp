@@ -50,6 +50,9 @@ namespace rocwmma
     /// SB = Single-block
     /// NC = Non-cooperative
     ///
+    /// InputT may be a MixedInput tag, in which case the narrower of A
+    /// and B is upcast to the fragment datatype of the other as it is loaded.
+    ///
 
     template <uint32_t BlockM,
               uint32_t BlockN,
@@ -65,19 +68,20 @@ namespace rocwmma
               uint32_t TBlockY,
               uint32_t WaveSize,
               uint32_t ArchId>
-    __global__ void __launch_bounds__(256) gemm_PGR0_LB0_MP0_SB_NC(uint32_t       m,
-                                                                   uint32_t       n,
-                                                                   uint32_t       k,
-                                                                   InputT const*  a,
-                                                                   InputT const*  b,
-                                                                   OutputT const* c,
-                                                                   OutputT*       d,
-                                                                   uint32_t       lda,
-                                                                   uint32_t       ldb,
-                                                                   uint32_t       ldc,
-                                                                   uint32_t       ldd,
-                                                                   ComputeT       alpha,
-                                                                   ComputeT       beta)
+    __global__ void __launch_bounds__(256)
+        gemm_PGR0_LB0_MP0_SB_NC(uint32_t                     m,
+                                uint32_t                     n,
+                                uint32_t                     k,
+                                GemmInputTA_t<InputT> const* a,
+                                GemmInputTB_t<InputT> const* b,
+                                OutputT const*               c,
+                                OutputT*                     d,
+                                uint32_t                     lda,
+                                uint32_t                     ldb,
+                                uint32_t                     ldc,
+                                uint32_t                     ldd,
+                                ComputeT                     alpha,
+                                ComputeT                     beta)
     {
         if constexpr(gemm_PGR0_LB0_MP0_SB_NC_guard<BlockM,
                                                    BlockN,
@@ -90,13 +94,17 @@ namespace rocwmma
                                                    WaveSize,
                                                    ArchId>::enableBuild())
         {
-            using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
-            using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+            using InputTA   = GemmInputTA_t<InputT>;
+            using InputTB   = GemmInputTB_t<InputT>;
+            using MmaInputT = GemmMmaInputT_t<InputT>;
+
+            using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, MmaInputT, LayoutA>;
+            using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, MmaInputT, LayoutB>;
             using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutC>;
             using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>;
 
-            using MappingA = MappingUtil<BlockM, BlockK, InputT, LayoutA>;
-            using MappingB = MappingUtil<BlockK, BlockN, InputT, LayoutB>;
+            using MappingA = MappingUtil<BlockM, BlockK, InputTA, LayoutA>;
+            using MappingB = MappingUtil<BlockK, BlockN, InputTB, LayoutB>;
             using MappingC = MappingUtil<BlockM, BlockN, OutputT, LayoutC>;
             using MappingD = MappingUtil<BlockM, BlockN, OutputT, LayoutD>;
 
@@ -141,7 +149,8 @@ namespace rocwmma
                 auto fragA = FragA();
                 auto fragB = FragB();
 
-                // Load and multiply
+                // Load and multiply.
+                // Mixed inputs are upcast to MmaInputT by the load.
                 load_matrix_sync(fragA, addrA, lda);
                 load_matrix_sync(fragB, addrB, ldb);
                 mma_sync(fragAcc, fragA, fragB, fragAcc);
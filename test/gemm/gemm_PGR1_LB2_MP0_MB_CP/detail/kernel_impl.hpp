@@ -133,23 +133,19 @@ namespace rocwmma
 
         dim3 gridDim() const final
         {
-            return dim3(ceilDiv(Base::mM,
-                                BlockM * BlocksX * Base::mTBlockX
-                                    / Base::DeviceInfo::instance()->warpSize()),
+            return dim3(ceilDiv(Base::mM, BlockM * BlocksX * Base::mTBlockX / Base::mWaveSize),
                         ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY));
         }
 
         bool checkSizes() const final
         {
-            return ((BlockM * BlocksX * Base::mTBlockX / Base::DeviceInfo::instance()->warpSize())
-                    <= Base::mM)
+            return ((BlockM * BlocksX * Base::mTBlockX / Base::mWaveSize) <= Base::mM)
                    && ((BlockN * BlocksY * Base::mTBlockY) <= Base::mN) && (BlockK <= Base::mK);
         }
 
         bool checkQuirks() const final
         {
-            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
-            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+            auto deviceArch = Base::mDeviceArch;
 
             // Don't run the kernel if the threadblock size is not supported
             auto kernelImplCheck = (kernelImpl() != nullptr);
@@ -188,7 +184,7 @@ namespace rocwmma
         {
             // Uses 2 lds blocks for prefetch loop
             return 2 * sizeof(InputT)
-                   * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
+                   * (Base::mTBlockX / Base::mWaveSize * BlocksX * BlockM
                       + Base::mTBlockY * BlocksY * BlockN)
                    * BlockK;
         }
@@ -209,6 +205,26 @@ namespace rocwmma
                                             << dataTypeToString<LayoutLds>() << ", " << BlocksX
                                             << ", " << BlocksY << ", ");
         }
+
+        bool tuningCandidate(GemmTuning::Problem&   problem,
+                             GemmTuning::Candidate& candidate) const final
+        {
+            candidate.kernel     = "PGR1_LB2_MP0_MB_CP";
+            candidate.gemmConfig = dataTypeToString<GemmConfig>();
+            candidate.layoutLds  = dataTypeToString<LayoutLds>();
+            candidate.blocksX    = BlocksX;
+            candidate.blocksY    = BlocksY;
+            return Base::tuningCandidate(problem, candidate);
+        }
+
+#if ROCWMMA_GEMM_PHASE_TRACE
+        // Phase recorders of this translation unit's kernels
+        bool setPhaseTraceTarget(GemmPhaseTrace::Target const& target) final
+        {
+            CHECK_HIP_ERROR(GemmPhaseTrace::setTarget(target));
+            return true;
+        }
+#endif // ROCWMMA_GEMM_PHASE_TRACE
     };
 
 } // namespace rocwmma
@@ -33,6 +33,7 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #include "gemm_config.hpp"
+#include "gemm_resource_budget.hpp"
 #include "kernel_predicates.hpp"
 #include <rocwmma/rocwmma.hpp>
 #include <rocwmma/rocwmma_coop.hpp>
@@ -124,6 +125,13 @@ namespace rocwmma
             using GemmDriver     = typename GemmConfig::
                 template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
 
+            // Registers and LDS of this configuration: global prefetch, 2 lds buffers
+            using Budget = GemmOccupancy::
+                GemmDriverBudget<GlobalMapping, TBlockX, TBlockY, WaveSize, ArchId, true, 2u>;
+            static_assert(Budget::Result.registerWavesPerSimd >= ROCWMMA_GEMM_MIN_WAVES_PER_SIMD,
+                          "Fragment registers limit occupancy below "
+                          "ROCWMMA_GEMM_MIN_WAVES_PER_SIMD");
+
             // Global fragments used in pre-fetching
             using GRFragA = typename GlobalMapping::GRFragA;
             using GRFragB = typename GlobalMapping::GRFragB;
@@ -175,6 +183,12 @@ namespace rocwmma
             auto kStepOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), lda);
             auto kStepOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), ldb);
 
+            ///
+            /// Phase timers of this wave, no-ops unless tracing
+            ///
+            auto phaseRecorder = GemmDriver::PhaseRecorder::open();
+            auto phaseStart    = phaseRecorder.start();
+
             ///
             /// Start global prefetch
             ///
@@ -182,6 +196,7 @@ namespace rocwmma
             typename GlobalMapping::GRBuffB grBuffB;
             GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
             GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
+            phaseRecorder.stop(GemmPhaseTrace::GlobalRead, phaseStart);
             globalReadOffsetA += kStepOffsetA;
             globalReadOffsetB += kStepOffsetB;
 
@@ -206,8 +221,10 @@ namespace rocwmma
             ///
             /// Write prefetch to local
             ///
+            phaseStart = phaseRecorder.start();
             GemmDriver::localWriteCoopA(ldsPtrLo + ldsWriteOffsetA, grBuffA, ldlds);
             GemmDriver::localWriteCoopB(ldsPtrLo + ldsWriteOffsetB, grBuffB, ldlds);
+            phaseRecorder.stop(GemmPhaseTrace::LocalWrite, phaseStart);
 
             ///
             /// Initialize accumulation frags
@@ -229,22 +246,30 @@ namespace rocwmma
                 typename GlobalMapping::MfmaBuffB fragsB;
 
                 // Local read mfma frags
+                phaseStart = phaseRecorder.start();
                 GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
                 GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
+                phaseRecorder.stop(GemmPhaseTrace::LocalRead, phaseStart);
 
                 // Start fetching next round of frags
+                phaseStart = phaseRecorder.start();
                 GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
                 GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
+                phaseRecorder.stop(GemmPhaseTrace::GlobalRead, phaseStart);
 
                 // Advance offsets to next k step
                 globalReadOffsetA += kStepOffsetA;
                 globalReadOffsetB += kStepOffsetB;
 
                 // accum(A * B)
+                phaseStart = phaseRecorder.start();
                 GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+                phaseRecorder.stop(GemmPhaseTrace::Mma, phaseStart);
 
+                phaseStart = phaseRecorder.start();
                 GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldlds);
                 GemmDriver::localWriteCoopB(ldsPtrHi + ldsWriteOffsetB, grBuffB, ldlds);
+                phaseRecorder.stop(GemmPhaseTrace::LocalWrite, phaseStart);
 
                 // Make sure that all waves have finished reading / writing to lds.
                 GemmDriver::syncWorkgroup();
@@ -260,7 +285,9 @@ namespace rocwmma
             ///
 
             typename GlobalMapping::MfmaBuffC fragsC;
+            phaseStart = phaseRecorder.start();
             GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, ldc);
+            phaseRecorder.stop(GemmPhaseTrace::GlobalRead, phaseStart);
 
             ///
             /// Clean up tail A * B
@@ -269,16 +296,24 @@ namespace rocwmma
             typename GlobalMapping::MfmaBuffA fragsA;
             typename GlobalMapping::MfmaBuffB fragsB;
 
+            phaseStart = phaseRecorder.start();
             GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
             GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
+            phaseRecorder.stop(GemmPhaseTrace::LocalRead, phaseStart);
+
+            phaseStart = phaseRecorder.start();
             GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+            phaseRecorder.stop(GemmPhaseTrace::Mma, phaseStart);
 
             ///
             /// D = alpha * accum + beta * C
             ///
             typename GlobalMapping::MfmaBuffD fragsD;
+            phaseStart = phaseRecorder.start();
             GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
             GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, ldd);
+            phaseRecorder.stop(GemmPhaseTrace::Epilogue, phaseStart);
+            phaseRecorder.close();
         }
     }
 } // namespace rocwmma
@@ -82,7 +82,7 @@ namespace rocwmma
             // for correctness.
             // Second part is that the ldsRF crosses threshold from 16/32 block sizes to 64, which has different considerations
             // for the MaxVW. This unfortunately limits applicability in cooperative environment.
-            LdsRFTest = !(std::is_same_v<GemmConfig, typename CooperativeGemm::BlockLevel::LdsRF>)
+            LdsRFTest = !(is_same_v<GemmConfig, typename CooperativeGemm::BlockLevel::LdsRF>)
                         || ((BlockM * BlockK / WaveSize > 8u) && (BlockN * BlockK / WaveSize > 8u)),
 
             Enable = (LdsRFTest)
@@ -99,7 +99,7 @@ namespace rocwmma
             // for correctness.
             // Second part is that the ldsRF layout supports only one wave due to MaxVW considerations.
             // This unfortunately limits applicability in cooperative environment.
-            LdsRFTest = !(std::is_same_v<GemmConfig, typename CooperativeGemm::BlockLevel::LdsRF>)
+            LdsRFTest = !(is_same_v<GemmConfig, typename CooperativeGemm::BlockLevel::LdsRF>)
                         || (((TBlockX / WaveSize) * TBlockY) == 1),
 
             CostABTest
@@ -113,7 +113,7 @@ namespace rocwmma
             Enable = (ArchTest && LdsRFTest && CostABTest && CostAccTest && CostTailTest)
         };
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         static constexpr void debugGfx9Predicates()
         {
             std::cout << "Gfx9 Predicates:\n";
@@ -124,7 +124,7 @@ namespace rocwmma
             std::cout << "CostTailTest: " << (bool)Gfx9Predicates::CostTailTest << std::endl;
             std::cout << "Enable: " << (bool)Gfx9Predicates::Enable << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
 
         enum struct Gfx11Predicates : bool
         {
@@ -145,7 +145,7 @@ namespace rocwmma
             Enable = (ArchTest && CostABTest && CostAccTest && CostTailTest)
         };
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         static constexpr void debugGfx11Predicates()
         {
             std::cout << "Gfx11 Predicates:\n";
@@ -155,7 +155,7 @@ namespace rocwmma
             std::cout << "CostTailTest: " << (bool)Gfx11Predicates::CostTailTest << std::endl;
             std::cout << "Enable: " << (bool)Gfx11Predicates::Enable << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
 
     public:
         constexpr static bool enableBuild()
@@ -170,7 +170,7 @@ namespace rocwmma
                    && ((bool)Gfx9Predicates::Enable || (bool)Gfx11Predicates::Enable);
         }
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         constexpr static void debugPredicates()
         {
             std::cout << "Base predicates:\n";
@@ -182,7 +182,7 @@ namespace rocwmma
             std::cout << "Overall enable build: " << enableBuild() << std::endl;
             std::cout << "Overall enable run: " << enableRun() << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
     };
 } // namespace rocwmma
 
@@ -75,7 +75,7 @@ namespace rocwmma
 
         static inline std::vector<ThreadBlockT> threadBlocks()
         {
-            auto warpSize = HipDevice::instance()->warpSize();
+            auto warpSize = Base::targetWaveSize();
 
             return {
                 //{warpSize, 1},
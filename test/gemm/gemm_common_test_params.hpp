@@ -32,9 +32,12 @@
 
 #include <rocwmma/internal/types.hpp>
 
+#include "arch_profile.hpp"
 #include "common.hpp"
 #include "gemm_kernel_base.hpp"
+#include "gemm_mixed_input.hpp"
 #include "kernel_generator.hpp"
+#include "rocwmma_options.hpp"
 
 namespace rocwmma
 {
@@ -120,6 +123,26 @@ namespace rocwmma
         // Native double f64
         using TestTypesF64 = std::tuple<std::tuple<float64_t, float64_t, float64_t>>;
 
+        // Mixed A / B inputs, upcast to the wider type on load
+        using TestTypesMixed = std::tuple<std::tuple<MixedF16I8, float32_t, float32_t>
+#if ROCWMMA_FP8
+                                          ,
+                                          std::tuple<MixedF16F8, float32_t, float32_t>,
+                                          std::tuple<MixedBF16F8, float32_t, float32_t>
+#endif // ROCWMMA_FP8
+#if ROCWMMA_FP8_FNUZ
+                                          ,
+                                          std::tuple<MixedF16F8Fnuz, float32_t, float32_t>,
+                                          std::tuple<MixedBF16F8Fnuz, float32_t, float32_t>
+#endif // ROCWMMA_FP8_FNUZ
+                                          >;
+
+        // Complex inputs, split into real / imag fragments
+        using TestTypesComplex
+            = std::tuple<std::tuple<complex_float16_t, complex_float32_t, complex_float32_t>,
+                         std::tuple<complex_float32_t, complex_float32_t, complex_float32_t>,
+                         std::tuple<complex_float64_t, complex_float64_t, complex_float64_t>>;
+
         // Aggregate types <= 8 bit
         using TestTypesTiny = typename Concat<TestTypesF8, TestTypesBF8, TestTypesI8>::Result;
 
@@ -318,9 +341,23 @@ namespace rocwmma
         using AlphaT       = float64_t;
         using BetaT        = float64_t;
 
+        // Wave size that thread blocks are built for. Dry runs take it from
+        // the target profile and must not construct HipDevice; an unknown
+        // target is reported by the dry run itself.
+        static inline int64_t targetWaveSize()
+        {
+            auto const& dryRunArch = RocwmmaOptions::instance()->dryRunArch();
+            if(!dryRunArch.empty())
+            {
+                auto profile = findArchProfile(dryRunArch);
+                return profile ? profile->waveSize : Constants::AMDGCN_WAVE_SIZE_64;
+            }
+            return HipDevice::instance()->warpSize();
+        }
+
         static inline std::vector<ThreadBlockT> threadBlocks()
         {
-            auto warpSize = HipDevice::instance()->warpSize();
+            auto warpSize = targetWaveSize();
 
             return
             {
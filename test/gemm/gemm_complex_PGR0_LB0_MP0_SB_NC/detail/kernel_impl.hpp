@@ -0,0 +1,189 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD = LayoutC>
+    struct Kernel_Complex_PGR0_LB0_MP0_SB_NC final : public GemmKernelBase<BlockM,
+                                                                    BlockN,
+                                                                    BlockK,
+                                                                    InputT,
+                                                                    OutputT,
+                                                                    ComputeT,
+                                                                    LayoutA,
+                                                                    LayoutB,
+                                                                    LayoutC,
+                                                                    LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_complex_PGR0_LB0_MP0_SB_NC_guard<BlockM,
+                                                         BlockN,
+                                                         BlockK,
+                                                         InputT,
+                                                         OutputT,
+                                                         ComputeT,
+                                                         TBlockX,
+                                                         TBlockY,
+                                                         WaveSize,
+                                                         ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static constexpr auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return typename Base::KernelFunc(gemm_complex_PGR0_LB0_MP0_SB_NC<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD,
+                                                                              TBlockX,
+                                                                              TBlockY,
+                                                                              WaveSize,
+                                                                              ArchId>);
+                }
+                else
+                {
+                    return typename Base::KernelFunc(nullptr);
+                }
+            }
+        };
+
+        using DataStorage = typename Base::DataStorage;
+
+        // Fills count elements with small complex integers of both signs,
+        // which are exact in every complex datatype under test.
+        template <typename DataT>
+        static void fillComplex(DataT* data, int64_t count, uint32_t seed)
+        {
+            using RealT = typename DataT::value_type;
+
+#pragma omp parallel for
+            for(int64_t i = 0; i < count; ++i)
+            {
+                auto real = static_cast<int32_t>((i + seed) % 5) - 2;
+                auto imag = static_cast<int32_t>((3 * i + seed + 1) % 5) - 2;
+                data[i]   = DataT(static_cast<RealT>(real), static_cast<RealT>(imag));
+            }
+        }
+
+        // Device and host (if allocated) copies of one matrix
+        template <typename DataT, typename DevicePtrT, typename HostPtrT>
+        static void refill(DevicePtrT& devicePtr, HostPtrT& hostPtr, int64_t count, uint32_t seed)
+        {
+            auto values = DataStorage::template allocHost<DataT>(count);
+            fillComplex(values.get(), count, seed);
+
+            DataStorage::copyData(devicePtr, values, count);
+            if(hostPtr != nullptr)
+            {
+                DataStorage::copyData(hostPtr, values, count);
+            }
+        }
+
+    public:
+        Kernel_Complex_PGR0_LB0_MP0_SB_NC() {}
+        ~Kernel_Complex_PGR0_LB0_MP0_SB_NC() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                auto& dataInstance = DataStorage::instance();
+
+                auto m = static_cast<int64_t>(Base::mM);
+                auto n = static_cast<int64_t>(Base::mN);
+                auto k = static_cast<int64_t>(Base::mK);
+
+                // The common fill has no imag part, which would leave the
+                // cross terms of the complex mma untested.
+                refill<InputT>(dataInstance->deviceA(), dataInstance->hostA(), m * k, 0u);
+                refill<InputT>(dataInstance->deviceB(), dataInstance->hostB(), k * n, 1u);
+                refill<OutputT>(dataInstance->deviceC(), dataInstance->hostC(), m * n, 2u);
+            }
+        }
+
+        bool checkQuirks() const final
+        {
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        bool tuningCandidate(GemmTuning::Problem&   problem,
+                             GemmTuning::Candidate& candidate) const final
+        {
+            candidate.kernel = "Complex_PGR0_LB0_MP0_SB_NC";
+            return Base::tuningCandidate(problem, candidate);
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
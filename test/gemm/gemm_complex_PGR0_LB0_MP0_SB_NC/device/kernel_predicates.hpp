@@ -0,0 +1,137 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_PREDICATES
+#define ROCWMMA_GEMM_TEST_DEVICE_PREDICATES
+
+#include "gemm_predicates_base.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// Complex InputT / OutputT / ComputeT are checked through their real
+    /// datatypes, which are those of the real and imag fragments.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              uint32_t TBlockX,
+              uint32_t TBlockY,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    struct gemm_complex_PGR0_LB0_MP0_SB_NC_guard
+        : public GemmPredicatesBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    typename InputT::value_type,
+                                    typename OutputT::value_type,
+                                    typename ComputeT::value_type,
+                                    1u,
+                                    1u,
+                                    TBlockX,
+                                    TBlockY,
+                                    WaveSize,
+                                    ArchId>
+    {
+        using Base       = GemmPredicatesBase<BlockM,
+                                        BlockN,
+                                        BlockK,
+                                        typename InputT::value_type,
+                                        typename OutputT::value_type,
+                                        typename ComputeT::value_type,
+                                        1u,
+                                        1u,
+                                        TBlockX,
+                                        TBlockY,
+                                        WaveSize,
+                                        ArchId>;
+        using TestTraits = typename Base::TestTraits;
+
+    private:
+        using RealInputT   = typename InputT::value_type;
+        using RealComputeT = typename ComputeT::value_type;
+
+        enum struct ComplexPredicates : bool
+        {
+            // cf16 accumulates in cf32, cf32 and cf64 in themselves
+            TypesTest
+            = (std::is_same_v<RealInputT, float16_t> && std::is_same_v<RealComputeT, float32_t>)
+              || (std::is_same_v<RealInputT, float32_t> && std::is_same_v<RealComputeT, float32_t>)
+              || (std::is_same_v<RealInputT, float64_t>
+                  && std::is_same_v<RealComputeT, float64_t>),
+
+            // Real and imag fragments double the register cost
+            CostABTest
+            = ((2u * ((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB))
+               <= 256u),
+            CostCTest = ((2u * (uint32_t)TestTraits::Cost::TileC) <= 256u),
+            CostDTest = ((2u * (uint32_t)TestTraits::Cost::TileD) <= 256u),
+
+            Enable = (TypesTest && CostABTest && CostCTest && CostDTest)
+        };
+
+#if !NDEBUG
+        static constexpr void debugComplexPredicates()
+        {
+            std::cout << "Complex Predicates:\n";
+            std::cout << "TypesTest: " << (bool)ComplexPredicates::TypesTest << std::endl;
+            std::cout << "CostABTest: " << (bool)ComplexPredicates::CostABTest << std::endl;
+            std::cout << "CostCTest: " << (bool)ComplexPredicates::CostCTest << std::endl;
+            std::cout << "CostDTest: " << (bool)ComplexPredicates::CostDTest << std::endl;
+            std::cout << "Enable: " << (bool)ComplexPredicates::Enable << std::endl;
+        }
+#endif // !NDEBUG
+
+    public:
+        constexpr static bool enableBuild()
+        {
+            return Base::enableBuild() && (bool)ComplexPredicates::Enable;
+        }
+
+        constexpr static bool enableRun()
+        {
+            return Base::enableRun() && (bool)ComplexPredicates::Enable;
+        }
+
+#if !NDEBUG
+        constexpr static void debugPredicates()
+        {
+            std::cout << "Base predicates:\n";
+            Base::debugPredicates();
+            std::cout << "\nDerived Predicates:\n";
+            debugComplexPredicates();
+
+            std::cout << "Overall enable build: " << enableBuild() << std::endl;
+            std::cout << "Overall enable run: " << enableRun() << std::endl;
+        }
+#endif // !NDEBUG
+    };
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_PREDICATES
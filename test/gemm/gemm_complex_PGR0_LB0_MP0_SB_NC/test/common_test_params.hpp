@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_COMMON_TEST_PARAMS
+#define ROCWMMA_GEMM_COMMON_TEST_PARAMS
+
+#include "gemm_common_test_params.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// FWD declarations
+    ///
+
+    class KernelGenerator_Complex_PGR0_LB0_MP0_SB_NC;
+
+    ///
+    /// Generalized kernel params for complex tests
+    ///
+    struct CommonTestParams : public GemmCommonTestParams
+    {
+        ///
+        /// Kernel generator impl objects
+        ///
+        using KernelGeneratorImpl = KernelGenerator_Complex_PGR0_LB0_MP0_SB_NC;
+
+        ///
+        /// Complex types: cf16 accumulates in cf32
+        /// Layout: InputT, OutputT, ComputeT
+        ///
+
+        // 16 x 16 supports up to cf64
+        using TestTypes16x16 = TestTypesComplex;
+
+        // 32 x 32 supports up to cf32
+        using TestTypes32x32
+            = std::tuple<std::tuple<complex_float16_t, complex_float32_t, complex_float32_t>,
+                         std::tuple<complex_float32_t, complex_float32_t, complex_float32_t>>;
+
+        ///
+        /// Block sizes: complex fragments hold twice the registers of
+        /// real ones, so BlockK is limited to the medium sets.
+        ///
+        using TestBlockSizes16x16 = TestBlockSizes16x16MediumBlockK;
+        using TestBlockSizes32x32 = TestBlockSizes32x32MediumBlockK;
+    };
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
@@ -133,13 +133,13 @@ namespace rocwmma
             template <template <uint32_t, uint32_t> class Schedule,
                       uint32_t TBlockX,
                       uint32_t TBlockY>
-            struct WaveCountIsConstexpr<Schedule<TBlockX, TBlockY>> : public std::true_type
+            struct WaveCountIsConstexpr<Schedule<TBlockX, TBlockY>> : public true_type
             {
             };
 
             // Schedule with TBlockX/Y = (0,0) values does not have constexpr waveCount();
             template <template <uint32_t, uint32_t> class Schedule>
-            struct WaveCountIsConstexpr<Schedule<0u, 0u>> : public std::false_type
+            struct WaveCountIsConstexpr<Schedule<0u, 0u>> : public false_type
             {
             };
 
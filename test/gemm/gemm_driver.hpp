@@ -26,6 +26,8 @@
 #ifndef GEMM_DRIVER_HPP
 #define GEMM_DRIVER_HPP
 
+#include "gemm_phase_trace.hpp"
+
 namespace rocwmma
 {
     /* GemmDriver class:
@@ -61,6 +63,9 @@ namespace rocwmma
             using LRFragA = typename LdsMapping::LRFragA;
             using LRFragB = typename LdsMapping::LRFragB;
 
+            // Per-wave phase timers, empty unless ROCWMMA_GEMM_PHASE_TRACE
+            using PhaseRecorder = GemmPhaseTrace::WaveRecorder<>;
+
             template <typename FragT>
             using MappingUtil = GetMappingUtil_t<FragT>;
 
@@ -75,12 +80,12 @@ namespace rocwmma
             // Ensure that splitCounts are the same on both sides of
             // global fetch and local writes to match fragment data locality.
             constexpr static auto splitCountA
-                = std::min((uint32_t)GetIOTraitsFragA<GRFragA>::IOCount,
-                           (uint32_t)GetIOTraitsFragA<LWFragA>::IOCount);
+                = min((uint32_t)GetIOTraitsFragA<GRFragA>::IOCount,
+                      (uint32_t)GetIOTraitsFragA<LWFragA>::IOCount);
 
             constexpr static auto splitCountB
-                = std::min((uint32_t)GetIOTraitsFragB<GRFragB>::IOCount,
-                           (uint32_t)GetIOTraitsFragB<LWFragB>::IOCount);
+                = min((uint32_t)GetIOTraitsFragB<GRFragB>::IOCount,
+                      (uint32_t)GetIOTraitsFragB<LWFragB>::IOCount);
 
             static_assert(
                 ((uint32_t)GetIOTraitsFragA<GRFragA>::IOCount % splitCountA == 0u)
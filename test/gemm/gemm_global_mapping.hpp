@@ -171,6 +171,15 @@ namespace rocwmma
 
                 // Global matrix coordinate of wave tile for the current wave
                 __device__ constexpr static inline auto waveTileCoordC();
+
+                // As above, for an explicit workgroup coordinate in place of blockIdx,
+                // e.g. the (x, y) of a tile claimed from a tile_queue in persistent kernels
+                template <typename CoordT>
+                __device__ constexpr static inline auto
+                    macroTileCoordC(CoordT const& workgroupCoord);
+                template <typename CoordT>
+                __device__ constexpr static inline auto
+                    waveTileCoordC(CoordT const& workgroupCoord);
             };
 
         } // namespace detail
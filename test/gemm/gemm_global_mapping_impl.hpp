@@ -157,6 +157,22 @@ namespace rocwmma
             {
                 return macroTileCoordC() + waveOffsetC();
             }
+
+            template <MappingBaseT>
+            template <typename CoordT>
+            __device__ constexpr inline auto
+                MappingBase<MappingBaseT_impl>::macroTileCoordC(CoordT const& workgroupCoord)
+            {
+                return workgroupCoord * macroTileSizeC();
+            }
+
+            template <MappingBaseT>
+            template <typename CoordT>
+            __device__ constexpr inline auto
+                MappingBase<MappingBaseT_impl>::waveTileCoordC(CoordT const& workgroupCoord)
+            {
+                return macroTileCoordC(workgroupCoord) + waveOffsetC();
+            }
         }
 
 #undef MappingBaseT
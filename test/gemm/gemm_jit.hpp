@@ -0,0 +1,660 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_JIT_HPP
+#define ROCWMMA_GEMM_JIT_HPP
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Host-side generation of runtime-specialized GEMM kernels.
+// Problem sizes, leading dims and alpha / beta zero-ness are baked into the
+// source as compile-time constants, and the GemmDriver configuration is
+// picked from a heuristic table. Compilation (e.g. hipRTC) is left to the
+// caller; this layer has no HIP dependency.
+namespace rocwmma
+{
+    namespace GemmJit
+    {
+        enum struct ArchFamily
+        {
+            GFX9,
+            GFX11,
+            GFX12,
+            UNSUPPORTED
+        };
+
+        // Accepts full target names, e.g. gfx90a:sramecc+:xnack-
+        inline ArchFamily archFamily(std::string const& arch)
+        {
+            auto name = arch.substr(0, arch.find(':'));
+            if(name == "gfx908" || name == "gfx90a" || name == "gfx940" || name == "gfx941"
+               || name == "gfx942")
+            {
+                return ArchFamily::GFX9;
+            }
+            if(name == "gfx1100" || name == "gfx1101" || name == "gfx1102")
+            {
+                return ArchFamily::GFX11;
+            }
+            if(name == "gfx1200" || name == "gfx1201")
+            {
+                return ArchFamily::GFX12;
+            }
+            return ArchFamily::UNSUPPORTED;
+        }
+
+        inline uint32_t waveSize(ArchFamily family)
+        {
+            return family == ArchFamily::GFX9 ? 64u : 32u;
+        }
+
+        // Element size of rocWMMA data type names
+        inline uint32_t dataTypeBytes(std::string const& type)
+        {
+            static const std::map<std::string, uint32_t> sizes = {{"int8_t", 1u},
+                                                                  {"float8_t", 1u},
+                                                                  {"bfloat8_t", 1u},
+                                                                  {"float16_t", 2u},
+                                                                  {"hfloat16_t", 2u},
+                                                                  {"bfloat16_t", 2u},
+                                                                  {"int32_t", 4u},
+                                                                  {"float32_t", 4u},
+                                                                  {"xfloat32_t", 4u},
+                                                                  {"float64_t", 8u}};
+
+            auto it = sizes.find(type);
+            if(it == sizes.end())
+            {
+                throw std::invalid_argument("GemmJit: unknown data type " + type);
+            }
+            return it->second;
+        }
+
+        // Input types the PGR1_LB2_MP0_MB_CP kernel predicates build for on the
+        // given arch. Anything else would only fail in the generated static_assert.
+        inline bool isSupportedInputType(std::string const& arch, std::string const& type)
+        {
+            auto name      = arch.substr(0, arch.find(':'));
+            auto isGfx94x  = name == "gfx940" || name == "gfx941" || name == "gfx942";
+            auto isF8      = type == "float8_t" || type == "bfloat8_t";
+            auto isInt8F16 = type == "int8_t" || type == "float16_t" || type == "hfloat16_t"
+                             || type == "bfloat16_t";
+
+            switch(archFamily(arch))
+            {
+            case ArchFamily::GFX9:
+                // 8-bit floats and xfloat32_t need gfx94x; gfx908 has no float64_t mma
+                if(isF8 || type == "xfloat32_t")
+                {
+                    return isGfx94x;
+                }
+                if(type == "float64_t")
+                {
+                    return name != "gfx908";
+                }
+                return isInt8F16 || type == "float32_t";
+            case ArchFamily::GFX11:
+                return isInt8F16;
+            case ArchFamily::GFX12:
+                return isInt8F16 || isF8;
+            default:
+                return false;
+            }
+        }
+
+        ///
+        /// Runtime problem to specialize for
+        ///
+        struct Problem
+        {
+            uint32_t m, n, k;
+            uint32_t lda, ldb, ldc, ldd;
+
+            std::string inputT, outputT, computeT;
+
+            // "row_major" or "col_major"
+            std::string layoutA, layoutB, layoutC, layoutD;
+
+            bool alphaZero = false;
+            bool betaZero  = false;
+
+            // Full target name of the device
+            std::string arch;
+
+            // Packed leading dims for the current layouts
+            void setPackedLeadingDims()
+            {
+                lda = layoutA == "row_major" ? k : m;
+                ldb = layoutB == "row_major" ? n : k;
+                ldc = layoutC == "row_major" ? n : m;
+                ldd = layoutD == "row_major" ? n : m;
+            }
+        };
+
+        ///
+        /// GemmDriver configuration for the PGR1_LB2_MP0_MB_CP kernel flow
+        ///
+        struct Config
+        {
+            uint32_t    blockM, blockN, blockK;
+            uint32_t    blocksX, blocksY;
+            uint32_t    tBlockX, tBlockY;
+            std::string gemmConfig;
+            std::string layoutLds;
+
+            uint32_t macroTileM(uint32_t waveSize) const
+            {
+                return blockM * blocksX * tBlockX / waveSize;
+            }
+
+            uint32_t macroTileN() const
+            {
+                return blockN * blocksY * tBlockY;
+            }
+        };
+
+        // Table rows are tried in order; the first supported row that tiles
+        // the problem exactly wins. Rows are ordered from largest macro tile to
+        // smallest so that big problems get the most data re-use.
+        struct HeuristicEntry
+        {
+            ArchFamily family;
+            uint32_t   inputBytes;
+            Config     config;
+        };
+
+        inline std::vector<HeuristicEntry> const& defaultHeuristics()
+        {
+            constexpr auto Wg  = "WorkgroupLevel::LdsNT";
+            constexpr auto Blk = "BlockLevel::LdsNT";
+            constexpr auto Col = "col_major";
+
+            static const std::vector<HeuristicEntry> table = {
+                // gfx9, 16-bit inputs
+                {ArchFamily::GFX9, 2u, {32, 32, 16, 2, 2, 128, 2, Wg, Col}},
+                {ArchFamily::GFX9, 2u, {32, 32, 16, 1, 1, 128, 2, Wg, Col}},
+                {ArchFamily::GFX9, 2u, {16, 16, 32, 1, 1, 64, 1, Blk, Col}},
+                // gfx9, 8-bit inputs
+                {ArchFamily::GFX9, 1u, {32, 32, 32, 2, 2, 128, 2, Wg, Col}},
+                {ArchFamily::GFX9, 1u, {16, 16, 64, 1, 1, 64, 1, Blk, Col}},
+                // gfx9, 32-bit inputs
+                {ArchFamily::GFX9, 4u, {32, 32, 8, 2, 2, 128, 2, Wg, Col}},
+                {ArchFamily::GFX9, 4u, {16, 16, 16, 1, 1, 64, 1, Blk, Col}},
+                // gfx9, 64-bit inputs
+                {ArchFamily::GFX9, 8u, {16, 16, 16, 2, 2, 128, 2, Wg, Col}},
+                {ArchFamily::GFX9, 8u, {16, 16, 16, 1, 1, 64, 1, Blk, Col}},
+                // gfx11 / gfx12: wave32, BlockM / N = 16 only
+                {ArchFamily::GFX11, 2u, {16, 16, 16, 2, 2, 64, 2, Wg, Col}},
+                {ArchFamily::GFX11, 2u, {16, 16, 16, 1, 1, 32, 1, Blk, Col}},
+                {ArchFamily::GFX11, 1u, {16, 16, 16, 1, 1, 32, 1, Blk, Col}},
+                {ArchFamily::GFX12, 2u, {16, 16, 16, 2, 2, 64, 2, Wg, Col}},
+                {ArchFamily::GFX12, 2u, {16, 16, 16, 1, 1, 32, 1, Blk, Col}},
+                {ArchFamily::GFX12, 1u, {16, 16, 16, 1, 1, 32, 1, Blk, Col}},
+            };
+            return table;
+        }
+
+        inline std::optional<Config>
+            selectConfig(Problem const&                     problem,
+                         std::vector<HeuristicEntry> const& table = defaultHeuristics())
+        {
+            auto family     = archFamily(problem.arch);
+            auto inputBytes = dataTypeBytes(problem.inputT);
+            auto wave       = waveSize(family);
+
+            if(!isSupportedInputType(problem.arch, problem.inputT))
+            {
+                return std::nullopt;
+            }
+
+            for(auto const& entry : table)
+            {
+                auto const& config = entry.config;
+                if(entry.family != family || entry.inputBytes != inputBytes)
+                {
+                    continue;
+                }
+
+                // Specialized kernels carry no bounds checks, so tiles must be exact
+                auto tileM = config.macroTileM(wave);
+                auto tileN = config.macroTileN();
+                if(tileM && tileN && problem.m % tileM == 0u && problem.n % tileN == 0u
+                   && problem.k % config.blockK == 0u)
+                {
+                    return config;
+                }
+            }
+            return std::nullopt;
+        }
+
+        ///
+        /// Generated program and its launch parameters
+        ///
+        struct Program
+        {
+            std::string              source;
+            std::vector<std::string> options;
+            std::string              kernelName;
+            Config                   config;
+
+            uint32_t gridX, gridY;
+            uint32_t blockX, blockY;
+            uint32_t ldsBytes;
+        };
+
+        static constexpr char const* KernelName = "rocwmma_jit_gemm";
+
+        // Fully unroll the K loop up to this trip count
+        static constexpr uint32_t MaxFullUnroll = 64u;
+
+        namespace detail
+        {
+            inline std::string substitute(std::string                               text,
+                                          std::map<std::string, std::string> const& values)
+            {
+                for(auto const& [name, value] : values)
+                {
+                    auto token = "${" + name + "}";
+                    for(auto pos = text.find(token); pos != std::string::npos;
+                        pos      = text.find(token, pos + value.size()))
+                    {
+                        text.replace(pos, token.size(), value);
+                    }
+                }
+                return text;
+            }
+
+            inline void validate(Problem const& problem)
+            {
+                auto checkLayout = [](std::string const& layout) {
+                    if(layout != "row_major" && layout != "col_major")
+                    {
+                        throw std::invalid_argument("GemmJit: unknown layout " + layout);
+                    }
+                };
+                checkLayout(problem.layoutA);
+                checkLayout(problem.layoutB);
+                checkLayout(problem.layoutC);
+                checkLayout(problem.layoutD);
+
+                // Smallest valid leading dim for each layout
+                auto minLd = [](std::string const& layout, uint32_t rows, uint32_t cols) {
+                    return layout == "row_major" ? cols : rows;
+                };
+                if(problem.m == 0u || problem.n == 0u || problem.k == 0u
+                   || problem.lda < minLd(problem.layoutA, problem.m, problem.k)
+                   || problem.ldb < minLd(problem.layoutB, problem.k, problem.n)
+                   || problem.ldc < minLd(problem.layoutC, problem.m, problem.n)
+                   || problem.ldd < minLd(problem.layoutD, problem.m, problem.n))
+                {
+                    throw std::invalid_argument("GemmJit: invalid problem dimensions");
+                }
+
+                if(archFamily(problem.arch) == ArchFamily::UNSUPPORTED)
+                {
+                    throw std::invalid_argument("GemmJit: unsupported arch " + problem.arch);
+                }
+            }
+
+            static constexpr char const* SourceTemplate
+                = R"(// Generated by rocWMMA GemmJit. Do not edit.
+// ${DESCRIPTION}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "gemm_config.hpp"
+#include "kernel_predicates.hpp"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    namespace GemmJitKernel
+    {
+        // Problem constants
+        constexpr uint32_t M   = ${M}u;
+        constexpr uint32_t N   = ${N}u;
+        constexpr uint32_t K   = ${K}u;
+        constexpr uint32_t Lda = ${LDA}u;
+        constexpr uint32_t Ldb = ${LDB}u;
+        constexpr uint32_t Ldc = ${LDC}u;
+        constexpr uint32_t Ldd = ${LDD}u;
+
+        constexpr bool AlphaZero = ${ALPHA_ZERO};
+        constexpr bool BetaZero  = ${BETA_ZERO};
+
+        // GemmDriver configuration
+        constexpr uint32_t BlockM  = ${BLOCK_M}u;
+        constexpr uint32_t BlockN  = ${BLOCK_N}u;
+        constexpr uint32_t BlockK  = ${BLOCK_K}u;
+        constexpr uint32_t BlocksX = ${BLOCKS_X}u;
+        constexpr uint32_t BlocksY = ${BLOCKS_Y}u;
+        constexpr uint32_t TBlockX = ${TBLOCK_X}u;
+        constexpr uint32_t TBlockY = ${TBLOCK_Y}u;
+
+        using InputT   = ${INPUT_T};
+        using OutputT  = ${OUTPUT_T};
+        using ComputeT = ${COMPUTE_T};
+
+        using LayoutA   = ${LAYOUT_A};
+        using LayoutB   = ${LAYOUT_B};
+        using LayoutC   = ${LAYOUT_C};
+        using LayoutD   = ${LAYOUT_D};
+        using LayoutLds = ${LAYOUT_LDS};
+
+        using GemmConfig = CooperativeGemm::${GEMM_CONFIG};
+
+        using Guard = gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
+                                                    BlockN,
+                                                    BlockK,
+                                                    InputT,
+                                                    OutputT,
+                                                    ComputeT,
+                                                    LayoutA,
+                                                    LayoutB,
+                                                    LayoutC,
+                                                    LayoutD,
+                                                    LayoutLds,
+                                                    GemmConfig,
+                                                    BlocksX,
+                                                    BlocksY,
+                                                    TBlockX,
+                                                    TBlockY,
+                                                    Constants::AMDGCN_WAVE_SIZE,
+                                                    Constants::AMDGCN_CURRENT_ARCH_ID>;
+
+        static_assert(Guard::enableBuild(), "GemmJit configuration is not supported on target");
+
+        using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                          BlockN,
+                                                                          BlockK,
+                                                                          InputT,
+                                                                          OutputT,
+                                                                          ComputeT,
+                                                                          LayoutA,
+                                                                          LayoutB,
+                                                                          LayoutC,
+                                                                          LayoutD,
+                                                                          BlocksX,
+                                                                          BlocksY,
+                                                                          TBlockX,
+                                                                          TBlockY>;
+
+        using LdsMapping     = typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+        using CoopSchedulerA = typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+        using CoopSchedulerB = typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+        using GemmDriver     = typename GemmConfig::
+            template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+        using DataMappingA   = GetDataLayout_t<typename GlobalMapping::MfmaFragA>;
+        using DataMappingB   = GetDataLayout_t<typename GlobalMapping::MfmaFragB>;
+        using DataMappingC   = GetDataLayout_t<typename GlobalMapping::MfmaFragC>;
+        using DataMappingD   = GetDataLayout_t<typename GlobalMapping::MfmaFragD>;
+        using DataMappingLds = typename LdsMapping::DataLayout;
+
+    } // namespace GemmJitKernel
+} // namespace rocwmma
+
+// Grid is exactly ${GRID_X} x ${GRID_Y} macro tiles, so no bounds checks are needed.
+extern "C" __global__ void __launch_bounds__(${THREADS})
+    ${KERNEL_NAME}(rocwmma::GemmJitKernel::InputT const*  a,
+                   rocwmma::GemmJitKernel::InputT const*  b,
+                   rocwmma::GemmJitKernel::OutputT const* c,
+                   rocwmma::GemmJitKernel::OutputT*       d,
+                   rocwmma::GemmJitKernel::ComputeT       alpha,
+                   rocwmma::GemmJitKernel::ComputeT       beta)
+{
+    using namespace rocwmma;
+    using namespace rocwmma::GemmJitKernel;
+
+    ///
+    /// Initialize accumulation frags
+    ///
+    typename GlobalMapping::MfmaBuffAcc fragsAcc;
+    GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
+
+    if constexpr(!AlphaZero)
+    {
+        ///
+        /// Setup global addressing offsets in 1D
+        ///
+        auto globalReadOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(), Lda);
+        auto globalReadOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(), Ldb);
+        auto kStepOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), Lda);
+        auto kStepOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), Ldb);
+
+        ///
+        /// Start global prefetch
+        ///
+        typename GlobalMapping::GRBuffA grBuffA;
+        typename GlobalMapping::GRBuffB grBuffB;
+        GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, Lda);
+        GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, Ldb);
+        globalReadOffsetA += kStepOffsetA;
+        globalReadOffsetB += kStepOffsetB;
+
+        ///
+        /// Setup LDS addressing: 2 LDS blocks for pipelining
+        ///
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto  sizeLds  = LdsMapping::sizeLds();
+        auto* ldsPtrLo = reinterpret_cast<InputT*>(localMemPtr);
+        auto* ldsPtrHi = ldsPtrLo + get<0>(sizeLds) * get<1>(sizeLds);
+
+        auto ldlds = LdsMapping::ldLds();
+        auto ldsWriteOffsetA = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordA(), ldlds);
+        auto ldsWriteOffsetB = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordB(), ldlds);
+        auto ldsReadOffsetA  = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordA(), ldlds);
+        auto ldsReadOffsetB  = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordB(), ldlds);
+
+        ///
+        /// Write prefetch to local
+        ///
+        GemmDriver::localWriteCoopA(ldsPtrLo + ldsWriteOffsetA, grBuffA, ldlds);
+        GemmDriver::localWriteCoopB(ldsPtrLo + ldsWriteOffsetB, grBuffB, ldlds);
+        GemmDriver::syncWorkgroup();
+
+        ///
+        /// Accumulate A * B: ${K_ITERATIONS} steady-state iterations
+        ///
+${K_UNROLL}
+        for(uint32_t currentK = BlockK; currentK < K; currentK += BlockK)
+        {
+            typename GlobalMapping::MfmaBuffA fragsA;
+            typename GlobalMapping::MfmaBuffB fragsB;
+
+            GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
+            GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
+
+            GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, Lda);
+            GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, Ldb);
+            globalReadOffsetA += kStepOffsetA;
+            globalReadOffsetB += kStepOffsetB;
+
+            GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+
+            GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldlds);
+            GemmDriver::localWriteCoopB(ldsPtrHi + ldsWriteOffsetB, grBuffB, ldlds);
+            GemmDriver::syncWorkgroup();
+
+            auto* tmp = ldsPtrLo;
+            ldsPtrLo  = ldsPtrHi;
+            ldsPtrHi  = tmp;
+        }
+
+        ///
+        /// Clean up tail A * B
+        ///
+        typename GlobalMapping::MfmaBuffA fragsA;
+        typename GlobalMapping::MfmaBuffB fragsB;
+        GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
+        GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
+        GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+    }
+
+    ///
+    /// D = alpha * accum + beta * C
+    ///
+    typename GlobalMapping::MfmaBuffC fragsC;
+    if constexpr(BetaZero)
+    {
+        GemmDriver::fill(fragsC, static_cast<OutputT>(0));
+    }
+    else
+    {
+        auto globalReadOffsetC = DataMappingC::fromMatrixCoord(GlobalMapping::readCoordC(), Ldc);
+        GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, Ldc);
+    }
+
+    typename GlobalMapping::MfmaBuffD fragsD;
+    auto globalWriteOffsetD = DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(), Ldd);
+    GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+    GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, Ldd);
+}
+)";
+        } // namespace detail
+
+        inline std::string generateSource(Problem const& problem, Config const& config)
+        {
+            detail::validate(problem);
+
+            auto wave        = waveSize(archFamily(problem.arch));
+            auto kIterations = problem.k / config.blockK - 1u;
+
+            std::ostringstream description;
+            description << problem.inputT << "_" << problem.outputT << "_" << problem.computeT
+                        << " " << problem.layoutA << "_" << problem.layoutB << "_"
+                        << problem.layoutC << "_" << problem.layoutD << " M=" << problem.m
+                        << " N=" << problem.n << " K=" << problem.k << " on " << problem.arch;
+
+            auto toString = [](auto value) { return std::to_string(value); };
+            return detail::substitute(
+                detail::SourceTemplate,
+                {{"DESCRIPTION", description.str()},
+                 {"M", toString(problem.m)},
+                 {"N", toString(problem.n)},
+                 {"K", toString(problem.k)},
+                 {"LDA", toString(problem.lda)},
+                 {"LDB", toString(problem.ldb)},
+                 {"LDC", toString(problem.ldc)},
+                 {"LDD", toString(problem.ldd)},
+                 {"ALPHA_ZERO", problem.alphaZero ? "true" : "false"},
+                 {"BETA_ZERO", problem.betaZero ? "true" : "false"},
+                 {"BLOCK_M", toString(config.blockM)},
+                 {"BLOCK_N", toString(config.blockN)},
+                 {"BLOCK_K", toString(config.blockK)},
+                 {"BLOCKS_X", toString(config.blocksX)},
+                 {"BLOCKS_Y", toString(config.blocksY)},
+                 {"TBLOCK_X", toString(config.tBlockX)},
+                 {"TBLOCK_Y", toString(config.tBlockY)},
+                 {"INPUT_T", problem.inputT},
+                 {"OUTPUT_T", problem.outputT},
+                 {"COMPUTE_T", problem.computeT},
+                 {"LAYOUT_A", problem.layoutA},
+                 {"LAYOUT_B", problem.layoutB},
+                 {"LAYOUT_C", problem.layoutC},
+                 {"LAYOUT_D", problem.layoutD},
+                 {"LAYOUT_LDS", config.layoutLds},
+                 {"GEMM_CONFIG", config.gemmConfig},
+                 {"GRID_X", toString(problem.m / config.macroTileM(wave))},
+                 {"GRID_Y", toString(problem.n / config.macroTileN())},
+                 {"THREADS", toString(config.tBlockX * config.tBlockY)},
+                 {"KERNEL_NAME", KernelName},
+                 {"K_ITERATIONS", toString(kIterations)},
+                 {"K_UNROLL",
+                  kIterations <= MaxFullUnroll ? "#pragma unroll" : "#pragma unroll 8"}});
+        }
+
+        // Compiler options for the generated source. includeDirs must cover the
+        // rocWMMA headers, test/gemm and the PGR1_LB2_MP0_MB_CP device predicates.
+        inline std::vector<std::string> compileOptions(Problem const&                  problem,
+                                                       std::vector<std::string> const& includeDirs)
+        {
+            std::vector<std::string> options = {"-D__HIP_PLATFORM_AMD__",
+                                                "--std=c++17",
+                                                "-O3",
+                                                "--gpu-architecture=" + problem.arch};
+            if(problem.inputT == "float16_t" || problem.outputT == "float16_t"
+               || problem.computeT == "float16_t")
+            {
+                // rocWMMA float16_t maps to _Float16 only with native half conversions.
+                // The headers test defined(), so the macro must be undefined, not zero.
+                options.push_back("-U__HIP_NO_HALF_CONVERSIONS__");
+            }
+            for(auto const& dir : includeDirs)
+            {
+                options.push_back("-I" + dir);
+            }
+            return options;
+        }
+
+        // Select a configuration and generate the program, or nothing if
+        // no heuristic row tiles the problem.
+        inline std::optional<Program>
+            generate(Problem const&                     problem,
+                     std::vector<std::string> const&    includeDirs,
+                     std::vector<HeuristicEntry> const& table = defaultHeuristics())
+        {
+            detail::validate(problem);
+
+            auto config = selectConfig(problem, table);
+            if(!config)
+            {
+                return std::nullopt;
+            }
+
+            auto wave = waveSize(archFamily(problem.arch));
+
+            Program program;
+            program.source     = generateSource(problem, *config);
+            program.options    = compileOptions(problem, includeDirs);
+            program.kernelName = KernelName;
+            program.config     = *config;
+            program.gridX      = problem.m / config->macroTileM(wave);
+            program.gridY      = problem.n / config->macroTileN();
+            program.blockX     = config->tBlockX;
+            program.blockY     = config->tBlockY;
+
+            // 2 LDS blocks for the prefetch pipeline, as in the test kernel
+            auto ldsRowsA    = config->tBlockX / wave * config->blocksX * config->blockM;
+            auto ldsRowsB    = config->tBlockY * config->blocksY * config->blockN;
+            program.ldsBytes = problem.alphaZero ? 0u
+                                                 : 2u * dataTypeBytes(problem.inputT)
+                                                       * (ldsRowsA + ldsRowsB) * config->blockK;
+            return program;
+        }
+
+    } // namespace GemmJit
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_JIT_HPP
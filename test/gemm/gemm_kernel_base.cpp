@@ -1016,6 +1016,24 @@ namespace rocwmma
     ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(xfloat32_t, float32_t, float32_t);
     ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(float64_t, float64_t, float64_t);
 
+    // Mixed A / B inputs
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(MixedF16I8, float32_t, float32_t);
+
+#if ROCWMMA_FP8
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(MixedF16F8, float32_t, float32_t);
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(MixedBF16F8, float32_t, float32_t);
+#endif
+
+#if ROCWMMA_FP8_FNUZ
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(MixedF16F8Fnuz, float32_t, float32_t);
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(MixedBF16F8Fnuz, float32_t, float32_t);
+#endif
+
+    // Complex inputs
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(complex_float16_t, complex_float32_t, complex_float32_t);
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(complex_float32_t, complex_float32_t, complex_float32_t);
+    ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(complex_float64_t, complex_float64_t, complex_float64_t);
+
 #if ROCWMMA_EXTENDED_TESTS
     ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(int8_t, int8_t, int32_t);
     ROCWMMA_INSTANTIATE_GEMM_KERNEL_BASE(bfloat16_t, bfloat16_t, bfloat16_t);
@@ -27,12 +27,17 @@
 #ifndef ROCWMMA_KERNEL_BASE_HPP
 #define ROCWMMA_KERNEL_BASE_HPP
 
+#include <functional>
 #include <iostream>
 #include <sstream>
 #include <string>
 
+#include "gemm_phase_trace.hpp"
 #include "gemm_resource.hpp"
+#include "gemm_tuning.hpp"
 #include "hip_device.hpp"
+#include "rocwmma_options.hpp"
+#include "roofline.hpp"
 
 namespace rocwmma
 {
@@ -67,6 +72,43 @@ namespace rocwmma
         virtual std::ostream& printHeader(std::ostream& stream) const = 0;
         virtual std::ostream& printKernel(std::ostream& stream) const = 0;
 
+        // Pipelined execution support.
+        // When enabled, exec() captures inputs and results into kernel-owned
+        // host storage, so validateResults() may run on a host worker while
+        // the shared device resources are re-used by subsequent kernels.
+        virtual bool supportsAsyncValidation() const
+        {
+            return false;
+        }
+        virtual void setAsyncValidation(bool enable) {}
+
+        // Autotuning support.
+        // After setup(), describes the problem and this kernel variant, including
+        // whether its run checks passed. Returns false if the kernel isn't tunable.
+        virtual bool tuningCandidate(GemmTuning::Problem&   problem,
+                                     GemmTuning::Candidate& candidate) const
+        {
+            return false;
+        }
+
+        // Measured time of one run of the last exec(), averaged over its hot runs
+        virtual double runTimeMs() const
+        {
+            return 0.0;
+        }
+
+        // Dry-run support.
+        // Runs the kernel checks for the problem against an arch profile instead
+        // of the device, then describes the candidate as tuningCandidate() does.
+        // Nothing is allocated or launched, so no device is needed.
+        virtual bool planCandidate(ProblemParams const&   problem,
+                                   ArchProfile const&     arch,
+                                   GemmTuning::Problem&   tuningProblem,
+                                   GemmTuning::Candidate& candidate)
+        {
+            return false;
+        }
+
         static bool sHeaderPrinted;
     };
 
@@ -95,6 +137,12 @@ namespace rocwmma
         // Shared access to Gemm storage
         using DataStorage = GemmResource<InputT, OutputT>;
 
+        // Datatypes of A and B, and of their fragments for the mma.
+        // These differ for MixedInput.
+        using InputTA   = GemmInputTA_t<InputT>;
+        using InputTB   = GemmInputTB_t<InputT>;
+        using MmaInputT = GemmMmaInputT_t<InputT>;
+
         // Using Hip device backend
         using DeviceInfo = HipDevice;
 
@@ -102,8 +150,8 @@ namespace rocwmma
         using KernelFunc = void (*)(uint32_t, // M
                                     uint32_t, // N
                                     uint32_t, // K
-                                    InputT const*, // A
-                                    InputT const*, // B
+                                    InputTA const*, // A
+                                    InputTB const*, // B
                                     OutputT const*, // C
                                     OutputT*, // D
                                     uint32_t, // lda
@@ -127,6 +175,10 @@ namespace rocwmma
         virtual dim3     gridDim() const;
         virtual dim3     blockDim() const;
 
+        // Device A argument of the kernel.
+        // Defaults to the dense A storage.
+        virtual InputTA const* kernelArgA() const;
+
         // Kernel run checks.
         // True = run test
         // False = skip test
@@ -138,6 +190,12 @@ namespace rocwmma
         // Reset all members to default values
         virtual void reset();
 
+        // Format incoming problem parameters
+        void setProblem(ProblemParams const& problem);
+
+        // Set mRunFlag from the kernel run checks
+        void runChecks();
+
         // Helper function to dispatch kernel guards
         // with runtime TBlockX, TBlockY, WaveSize and Device Arch
         template <template <uint32_t, uint32_t, uint32_t, uint32_t> class TestGuard>
@@ -160,8 +218,43 @@ namespace rocwmma
         virtual HipResource*  getResource() const override;
         virtual std::ostream& printHeader(std::ostream& stream) const override;
         virtual std::ostream& printKernel(std::ostream& stream) const override;
+        virtual bool          supportsAsyncValidation() const override;
+        virtual void          setAsyncValidation(bool enable) override;
+        virtual bool          tuningCandidate(GemmTuning::Problem&   problem,
+                                              GemmTuning::Candidate& candidate) const override;
+        virtual double        runTimeMs() const override;
+        virtual bool          planCandidate(ProblemParams const&   problem,
+                                            ArchProfile const&     arch,
+                                            GemmTuning::Problem&   tuningProblem,
+                                            GemmTuning::Candidate& candidate) override;
 
     protected:
+        // Capture inputs and rocWMMA result for async validation
+        virtual void captureResults();
+
+        // Phase trace support.
+        // Kernels instrumented with GemmDriver phase timers point their device
+        // recorders at the target and return true. The recorders live in the
+        // translation unit of the kernel, so kernels must override this.
+        virtual bool setPhaseTraceTarget(GemmPhaseTrace::Target const& target);
+
+        // Runs one more launch with the phase timers recording, then writes
+        // the capture with its histogram report and Chrome trace
+        void capturePhaseTrace(std::function<void()> const& launch);
+
+        // Roofline model.
+        // Global traffic of one run in bytes. Defaults to the tiled GEMM model
+        // with the reuse of the macro tile that tuningCandidate() describes.
+        virtual double modeledBytes() const;
+
+        // Bytes of A read per logical element, for kernels with packed A
+        virtual double modeledBytesPerElementA() const;
+
+        // Target of the kernel checks: the device, or an arch profile for dry runs
+        uint32_t mDeviceArch;
+        uint32_t mWaveSize;
+        uint32_t mSharedMemSize;
+
         // Problem params for kernel
         uint32_t mTBlockX, mTBlockY;
         uint32_t mM, mN, mK;
@@ -175,9 +268,17 @@ namespace rocwmma
         bool     mValidationResult = false;
         double   mMaxRelativeError;
 
+        // Kernel-owned host storage for async validation
+        bool                                             mAsyncValidation = false;
+        typename DataStorage::template HostPtrT<InputTA> mCapturedA;
+        typename DataStorage::template HostPtrT<InputTB> mCapturedB;
+        typename DataStorage::template HostPtrT<OutputT> mCapturedC, mCapturedD;
+
         // Performance
-        float64_t mElapsedTimeMs, mTotalGFlops, mMeasuredTFlopsPerSec;
-        int32_t   mEfficiency;
+        BenchmarkOption mBenchmarkOption;
+        float64_t       mElapsedTimeMs, mTotalGFlops, mMeasuredTFlopsPerSec;
+        int32_t         mEfficiency;
+        Roofline        mRoofline;
 
         // Reference
         float64_t         mRefMeasuredTFlopsPerSec;
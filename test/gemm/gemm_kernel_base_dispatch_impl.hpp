@@ -63,8 +63,8 @@ namespace rocwmma
         auto dispatchGuardFunc = [this]() {
             bool dispatchResult = false;
 
-            auto waveSize   = DeviceInfo::instance()->warpSize();
-            auto deviceArch = DeviceInfo::instance()->getGcnArch();
+            auto waveSize   = mWaveSize;
+            auto deviceArch = mDeviceArch;
 
 #define CASE_IMPL_ASSIGN4(TBLOCK_X, TBLOCK_Y, WAVE_SIZE, ARCH_ID) \
     dispatchResult = TestGuard<TBLOCK_X, TBLOCK_Y, WAVE_SIZE, ARCH_ID>::enableRun();
@@ -137,8 +137,8 @@ namespace rocwmma
         // - Wave Size [32, 64]
         // - Arch [gfx908, gfx90a, gfx940, gfx941, gfx942, gfx1100, gfx1101, gfx1102]
         auto dispatchKernel = [this]() {
-            auto waveSize   = DeviceInfo::instance()->warpSize();
-            auto deviceArch = DeviceInfo::instance()->getGcnArch();
+            auto waveSize   = mWaveSize;
+            auto deviceArch = mDeviceArch;
 
             // Runtime dispatcher to assign compile time TBlock params.
             auto result = typename std::decay_t<decltype(*this)>::KernelFunc(nullptr);
@@ -28,6 +28,7 @@
 #define ROCWMMA_KERNEL_BASE_IMPL_HPP
 
 #include <cmath>
+#include <fstream>
 #include <tuple>
 
 #include <hip/hip_ext.h>
@@ -41,7 +42,9 @@
 
 #include "common.hpp"
 #include "gemm_kernel_base.hpp"
+#include "gemm_phase_trace_report.hpp"
 #include "performance.hpp"
+#include "rocwmma_options.hpp"
 
 #if ROCWMMA_VALIDATION_TESTS
 #include "reference.hpp" // Vanilla CPU kernel
@@ -57,6 +60,7 @@ namespace rocwmma
     // Using Cpu reference kernel if:
     // - Not using rocBLAS OR
     // - Using rocBLAS and it cannot solve the problem
+    //   (including mixed A / B input types and complex types)
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -79,7 +83,9 @@ namespace rocwmma
                                   LayoutD>::mIsCpuRef
         = !(bool)ROCWMMA_ROCBLAS_INTEGRATION
           || ((bool)ROCWMMA_ROCBLAS_INTEGRATION
-              && !quirks::rocblas_supported<InputT, OutputT, ComputeT>::value);
+              && (!quirks::rocblas_supported<InputT, OutputT, ComputeT>::value
+                  || GemmInputTraits<InputT>::IsMixed
+                  || GemmInputTraits<InputT>::IsComplex));
 
     // Prepare / run reference kernel if:
     // - Validation mode OR
@@ -130,7 +136,8 @@ namespace rocwmma
                                   LayoutC,
                                   LayoutD>::mBenchRef
         = ((bool)ROCWMMA_BENCHMARK_TESTS && ROCWMMA_BENCHMARK_WITH_ROCBLAS
-           && quirks::rocblas_supported<InputT, OutputT, ComputeT>::value);
+           && quirks::rocblas_supported<InputT, OutputT, ComputeT>::value
+           && !GemmInputTraits<InputT>::IsMixed && !GemmInputTraits<InputT>::IsComplex);
 
     template <uint32_t BlockM,
               uint32_t BlockN,
@@ -203,6 +210,30 @@ namespace rocwmma
         return 0;
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    auto GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::kernelArgA() const -> InputTA const*
+    {
+        return DataStorage::instance()->deviceA().get();
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -224,8 +255,7 @@ namespace rocwmma
                         LayoutC,
                         LayoutD>::gridDim() const
     {
-        return dim3(ceilDiv(mM, BlockM * mTBlockX / DeviceInfo::instance()->warpSize()),
-                    ceilDiv(mN, BlockN * mTBlockY));
+        return dim3(ceilDiv(mM, BlockM * mTBlockX / mWaveSize), ceilDiv(mN, BlockN * mTBlockY));
     }
 
     template <uint32_t BlockM,
@@ -276,11 +306,8 @@ namespace rocwmma
                         LayoutC,
                         LayoutD>::checkDevice() const
     {
-        auto& deviceInfo = DeviceInfo::instance();
-        auto  deviceArch = deviceInfo->getGcnArch();
-
         // No unsupported devices
-        return !(deviceArch == DeviceInfo::UNSUPPORTED_ARCH);
+        return !(mDeviceArch == DeviceInfo::UNSUPPORTED_ARCH);
     }
 
     template <uint32_t BlockM,
@@ -307,8 +334,7 @@ namespace rocwmma
         // gridDim() takes the upper bound of block coverage.
         // In case of uneven division, this might put us out of bounds.
         // Forfeit the run because there is no tail for cleanup of remainders.
-        auto tileSize = std::make_pair(BlockM * mTBlockX / DeviceInfo::instance()->warpSize(),
-                                       BlockN * mTBlockY);
+        auto tileSize = std::make_pair(BlockM * mTBlockX / mWaveSize, BlockN * mTBlockY);
         auto gridDims = gridDim();
         return (gridDims.x * std::get<0>(tileSize) == mM)
                && (gridDims.y * std::get<1>(tileSize) == mN) && (mK % BlockK == 0) && BlockK <= mK;
@@ -335,7 +361,7 @@ namespace rocwmma
                         LayoutC,
                         LayoutD>::checkLds() const
     {
-        return ldsUsage() <= DeviceInfo::instance()->sharedMemSize();
+        return ldsUsage() <= mSharedMemSize;
     }
 
     template <uint32_t BlockM,
@@ -387,6 +413,10 @@ namespace rocwmma
                         LayoutC,
                         LayoutD>::reset()
     {
+        mDeviceArch    = DeviceInfo::UNSUPPORTED_ARCH;
+        mWaveSize      = DeviceInfo::UNSUPPORTED_WARP_SIZE;
+        mSharedMemSize = 0u;
+
         mTBlockX = mTBlockY = 0u;
         mM = mN = mK = 0u;
         mLda = mLdb = mLdc = mLdd = 0u;
@@ -399,8 +429,11 @@ namespace rocwmma
         mValidationResult = false;
         mMaxRelativeError = 0.0;
 
+        mBenchmarkOption = BenchmarkOption::EVENT;
+
         mElapsedTimeMs = mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
         mEfficiency                                           = -1;
+        mRoofline                                             = Roofline();
 
         mMeasuredTFlopsPerSec = 0.0;
         mRefEfficiency        = -1;
@@ -451,18 +484,20 @@ namespace rocwmma
                                  LayoutC,
                                  LayoutD>::printHeader(std::ostream& stream /* = std::cout */) const
     {
-        return stream << "TBlkX, TBlkY, "
-                      << "BlkM, BlkN, BlkK, "
-                      << "MatM, MatN, MatK, "
-                      << "alpha, lda, ldb, beta, ldc, ldd, "
-                      << "LytA_LytB_LytC_LytD, "
-                      << "Ti_To_Tc, "
-                      << "elapsedMs, "
-                      << "Problem Size(GFlops), "
-                      << "TFlops/s, "
-                      << "Efficiency(%), "
-                      << (mBenchRef ? "rocBLAS TFlops/s(%), rocBLAS Efficiency(%), " : "")
-                      << "Result" << std::endl;
+        stream << "TBlkX, TBlkY, "
+               << "BlkM, BlkN, BlkK, "
+               << "MatM, MatN, MatK, "
+               << "alpha, lda, ldb, beta, ldc, ldd, "
+               << "LytA_LytB_LytC_LytD, "
+               << "Ti_To_Tc, "
+               << "BenchMode, "
+               << "elapsedMs, "
+               << "Problem Size(GFlops), "
+               << "TFlops/s, "
+               << "Efficiency(%), ";
+        return printRooflineHeader(stream)
+               << (mBenchRef ? "rocBLAS TFlops/s(%), rocBLAS Efficiency(%), " : "") << "Result"
+               << std::endl;
     }
 
     template <uint32_t BlockM,
@@ -492,7 +527,8 @@ namespace rocwmma
                << dataTypeToString<LayoutA>() << "_" << dataTypeToString<LayoutB>() << "_"
                << dataTypeToString<LayoutC>() << "_" << dataTypeToString<LayoutD>() << ", "
                << dataTypeToString<InputT>() << "_" << dataTypeToString<OutputT>() << "_"
-               << dataTypeToString<ComputeT>() << ", ";
+               << dataTypeToString<ComputeT>() << ", " << benchmarkOptionString(mBenchmarkOption)
+               << ", ";
 
         if(!mRunFlag)
         {
@@ -503,19 +539,22 @@ namespace rocwmma
                    << "n/a"
                    << ", "
                    << "n/a"
-                   << ", " << (mBenchRef ? "n/a, n/a, " : "") << "SKIPPED" << std::endl;
+                   << ", ";
+            printRooflineSkipped(stream)
+                << (mBenchRef ? "n/a, n/a, " : "") << "SKIPPED" << std::endl;
         }
         else
         {
 
             stream << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
-                   << ", " << mEfficiency << ", "
-                   << (mBenchRef ? (std::to_string(mRefMeasuredTFlopsPerSec) + ", "
-                                    + std::to_string(mRefEfficiency) + ", ")
-                                 : "")
-                   << ((bool)ROCWMMA_VALIDATION_TESTS ? (mValidationResult ? "PASSED" : "FAILED")
-                                                      : "BENCH")
-                   << std::endl;
+                   << ", " << mEfficiency << ", ";
+            printRoofline(stream, mRoofline)
+                << (mBenchRef ? (std::to_string(mRefMeasuredTFlopsPerSec) + ", "
+                                 + std::to_string(mRefEfficiency) + ", ")
+                              : "")
+                << ((bool)ROCWMMA_VALIDATION_TESTS ? (mValidationResult ? "PASSED" : "FAILED")
+                                                   : "BENCH")
+                << std::endl;
         }
 
         return stream;
@@ -540,13 +579,8 @@ namespace rocwmma
                         LayoutA,
                         LayoutB,
                         LayoutC,
-                        LayoutD>::setup(ProblemParams const& problem)
+                        LayoutD>::setProblem(ProblemParams const& problem)
     {
-        // Reset the flags in case of multiple runs
-        mRunFlag          = true;
-        mValidationResult = false;
-
-        // Format incoming problem parameters
         std::tie(mTBlockX, mTBlockY)
             = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.threadBlockSize)),
                        static_cast<uint32_t const&>(std::get<1>(problem.threadBlockSize)));
@@ -561,13 +595,90 @@ namespace rocwmma
                        (std::is_same<LayoutB, row_major>::value ? mN : mK),
                        (std::is_same<LayoutC, row_major>::value ? mN : mM),
                        (std::is_same<LayoutC, row_major>::value ? mN : mM));
+    }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::runChecks()
+    {
         // Clear the kernel to run
         mRunFlag &= checkDevice();
         mRunFlag &= checkSizes();
         mRunFlag &= checkLds();
         mRunFlag &= checkQuirks();
 
+        // Replayed shape traces only run on kernels matching the recorded signature
+        if(mRunFlag)
+        {
+            std::stringstream types, layouts;
+            types << dataTypeToString<InputT>() << "_" << dataTypeToString<OutputT>() << "_"
+                  << dataTypeToString<ComputeT>();
+            layouts << dataTypeToString<LayoutA>() << "_" << dataTypeToString<LayoutB>() << "_"
+                    << dataTypeToString<LayoutC>() << "_" << dataTypeToString<LayoutD>();
+            mRunFlag &= RocwmmaOptions::instance()->sweep().includes(
+                {mM, mN, mK}, types.str(), layouts.str());
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::setup(ProblemParams const& problem)
+    {
+        // Reset the flags in case of multiple runs
+        mRunFlag          = true;
+        mValidationResult = false;
+
+        // Options are parsed after kernels are constructed
+        auto& options    = RocwmmaOptions::instance();
+        mBenchmarkOption = options->benchmarkOption();
+
+        auto& sweep = options->sweep();
+        mColdRuns   = sweep.coldRuns().value_or(mColdRuns);
+        mHotRuns    = sweep.hotRuns().value_or(mHotRuns);
+
+        // Kernel checks target the current device
+        auto& deviceInfo = DeviceInfo::instance();
+        mDeviceArch      = deviceInfo->getGcnArch();
+        mWaveSize        = deviceInfo->warpSize();
+        mSharedMemSize   = deviceInfo->sharedMemSize();
+
+        setProblem(problem);
+        runChecks();
+
         if(mRunFlag)
         {
             auto& dataInstance = DataStorage::instance();
@@ -585,9 +696,13 @@ namespace rocwmma
                                                      std::numeric_limits<OutputT>::signaling_NaN());
 
             // Initialize the host data if we are to use Cpu validation.
+            // Async validation captures its own copy after exec().
             if constexpr(mRunRefFlag && mIsCpuRef)
             {
-                dataInstance->copyDeviceToHostAll();
+                if(!mAsyncValidation)
+                {
+                    dataInstance->copyDeviceToHostAll();
+                }
             }
         }
     }
@@ -619,20 +734,20 @@ namespace rocwmma
             /// Run ROCWMMA kernel
             ///
 
-            auto rocwmmaKernel = [this]() {
+            auto rocwmmaKernel = [this](hipStream_t stream = 0) {
                 auto& dataInstance = DataStorage::instance();
                 hipExtLaunchKernelGGL((this->kernelImpl()), // Kernel to launch
                                       (this->gridDim()), // Wg grid size
                                       (this->blockDim()), // Thread block size
                                       (this->ldsUsage()), // sharedMemBytes
-                                      0, // stream
+                                      stream, // stream
                                       nullptr, // Event start
                                       nullptr, // event stop
                                       0, // flags
                                       this->mM, // M
                                       this->mN, // N
                                       this->mK, // K
-                                      dataInstance->deviceA().get(), // A*
+                                      this->kernelArgA(), // A*
                                       dataInstance->deviceB().get(), // B*
                                       dataInstance->deviceC().get(), // C*
                                       dataInstance->deviceD().get(), // D*
@@ -659,31 +774,121 @@ namespace rocwmma
             CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
 
             // Use the hot runs for timing. Ensure sequential execution.
+            // mElapsedTimeMs is the aggregate over all hot runs in every mode.
             mElapsedTimeMs = 0.0;
-            for(uint32_t i = 0; i < mHotRuns; ++i)
+            if(mBenchmarkOption == BenchmarkOption::EVENT)
             {
+                for(uint32_t i = 0; i < mHotRuns; ++i)
+                {
+                    CHECK_HIP_ERROR(hipEventRecord(startEvent));
+                    rocwmmaKernel();
+                    CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+                    CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+                    auto timeMs = 0.0f;
+                    CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+                    mElapsedTimeMs += timeMs;
+                }
+            }
+            else if(mBenchmarkOption == BenchmarkOption::BATCHED)
+            {
+                // Back-to-back launches amortize the event overhead
                 CHECK_HIP_ERROR(hipEventRecord(startEvent));
-                rocwmmaKernel();
+                for(uint32_t i = 0; i < mHotRuns; ++i)
+                {
+                    rocwmmaKernel();
+                }
                 CHECK_HIP_ERROR(hipEventRecord(stopEvent));
                 CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
                 auto timeMs = 0.0f;
                 CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
-                mElapsedTimeMs += timeMs;
+                mElapsedTimeMs = timeMs;
+            }
+            else // BenchmarkOption::GRAPH
+            {
+                // Capture all hot runs into one graph to remove host launch overhead.
+                // Capture requires a non-default stream.
+                hipStream_t    stream;
+                hipGraph_t     graph;
+                hipGraphExec_t graphExec;
+                CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+                CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal));
+                for(uint32_t i = 0; i < mHotRuns; ++i)
+                {
+                    rocwmmaKernel(stream);
+                }
+                CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+                CHECK_HIP_ERROR(hipGraphInstantiate(&graphExec, graph, nullptr, nullptr, 0));
+
+                // Upload the graph before timing
+                CHECK_HIP_ERROR(hipGraphUpload(graphExec, stream));
+
+                CHECK_HIP_ERROR(hipEventRecord(startEvent, stream));
+                CHECK_HIP_ERROR(hipGraphLaunch(graphExec, stream));
+                CHECK_HIP_ERROR(hipEventRecord(stopEvent, stream));
+                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+                auto timeMs = 0.0f;
+                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+                mElapsedTimeMs = timeMs;
+
+                CHECK_HIP_ERROR(hipGraphExecDestroy(graphExec));
+                CHECK_HIP_ERROR(hipGraphDestroy(graph));
+                CHECK_HIP_ERROR(hipStreamDestroy(stream));
             }
 
             // Calculate efficiency
             auto& deviceInfo = DeviceInfo::instance();
 
-            auto devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<InputT>();
-            mTotalGFlops                = calculateGFlops(mM, mN, mK);
+            // Complex multiply-accumulates count as FlopScale real ones
+            auto flopScale = static_cast<float64_t>(GemmInputTraits<InputT>::FlopScale);
+
+            auto devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<MmaInputT>();
+            mTotalGFlops                = calculateGFlops(mM, mN, mK) * flopScale;
             mMeasuredTFlopsPerSec       = calculateTFlopsPerSec(mM, mN, mK, mElapsedTimeMs)
-                                    * static_cast<float64_t>(mHotRuns);
+                                    * static_cast<float64_t>(mHotRuns) * flopScale;
 
             mEfficiency = round(mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
 
+            // Place the kernel on the roofline of the device
+            auto devicePeakGBs = deviceInfo->peakBandwidthGBs();
+            auto runTimeMs     = mElapsedTimeMs / static_cast<float64_t>(mHotRuns);
+            mRoofline          = calculateRoofline(
+                mTotalGFlops, modeledBytes(), runTimeMs, devicePeakGFlopsPerSec, devicePeakGBs);
+
+            if(!RocwmmaOptions::instance()->rooflinePlot().empty())
+            {
+                GemmTuning::Problem   problem;
+                GemmTuning::Candidate candidate;
+                tuningCandidate(problem, candidate);
+
+                std::stringstream label;
+                label << candidate.name() << ", " << mM << "x" << mN << "x" << mK << ", "
+                      << problem.inputT << "_" << problem.outputT << "_" << problem.computeT
+                      << ", " << problem.layouts;
+                appendRooflinePlotData(RocwmmaOptions::instance()->rooflinePlot(),
+                                       label.str(),
+                                       mTotalGFlops,
+                                       runTimeMs,
+                                       mRoofline,
+                                       devicePeakGFlopsPerSec,
+                                       devicePeakGBs);
+            }
+
             CHECK_HIP_ERROR(hipEventDestroy(startEvent));
             CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
 
+            // Phase timers are captured outside of the timed runs
+            if(!RocwmmaOptions::instance()->phaseTrace().empty())
+            {
+                capturePhaseTrace([&rocwmmaKernel]() { rocwmmaKernel(); });
+            }
+
+            // Defer the reference run to validateResults()
+            if(mAsyncValidation)
+            {
+                captureResults();
+                return;
+            }
+
             if constexpr(mRunRefFlag)
             {
                 // Reference kernel selection
@@ -697,7 +902,7 @@ namespace rocwmma
                     // Define fallback CPU kernel
                     auto cpuKernel = [this]() {
                         auto& dataInstance = DataStorage::instance();
-                        gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+                        gemm_CPU<InputTA, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
                             this->mM,
                             this->mN,
                             this->mK,
@@ -740,10 +945,10 @@ namespace rocwmma
                                              this->mK, // K
                                              &(this->mAlpha), // alpha,
                                              dataInstance->deviceA().get(), // A*,
-                                             rocblas_types<InputT>::type(), // a_type
+                                             rocblas_types<InputTA>::type(), // a_type
                                              this->mLda, // lda
                                              dataInstance->deviceB().get(), // B*,
-                                             rocblas_types<InputT>::type(), // b_type
+                                             rocblas_types<InputTB>::type(), // b_type
                                              this->mLdb, // ldb
                                              &(this->mBeta), // beta
                                              dataInstance->deviceC().get(), // C*
@@ -840,7 +1045,7 @@ namespace rocwmma
                 if constexpr(mBenchRef)
                 {
                     auto& deviceInfo             = DeviceInfo::instance();
-                    auto  devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<InputT>();
+                    auto  devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<MmaInputT>();
 
                     auto measuredTFlopsPerSec = calculateTFlopsPerSec(mM, mN, mK, elapsedTimeMs)
                                                 * static_cast<float64_t>(mHotRuns);
@@ -899,19 +1104,6 @@ namespace rocwmma
 
         if(mRunFlag && (bool)ROCWMMA_VALIDATION_TESTS)
         {
-            // If CPU reference, result layout is LayoutD, otherwise rocBLAS ref is always in col_major;
-            using DeviceRefLayout = typename std::conditional_t<mIsCpuRef, LayoutD, col_major>;
-
-            auto& dataInstance = DataStorage::instance();
-
-            // If CPU ref, the rocWMMA result is in device D, otherwise device C
-            auto* rocWMMAResult
-                = mIsCpuRef ? dataInstance->deviceD().get() : dataInstance->deviceC().get();
-
-            // If CPU ref, the reference result is in device C, otherwise device D
-            auto* refResult
-                = mIsCpuRef ? dataInstance->deviceC().get() : dataInstance->deviceD().get();
-
             // Give more error tolerance to ComputeT = fp16,
             // due to MFMA output is always fp32. We downcast the MFMA result to fp16, which
             // will introduce an error compared to native fp16 MAC. The tolerance would be a function
@@ -922,11 +1114,82 @@ namespace rocwmma
             // FMA operations will be very prone to significant errors.
             double errorTolerance = sizeof(ComputeT) < sizeof(float32_t) ? 100.0 : 10.0;
 
-            std::tie(mValidationResult, mMaxRelativeError)
-                = compareEqualLaunchKernel<OutputT, OutputT, LayoutD, DeviceRefLayout>(
-                    rocWMMAResult, refResult, mM, mN, errorTolerance);
+            CompareResult compareResult;
 
-            EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+            if(mAsyncValidation)
+            {
+#if ROCWMMA_VALIDATION_TESTS
+                // Run the CPU reference on captured data, then compare on host.
+                // Only kernel-owned buffers are touched here.
+                auto reference = DataStorage::template allocHost<OutputT>(mM * mN);
+                gemm_CPU<InputTA, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+                    mM,
+                    mN,
+                    mK,
+                    mCapturedA.get(),
+                    mCapturedB.get(),
+                    mCapturedC.get(),
+                    reference.get(),
+                    mAlpha,
+                    mBeta);
+
+                compareResult = compareEqualHost<OutputT, OutputT, LayoutD, LayoutD>(
+                    mCapturedD.get(), reference.get(), mM, mN, errorTolerance);
+#endif // ROCWMMA_VALIDATION_TESTS
+
+                // Release captured storage
+                mCapturedA.reset(nullptr);
+                mCapturedB.reset(nullptr);
+                mCapturedC.reset(nullptr);
+                mCapturedD.reset(nullptr);
+            }
+            else
+            {
+                // If CPU reference, result layout is LayoutD, otherwise rocBLAS ref is always in col_major;
+                using DeviceRefLayout = typename std::conditional_t<mIsCpuRef, LayoutD, col_major>;
+
+                auto& dataInstance = DataStorage::instance();
+
+                // If CPU ref, the rocWMMA result is in device D, otherwise device C
+                auto* rocWMMAResult
+                    = mIsCpuRef ? dataInstance->deviceD().get() : dataInstance->deviceC().get();
+
+                // If CPU ref, the reference result is in device C, otherwise device D
+                auto* refResult
+                    = mIsCpuRef ? dataInstance->deviceC().get() : dataInstance->deviceD().get();
+
+                if(RocwmmaOptions::instance()->validationOption() == ValidationOption::HOST)
+                {
+                    // Bring both results back and reduce on host
+                    auto hostResult = DataStorage::template allocHost<OutputT>(mM * mN);
+                    auto hostRef    = DataStorage::template allocHost<OutputT>(mM * mN);
+                    CHECK_HIP_ERROR(hipMemcpy(hostResult.get(),
+                                              rocWMMAResult,
+                                              mM * mN * sizeof(OutputT),
+                                              hipMemcpyDeviceToHost));
+                    CHECK_HIP_ERROR(hipMemcpy(hostRef.get(),
+                                              refResult,
+                                              mM * mN * sizeof(OutputT),
+                                              hipMemcpyDeviceToHost));
+
+                    compareResult = compareEqualHost<OutputT, OutputT, LayoutD, DeviceRefLayout>(
+                        hostResult.get(), hostRef.get(), mM, mN, errorTolerance);
+                }
+                else
+                {
+                    // Reduce on device, only the summary is copied back
+                    compareResult = compareEqualReduceLaunchKernel<OutputT,
+                                                                   OutputT,
+                                                                   LayoutD,
+                                                                   DeviceRefLayout>(
+                        rocWMMAResult, refResult, mM, mN, errorTolerance);
+                }
+            }
+
+            mValidationResult = compareResult.passed;
+            mMaxRelativeError = compareResult.maxRelativeError;
+
+            EXPECT_TRUE(mValidationResult) << compareResult;
         }
     }
 
@@ -992,6 +1255,370 @@ namespace rocwmma
     {
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    bool GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::supportsAsyncValidation() const
+    {
+        // Only the CPU reference benefits from overlap with device work
+        return (bool)ROCWMMA_VALIDATION_TESTS && mIsCpuRef;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::setAsyncValidation(bool enable)
+    {
+        mAsyncValidation = enable && supportsAsyncValidation();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    bool GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::tuningCandidate(GemmTuning::Problem&   problem,
+                                                  GemmTuning::Candidate& candidate) const
+    {
+        std::stringstream layouts;
+        layouts << dataTypeToString<LayoutA>() << "_" << dataTypeToString<LayoutB>() << "_"
+                << dataTypeToString<LayoutC>() << "_" << dataTypeToString<LayoutD>();
+
+        // Mixed A / B inputs are modeled in their mma input type
+        problem.m           = mM;
+        problem.n           = mN;
+        problem.k           = mK;
+        problem.inputT      = dataTypeToString<MmaInputT>();
+        problem.outputT     = dataTypeToString<OutputT>();
+        problem.computeT    = dataTypeToString<ComputeT>();
+        problem.layouts     = layouts.str();
+        problem.inputBytes  = sizeof(MmaInputT);
+        problem.outputBytes = sizeof(OutputT);
+        problem.betaZero    = (mBeta == static_cast<ComputeT>(0u));
+
+        // Variants fill in their own kernel name and multi-block params
+        candidate.blockM   = BlockM;
+        candidate.blockN   = BlockN;
+        candidate.blockK   = BlockK;
+        candidate.tBlockX  = mTBlockX;
+        candidate.tBlockY  = mTBlockY;
+        candidate.ldsBytes = ldsUsage();
+        candidate.enabled  = mRunFlag;
+        return true;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    double GemmKernelBase<BlockM,
+                          BlockN,
+                          BlockK,
+                          InputT,
+                          OutputT,
+                          ComputeT,
+                          LayoutA,
+                          LayoutB,
+                          LayoutC,
+                          LayoutD>::runTimeMs() const
+    {
+        return mElapsedTimeMs / static_cast<float64_t>(mHotRuns);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    double GemmKernelBase<BlockM,
+                          BlockN,
+                          BlockK,
+                          InputT,
+                          OutputT,
+                          ComputeT,
+                          LayoutA,
+                          LayoutB,
+                          LayoutC,
+                          LayoutD>::modeledBytes() const
+    {
+        GemmTuning::Problem   problem;
+        GemmTuning::Candidate candidate;
+        tuningCandidate(problem, candidate);
+
+        auto outputBytes = static_cast<double>(sizeof(OutputT));
+        return tiledGemmBytes(mM,
+                              mN,
+                              mK,
+                              candidate.macroTileM(mWaveSize),
+                              candidate.macroTileN(),
+                              modeledBytesPerElementA(),
+                              sizeof(InputTB),
+                              problem.betaZero ? 0.0 : outputBytes,
+                              outputBytes);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    double GemmKernelBase<BlockM,
+                          BlockN,
+                          BlockK,
+                          InputT,
+                          OutputT,
+                          ComputeT,
+                          LayoutA,
+                          LayoutB,
+                          LayoutC,
+                          LayoutD>::modeledBytesPerElementA() const
+    {
+        return sizeof(InputTA);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    bool GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::planCandidate(ProblemParams const&   problem,
+                                                ArchProfile const&     arch,
+                                                GemmTuning::Problem&   tuningProblem,
+                                                GemmTuning::Candidate& candidate)
+    {
+        mRunFlag          = true;
+        mValidationResult = false;
+
+        // Kernel checks target the arch profile
+        mDeviceArch    = DeviceInfo::gcnArchFromName(arch.name);
+        mWaveSize      = arch.waveSize;
+        mSharedMemSize = arch.maxLdsBytesPerWorkgroup;
+
+        setProblem(problem);
+        runChecks();
+
+        return tuningCandidate(tuningProblem, candidate);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::captureResults()
+    {
+        auto& dataInstance = DataStorage::instance();
+
+        // Snapshot inputs and the rocWMMA result before the
+        // shared device storage is re-used by the next kernel.
+        DataStorage::reallocHost(mCapturedA, mM * mK);
+        DataStorage::reallocHost(mCapturedB, mK * mN);
+        DataStorage::reallocHost(mCapturedC, mM * mN);
+        DataStorage::reallocHost(mCapturedD, mM * mN);
+
+        DataStorage::copyData(mCapturedA, dataInstance->deviceA(), mM * mK);
+        DataStorage::copyData(mCapturedB, dataInstance->deviceB(), mK * mN);
+        DataStorage::copyData(mCapturedC, dataInstance->deviceC(), mM * mN);
+        DataStorage::copyData(mCapturedD, dataInstance->deviceD(), mM * mN);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    bool GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::setPhaseTraceTarget(GemmPhaseTrace::Target const& target)
+    {
+        return false;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::capturePhaseTrace(std::function<void()> const& launch)
+    {
+        // Nothing to capture from uninstrumented kernels, or builds without
+        // ROCWMMA_GEMM_PHASE_TRACE. A null target also resets the recorders.
+        if(!setPhaseTraceTarget(GemmPhaseTrace::Target{nullptr, 0u}))
+        {
+            std::cout << "Phase trace: n/a (kernel not instrumented or built without "
+                         "ROCWMMA_GEMM_PHASE_TRACE)\n";
+            return;
+        }
+
+        auto grid  = gridDim();
+        auto block = blockDim();
+
+        auto slotRecords   = GemmPhaseTrace::slotRecords(ceilDiv(mK, BlockK));
+        auto wavesPerBlock = ceilDiv(block.x * block.y * block.z, mWaveSize);
+        auto slotCount     = static_cast<uint64_t>(grid.x) * grid.y * grid.z * wavesPerBlock;
+        auto bytes         = slotCount * GemmPhaseTrace::slotBytes(slotRecords);
+
+        // Zeroed slots mark waves that exit without recording
+        uint8_t* deviceSlots = nullptr;
+        CHECK_HIP_ERROR(hipMalloc(&deviceSlots, bytes));
+        CHECK_HIP_ERROR(hipMemset(deviceSlots, 0, bytes));
+
+        setPhaseTraceTarget(GemmPhaseTrace::Target{deviceSlots, slotRecords});
+        launch();
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        setPhaseTraceTarget(GemmPhaseTrace::Target{nullptr, 0u});
+
+        int device, clockRateKhz;
+        CHECK_HIP_ERROR(hipGetDevice(&device));
+        CHECK_HIP_ERROR(
+            hipDeviceGetAttribute(&clockRateKhz, hipDeviceAttributeWallClockRate, device));
+
+        GemmPhaseTrace::Capture capture;
+        capture.header = GemmPhaseTrace::FileHeader{GemmPhaseTrace::FileMagic,
+                                                    GemmPhaseTrace::FileVersion,
+                                                    static_cast<uint32_t>(clockRateKhz),
+                                                    slotRecords,
+                                                    slotCount};
+        capture.slots.resize(bytes);
+        CHECK_HIP_ERROR(
+            hipMemcpy(capture.slots.data(), deviceSlots, bytes, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipFree(deviceSlots));
+
+        // Files <prefix>-<index>.trace, .txt and .json
+        auto path = RocwmmaOptions::instance()->phaseTrace() + "-"
+                    + std::to_string(GemmPhaseTrace::nextCaptureIndex());
+
+        // Reports are titled with the kernel's csv header and row
+        std::stringstream title;
+        printHeader(title);
+        printKernel(title);
+
+        auto trace = GemmPhaseTrace::decode(capture);
+        GemmPhaseTrace::writeCaptureFile(path + ".trace", capture);
+
+        std::ofstream report(path + ".txt");
+        GemmPhaseTrace::writeHistogramReport(report, trace, title.str());
+
+        std::ofstream chromeTrace(path + ".json");
+        GemmPhaseTrace::writeChromeTrace(chromeTrace, trace);
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_KERNEL_BASE_IMPL_HPP
@@ -373,11 +373,11 @@ namespace rocwmma
 
             // This layout is only valid if global reads are MFMA friendly, due to register file transform.
             // In-register layout for MFMA blocks is not the same as wave tile or macro tile.
-            static_assert(std::is_same<typename GlobalMapping::GRFragA,
-                                       typename GlobalMapping::MfmaFragA>::value,
+            static_assert(is_same<typename GlobalMapping::GRFragA,
+                                  typename GlobalMapping::MfmaFragA>::value,
                           "GR A block must be MFMA size");
-            static_assert(std::is_same<typename GlobalMapping::GRFragB,
-                                       typename GlobalMapping::MfmaFragB>::value,
+            static_assert(is_same<typename GlobalMapping::GRFragB,
+                                  typename GlobalMapping::MfmaFragB>::value,
                           "GR B block must be MFMA size");
 
         private: // Coordinate projection helpers
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_MIXED_INPUT_HPP
+#define ROCWMMA_GEMM_MIXED_INPUT_HPP
+
+#include <rocwmma/internal/complex.hpp>
+#include <rocwmma/internal/types.hpp>
+#include <rocwmma/internal/utility/type_traits.hpp>
+#include <rocwmma/internal/utils.hpp>
+
+namespace rocwmma
+{
+    // Input type tag for GEMMs with distinct A and B datatypes, such as
+    // f16 activations x int8 weights. It takes the place of InputT in the
+    // test harness; kernels load both operands into fragments of the wider
+    // datatype, upcasting the narrower one in registers.
+    template <typename InputTA, typename InputTB>
+    struct MixedInput
+    {
+    };
+
+    // Per-matrix datatypes of a harness InputT, which is either one datatype
+    // for both A and B, a MixedInput tag or a complex datatype.
+    template <typename InputT>
+    struct GemmInputTraits
+    {
+        using InputTA   = InputT;
+        using InputTB   = InputT;
+        using MmaInputT = InputT;
+
+        constexpr static bool IsMixed   = false;
+        constexpr static bool IsComplex = false;
+
+        // Real flops of one multiply-accumulate, in units of 2
+        constexpr static uint32_t FlopScale = 1u;
+    };
+
+    template <typename InputTA_In, typename InputTB_In>
+    struct GemmInputTraits<MixedInput<InputTA_In, InputTB_In>>
+    {
+        using InputTA = InputTA_In;
+        using InputTB = InputTB_In;
+
+        // Fragment datatype of both operands for the mma
+        using MmaInputT = conditional_t<(sizeof(InputTA) >= sizeof(InputTB)), InputTA, InputTB>;
+
+        constexpr static bool IsMixed   = true;
+        constexpr static bool IsComplex = false;
+
+        constexpr static uint32_t FlopScale = 1u;
+
+        static_assert(!is_same<InputTA, InputTB>::value, "Mixed inputs must differ");
+    };
+
+    // Complex A and B, stored interleaved. Kernels split them into real and
+    // imag fragments of the real datatype for the mma.
+    template <typename T>
+    struct GemmInputTraits<complex_t<T>>
+    {
+        using InputTA   = complex_t<T>;
+        using InputTB   = complex_t<T>;
+        using MmaInputT = T;
+
+        constexpr static bool IsMixed   = false;
+        constexpr static bool IsComplex = true;
+
+        // 4 real multiplies and 4 real adds
+        constexpr static uint32_t FlopScale = 4u;
+    };
+
+    template <typename InputT>
+    using GemmInputTA_t = typename GemmInputTraits<InputT>::InputTA;
+
+    template <typename InputT>
+    using GemmInputTB_t = typename GemmInputTraits<InputT>::InputTB;
+
+    template <typename InputT>
+    using GemmMmaInputT_t = typename GemmInputTraits<InputT>::MmaInputT;
+
+    ///
+    /// Tested mixed input pairs
+    ///
+
+    using MixedF16I8      = MixedInput<float16_t, int8_t>;
+    using MixedF16F8      = MixedInput<float16_t, float8_t>;
+    using MixedF16F8Fnuz  = MixedInput<float16_t, float8_fnuz_t>;
+    using MixedBF16F8     = MixedInput<bfloat16_t, float8_t>;
+    using MixedBF16F8Fnuz = MixedInput<bfloat16_t, float8_fnuz_t>;
+
+    template <>
+    constexpr const char* dataTypeToString<MixedF16I8>()
+    {
+        return "f16xi8";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<MixedF16F8>()
+    {
+        return "f16xf8";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<MixedF16F8Fnuz>()
+    {
+        return "f16xf8(fnuz)";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<MixedBF16F8>()
+    {
+        return "bf16xf8";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<MixedBF16F8Fnuz>()
+    {
+        return "bf16xf8(fnuz)";
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_MIXED_INPUT_HPP
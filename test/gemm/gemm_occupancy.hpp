@@ -0,0 +1,242 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_OCCUPANCY_HPP
+#define ROCWMMA_GEMM_OCCUPANCY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+
+// Constexpr occupancy model: how many waves of a kernel with a given register
+// and LDS footprint can be resident per SIMD. Nothing here depends on HIP, so
+// the same arithmetic serves static_asserts in device code and host reports.
+namespace rocwmma
+{
+    namespace GemmOccupancy
+    {
+        ///
+        /// Per-arch resource limits. Arch ids match Constants::AMDGCN_ARCH_ID_*.
+        ///
+        struct ResourceLimits
+        {
+            uint32_t waveSize                = 0u;
+            uint32_t simdsPerCu              = 0u;
+            uint32_t maxWavesPerSimd         = 0u;
+            uint32_t vgprsPerSimd            = 0u; // 32-bit registers per lane, all resident waves
+            uint32_t agprsPerSimd            = 0u; // Separate accumulation file (0 = unified)
+            uint32_t maxVgprsPerWave         = 0u; // Addressable by one wave (per file)
+            uint32_t vgprGranularity         = 0u; // Allocation unit per wave
+            uint32_t ldsBytesPerCu           = 0u;
+            uint32_t maxLdsBytesPerWorkgroup = 0u;
+            uint32_t maxThreadsPerWorkgroup  = 0u;
+
+            constexpr bool valid() const
+            {
+                return waveSize > 0u;
+            }
+        };
+
+        constexpr ResourceLimits resourceLimits(uint32_t archId)
+        {
+            switch(archId)
+            {
+            case 0x908:
+                return {64u, 4u, 10u, 512u, 512u, 256u, 8u, 65536u, 65536u, 1024u};
+            case 0x90A:
+            case 0x940:
+            case 0x941:
+            case 0x942:
+                return {64u, 4u, 8u, 512u, 0u, 512u, 8u, 65536u, 65536u, 1024u};
+            case 0x1100:
+            case 0x1101:
+            case 0x1102:
+            case 0x1200:
+            case 0x1201:
+                return {32u, 2u, 16u, 1536u, 0u, 256u, 8u, 65536u, 65536u, 1024u};
+            default:
+                return {};
+            }
+        }
+
+        // Registers a gemm driver needs besides its fragments:
+        // addressing, loop counters and epilogue scratch
+        constexpr uint32_t DriverOverheadVgprs = 16u;
+
+        // Per-wave register allocation unit of every supported arch
+        constexpr uint32_t VgprGranularity = 8u;
+
+        ///
+        /// Footprint of one workgroup. Registers are per lane of each wave.
+        /// AGPRs on an arch without a separate file are counted as VGPRs.
+        ///
+        struct ResourceUsage
+        {
+            uint32_t vgprs    = 0u;
+            uint32_t agprs    = 0u;
+            uint32_t ldsBytes = 0u;
+            uint32_t threads  = 0u;
+        };
+
+        enum struct Limiter : uint32_t
+        {
+            Waves,
+            Vgprs,
+            Agprs,
+            Lds,
+            Threads
+        };
+
+        struct Occupancy
+        {
+            uint32_t wavesPerWorkgroup = 0u;
+            uint32_t workgroupsPerCu   = 0u;
+            uint32_t wavesPerSimd      = 0u;
+
+            // Waves per SIMD allowed by registers alone
+            uint32_t registerWavesPerSimd = 0u;
+
+            // Registers granted per wave, capped at what a wave can address
+            uint32_t allocatedVgprs = 0u;
+            uint32_t allocatedAgprs = 0u;
+
+            Limiter limiter = Limiter::Waves;
+            bool    spills  = false;
+
+            constexpr bool fits() const
+            {
+                return wavesPerSimd > 0u;
+            }
+        };
+
+        namespace detail
+        {
+            constexpr uint32_t ceilDiv(uint32_t num, uint32_t den)
+            {
+                return den ? (num + den - 1u) / den : 0u;
+            }
+
+            constexpr uint32_t allocate(uint32_t regs, ResourceLimits const& limits)
+            {
+                auto granted = ceilDiv(std::max(regs, 1u), limits.vgprGranularity)
+                               * limits.vgprGranularity;
+                return std::min(granted, limits.maxVgprsPerWave);
+            }
+        }
+
+        constexpr Occupancy occupancy(ResourceUsage const& usage, ResourceLimits const& limits)
+        {
+            Occupancy result;
+            if(!limits.valid())
+            {
+                return result;
+            }
+
+            auto separate = limits.agprsPerSimd > 0u;
+            auto vgprs    = separate ? usage.vgprs : usage.vgprs + usage.agprs;
+            auto agprs    = separate ? usage.agprs : 0u;
+
+            // Spilling waves allocate the most they can address
+            result.spills = vgprs > limits.maxVgprsPerWave || agprs > limits.maxVgprsPerWave;
+            result.allocatedVgprs = detail::allocate(vgprs, limits);
+            result.allocatedAgprs = separate ? detail::allocate(agprs, limits) : 0u;
+
+            auto byVgprs = limits.vgprsPerSimd / result.allocatedVgprs;
+            auto byAgprs = separate ? limits.agprsPerSimd / result.allocatedAgprs : byVgprs;
+            result.registerWavesPerSimd = std::min({byVgprs, byAgprs, limits.maxWavesPerSimd});
+
+            result.wavesPerWorkgroup = detail::ceilDiv(usage.threads, limits.waveSize);
+            if(usage.threads == 0u || usage.threads > limits.maxThreadsPerWorkgroup)
+            {
+                result.limiter = Limiter::Threads;
+                return result;
+            }
+
+            // Workgroups per CU from each resource
+            auto perCu = [&](uint32_t wavesPerSimd) {
+                return limits.simdsPerCu * wavesPerSimd / result.wavesPerWorkgroup;
+            };
+            auto byWaves = perCu(limits.maxWavesPerSimd);
+            auto byRegs  = perCu(result.registerWavesPerSimd);
+            auto byLds   = usage.ldsBytes == 0u ? byWaves
+                           : usage.ldsBytes > limits.maxLdsBytesPerWorkgroup
+                               ? 0u
+                               : limits.ldsBytesPerCu / usage.ldsBytes;
+
+            result.workgroupsPerCu = std::min({byWaves, byRegs, byLds});
+            result.limiter         = result.workgroupsPerCu == byWaves ? Limiter::Waves
+                                     : result.workgroupsPerCu == byLds ? Limiter::Lds
+                                     : byAgprs < byVgprs               ? Limiter::Agprs
+                                                                       : Limiter::Vgprs;
+
+            auto waves          = result.workgroupsPerCu * result.wavesPerWorkgroup;
+            result.wavesPerSimd = std::min(detail::ceilDiv(waves, limits.simdsPerCu),
+                                           limits.maxWavesPerSimd);
+            return result;
+        }
+
+        inline char const* toString(Limiter limiter)
+        {
+            switch(limiter)
+            {
+            case Limiter::Waves:
+                return "waves";
+            case Limiter::Vgprs:
+                return "vgprs";
+            case Limiter::Agprs:
+                return "agprs";
+            case Limiter::Lds:
+                return "lds";
+            case Limiter::Threads:
+                return "threads";
+            default:
+                return "unknown";
+            }
+        }
+
+        // One line summary, e.g. for kernel launch logs and the dry run
+        inline std::ostream& printReport(std::ostream&         stream,
+                                         ResourceUsage const&  usage,
+                                         ResourceLimits const& limits)
+        {
+            auto occ = occupancy(usage, limits);
+            stream << "VGPRs " << usage.vgprs << " (" << occ.allocatedVgprs << "/"
+                   << limits.maxVgprsPerWave << ")";
+            if(limits.agprsPerSimd > 0u)
+            {
+                stream << ", AGPRs " << usage.agprs << " (" << occ.allocatedAgprs << "/"
+                       << limits.maxVgprsPerWave << ")";
+            }
+            return stream << ", LDS " << usage.ldsBytes << "/" << limits.maxLdsBytesPerWorkgroup
+                          << " B, waves/SIMD " << occ.wavesPerSimd << "/" << limits.maxWavesPerSimd
+                          << " (" << toString(occ.limiter) << ")" << (occ.spills ? ", SPILLS" : "");
+        }
+
+    } // namespace GemmOccupancy
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_OCCUPANCY_HPP
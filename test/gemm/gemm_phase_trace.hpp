@@ -0,0 +1,241 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_GEMM_PHASE_TRACE_HPP
+#define ROCWMMA_GEMM_PHASE_TRACE_HPP
+
+#include <rocwmma/internal/types.hpp>
+
+// Opt-in phase timers of the GemmDriver kernel flow. Build with
+// ROCWMMA_GEMM_PHASE_TRACE=1 to record them; otherwise the recorder is empty
+// and every call compiles away.
+#ifndef ROCWMMA_GEMM_PHASE_TRACE
+#define ROCWMMA_GEMM_PHASE_TRACE 0
+#endif // ROCWMMA_GEMM_PHASE_TRACE
+
+#if ROCWMMA_GEMM_PHASE_TRACE && !defined(__HIPCC_RTC__)
+#include <hip/hip_runtime.h>
+#include <rocwmma/internal/constants.hpp>
+#endif // ROCWMMA_GEMM_PHASE_TRACE && !defined(__HIPCC_RTC__)
+
+namespace rocwmma
+{
+    namespace GemmPhaseTrace
+    {
+        enum Phase : uint32_t
+        {
+            GlobalRead = 0u,
+            LocalWrite,
+            LocalRead,
+            Mma,
+            Epilogue,
+            PhaseCount
+        };
+
+        ///
+        /// Trace buffer layout: one fixed-size slot per wave of the grid, at
+        /// index workgroup * wavesPerWorkgroup + wave. A slot is a WaveHeader
+        /// followed by slotRecords Records. Record starts are wall clock ticks
+        /// after the header's base clock. Waves that never close their
+        /// recorder, such as those out of bounds, leave a zero header.
+        ///
+        struct WaveHeader
+        {
+            uint64_t baseClock;
+            uint32_t workgroup;
+            uint16_t wave;
+            uint16_t recordCount; // Records attempted, saturating; may exceed the slot
+        };
+
+        struct Record
+        {
+            uint32_t start;
+            uint32_t phaseDuration; // Phase in the top PhaseBits, ticks below
+        };
+
+        constexpr uint32_t PhaseBits      = 4u;
+        constexpr uint32_t DurationBits   = 32u - PhaseBits;
+        constexpr uint32_t DurationMask   = (1u << DurationBits) - 1u;
+        constexpr uint32_t MaxRecordCount = 0xFFFFu;
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t packPhase(uint32_t phase, uint64_t duration)
+        {
+            return (phase << DurationBits)
+                   | static_cast<uint32_t>(duration < DurationMask ? duration : DurationMask);
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t phaseOf(Record const& record)
+        {
+            return record.phaseDuration >> DurationBits;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t durationOf(Record const& record)
+        {
+            return record.phaseDuration & DurationMask;
+        }
+
+        ROCWMMA_HOST_DEVICE constexpr inline uint64_t slotBytes(uint32_t slotRecords)
+        {
+            return sizeof(WaveHeader) + static_cast<uint64_t>(slotRecords) * sizeof(Record);
+        }
+
+        // Slot capacity of the cooperative gemm flow: at most one record of
+        // each phase per k step, plus the prologue and epilogue.
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t slotRecords(uint32_t kSteps)
+        {
+            return (PhaseCount - 1u) * kSteps + PhaseCount;
+        }
+
+        // Trace buffer of a launch
+        struct Target
+        {
+            uint8_t* slots;
+            uint32_t slotRecords;
+        };
+
+        ///
+        /// Per-wave recorder. Usage in device code:
+        ///
+        /// auto recorder = WaveRecorder<>::open();
+        /// auto start    = recorder.start();
+        /// ... phase ...
+        /// recorder.stop(GemmPhaseTrace::Mma, start);
+        /// recorder.close();
+        ///
+        /// The clock is read as issued, so a phase of asynchronous loads only
+        /// covers their issue; waiting on them lands in the phase that first
+        /// consumes the data.
+        ///
+        template <bool Enabled = (bool)ROCWMMA_GEMM_PHASE_TRACE>
+        struct WaveRecorder
+        {
+            ROCWMMA_DEVICE static inline WaveRecorder open()
+            {
+                return WaveRecorder();
+            }
+
+            ROCWMMA_DEVICE inline uint64_t start() const
+            {
+                return 0u;
+            }
+
+            ROCWMMA_DEVICE inline void stop(Phase phase, uint64_t start) {}
+
+            ROCWMMA_DEVICE inline void close() const {}
+        };
+
+#if ROCWMMA_GEMM_PHASE_TRACE && !defined(__HIPCC_RTC__)
+
+        // Trace buffer of kernels launched from this translation unit.
+        // Null slots leave recording off.
+        static __device__ Target gTarget = {nullptr, 0u};
+
+        // Must be called from the translation unit that launches the kernel
+        static inline hipError_t setTarget(Target const& target)
+        {
+            return hipMemcpyToSymbol(HIP_SYMBOL(gTarget), &target, sizeof(Target));
+        }
+
+        template <>
+        struct WaveRecorder<true>
+        {
+            ROCWMMA_DEVICE static inline WaveRecorder open()
+            {
+                constexpr uint32_t waveSize = Constants::AMDGCN_WAVE_SIZE;
+
+                // Flat thread id
+                auto tid = threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+
+                // Flat workgroup id
+                auto workgroup = blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+
+                auto threads = blockDim.x * blockDim.y * blockDim.z;
+                auto waves   = (threads + waveSize - 1u) / waveSize;
+                auto wave    = tid / waveSize;
+
+                auto target = gTarget;
+
+                WaveRecorder recorder;
+                recorder.mSlot = target.slots == nullptr
+                                     ? nullptr
+                                     : target.slots
+                                           + (static_cast<uint64_t>(workgroup) * waves + wave)
+                                                 * slotBytes(target.slotRecords);
+                recorder.mSlotRecords = target.slotRecords;
+                recorder.mWorkgroup   = workgroup;
+                recorder.mWave        = wave;
+                recorder.mCount       = 0u;
+                recorder.mLeader      = (tid % waveSize) == 0u;
+                recorder.mBaseClock   = wall_clock64();
+                return recorder;
+            }
+
+            ROCWMMA_DEVICE inline uint64_t start() const
+            {
+                return wall_clock64();
+            }
+
+            ROCWMMA_DEVICE inline void stop(Phase phase, uint64_t start)
+            {
+                auto end = wall_clock64();
+                if(mSlot != nullptr && mLeader && mCount < mSlotRecords)
+                {
+                    auto* records   = reinterpret_cast<Record*>(mSlot + sizeof(WaveHeader));
+                    records[mCount] = Record{static_cast<uint32_t>(start - mBaseClock),
+                                             packPhase(phase, end - start)};
+                }
+                mCount++;
+            }
+
+            ROCWMMA_DEVICE inline void close() const
+            {
+                if(mSlot != nullptr && mLeader)
+                {
+                    *reinterpret_cast<WaveHeader*>(mSlot)
+                        = WaveHeader{mBaseClock,
+                                     mWorkgroup,
+                                     static_cast<uint16_t>(mWave),
+                                     static_cast<uint16_t>(
+                                         mCount < MaxRecordCount ? mCount : MaxRecordCount)};
+                }
+            }
+
+        private:
+            uint8_t* mSlot;
+            uint64_t mBaseClock;
+            uint32_t mSlotRecords;
+            uint32_t mWorkgroup;
+            uint32_t mWave;
+            uint32_t mCount;
+            bool     mLeader;
+        };
+
+#endif // ROCWMMA_GEMM_PHASE_TRACE && !defined(__HIPCC_RTC__)
+
+    } // namespace GemmPhaseTrace
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_PHASE_TRACE_HPP
@@ -0,0 +1,393 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_GEMM_PHASE_TRACE_REPORT_HPP
+#define ROCWMMA_GEMM_PHASE_TRACE_REPORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gemm_phase_trace.hpp"
+
+// Host side of the gemm phase trace: the capture file format, its decoder,
+// and the histogram and Chrome trace reports. Nothing here depends on HIP, so
+// captured traces can be replayed and tested on any host.
+namespace rocwmma
+{
+    namespace GemmPhaseTrace
+    {
+        constexpr uint32_t FileMagic   = 0x54505752u; // "RWPT"
+        constexpr uint32_t FileVersion = 1u;
+
+        ///
+        /// Capture file: a FileHeader followed by slotCount raw trace slots of
+        /// slotBytes(slotRecords) each, as copied back from the device.
+        ///
+        struct FileHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t clockRateKhz; // Wall clock rate of the device
+            uint32_t slotRecords;
+            uint64_t slotCount;
+        };
+
+        struct Capture
+        {
+            FileHeader           header;
+            std::vector<uint8_t> slots;
+        };
+
+        // One decoded phase of one wave
+        struct Event
+        {
+            uint32_t workgroup;
+            uint32_t wave;
+            Phase    phase;
+            uint64_t start; // Absolute wall clock ticks
+            uint32_t duration; // Ticks
+        };
+
+        struct Trace
+        {
+            uint32_t           clockRateKhz = 0u;
+            uint64_t           waves        = 0u; // Waves that closed their recorder
+            uint64_t           dropped      = 0u; // Records that overflowed their slot
+            std::vector<Event> events;
+        };
+
+        // Log2 buckets: bucket b holds durations in [2^b, 2^(b+1)), bucket 0 also 0
+        constexpr uint32_t HistogramBuckets = 32u;
+
+        struct PhaseSummary
+        {
+            uint64_t                               count = 0u;
+            uint64_t                               total = 0u;
+            uint32_t                               min   = 0u;
+            uint32_t                               p50   = 0u;
+            uint32_t                               p99   = 0u;
+            uint32_t                               max   = 0u;
+            std::array<uint64_t, HistogramBuckets> buckets{};
+        };
+
+        inline char const* phaseName(uint32_t phase)
+        {
+            switch(phase)
+            {
+            case GlobalRead:
+                return "GlobalRead";
+            case LocalWrite:
+                return "LocalWrite";
+            case LocalRead:
+                return "LocalRead";
+            case Mma:
+                return "Mma";
+            case Epilogue:
+                return "Epilogue";
+            default:
+                return "Unknown";
+            }
+        }
+
+        inline uint32_t histogramBucket(uint32_t duration)
+        {
+            uint32_t bucket = 0u;
+            while(duration > 1u)
+            {
+                duration >>= 1u;
+                bucket++;
+            }
+            return bucket;
+        }
+
+        inline double ticksToUs(uint64_t ticks, uint32_t clockRateKhz)
+        {
+            return clockRateKhz == 0u ? 0.0
+                                      : static_cast<double>(ticks) * 1000.0
+                                            / static_cast<double>(clockRateKhz);
+        }
+
+        ///
+        /// Capture file I/O. Reads throw std::runtime_error on malformed input.
+        ///
+        inline void writeCapture(std::ostream& stream, Capture const& capture)
+        {
+            stream.write(reinterpret_cast<char const*>(&capture.header), sizeof(FileHeader));
+            stream.write(reinterpret_cast<char const*>(capture.slots.data()),
+                         static_cast<std::streamsize>(capture.slots.size()));
+            if(!stream)
+            {
+                throw std::runtime_error("Failed to write phase trace capture");
+            }
+        }
+
+        inline Capture readCapture(std::istream& stream)
+        {
+            Capture capture;
+            if(!stream.read(reinterpret_cast<char*>(&capture.header), sizeof(FileHeader)))
+            {
+                throw std::runtime_error("Truncated phase trace header");
+            }
+
+            auto const& header = capture.header;
+            if(header.magic != FileMagic)
+            {
+                throw std::runtime_error("Not a phase trace capture");
+            }
+            if(header.version != FileVersion)
+            {
+                throw std::runtime_error("Unsupported phase trace version "
+                                         + std::to_string(header.version));
+            }
+
+            capture.slots.resize(header.slotCount * slotBytes(header.slotRecords));
+            if(!stream.read(reinterpret_cast<char*>(capture.slots.data()),
+                            static_cast<std::streamsize>(capture.slots.size())))
+            {
+                throw std::runtime_error("Truncated phase trace slots");
+            }
+            return capture;
+        }
+
+        inline void writeCaptureFile(std::string const& path, Capture const& capture)
+        {
+            std::ofstream file(path, std::ios::binary);
+            if(!file)
+            {
+                throw std::runtime_error("Failed to open phase trace capture: " + path);
+            }
+            writeCapture(file, capture);
+        }
+
+        inline Capture readCaptureFile(std::string const& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if(!file)
+            {
+                throw std::runtime_error("Failed to open phase trace capture: " + path);
+            }
+            return readCapture(file);
+        }
+
+        ///
+        /// Decodes all closed slots of a capture into events, ordered by slot
+        /// then record.
+        ///
+        inline Trace decode(Capture const& capture)
+        {
+            auto const& header = capture.header;
+            auto        bytes  = slotBytes(header.slotRecords);
+
+            Trace trace;
+            trace.clockRateKhz = header.clockRateKhz;
+
+            for(uint64_t slot = 0u; slot < header.slotCount; slot++)
+            {
+                auto const* slotPtr = capture.slots.data() + slot * bytes;
+
+                WaveHeader wave;
+                std::memcpy(&wave, slotPtr, sizeof(WaveHeader));
+                if(wave.recordCount == 0u)
+                {
+                    continue;
+                }
+
+                auto recorded = std::min<uint32_t>(wave.recordCount, header.slotRecords);
+                trace.waves++;
+                trace.dropped += wave.recordCount - recorded;
+
+                for(uint32_t i = 0u; i < recorded; i++)
+                {
+                    Record record;
+                    std::memcpy(&record,
+                                slotPtr + sizeof(WaveHeader) + i * sizeof(Record),
+                                sizeof(Record));
+
+                    auto phase = phaseOf(record);
+                    if(phase >= PhaseCount)
+                    {
+                        throw std::runtime_error("Invalid phase in trace slot "
+                                                 + std::to_string(slot));
+                    }
+
+                    trace.events.push_back(Event{wave.workgroup,
+                                                 wave.wave,
+                                                 static_cast<Phase>(phase),
+                                                 wave.baseClock + record.start,
+                                                 durationOf(record)});
+                }
+            }
+
+            return trace;
+        }
+
+        inline std::array<PhaseSummary, PhaseCount> summarize(Trace const& trace)
+        {
+            std::array<PhaseSummary, PhaseCount>          summaries{};
+            std::array<std::vector<uint32_t>, PhaseCount> durations;
+
+            for(auto const& event : trace.events)
+            {
+                auto& summary = summaries[event.phase];
+                summary.count++;
+                summary.total += event.duration;
+                summary.buckets[histogramBucket(event.duration)]++;
+                durations[event.phase].push_back(event.duration);
+            }
+
+            for(uint32_t phase = 0u; phase < PhaseCount; phase++)
+            {
+                auto& sorted = durations[phase];
+                if(sorted.empty())
+                {
+                    continue;
+                }
+
+                // Nearest-rank percentiles
+                std::sort(sorted.begin(), sorted.end());
+                auto rank = [&sorted](uint64_t percent) {
+                    auto index = (percent * sorted.size() + 99u) / 100u;
+                    return sorted[std::max<uint64_t>(index, 1u) - 1u];
+                };
+
+                auto& summary = summaries[phase];
+                summary.min   = sorted.front();
+                summary.max   = sorted.back();
+                summary.p50   = rank(50u);
+                summary.p99   = rank(99u);
+            }
+
+            return summaries;
+        }
+
+        ///
+        /// Per-phase summary in csv form followed by the log2 histograms, one
+        /// line per phase as "bucket:count" pairs of the non-empty buckets.
+        /// Each line of the title is written as a leading comment.
+        ///
+        inline void writeHistogramReport(std::ostream&      stream,
+                                         Trace const&       trace,
+                                         std::string const& title)
+        {
+            auto summaries = summarize(trace);
+
+            uint64_t                               total = 0u;
+            for(auto const& summary : summaries)
+            {
+                total += summary.total;
+            }
+
+            std::istringstream titleLines(title);
+            for(std::string line; std::getline(titleLines, line);)
+            {
+                stream << "# " << line << "\n";
+            }
+
+            stream << "# waves: " << trace.waves << ", events: " << trace.events.size()
+                   << ", dropped: " << trace.dropped << ", clockRateKhz: " << trace.clockRateKhz
+                   << "\n"
+                   << "Phase, Count, Total(us), Share(%), Min, P50, P99, Max (ticks)\n";
+
+            for(uint32_t phase = 0u; phase < PhaseCount; phase++)
+            {
+                auto const& summary = summaries[phase];
+                auto        share
+                    = total == 0u ? 0.0
+                                  : 100.0 * static_cast<double>(summary.total)
+                                        / static_cast<double>(total);
+
+                stream << phaseName(phase) << ", " << summary.count << ", " << std::fixed
+                       << std::setprecision(3) << ticksToUs(summary.total, trace.clockRateKhz)
+                       << ", " << std::setprecision(1) << share << std::defaultfloat << ", "
+                       << summary.min << ", " << summary.p50 << ", " << summary.p99 << ", "
+                       << summary.max << "\n";
+            }
+
+            stream << "# Histograms, log2(ticks) bucket:count\n";
+            for(uint32_t phase = 0u; phase < PhaseCount; phase++)
+            {
+                stream << phaseName(phase) << ":";
+                auto const& buckets = summaries[phase].buckets;
+                for(uint32_t bucket = 0u; bucket < HistogramBuckets; bucket++)
+                {
+                    if(buckets[bucket] != 0u)
+                    {
+                        stream << " " << bucket << ":" << buckets[bucket];
+                    }
+                }
+                stream << "\n";
+            }
+        }
+
+        ///
+        /// Chrome trace event JSON (chrome://tracing, Perfetto): one complete
+        /// event per phase, with workgroups as processes and waves as threads.
+        /// Times are in microseconds from the earliest event.
+        ///
+        inline void writeChromeTrace(std::ostream& stream, Trace const& trace)
+        {
+            uint64_t origin = ~0ull;
+            for(auto const& event : trace.events)
+            {
+                origin = std::min(origin, event.start);
+            }
+
+            stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+            auto first = true;
+            for(auto const& event : trace.events)
+            {
+                stream << (first ? "" : ",") << "\n{\"name\":\"" << phaseName(event.phase)
+                       << "\",\"ph\":\"X\",\"pid\":" << event.workgroup
+                       << ",\"tid\":" << event.wave << std::fixed << std::setprecision(3)
+                       << ",\"ts\":" << ticksToUs(event.start - origin, trace.clockRateKhz)
+                       << ",\"dur\":" << ticksToUs(event.duration, trace.clockRateKhz)
+                       << std::defaultfloat << "}";
+                first = false;
+            }
+
+            stream << "\n]}\n";
+        }
+
+        // Running index of the captures of this process, for file names
+        inline uint32_t nextCaptureIndex()
+        {
+            static uint32_t index = 0u;
+            return index++;
+        }
+
+    } // namespace GemmPhaseTrace
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_PHASE_TRACE_REPORT_HPP
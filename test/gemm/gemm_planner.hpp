@@ -0,0 +1,289 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_PLANNER_HPP
+#define ROCWMMA_GEMM_PLANNER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "arch_profile.hpp"
+#include "gemm_occupancy.hpp"
+#include "gemm_tuning.hpp"
+
+// Host-side dry-run planning: predicted resources, occupancy and roofline
+// time of GEMM candidates against an arch profile. Nothing here depends on
+// HIP, so plans can be made and checked without a device.
+namespace rocwmma
+{
+    namespace GemmPlanner
+    {
+        using GemmTuning::Candidate;
+        using GemmTuning::Problem;
+
+        // Element size of dataTypeToString names
+        inline uint32_t dataTypeBytes(std::string const& type)
+        {
+            static const std::map<std::string, uint32_t> sizes = {{"i8", 1u},
+                                                                  {"f8", 1u},
+                                                                  {"bf8", 1u},
+                                                                  {"f8(fnuz)", 1u},
+                                                                  {"bf8(fnuz)", 1u},
+                                                                  {"f16", 2u},
+                                                                  {"h16", 2u},
+                                                                  {"bf16", 2u},
+                                                                  {"i32", 4u},
+                                                                  {"f32", 4u},
+                                                                  {"xf32", 4u},
+                                                                  {"f64", 8u}};
+
+            auto it = sizes.find(type);
+            if(it == sizes.end())
+            {
+                throw std::invalid_argument("GemmPlanner: unknown data type " + type);
+            }
+            return it->second;
+        }
+
+        // Occupancy limits of a profile, as GemmOccupancy::resourceLimits()
+        // gives for the matching arch id
+        inline GemmOccupancy::ResourceLimits resourceLimits(ArchProfile const& arch)
+        {
+            return {arch.waveSize,
+                    arch.simdsPerCu,
+                    arch.maxWavesPerSimd,
+                    arch.vgprsPerSimd,
+                    arch.agprsPerSimd,
+                    arch.maxVgprsPerWave,
+                    GemmOccupancy::VgprGranularity,
+                    arch.ldsBytesPerCu,
+                    arch.maxLdsBytesPerWorkgroup,
+                    arch.maxThreadsPerWorkgroup};
+        }
+
+        ///
+        /// Per-lane register estimate of one wave, from fragment sizes.
+        /// Each wave holds BlocksX A fragments, BlocksY B fragments and
+        /// BlocksX x BlocksY accumulators. Global read prefetch (PGR1) adds
+        /// the wave's share of the cooperative A and B macro tile loads.
+        ///
+        struct RegisterEstimate
+        {
+            static constexpr uint32_t OverheadVgprs = GemmOccupancy::DriverOverheadVgprs;
+            static constexpr uint32_t Granularity   = GemmOccupancy::VgprGranularity;
+
+            uint32_t vgprs = 0u;
+            uint32_t agprs = 0u; // Accumulators, if the arch has a separate file
+        };
+
+        inline uint32_t
+            fragmentRegs(uint64_t rows, uint64_t cols, uint32_t bytes, uint32_t waveSize)
+        {
+            auto laneBytes = (rows * cols * bytes + waveSize - 1u) / waveSize;
+            return static_cast<uint32_t>((laneBytes + 3u) / 4u);
+        }
+
+        inline bool hasGlobalPrefetch(Candidate const& candidate)
+        {
+            return candidate.kernel.rfind("PGR1", 0) == 0;
+        }
+
+        inline RegisterEstimate estimateRegisters(ArchProfile const& arch,
+                                                  Problem const&     problem,
+                                                  Candidate const&   candidate)
+        {
+            auto wave     = arch.waveSize;
+            auto inBytes  = problem.inputBytes;
+            auto accBytes = dataTypeBytes(problem.computeT);
+
+            auto fragsA = candidate.blocksX
+                          * fragmentRegs(candidate.blockM, candidate.blockK, inBytes, wave);
+            auto fragsB = candidate.blocksY
+                          * fragmentRegs(candidate.blockN, candidate.blockK, inBytes, wave);
+            auto accum  = candidate.blocksX * candidate.blocksY
+                         * fragmentRegs(candidate.blockM, candidate.blockN, accBytes, wave);
+
+            uint32_t prefetch = 0u;
+            auto     waves    = candidate.tBlockX / wave * candidate.tBlockY;
+            if(hasGlobalPrefetch(candidate) && waves > 0u)
+            {
+                auto tileK = static_cast<uint64_t>(candidate.blockK);
+                prefetch   = fragmentRegs(candidate.macroTileM(wave) + candidate.macroTileN(),
+                                        tileK,
+                                        inBytes,
+                                        wave * waves);
+            }
+
+            auto roundUp = [](uint32_t regs) {
+                return (regs + RegisterEstimate::Granularity - 1u) / RegisterEstimate::Granularity
+                       * RegisterEstimate::Granularity;
+            };
+
+            RegisterEstimate result;
+            auto             vgprs = RegisterEstimate::OverheadVgprs + fragsA + fragsB + prefetch;
+            if(arch.agprsPerSimd > 0u)
+            {
+                result.vgprs = roundUp(vgprs);
+                result.agprs = roundUp(accum);
+            }
+            else
+            {
+                result.vgprs = roundUp(vgprs + accum);
+            }
+            return result;
+        }
+
+        ///
+        /// Predicted launch of one candidate
+        ///
+        struct Plan
+        {
+            Problem   problem;
+            Candidate candidate;
+
+            RegisterEstimate registers;
+            bool             spills = false;
+
+            // Resident waves per SIMD and what limits them
+            uint32_t    wavesPerSimd = 0u;
+            std::string limiter;
+
+            uint32_t gridX = 0u, gridY = 0u;
+
+            double flops       = 0.0;
+            double bytes       = 0.0;
+            double computeMs   = 0.0;
+            double memoryMs    = 0.0;
+            double predictedMs = 0.0;
+
+            // Candidate passed its run checks and fits on a CU.
+            // Spilling candidates still run, from scratch memory.
+            bool runs() const
+            {
+                return candidate.enabled && wavesPerSimd > 0u;
+            }
+
+            double occupancy(ArchProfile const& arch) const
+            {
+                return static_cast<double>(wavesPerSimd) / arch.maxWavesPerSimd;
+            }
+
+            char const* bound() const
+            {
+                return computeMs >= memoryMs ? "compute" : "memory";
+            }
+
+            double predictedTFlopsPerSec() const
+            {
+                return predictedMs > 0.0 ? flops / (predictedMs * 1.0e9) : 0.0;
+            }
+        };
+
+        inline Plan
+            plan(ArchProfile const& arch, Problem const& problem, Candidate const& candidate)
+        {
+            auto ceilDiv = [](uint64_t num, uint64_t den) {
+                return static_cast<uint32_t>(den ? (num + den - 1u) / den : 0u);
+            };
+
+            Plan result;
+            result.problem   = problem;
+            result.candidate = candidate;
+            result.registers = estimateRegisters(arch, problem, candidate);
+
+            GemmOccupancy::ResourceUsage usage;
+            usage.vgprs    = result.registers.vgprs;
+            usage.agprs    = result.registers.agprs;
+            usage.ldsBytes = candidate.ldsBytes;
+            usage.threads  = candidate.tBlockX * candidate.tBlockY;
+
+            auto occupancy      = GemmOccupancy::occupancy(usage, resourceLimits(arch));
+            result.spills       = occupancy.spills;
+            result.wavesPerSimd = occupancy.wavesPerSimd;
+            result.limiter      = GemmOccupancy::toString(occupancy.limiter);
+
+            result.gridX = ceilDiv(problem.m, candidate.macroTileM(arch.waveSize));
+            result.gridY = ceilDiv(problem.n, candidate.macroTileN());
+
+            // No matrix core peak for the type means the kernel can't run there
+            auto model      = GemmTuning::CostModel(arch);
+            auto hasPeak    = arch.peakTFlopsFor(problem.inputT) > 0.0;
+            result.flops    = problem.flops();
+            result.bytes    = model.bytesMoved(problem, candidate);
+            result.memoryMs = model.memoryMs(problem, candidate);
+            result.computeMs
+                = hasPeak && result.wavesPerSimd > 0u ? model.computeMs(problem, candidate) : 0.0;
+            result.predictedMs = std::max(result.computeMs, result.memoryMs)
+                                 + GemmTuning::CostModel::LaunchOverheadMs;
+            return result;
+        }
+
+        inline std::ostream& printHeader(std::ostream& stream)
+        {
+            return stream << "Kernel, GemmConfig, LytLds, BlkM, BlkN, BlkK, BlocksX, BlocksY, "
+                          << "TBlkX, TBlkY, MatM, MatN, MatK, LytA_LytB_LytC_LytD, Ti_To_Tc, "
+                          << "LdsBytes, VGPRs, AGPRs, WavesPerSimd, Occupancy(%), Limiter, "
+                          << "GridX, GridY, Problem Size(GFlops), Bytes(MB), Bound, "
+                          << "PredictedMs, Predicted TFlops/s, Result" << std::endl;
+        }
+
+        inline std::ostream& printPlan(std::ostream& stream, ArchProfile const& arch, Plan const& p)
+        {
+            auto const& c = p.candidate;
+            auto const& q = p.problem;
+
+            stream << c.kernel << ", " << (c.gemmConfig.empty() ? "n/a" : c.gemmConfig) << ", "
+                   << (c.layoutLds.empty() ? "n/a" : c.layoutLds) << ", " << c.blockM << ", "
+                   << c.blockN << ", " << c.blockK << ", " << c.blocksX << ", " << c.blocksY
+                   << ", " << c.tBlockX << ", " << c.tBlockY << ", " << q.m << ", " << q.n << ", "
+                   << q.k << ", " << q.layouts << ", " << q.inputT << "_" << q.outputT << "_"
+                   << q.computeT << ", " << c.ldsBytes << ", " << p.registers.vgprs << ", "
+                   << p.registers.agprs << ", " << p.wavesPerSimd << ", "
+                   << static_cast<int32_t>(p.occupancy(arch) * 100.0) << ", " << p.limiter
+                   << ", " << p.gridX << ", " << p.gridY << ", " << p.flops / 1.0e9 << ", "
+                   << p.bytes / 1.0e6 << ", ";
+
+            if(p.runs())
+            {
+                stream << p.bound() << ", " << p.predictedMs << ", " << p.predictedTFlopsPerSec()
+                       << ", " << (p.spills ? "SPILLS" : "PLANNED");
+            }
+            else
+            {
+                stream << "n/a, n/a, n/a, SKIPPED";
+            }
+            return stream << std::endl;
+        }
+
+    } // namespace GemmPlanner
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_PLANNER_HPP
@@ -87,7 +87,7 @@ namespace rocwmma
             EnableRun = (TBlockXTest && MinTBlockTest && ArchTest),
         };
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         static constexpr void debugGlobalPredicates()
         {
             std::cout << "Global Predicates:\n";
@@ -101,7 +101,7 @@ namespace rocwmma
             std::cout << "EnableBuild: " << (bool)GlobalPredicates::EnableBuild << std::endl;
             std::cout << "EnableRun: " << (bool)GlobalPredicates::EnableRun << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
 
         enum struct Gfx9Predicates : bool
         {
@@ -214,7 +214,7 @@ namespace rocwmma
                       && XF32BlockSizeTest && F64BlockSizeTest)
         };
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         static constexpr void debugGfx9Predicates()
         {
             std::cout << "Gfx9 Predicates:\n";
@@ -240,7 +240,7 @@ namespace rocwmma
                       << std::endl;
             std::cout << "Enable: " << (bool)Gfx9Predicates::Enable << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
 
         enum struct Gfx11Predicates : bool
         {
@@ -276,7 +276,7 @@ namespace rocwmma
                       && F16BlockSizeTest)
         };
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         static constexpr void debugGfx11Predicates()
         {
             std::cout << "Gfx11 Predicates:\n";
@@ -289,7 +289,7 @@ namespace rocwmma
                       << std::endl;
             std::cout << "Enable: " << (bool)Gfx11Predicates::Enable << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
 
         enum struct Gfx12Predicates : bool
         {
@@ -328,7 +328,7 @@ namespace rocwmma
                       && F16BlockSizeTest)
         };
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         static constexpr void debugGfx12Predicates()
         {
             std::cout << "Gfx12 Predicates:\n";
@@ -341,7 +341,7 @@ namespace rocwmma
                       << std::endl;
             std::cout << "Enable: " << (bool)Gfx12Predicates::Enable << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
 
     public:
         constexpr static bool enableBuild()
@@ -358,7 +358,7 @@ namespace rocwmma
                         || (bool)Gfx12Predicates::Enable));
         }
 
-#if !NDEBUG
+#if !NDEBUG && !defined(__HIPCC_RTC__)
         constexpr static void debugPredicates()
         {
             debugGlobalPredicates();
@@ -369,7 +369,7 @@ namespace rocwmma
             std::cout << "Overall enable build: " << enableBuild() << std::endl;
             std::cout << "Overall enable run: " << enableRun() << std::endl;
         }
-#endif // !NDEBUG
+#endif // !NDEBUG && !defined(__HIPCC_RTC__)
     };
 
 } // namespace rocwmma
@@ -51,6 +51,24 @@ namespace rocwmma
     template struct GemmResource<xfloat32_t, float32_t>;
     template struct GemmResource<float64_t, float64_t>;
 
+    // Mixed A / B inputs
+    template struct GemmResource<MixedF16I8, float32_t>;
+
+#if ROCWMMA_FP8
+    template struct GemmResource<MixedF16F8, float32_t>;
+    template struct GemmResource<MixedBF16F8, float32_t>;
+#endif
+
+#if ROCWMMA_FP8_FNUZ
+    template struct GemmResource<MixedF16F8Fnuz, float32_t>;
+    template struct GemmResource<MixedBF16F8Fnuz, float32_t>;
+#endif
+
+    // Complex inputs
+    template struct GemmResource<complex_float16_t, complex_float32_t>;
+    template struct GemmResource<complex_float32_t, complex_float32_t>;
+    template struct GemmResource<complex_float64_t, complex_float64_t>;
+
 #if ROCWMMA_EXTENDED_TESTS
     template struct GemmResource<int8_t, int8_t>;
     template struct GemmResource<bfloat16_t, bfloat16_t>;
@@ -30,6 +30,7 @@
 #include <memory>
 #include <tuple>
 
+#include "gemm_mixed_input.hpp"
 #include "hip_resource.hpp"
 #include "singleton.hpp"
 
@@ -64,6 +65,10 @@ namespace rocwmma
         template <typename DataT>
         using HostPtrT = Base::template HostPtrT<DataT>;
 
+        // Datatypes of A and B, which differ for MixedInput
+        using InputTA = GemmInputTA_t<InputT>;
+        using InputTB = GemmInputTB_t<InputT>;
+
         // M, N, K
         using ProblemDims = std::tuple<int64_t, int64_t, int64_t>;
 
@@ -99,22 +104,24 @@ namespace rocwmma
         void resizeStorage(ProblemDims const& size);
         void resizeStorage(MatrixElements const& size);
 
-        HostPtrT<InputT>&  hostA();
-        HostPtrT<InputT>&  hostB();
+        HostPtrT<InputTA>& hostA();
+        HostPtrT<InputTB>& hostB();
         HostPtrT<OutputT>& hostC();
         HostPtrT<OutputT>& hostD();
 
-        DevicePtrT<InputT>&  deviceA();
-        DevicePtrT<InputT>&  deviceB();
+        DevicePtrT<InputTA>& deviceA();
+        DevicePtrT<InputTB>& deviceB();
         DevicePtrT<OutputT>& deviceC();
         DevicePtrT<OutputT>& deviceD();
 
         void reset() final;
 
     protected:
-        DevicePtrT<InputT>  mDeviceA, mDeviceB;
+        DevicePtrT<InputTA> mDeviceA;
+        DevicePtrT<InputTB> mDeviceB;
         DevicePtrT<OutputT> mDeviceC, mDeviceD;
-        HostPtrT<InputT>    mHostA, mHostB;
+        HostPtrT<InputTA>   mHostA;
+        HostPtrT<InputTB>   mHostB;
         HostPtrT<OutputT>   mHostC, mHostD;
         MatrixElements      mCurrentMatrixElements;
         MatrixElements      mCurrentAllocElements;
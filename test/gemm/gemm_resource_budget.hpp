@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_RESOURCE_BUDGET_HPP
+#define ROCWMMA_GEMM_RESOURCE_BUDGET_HPP
+
+#include <rocwmma/rocwmma.hpp>
+
+#include "gemm_occupancy.hpp"
+
+// Reject gemm kernel configurations that registers limit to fewer
+// than this many waves per SIMD (0 = report only, never reject).
+#if !defined(ROCWMMA_GEMM_MIN_WAVES_PER_SIMD)
+#define ROCWMMA_GEMM_MIN_WAVES_PER_SIMD 0
+#endif
+
+namespace rocwmma
+{
+    namespace GemmOccupancy
+    {
+        ///
+        /// Per-lane 32-bit registers holding a fragment (or array of fragments),
+        /// from the size of its packed storage vector.
+        ///
+        template <typename FragT>
+        struct RegisterCount;
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayoutT>
+        struct RegisterCount<fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>>
+        {
+        private:
+            using FragT    = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayoutT>;
+            using IOTraits = typename FragT::IOTraits;
+            using StorageT = typename FragT::Traits::StorageT;
+
+        public:
+            static constexpr uint32_t value
+                = ceilDiv(static_cast<uint32_t>(sizeof(StorageT)),
+                          Constants::AMDGCN_REGISTER_ELEMENT_SIZE_BYTES);
+
+            static_assert(value >= IOTraits::PackedVRegCount,
+                          "Fragment storage is smaller than its packed registers");
+        };
+
+        template <typename FragT, size_t Count>
+        struct RegisterCount<FragT[Count]>
+        {
+            static constexpr uint32_t value = Count * RegisterCount<FragT>::value;
+        };
+
+        ///
+        /// Resource budget of one GemmDriver kernel configuration.
+        ///
+        /// Registers are the peak of the fragment buffers live in each phase
+        /// of the driver, plus DriverOverheadVgprs:
+        /// - K loop:   A + B + global prefetch + accumulators
+        /// - K tail:   A + B + C + accumulators
+        /// - Epilogue: C + D + accumulators
+        /// Accumulators are held in AGPRs on archs with a separate file.
+        /// LDS holds LdsBuffers macro tiles of A and B, BlockK deep.
+        ///
+        /// This is what the fragments ask for; the compiler may do better by
+        /// re-using dead registers, or worse with addressing and unrolling.
+        ///
+        template <typename GlobalMapping,
+                  uint32_t TBlockX,
+                  uint32_t TBlockY,
+                  uint32_t WaveSize,
+                  uint32_t ArchId,
+                  bool     GlobalPrefetch,
+                  uint32_t LdsBuffers>
+        struct GemmDriverBudget
+        {
+        private:
+            using MfmaFragA = typename GlobalMapping::MfmaFragA;
+            using MfmaFragB = typename GlobalMapping::MfmaFragB;
+            using ShapeA    = GetIOShape_t<MfmaFragA>;
+            using ShapeB    = GetIOShape_t<MfmaFragB>;
+            using InputT    = GetDataType_t<MfmaFragA>;
+
+            template <typename FragT>
+            static constexpr uint32_t regs = RegisterCount<FragT>::value;
+
+            static constexpr uint32_t max3(uint32_t a, uint32_t b, uint32_t c)
+            {
+                return a > b ? (a > c ? a : c) : (b > c ? b : c);
+            }
+
+        public:
+            static constexpr ResourceLimits Limits = resourceLimits(ArchId);
+
+            static_assert(Limits.valid(), "No resource limits for target arch");
+            static_assert(Limits.waveSize == WaveSize, "Wave size does not match target arch");
+
+            static constexpr uint32_t RegsA   = regs<typename GlobalMapping::MfmaBuffA>;
+            static constexpr uint32_t RegsB   = regs<typename GlobalMapping::MfmaBuffB>;
+            static constexpr uint32_t RegsC   = regs<typename GlobalMapping::MfmaBuffC>;
+            static constexpr uint32_t RegsD   = regs<typename GlobalMapping::MfmaBuffD>;
+            static constexpr uint32_t RegsAcc = regs<typename GlobalMapping::MfmaBuffAcc>;
+            static constexpr uint32_t RegsPrefetch
+                = GlobalPrefetch ? regs<typename GlobalMapping::GRBuffA>
+                                       + regs<typename GlobalMapping::GRBuffB>
+                                 : 0u;
+
+            static constexpr bool SeparateAcc = Limits.agprsPerSimd > 0u;
+
+            static constexpr uint32_t MacroTileM
+                = TBlockX / WaveSize * std::extent<typename GlobalMapping::MfmaBuffA>::value
+                  * ShapeA::BlockDim;
+            static constexpr uint32_t MacroTileN
+                = TBlockY * std::extent<typename GlobalMapping::MfmaBuffB>::value
+                  * ShapeB::BlockDim;
+
+            static constexpr ResourceUsage Usage = {
+                DriverOverheadVgprs
+                    + max3(RegsA + RegsB + RegsPrefetch, RegsA + RegsB + RegsC, RegsC + RegsD)
+                    + (SeparateAcc ? 0u : RegsAcc),
+                SeparateAcc ? RegsAcc : 0u,
+                static_cast<uint32_t>(LdsBuffers * sizeof(InputT) * (MacroTileM + MacroTileN)
+                                      * ShapeA::KDim),
+                TBlockX * TBlockY};
+
+            static constexpr Occupancy Result = occupancy(Usage, Limits);
+        };
+
+    } // namespace GemmOccupancy
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_RESOURCE_BUDGET_HPP
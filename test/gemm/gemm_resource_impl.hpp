@@ -35,12 +35,12 @@ namespace rocwmma
     template <typename InputT, typename OutputT>
     GemmResource<InputT, OutputT>::GemmResource()
         : HipResource()
-        , mDeviceA(Base::template allocDevice<InputT>(0))
-        , mDeviceB(Base::template allocDevice<InputT>(0))
+        , mDeviceA(Base::template allocDevice<InputTA>(0))
+        , mDeviceB(Base::template allocDevice<InputTB>(0))
         , mDeviceC(Base::template allocDevice<OutputT>(0))
         , mDeviceD(Base::template allocDevice<OutputT>(0))
-        , mHostA(Base::template allocHost<InputT>(0))
-        , mHostB(Base::template allocHost<InputT>(0))
+        , mHostA(Base::template allocHost<InputTA>(0))
+        , mHostB(Base::template allocHost<InputTB>(0))
         , mHostC(Base::template allocHost<OutputT>(0))
         , mHostD(Base::template allocHost<OutputT>(0))
         , mCurrentMatrixElements({0, 0, 0, 0})
@@ -140,13 +140,13 @@ namespace rocwmma
     }
 
     template <typename InputT, typename OutputT>
-    auto GemmResource<InputT, OutputT>::hostA() -> HostPtrT<InputT>&
+    auto GemmResource<InputT, OutputT>::hostA() -> HostPtrT<InputTA>&
     {
         return mHostA;
     }
 
     template <typename InputT, typename OutputT>
-    auto GemmResource<InputT, OutputT>::hostB() -> HostPtrT<InputT>&
+    auto GemmResource<InputT, OutputT>::hostB() -> HostPtrT<InputTB>&
     {
         return mHostB;
     }
@@ -164,13 +164,13 @@ namespace rocwmma
     }
 
     template <typename InputT, typename OutputT>
-    auto GemmResource<InputT, OutputT>::deviceA() -> DevicePtrT<InputT>&
+    auto GemmResource<InputT, OutputT>::deviceA() -> DevicePtrT<InputTA>&
     {
         return mDeviceA;
     }
 
     template <typename InputT, typename OutputT>
-    auto GemmResource<InputT, OutputT>::deviceB() -> DevicePtrT<InputT>&
+    auto GemmResource<InputT, OutputT>::deviceB() -> DevicePtrT<InputTB>&
     {
         return mDeviceB;
     }
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD = LayoutC>
+    struct Kernel_Sparse_PGR0_LB0_MP0_SB_NC final : public GemmKernelBase<BlockM,
+                                                                   BlockN,
+                                                                   BlockK,
+                                                                   InputT,
+                                                                   OutputT,
+                                                                   ComputeT,
+                                                                   LayoutA,
+                                                                   LayoutB,
+                                                                   LayoutC,
+                                                                   LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_sparse_PGR0_LB0_MP0_SB_NC_guard<BlockM,
+                                                        BlockN,
+                                                        BlockK,
+                                                        InputT,
+                                                        OutputT,
+                                                        ComputeT,
+                                                        TBlockX,
+                                                        TBlockY,
+                                                        WaveSize,
+                                                        ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static constexpr auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return typename Base::KernelFunc(gemm_sparse_PGR0_LB0_MP0_SB_NC<BlockM,
+                                                                             BlockN,
+                                                                             BlockK,
+                                                                             InputT,
+                                                                             OutputT,
+                                                                             ComputeT,
+                                                                             LayoutA,
+                                                                             LayoutB,
+                                                                             LayoutC,
+                                                                             LayoutD,
+                                                                             TBlockX,
+                                                                             TBlockY,
+                                                                             WaveSize,
+                                                                             ArchId>);
+                }
+                else
+                {
+                    return typename Base::KernelFunc(nullptr);
+                }
+            }
+        };
+
+        using DataStorage = typename Base::DataStorage;
+        using OperandA    = SparseOperandA<InputT, LayoutA>;
+
+    public:
+        Kernel_Sparse_PGR0_LB0_MP0_SB_NC() {}
+        ~Kernel_Sparse_PGR0_LB0_MP0_SB_NC() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                auto& dataInstance = DataStorage::instance();
+
+                auto m = Base::mM;
+                auto k = Base::mK;
+
+                // Prune A to 2:4 in place, so that the dense references
+                // see the same operand as the sparse kernel.
+                auto elementsA = static_cast<int64_t>(m) * k;
+                auto hostA     = DataStorage::template allocHost<InputT>(elementsA);
+                DataStorage::copyData(hostA, dataInstance->deviceA(), elementsA);
+
+                auto elementsPacked = static_cast<int64_t>(OperandA::elements(m, k));
+                auto packed         = DataStorage::template allocHost<InputT>(elementsPacked);
+                auto ldv            = OperandA::ldValues(m, k);
+                auto ldmeta         = OperandA::ldMetadata(m, k);
+                auto metadata       = OperandA::metadata(packed.get(), m, k);
+
+                compress_sparse_2_4<InputT, LayoutA>(
+                    m, k, hostA.get(), Base::mLda, packed.get(), ldv, metadata, ldmeta);
+                decompress_sparse_2_4<InputT, LayoutA>(
+                    m, k, packed.get(), ldv, metadata, ldmeta, hostA.get(), Base::mLda);
+
+                DataStorage::copyData(dataInstance->deviceA(), hostA, elementsA);
+                if(dataInstance->hostA() != nullptr)
+                {
+                    DataStorage::copyData(dataInstance->hostA(), hostA, elementsA);
+                }
+
+                DataStorage::reallocDevice(mDeviceSparseA, elementsPacked);
+                DataStorage::copyData(mDeviceSparseA, packed, elementsPacked);
+            }
+        }
+
+        void tearDown() final
+        {
+            Base::tearDown();
+            mDeviceSparseA.reset(nullptr);
+        }
+
+        bool checkQuirks() const final
+        {
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        bool tuningCandidate(GemmTuning::Problem&   problem,
+                             GemmTuning::Candidate& candidate) const final
+        {
+            candidate.kernel = "Sparse_PGR0_LB0_MP0_SB_NC";
+            return Base::tuningCandidate(problem, candidate);
+        }
+
+    protected:
+        InputT const* kernelArgA() const final
+        {
+            return mDeviceSparseA.get();
+        }
+
+        // A is read as its packed values and metadata
+        double modeledBytesPerElementA() const final
+        {
+            auto elements = static_cast<double>(Base::mM) * Base::mK;
+            return OperandA::elements(Base::mM, Base::mK) * sizeof(InputT) / elements;
+        }
+
+    private:
+        // Packed compressed values and metadata of A
+        typename DataStorage::template DevicePtrT<InputT> mDeviceSparseA;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
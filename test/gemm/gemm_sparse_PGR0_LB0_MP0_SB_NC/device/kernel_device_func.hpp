@@ -0,0 +1,226 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_FUNC
+#define ROCWMMA_GEMM_TEST_DEVICE_FUNC
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "kernel_predicates.hpp"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    ///
+    /// Packed 2:4 sparse A operand of an m x k problem: the m x k/2
+    /// compressed values, followed by the m x k/8 metadata bytes. Both are
+    /// tightly packed in LayoutA.
+    ///
+    template <typename InputT, typename LayoutA>
+    struct SparseOperandA
+    {
+        ROCWMMA_HOST_DEVICE static constexpr uint32_t ldValues(uint32_t m, uint32_t k)
+        {
+            return std::is_same_v<LayoutA, row_major> ? k / 2u : m;
+        }
+
+        ROCWMMA_HOST_DEVICE static constexpr uint32_t ldMetadata(uint32_t m, uint32_t k)
+        {
+            return std::is_same_v<LayoutA, row_major> ? k / 8u : m;
+        }
+
+        // Storage in InputT elements, rounded up to hold the metadata bytes
+        ROCWMMA_HOST_DEVICE static constexpr uint64_t elements(uint32_t m, uint32_t k)
+        {
+            auto metadataBytes = static_cast<uint64_t>(m) * k / 8u;
+            return static_cast<uint64_t>(m) * k / 2u
+                   + (metadataBytes + sizeof(InputT) - 1u) / sizeof(InputT);
+        }
+
+        ROCWMMA_HOST_DEVICE static inline uint8_t const*
+            metadata(InputT const* packed, uint32_t m, uint32_t k)
+        {
+            return reinterpret_cast<uint8_t const*>(packed + static_cast<uint64_t>(m) * k / 2u);
+        }
+
+        ROCWMMA_HOST_DEVICE static inline uint8_t* metadata(InputT* packed, uint32_t m, uint32_t k)
+        {
+            return reinterpret_cast<uint8_t*>(packed + static_cast<uint64_t>(m) * k / 2u);
+        }
+    };
+
+    ///
+    /// This class of kernel is a naive kernel whereas
+    /// each wave is responsible for calculating a macro tile area of
+    /// a single block: BlockM x BlockN, with a 2:4 sparse A operand.
+    ///
+    /// Kernel behaviour is described by:
+    /// Sparse = 2:4 structured-sparse A, compressed values + metadata
+    /// PGR0 = Prefetch Global Read = 0, no prefetch
+    /// LB0 = Lds Blocks = 0, no Lds usage
+    /// MP0 = Mfma Priority = 0, no setprio
+    /// SB = Single-block
+    /// NC = Non-cooperative
+    ///
+    /// Argument a is the packed SparseOperandA and lda is unused.
+    ///
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              uint32_t TBlockX,
+              uint32_t TBlockY,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __launch_bounds__(256) gemm_sparse_PGR0_LB0_MP0_SB_NC(uint32_t       m,
+                                                                          uint32_t       n,
+                                                                          uint32_t       k,
+                                                                          InputT const*  a,
+                                                                          InputT const*  b,
+                                                                          OutputT const* c,
+                                                                          OutputT*       d,
+                                                                          uint32_t       lda,
+                                                                          uint32_t       ldb,
+                                                                          uint32_t       ldc,
+                                                                          uint32_t       ldd,
+                                                                          ComputeT       alpha,
+                                                                          ComputeT       beta)
+    {
+        if constexpr(gemm_sparse_PGR0_LB0_MP0_SB_NC_guard<BlockM,
+                                                          BlockN,
+                                                          BlockK,
+                                                          InputT,
+                                                          OutputT,
+                                                          ComputeT,
+                                                          TBlockX,
+                                                          TBlockY,
+                                                          WaveSize,
+                                                          ArchId>::enableBuild())
+        {
+            using FragA   = sparse_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+            using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+            using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutC>;
+            using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>;
+
+            using OperandA  = SparseOperandA<InputT, LayoutA>;
+            using MappingA  = MappingUtil<BlockM, BlockK / 2u, InputT, LayoutA>;
+            using MappingAI = MappingUtil<BlockM, BlockK / 8u, uint8_t, LayoutA>;
+            using MappingB  = MappingUtil<BlockK, BlockN, InputT, LayoutB>;
+            using MappingC  = MappingUtil<BlockM, BlockN, OutputT, LayoutC>;
+            using MappingD  = MappingUtil<BlockM, BlockN, OutputT, LayoutD>;
+
+            // Target C / D block on 2D grid
+            auto matrixCoordC = MappingC::matrixCoord();
+
+            if(get<0>(matrixCoordC) + BlockM > m || get<1>(matrixCoordC) + BlockN > n)
+            {
+                return;
+            }
+
+            if(BlockK > k)
+            {
+                return;
+            }
+
+            // Initialize accumulator
+            auto fragAcc = FragAcc();
+            fill_fragment(fragAcc, static_cast<ComputeT>(0));
+
+            // Compressed A values and metadata
+            auto  ldv      = OperandA::ldValues(m, k);
+            auto  ldmeta   = OperandA::ldMetadata(m, k);
+            auto* metadata = OperandA::metadata(a, m, k);
+
+            // Setup starting addresses
+            // Offset A to col 0
+            // Offset B to row 0
+            auto* addrA  = MappingA::dataCoord(a, MappingC::matrixCoordN(0), ldv);
+            auto* addrAI = MappingAI::dataCoord(metadata, MappingC::matrixCoordN(0), ldmeta);
+            auto* addrB  = MappingB::dataCoord(b, MappingC::matrixCoordM(0), ldb);
+
+            // Setup address increments.
+            // A steps BlockK / 2 values and BlockK / 8 metadata bytes through m x k
+            // B steps BlockK through k x n
+            auto incrA  = MappingA::dataOffset(make_coord2d(0u, BlockK / 2u), ldv);
+            auto incrAI = MappingAI::dataOffset(make_coord2d(0u, BlockK / 8u), ldmeta);
+            auto incrB  = MappingB::dataOffset(make_coord2d(BlockK, 0u), ldb);
+            auto count  = k / BlockK;
+
+            // Accumulate A * B
+            for(int i = 0; i < count; i++)
+            {
+                // Keeping the workgroup in sync here is not necessary for correctness.
+                // HOWEVER, if we keep waves in sync chances are good we may
+                // benefit from cache hits on re-used data from A and B global loads.
+                synchronize_workgroup();
+
+                auto fragA = FragA();
+                auto fragB = FragB();
+
+                // Load and multiply
+                load_matrix_sync(fragA, addrA, ldv, addrAI, ldmeta);
+                load_matrix_sync(fragB, addrB, ldb);
+                mma_sync(fragAcc, fragA, fragB, fragAcc);
+
+                addrA += incrA;
+                addrAI += incrAI;
+                addrB += incrB;
+            }
+
+            auto fragC = FragC();
+
+            // Setup address and load C
+            auto* addrC = MappingC::dataCoord(c, matrixCoordC, ldc);
+            load_matrix_sync(fragC, addrC, ldc);
+
+            // D = alpha * accumAB + beta * C
+#pragma unroll
+            for(int i = 0; i < fragC.num_elements; ++i)
+            {
+                fragC.x[i] = OutputT(alpha * ComputeT(fragAcc.x[i]) + beta * ComputeT(fragC.x[i]));
+            }
+
+            // Output addresss
+            auto* addrD = MappingD::dataCoord(d, matrixCoordC, ldd);
+
+            // Store the output
+            store_matrix_sync(addrD, fragC, ldd);
+        }
+    }
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_FUNC
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_PREDICATES
+#define ROCWMMA_GEMM_TEST_DEVICE_PREDICATES
+
+#include "gemm_predicates_base.hpp"
+
+namespace rocwmma
+{
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              uint32_t TBlockX,
+              uint32_t TBlockY,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    struct gemm_sparse_PGR0_LB0_MP0_SB_NC_guard : public GemmPredicatesBase<BlockM,
+                                                                            BlockN,
+                                                                            BlockK,
+                                                                            InputT,
+                                                                            OutputT,
+                                                                            ComputeT,
+                                                                            1u,
+                                                                            1u,
+                                                                            TBlockX,
+                                                                            TBlockY,
+                                                                            WaveSize,
+                                                                            ArchId>
+    {
+        using Base       = GemmPredicatesBase<BlockM,
+                                        BlockN,
+                                        BlockK,
+                                        InputT,
+                                        OutputT,
+                                        ComputeT,
+                                        1u,
+                                        1u,
+                                        TBlockX,
+                                        TBlockY,
+                                        WaveSize,
+                                        ArchId>;
+        using TestTraits = typename Base::TestTraits;
+
+    private:
+        // Dense K of one sparse mma: 32 (16 x 16) or 16 (32 x 32) for
+        // 16-bit inputs, twice that for i8
+        constexpr static uint32_t SparseKPerMma
+            = (BlockM == 16u ? 32u : 16u) * (sizeof(InputT) == 1u ? 2u : 1u);
+
+        enum struct SparsePredicates : bool
+        {
+            // Sparse mfma is gfx94x only
+            ArchTest = (bool)TestTraits::Arch::IsGfx940 || (bool)TestTraits::Arch::IsGfx941
+                       || (bool)TestTraits::Arch::IsGfx942,
+
+            // f16 / bf16 accumulate in f32, i8 in i32
+            TypesTest
+            = ((std::is_same_v<InputT, float16_t> || std::is_same_v<InputT, bfloat16_t>)
+               && std::is_same_v<ComputeT, float32_t>)
+              || (std::is_same_v<InputT, int8_t> && std::is_same_v<ComputeT, int32_t>),
+
+            // Square single blocks of 16 or 32, whole sparse mma along K
+            BlockSizeTest = (BlockM == BlockN) && (BlockM == 16u || BlockM == 32u),
+            BlockKTest    = (BlockK % SparseKPerMma == 0u),
+
+            // A inputs are compressed to half
+            CostABTest
+            = (((uint32_t)TestTraits::Cost::TileA / 2u + (uint32_t)TestTraits::Cost::TileB)
+               <= 256u),
+            CostCTest = ((uint32_t)TestTraits::Cost::TileC <= 256u),
+            CostDTest = ((uint32_t)TestTraits::Cost::TileD <= 256u),
+
+            Enable = (ArchTest && TypesTest && BlockSizeTest && BlockKTest && CostABTest
+                      && CostCTest && CostDTest)
+        };
+
+#if !NDEBUG
+        static constexpr void debugSparsePredicates()
+        {
+            std::cout << "Sparse Predicates:\n";
+            std::cout << "ArchTest: " << (bool)SparsePredicates::ArchTest << std::endl;
+            std::cout << "TypesTest: " << (bool)SparsePredicates::TypesTest << std::endl;
+            std::cout << "BlockSizeTest: " << (bool)SparsePredicates::BlockSizeTest << std::endl;
+            std::cout << "BlockKTest: " << (bool)SparsePredicates::BlockKTest << std::endl;
+            std::cout << "CostABTest: " << (bool)SparsePredicates::CostABTest << std::endl;
+            std::cout << "CostCTest: " << (bool)SparsePredicates::CostCTest << std::endl;
+            std::cout << "CostDTest: " << (bool)SparsePredicates::CostDTest << std::endl;
+            std::cout << "Enable: " << (bool)SparsePredicates::Enable << std::endl;
+        }
+#endif // !NDEBUG
+
+    public:
+        constexpr static bool enableBuild()
+        {
+            return Base::enableBuild() && (bool)SparsePredicates::Enable;
+        }
+
+        constexpr static bool enableRun()
+        {
+            return Base::enableRun() && (bool)SparsePredicates::Enable;
+        }
+
+#if !NDEBUG
+        constexpr static void debugPredicates()
+        {
+            std::cout << "Base predicates:\n";
+            Base::debugPredicates();
+            std::cout << "\nDerived Predicates:\n";
+            debugSparsePredicates();
+
+            std::cout << "Overall enable build: " << enableBuild() << std::endl;
+            std::cout << "Overall enable run: " << enableRun() << std::endl;
+        }
+#endif // !NDEBUG
+    };
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_PREDICATES
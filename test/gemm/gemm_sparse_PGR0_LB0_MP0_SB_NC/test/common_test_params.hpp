@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_COMMON_TEST_PARAMS
+#define ROCWMMA_GEMM_COMMON_TEST_PARAMS
+
+#include "gemm_common_test_params.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// FWD declarations
+    ///
+
+    class KernelGenerator_Sparse_PGR0_LB0_MP0_SB_NC;
+
+    ///
+    /// Generalized kernel params for 2:4 sparse tests
+    ///
+    struct CommonTestParams : public GemmCommonTestParams
+    {
+        ///
+        /// Kernel generator impl objects
+        ///
+        using KernelGeneratorImpl = KernelGenerator_Sparse_PGR0_LB0_MP0_SB_NC;
+
+        ///
+        /// Sparse mma types: f16 / bf16 accumulate in f32, i8 in i32
+        /// Layout: InputT, OutputT, ComputeT
+        ///
+        using TestTypesSparse = std::tuple<std::tuple<float16_t, float16_t, float32_t>,
+                                           std::tuple<float16_t, float32_t, float32_t>,
+                                           std::tuple<bfloat16_t, bfloat16_t, float32_t>,
+                                           std::tuple<bfloat16_t, float32_t, float32_t>,
+                                           std::tuple<int8_t, int8_t, int32_t>,
+                                           std::tuple<int8_t, int32_t, int32_t>>;
+
+        using TestTypes16x16 = TestTypesSparse;
+        using TestTypes32x32 = TestTypesSparse;
+
+        ///
+        /// Block sizes: BlockK must hold whole sparse mma, which cover
+        /// 32 (16 x 16) or 16 (32 x 32) dense K for 16-bit types and twice
+        /// that for i8. Smaller BlockK are skipped by the kernel guard.
+        ///
+        using TestBlockSizes16x16 = std::tuple<std::tuple<I<16>, I<16>, I<32>>,
+                                               std::tuple<I<16>, I<16>, I<64>>
+#if ROCWMMA_EXTENDED_TESTS
+                                               ,
+                                               std::tuple<I<16>, I<16>, I<128>>
+#endif // ROCWMMA_EXTENDED_TESTS
+                                               >;
+
+        using TestBlockSizes32x32 = std::tuple<std::tuple<I<32>, I<32>, I<16>>,
+                                               std::tuple<I<32>, I<32>, I<32>>
+#if ROCWMMA_EXTENDED_TESTS
+                                               ,
+                                               std::tuple<I<32>, I<32>, I<64>>
+#endif // ROCWMMA_EXTENDED_TESTS
+                                               >;
+    };
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
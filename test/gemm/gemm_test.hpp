@@ -27,10 +27,14 @@
 #ifndef ROCWMMA_GEMM_TEST_BASE_HPP
 #define ROCWMMA_GEMM_TEST_BASE_HPP
 
+#include <map>
+
 #include <gtest/gtest.h>
 
 #include "gemm_common_test_params.hpp"
 #include "gemm_kernel_base.hpp"
+#include "gemm_planner.hpp"
+#include "kernel_pipeline.hpp"
 #include "rocwmma_options.hpp"
 
 namespace rocwmma
@@ -49,8 +53,22 @@ namespace rocwmma
                                                   typename GemmCommonTestParams::AlphaT,
                                                   typename GemmCommonTestParams::BetaT>>;
 
+        using KernelT      = typename GemmCommonTestParams::KernelT;
+        using ThreadBlockT = typename GemmCommonTestParams::ThreadBlockT;
+        using ProblemSizeT = typename GemmCommonTestParams::ProblemSizeT;
+        using AlphaT       = typename GemmCommonTestParams::AlphaT;
+        using BetaT        = typename GemmCommonTestParams::BetaT;
+
         void SetUp() override
         {
+            // Pipelined, tuned or dry-run suites cover these kernels
+            if(RocwmmaOptions::instance()->pipelineDepth() > 0u
+               || !RocwmmaOptions::instance()->tuningDatabase().empty()
+               || !RocwmmaOptions::instance()->dryRunArch().empty())
+            {
+                GTEST_SKIP();
+            }
+
             // Construct ProblemParams from
             // incoming gtest parameterization
             auto param       = Base::GetParam();
@@ -164,6 +182,345 @@ namespace rocwmma
             }
         }
 
+        // Runs every combination of a suite's parameters through the KernelPipeline.
+        // Setup and launch are issued in order on the calling thread, while the CPU
+        // reference and comparison of previous kernels run on host workers.
+        static void RunKernelsPipelined(std::vector<KernelT> const&      kernels,
+                                        std::vector<ThreadBlockT> const& threadBlocks,
+                                        std::vector<ProblemSizeT> const& problemSizes,
+                                        std::vector<AlphaT> const&       alphas,
+                                        std::vector<BetaT> const&        betas)
+        {
+            using Options        = rocwmma::RocwmmaOptions;
+            auto& loggingOptions = Options::instance();
+
+            auto depth = loggingOptions->pipelineDepth();
+            if(depth == 0u)
+            {
+                GTEST_SKIP();
+            }
+
+            struct Job
+            {
+                KernelT       kernel;
+                ProblemParams params;
+            };
+
+            // Problem-major ordering, so that neighbouring jobs use
+            // different kernel objects and are free to overlap.
+            auto jobs = std::vector<Job>();
+            for(auto const& threadBlock : threadBlocks)
+            {
+                for(auto const& problemSize : problemSizes)
+                {
+                    for(auto const& alpha : alphas)
+                    {
+                        for(auto const& beta : betas)
+                        {
+                            for(auto const& kernel : kernels)
+                            {
+                                jobs.push_back({kernel, {threadBlock, problemSize, alpha, beta}});
+                            }
+                        }
+                    }
+                }
+            }
+
+            typename KernelPipeline<Job>::Stages stages;
+            stages.issue = [](Job& job) {
+                // Cleanup previously used resources if the resource context changes.
+                static HipResource* sLastResourceRun = nullptr;
+                if(sLastResourceRun && sLastResourceRun != job.kernel->getResource())
+                {
+                    sLastResourceRun->reset();
+                }
+                sLastResourceRun = job.kernel->getResource();
+
+                job.kernel->setAsyncValidation(true);
+                job.kernel->setup(job.params);
+                job.kernel->exec();
+
+                // Kernels that can't detach from shared storage validate in order
+                if(!job.kernel->supportsAsyncValidation())
+                {
+                    job.kernel->validateResults();
+                }
+            };
+            stages.validate = [](Job& job) {
+                if(job.kernel->supportsAsyncValidation())
+                {
+                    job.kernel->validateResults();
+                }
+            };
+            stages.report = [&loggingOptions](Job& job) {
+                if(!loggingOptions->omitCout())
+                {
+                    job.kernel->reportResults(std::cout,
+                                              KernelI::sHeaderPrinted,
+                                              loggingOptions->omitSkipped(),
+                                              loggingOptions->omitFailed(),
+                                              loggingOptions->omitPassed());
+                }
+
+                if(loggingOptions->ostream().isOpen())
+                {
+                    job.kernel->reportResults(loggingOptions->ostream().fstream(),
+                                              KernelI::sHeaderPrinted,
+                                              loggingOptions->omitSkipped(),
+                                              loggingOptions->omitFailed(),
+                                              loggingOptions->omitPassed());
+                }
+
+                // Print the header only once
+                KernelI::sHeaderPrinted = true;
+
+                job.kernel->setAsyncValidation(false);
+                job.kernel->tearDown();
+            };
+            stages.resourceKey = [](Job const& job) -> void const* { return job.kernel.get(); };
+
+            KernelPipeline<Job> pipeline(depth, depth);
+            pipeline.run(jobs, stages);
+        }
+
+        // Autotunes every (problem size, alpha, beta) of a suite over its instantiated
+        // kernels and thread blocks. Candidates are pruned with the kernels' own run
+        // checks and the cost model, then survivors are benchmarked on the device.
+        // Winners are merged into the tuning database given by --tune.
+        static void RunKernelsTuned(std::vector<KernelT> const&      kernels,
+                                    std::vector<ThreadBlockT> const& threadBlocks,
+                                    std::vector<ProblemSizeT> const& problemSizes,
+                                    std::vector<AlphaT> const&       alphas,
+                                    std::vector<BetaT> const&        betas)
+        {
+            using Options        = rocwmma::RocwmmaOptions;
+            auto& loggingOptions = Options::instance();
+
+            auto const& dbPath = loggingOptions->tuningDatabase();
+            if(dbPath.empty())
+            {
+                GTEST_SKIP();
+            }
+
+            auto& deviceInfo = HipDevice::instance();
+            auto  arch       = std::string(deviceInfo->getDeviceProps().gcnArchName);
+            auto  profile    = findArchProfile(arch);
+            if(!profile)
+            {
+                GTEST_SKIP() << "No arch profile for " << arch;
+            }
+            profile->cuCount = deviceInfo->cuCount();
+
+            auto model = GemmTuning::CostModel(*profile);
+            auto tuner = GemmTuning::Autotuner(model);
+
+            // Results from previous suites or runs are kept unless beaten
+            GemmTuning::TuningDatabase database;
+            {
+                GemmTuning::MappedTuningDatabase existing;
+                if(existing.open(dbPath))
+                {
+                    database.merge(existing);
+                }
+            }
+
+            auto setupKernel = [](KernelT const& kernel, ProblemParams const& params) {
+                // Cleanup previously used resources if the resource context changes.
+                static HipResource* sLastResourceRun = nullptr;
+                if(sLastResourceRun && sLastResourceRun != kernel->getResource())
+                {
+                    sLastResourceRun->reset();
+                }
+                sLastResourceRun = kernel->getResource();
+
+                kernel->setup(params);
+            };
+
+            for(auto const& problemSize : problemSizes)
+            {
+                for(auto const& alpha : alphas)
+                {
+                    for(auto const& beta : betas)
+                    {
+                        // Suites mix data types and layouts, so candidates
+                        // are grouped by the database key they tune.
+                        struct Group
+                        {
+                            GemmTuning::Problem                problem;
+                            std::vector<GemmTuning::Candidate> candidates;
+                            std::vector<ProblemParams>         params;
+                            std::vector<KernelT>               kernels;
+                        };
+                        std::map<std::string, Group> groups;
+
+                        for(auto const& kernel : kernels)
+                        {
+                            for(auto const& threadBlock : threadBlocks)
+                            {
+                                ProblemParams params = {threadBlock, problemSize, alpha, beta};
+                                setupKernel(kernel, params);
+
+                                GemmTuning::Problem   problem;
+                                GemmTuning::Candidate candidate;
+                                if(kernel->tuningCandidate(problem, candidate))
+                                {
+                                    auto& group
+                                        = groups[GemmTuning::Key::fromProblem(arch, problem).str()];
+                                    group.problem = problem;
+                                    group.candidates.push_back(candidate);
+                                    group.params.push_back(params);
+                                    group.kernels.push_back(kernel);
+                                }
+                                kernel->tearDown();
+                            }
+                        }
+
+                        for(auto& keyGroup : groups)
+                        {
+                            auto const& keyStr = keyGroup.first;
+                            auto&       group  = keyGroup.second;
+
+                            auto timing = [&group, &setupKernel](GemmTuning::Candidate const&,
+                                                                 size_t index) {
+                                auto& kernel = group.kernels[index];
+                                setupKernel(kernel, group.params[index]);
+                                kernel->exec();
+                                auto runTimeMs = kernel->runTimeMs();
+                                kernel->tearDown();
+                                return runTimeMs;
+                            };
+
+                            auto result = tuner.tune(group.problem, group.candidates, timing);
+                            if(!result.found())
+                            {
+                                continue;
+                            }
+
+                            auto const& best = result.best();
+                            database.update(GemmTuning::Key::fromProblem(arch, group.problem),
+                                            {best.candidate,
+                                             best.measuredMs,
+                                             group.problem.flops() / best.measuredMs * 1.0e-9});
+
+                            if(!loggingOptions->omitCout())
+                            {
+                                std::cout << "Tuned " << keyStr << ": " << best.candidate.name()
+                                          << ", " << best.measuredMs << " ms ("
+                                          << result.measurements.size() << " benchmarked, "
+                                          << result.prunedByPredicates + result.prunedByModel
+                                          << " pruned)" << std::endl;
+                            }
+                        }
+                    }
+                }
+            }
+
+            database.save(dbPath);
+        }
+
+        // Plans every kernel, thread block and problem of a suite against the
+        // arch profile given by --dry-run. Reports predicted resources, occupancy
+        // and roofline time of each candidate without touching the device.
+        static void RunKernelsDryRun(std::vector<KernelT> const&      kernels,
+                                     std::vector<ThreadBlockT> const& threadBlocks,
+                                     std::vector<ProblemSizeT> const& problemSizes,
+                                     std::vector<AlphaT> const&       alphas,
+                                     std::vector<BetaT> const&        betas)
+        {
+            using Options        = rocwmma::RocwmmaOptions;
+            auto& loggingOptions = Options::instance();
+
+            auto const& arch = loggingOptions->dryRunArch();
+            if(arch.empty())
+            {
+                GTEST_SKIP();
+            }
+
+            auto profile = findArchProfile(arch);
+            if(!profile)
+            {
+                std::string known;
+                for(auto const& archProfile : archProfiles())
+                {
+                    known += " " + archProfile.name;
+                }
+                FAIL() << "No arch profile for " << arch << ", expected one of:" << known;
+            }
+
+            auto report = [&loggingOptions, &profile](GemmPlanner::Plan const& plan) {
+                static bool sHeaderPrinted = false;
+                if(!plan.runs() && loggingOptions->omitSkipped())
+                {
+                    return;
+                }
+
+                if(!loggingOptions->omitCout())
+                {
+                    if(!sHeaderPrinted)
+                    {
+                        GemmPlanner::printHeader(std::cout);
+                    }
+                    GemmPlanner::printPlan(std::cout, *profile, plan);
+                }
+
+                if(loggingOptions->ostream().isOpen())
+                {
+                    auto& stream = loggingOptions->ostream().fstream();
+                    if(!sHeaderPrinted)
+                    {
+                        GemmPlanner::printHeader(stream);
+                    }
+                    GemmPlanner::printPlan(stream, *profile, plan);
+                }
+
+                sHeaderPrinted = true;
+            };
+
+            size_t planned = 0u, skipped = 0u;
+            double totalMs = 0.0;
+            for(auto const& problemSize : problemSizes)
+            {
+                for(auto const& alpha : alphas)
+                {
+                    for(auto const& beta : betas)
+                    {
+                        for(auto const& kernel : kernels)
+                        {
+                            for(auto const& threadBlock : threadBlocks)
+                            {
+                                ProblemParams params = {threadBlock, problemSize, alpha, beta};
+
+                                GemmTuning::Problem   problem;
+                                GemmTuning::Candidate candidate;
+                                if(!kernel->planCandidate(params, *profile, problem, candidate))
+                                {
+                                    continue;
+                                }
+
+                                auto plan = GemmPlanner::plan(*profile, problem, candidate);
+                                if(plan.runs())
+                                {
+                                    planned++;
+                                    totalMs += plan.predictedMs;
+                                }
+                                else
+                                {
+                                    skipped++;
+                                }
+                                report(plan);
+                            }
+                        }
+                    }
+                }
+            }
+
+            if(!loggingOptions->omitCout())
+            {
+                std::cout << "Dry run " << profile->name << ": " << planned << " planned, "
+                          << skipped << " skipped, " << totalMs << " ms predicted" << std::endl;
+            }
+        }
+
         void TearDown() override
         {
             // Construct ProblemParams from
@@ -27,6 +27,7 @@
 #ifndef ROCWMMA_GEMM_TEST_MACROS_HPP
 #define ROCWMMA_GEMM_TEST_MACROS_HPP
 
+#include "deferred_tests.hpp"
 #include "gemm_test.hpp"
 #include "kernel_generator.hpp"
 
@@ -93,12 +94,87 @@
 /// test_params : the class generated by ROCWMMA_GENERATE_GEMM_GTEST_SUITE_PARAMS,
 /// which fulfills the rocwmma::GemmTest interface.
 ///
-#define ROCWMMA_GEMM_GTEST_PARAM_TRIAGE(test_params)                     \
-    ::testing::Combine(::testing::ValuesIn(test_params::kernels()),      \
-                       ::testing::ValuesIn(test_params::threadBlocks()), \
-                       ::testing::ValuesIn(test_params::problemSizes()), \
-                       ::testing::ValuesIn(test_params::alphas()),       \
-                       ::testing::ValuesIn(test_params::betas()))
+#define ROCWMMA_GEMM_GTEST_PARAM_TRIAGE(test_params)                                         \
+    ::testing::Combine(::testing::ValuesIn(test_params::kernels()),                          \
+                       ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(test_params, threadBlocks)), \
+                       ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(test_params, problemSizes)), \
+                       ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(test_params, alphas)),       \
+                       ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(test_params, betas)))
+
+///
+/// Pipelined variant of a GEMM test suite, registered only with --pipeline *depth*.
+/// Runs the same parameter space as the parameterized suite in a single test,
+/// overlapping the CPU reference of each kernel with the launch of the next.
+/// @params
+/// test_suite_prefix = used as the general test context (e.g. gemm_kernel_tests)
+/// test_suite_name = specific test context (e.g. gemm_my_kernel_NN_32x32_2x1)
+/// test_params = the object generated by ROCWMMA_GENERATE_GEMM_GTEST_SUITE_PARAMS
+///
+#define ROCWMMA_INSTANTIATE_GEMM_PIPELINED_GTEST(test_suite_prefix, test_suite_name, test_params) \
+    [[maybe_unused]] static bool const test_suite_name##_Pipelined                                \
+        = rocwmma::DeferredTests::add(rocwmma::DeferredTests::Mode::Pipelined,                    \
+                                      #test_suite_prefix,                                         \
+                                      #test_suite_name "_Pipelined",                              \
+                                      __FILE__,                                                   \
+                                      __LINE__,                                                   \
+                                      []() {                                                      \
+                                          rocwmma::GemmTest::RunKernelsPipelined(                 \
+                                              test_params::kernels(),                             \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, threadBlocks),    \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, problemSizes),    \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, alphas),          \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, betas));          \
+                                      });
+
+///
+/// Autotuning variant of a GEMM test suite, registered only with --tune *file.db*.
+/// Searches the suite's kernels and thread blocks for the fastest candidate
+/// per problem and records the winners in the tuning database.
+/// @params
+/// test_suite_prefix = used as the general test context (e.g. gemm_kernel_tests)
+/// test_suite_name = specific test context (e.g. gemm_my_kernel_NN_32x32_2x1)
+/// test_params = the object generated by ROCWMMA_GENERATE_GEMM_GTEST_SUITE_PARAMS
+///
+#define ROCWMMA_INSTANTIATE_GEMM_TUNED_GTEST(test_suite_prefix, test_suite_name, test_params)  \
+    [[maybe_unused]] static bool const test_suite_name##_Tuned                                 \
+        = rocwmma::DeferredTests::add(rocwmma::DeferredTests::Mode::Tuned,                     \
+                                      #test_suite_prefix,                                      \
+                                      #test_suite_name "_Tuned",                               \
+                                      __FILE__,                                                \
+                                      __LINE__,                                                \
+                                      []() {                                                   \
+                                          rocwmma::GemmTest::RunKernelsTuned(                  \
+                                              test_params::kernels(),                          \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, threadBlocks), \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, problemSizes), \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, alphas),       \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, betas));       \
+                                      });
+
+///
+/// Dry-run variant of a GEMM test suite, registered only with --dry-run *gfx_arch*.
+/// Plans the suite's parameter space against an arch profile and reports
+/// predicted resources and times. Nothing is launched.
+/// @params
+/// test_suite_prefix = used as the general test context (e.g. gemm_kernel_tests)
+/// test_suite_name = specific test context (e.g. gemm_my_kernel_NN_32x32_2x1)
+/// test_params = the object generated by ROCWMMA_GENERATE_GEMM_GTEST_SUITE_PARAMS
+///
+#define ROCWMMA_INSTANTIATE_GEMM_DRY_RUN_GTEST(test_suite_prefix, test_suite_name, test_params) \
+    [[maybe_unused]] static bool const test_suite_name##_DryRun                                 \
+        = rocwmma::DeferredTests::add(rocwmma::DeferredTests::Mode::DryRun,                     \
+                                      #test_suite_prefix,                                       \
+                                      #test_suite_name "_DryRun",                               \
+                                      __FILE__,                                                 \
+                                      __LINE__,                                                 \
+                                      []() {                                                    \
+                                          rocwmma::GemmTest::RunKernelsDryRun(                  \
+                                              test_params::kernels(),                           \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, threadBlocks),  \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, problemSizes),  \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, alphas),        \
+                                              ROCWMMA_SWEEP_PARAMS(test_params, betas));        \
+                                      });
 
 ///
 /// Specific to GEMM gtest interface of rocwmma::GemmTest
@@ -116,7 +192,10 @@
                                     rocwmma::GemmTest,                                        \
                                     RunKernel,                                                \
                                     ROCWMMA_GEMM_GTEST_PARAM_TRIAGE,                          \
-                                    test_params)
+                                    test_params)                                              \
+    ROCWMMA_INSTANTIATE_GEMM_PIPELINED_GTEST(test_suite_prefix, test_suite_name, test_params) \
+    ROCWMMA_INSTANTIATE_GEMM_TUNED_GTEST(test_suite_prefix, test_suite_name, test_params)     \
+    ROCWMMA_INSTANTIATE_GEMM_DRY_RUN_GTEST(test_suite_prefix, test_suite_name, test_params)
 
 ///
 /// Specific to GEMM gtest interface of rocwmma::GemmTest
@@ -128,13 +207,16 @@
 /// ROCWMMA_GEMM_GTEST_PARAM_TRIAGE macro to ensure matching of gtest parameters.
 /// Invokes the RunKernelWithoutWarmup() function in rocwmma::GemmTest object.
 ///
-#define ROCWMMA_INSTANTIATE_GEMM_GTEST_SUITE_NO_WARMUP(              \
-    test_suite_prefix, test_suite_name, test_params)                 \
-    ROCWMMA_INSTANTIATE_GTEST_SUITE(test_suite_prefix,               \
-                                    test_suite_name,                 \
-                                    rocwmma::GemmTest,               \
-                                    RunKernelWithoutWarmup,          \
-                                    ROCWMMA_GEMM_GTEST_PARAM_TRIAGE, \
-                                    test_params)
+#define ROCWMMA_INSTANTIATE_GEMM_GTEST_SUITE_NO_WARMUP(                                       \
+    test_suite_prefix, test_suite_name, test_params)                                          \
+    ROCWMMA_INSTANTIATE_GTEST_SUITE(test_suite_prefix,                                        \
+                                    test_suite_name,                                          \
+                                    rocwmma::GemmTest,                                        \
+                                    RunKernelWithoutWarmup,                                   \
+                                    ROCWMMA_GEMM_GTEST_PARAM_TRIAGE,                          \
+                                    test_params)                                              \
+    ROCWMMA_INSTANTIATE_GEMM_PIPELINED_GTEST(test_suite_prefix, test_suite_name, test_params) \
+    ROCWMMA_INSTANTIATE_GEMM_TUNED_GTEST(test_suite_prefix, test_suite_name, test_params)     \
+    ROCWMMA_INSTANTIATE_GEMM_DRY_RUN_GTEST(test_suite_prefix, test_suite_name, test_params)
 
 #endif // ROCWMMA_GEMM_TEST_MACROS_HPP
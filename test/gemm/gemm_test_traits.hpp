@@ -35,6 +35,8 @@
 #include <rocwmma/rocwmma.hpp>
 #pragma GCC diagnostic pop
 
+#include "gemm_mixed_input.hpp"
+
 namespace rocwmma
 {
     template <uint32_t BlockM,
@@ -49,6 +51,10 @@ namespace rocwmma
               uint32_t ArchId>
     struct GemmTestTraits
     {
+        // Mixed A / B inputs are upcast in registers, so tile costs and
+        // input type support follow the mma fragment datatype.
+        using MmaInputT = GemmMmaInputT_t<InputT>;
+
         // Size properties of gemm tiles
         enum struct TileSizes : uint32_t
         {
@@ -76,10 +82,10 @@ namespace rocwmma
             DWord       = 4u,
 
             TileA
-            = ceilDiv((uint32_t)TileSizes::A_Size * sizeof(InputT), Granularity* WaveSize* DWord)
+            = ceilDiv((uint32_t)TileSizes::A_Size * sizeof(MmaInputT), Granularity* WaveSize* DWord)
               * Granularity,
             TileB
-            = ceilDiv((uint32_t)TileSizes::B_Size * sizeof(InputT), Granularity* WaveSize* DWord)
+            = ceilDiv((uint32_t)TileSizes::B_Size * sizeof(MmaInputT), Granularity* WaveSize* DWord)
               * Granularity,
             TileC
             = ceilDiv((uint32_t)TileSizes::C_Size * sizeof(ComputeT), Granularity* WaveSize* DWord)
@@ -115,72 +121,72 @@ namespace rocwmma
 
         enum struct InputType : bool
         {
-            IsInt8 = std::is_same_v<InputT, int8_t>,
+            IsInt8 = is_same_v<MmaInputT, int8_t>,
 
             // Make sure to include fnuz f8 types
-            IsFloat8      = std::is_same_v<InputT, float8_t>,
-            IsFloat8Fnuz  = std::is_same_v<InputT, float8_fnuz_t>,
-            IsBFloat8     = std::is_same_v<InputT, bfloat8_t>,
-            IsBFloat8Fnuz = std::is_same_v<InputT, bfloat8_fnuz_t>,
+            IsFloat8      = is_same_v<MmaInputT, float8_t>,
+            IsFloat8Fnuz  = is_same_v<MmaInputT, float8_fnuz_t>,
+            IsBFloat8     = is_same_v<MmaInputT, bfloat8_t>,
+            IsBFloat8Fnuz = is_same_v<MmaInputT, bfloat8_fnuz_t>,
 
 #if !ROCWMMA_TESTS_NO_HALF
-            IsHFloat16 = std::is_same_v<InputT, hfloat16_t>,
+            IsHFloat16 = is_same_v<MmaInputT, hfloat16_t>,
 #else
             IsHFloat16 = false,
 #endif // !ROCWMMA_TESTS_NO_HALF
-            IsFloat16  = std::is_same_v<InputT, float16_t> || IsHFloat16,
-            IsBFloat16 = std::is_same_v<InputT, bfloat16_t>,
+            IsFloat16  = is_same_v<MmaInputT, float16_t> || IsHFloat16,
+            IsBFloat16 = is_same_v<MmaInputT, bfloat16_t>,
 
-            IsFloat32  = std::is_same_v<InputT, float32_t>,
-            IsXFloat32 = std::is_same_v<InputT, xfloat32_t>,
+            IsFloat32  = is_same_v<MmaInputT, float32_t>,
+            IsXFloat32 = is_same_v<MmaInputT, xfloat32_t>,
 
-            IsFloat64 = std::is_same_v<InputT, float64_t>,
+            IsFloat64 = is_same_v<MmaInputT, float64_t>,
         };
 
         enum struct OutputType : bool
         {
-            IsInt8        = std::is_same_v<OutputT, int8_t>,
-            IsFloat8      = std::is_same_v<InputT, float8_t>,
-            IsFloat8Fnuz  = std::is_same_v<InputT, float8_fnuz_t>,
-            IsBFloat8     = std::is_same_v<InputT, bfloat8_t>,
-            IsBFloat8Fnuz = std::is_same_v<InputT, bfloat8_fnuz_t>,
+            IsInt8        = is_same_v<OutputT, int8_t>,
+            IsFloat8      = is_same_v<InputT, float8_t>,
+            IsFloat8Fnuz  = is_same_v<InputT, float8_fnuz_t>,
+            IsBFloat8     = is_same_v<InputT, bfloat8_t>,
+            IsBFloat8Fnuz = is_same_v<InputT, bfloat8_fnuz_t>,
 
 #if !ROCWMMA_TESTS_NO_HALF
-            IsHFloat16 = std::is_same_v<OutputT, hfloat16_t>,
+            IsHFloat16 = is_same_v<OutputT, hfloat16_t>,
 #else
             IsHFloat16 = false,
 #endif // !ROCWMMA_TESTS_NO_HALF
 
-            IsFloat16  = std::is_same_v<OutputT, float16_t> || IsHFloat16,
-            IsBFloat16 = std::is_same_v<OutputT, bfloat16_t>,
+            IsFloat16  = is_same_v<OutputT, float16_t> || IsHFloat16,
+            IsBFloat16 = is_same_v<OutputT, bfloat16_t>,
 
-            IsFloat32  = std::is_same_v<OutputT, float32_t>,
-            IsXFloat32 = std::is_same_v<OutputT, xfloat32_t>,
+            IsFloat32  = is_same_v<OutputT, float32_t>,
+            IsXFloat32 = is_same_v<OutputT, xfloat32_t>,
 
-            IsFloat64 = std::is_same_v<OutputT, float64_t>,
+            IsFloat64 = is_same_v<OutputT, float64_t>,
         };
 
         enum struct ComputeType : bool
         {
-            IsInt8        = std::is_same_v<ComputeT, int8_t>,
-            IsFloat8      = std::is_same_v<InputT, float8_t>,
-            IsFloat8Fnuz  = std::is_same_v<InputT, float8_fnuz_t>,
-            IsBFloat8     = std::is_same_v<InputT, bfloat8_t>,
-            IsBFloat8Fnuz = std::is_same_v<InputT, bfloat8_fnuz_t>,
+            IsInt8        = is_same_v<ComputeT, int8_t>,
+            IsFloat8      = is_same_v<InputT, float8_t>,
+            IsFloat8Fnuz  = is_same_v<InputT, float8_fnuz_t>,
+            IsBFloat8     = is_same_v<InputT, bfloat8_t>,
+            IsBFloat8Fnuz = is_same_v<InputT, bfloat8_fnuz_t>,
 
 #if !ROCWMMA_TESTS_NO_HALF
-            IsHFloat16 = std::is_same_v<ComputeT, hfloat16_t>,
+            IsHFloat16 = is_same_v<ComputeT, hfloat16_t>,
 #else
             IsHFloat16 = false,
 #endif // !ROCWMMA_TESTS_NO_HALF
 
-            IsFloat16  = std::is_same_v<ComputeT, float16_t> || IsHFloat16,
-            IsBFloat16 = std::is_same_v<ComputeT, bfloat16_t>,
+            IsFloat16  = is_same_v<ComputeT, float16_t> || IsHFloat16,
+            IsBFloat16 = is_same_v<ComputeT, bfloat16_t>,
 
-            IsFloat32  = std::is_same_v<ComputeT, float32_t>,
-            IsXFloat32 = std::is_same_v<ComputeT, xfloat32_t>,
+            IsFloat32  = is_same_v<ComputeT, float32_t>,
+            IsXFloat32 = is_same_v<ComputeT, xfloat32_t>,
 
-            IsFloat64 = std::is_same_v<ComputeT, float64_t>,
+            IsFloat64 = is_same_v<ComputeT, float64_t>,
         };
 
         enum struct BlockSizes : bool
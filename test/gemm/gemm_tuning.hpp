@@ -0,0 +1,748 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TUNING_HPP
+#define ROCWMMA_GEMM_TUNING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "arch_profile.hpp"
+#include "roofline.hpp"
+
+// Host-side GEMM autotuning: candidate pruning with an analytic cost model,
+// search over a pluggable timing backend and a persistent tuning database.
+// Nothing here depends on HIP, so the search and storage can be exercised
+// on host with SyntheticTimingBackend.
+namespace rocwmma
+{
+    namespace GemmTuning
+    {
+        ///
+        /// Problem being tuned. Type and layout names follow dataTypeToString.
+        ///
+        struct Problem
+        {
+            uint32_t m, n, k;
+
+            std::string inputT, outputT, computeT;
+
+            // LytA_LytB_LytC_LytD, e.g. N_T_N_N
+            std::string layouts;
+
+            uint32_t inputBytes, outputBytes;
+
+            // C is not read when beta is zero
+            bool betaZero = false;
+
+            double flops() const
+            {
+                return 2.0 * static_cast<double>(m) * static_cast<double>(n)
+                       * static_cast<double>(k);
+            }
+        };
+
+        ///
+        /// One instantiated kernel variant at one thread block size
+        ///
+        struct Candidate
+        {
+            std::string kernel; // e.g. PGR1_LB2_MP0_MB_CP
+            std::string gemmConfig; // Empty if the variant is not cooperative
+            std::string layoutLds;
+
+            uint32_t blockM, blockN, blockK;
+            uint32_t blocksX = 1u;
+            uint32_t blocksY = 1u;
+            uint32_t tBlockX, tBlockY;
+            uint32_t ldsBytes = 0u;
+
+            // Outcome of the kernel's own run checks for the problem,
+            // including its GemmPredicatesBase guard.
+            bool enabled = true;
+
+            uint32_t macroTileM(uint32_t waveSize) const
+            {
+                return blockM * blocksX * tBlockX / waveSize;
+            }
+
+            uint32_t macroTileN() const
+            {
+                return blockN * blocksY * tBlockY;
+            }
+
+            std::string name() const
+            {
+                return kernel + "/" + gemmConfig + "/" + layoutLds + "/" + std::to_string(blockM)
+                       + "x" + std::to_string(blockN) + "x" + std::to_string(blockK) + "/"
+                       + std::to_string(blocksX) + "x" + std::to_string(blocksY) + "/"
+                       + std::to_string(tBlockX) + "x" + std::to_string(tBlockY);
+            }
+        };
+
+        ///
+        /// Analytic cost model: quantized roofline over the arch profile.
+        /// Only used to rank and prune candidates, not to report results.
+        ///
+        class CostModel
+        {
+        public:
+            // Fixed launch cost, so tiny problems don't favour huge grids
+            static constexpr double LaunchOverheadMs = 0.004;
+
+            explicit CostModel(ArchProfile const& arch)
+                : mArch(arch)
+            {
+            }
+
+            ArchProfile const& arch() const
+            {
+                return mArch;
+            }
+
+            // Resident workgroups per CU, limited by wave slots and LDS
+            uint32_t workgroupsPerCu(Candidate const& candidate) const
+            {
+                auto wavesPerWg = candidate.tBlockX / mArch.waveSize * candidate.tBlockY;
+                if(wavesPerWg == 0u)
+                {
+                    return 0u;
+                }
+
+                auto byWaves = mArch.simdsPerCu * mArch.maxWavesPerSimd / wavesPerWg;
+                auto byLds   = candidate.ldsBytes ? mArch.ldsBytesPerCu / candidate.ldsBytes
+                                                  : byWaves;
+                return std::min(byWaves, byLds);
+            }
+
+            // Checks mirroring the kernel's checkSizes / checkLds, so that
+            // candidates from any source can be pruned consistently.
+            bool feasible(Problem const& problem, Candidate const& candidate) const
+            {
+                auto threads = candidate.tBlockX * candidate.tBlockY;
+                if(!candidate.enabled || candidate.tBlockX % mArch.waveSize != 0u
+                   || threads > mArch.maxThreadsPerWorkgroup
+                   || candidate.ldsBytes > mArch.maxLdsBytesPerWorkgroup
+                   || workgroupsPerCu(candidate) == 0u
+                   || mArch.peakTFlopsFor(problem.inputT) <= 0.0)
+                {
+                    return false;
+                }
+
+                return candidate.macroTileM(mArch.waveSize) <= problem.m
+                       && candidate.macroTileN() <= problem.n && candidate.blockK <= problem.k;
+            }
+
+            // Time on matrix cores, quantized to whole tiles per CU
+            double computeMs(Problem const& problem, Candidate const& candidate) const
+            {
+                uint64_t tileM   = candidate.macroTileM(mArch.waveSize);
+                uint64_t tileN   = candidate.macroTileN();
+                uint64_t tilesM  = ceilDiv(problem.m, tileM);
+                uint64_t tilesN  = ceilDiv(problem.n, tileN);
+                uint64_t paddedK = ceilDiv(problem.k, candidate.blockK) * candidate.blockK;
+
+                // Padded work: partial tiles cost as much as full ones
+                auto tileFlops = 2.0 * tileM * tileN * paddedK;
+
+                // The busiest CU bounds the runtime
+                auto tilesPerCu = ceilDiv(tilesM * tilesN, mArch.cuCount);
+
+                // Matrix cores need ~2 resident waves per SIMD to hide latency
+                auto wavesPerWg    = candidate.tBlockX / mArch.waveSize * candidate.tBlockY;
+                auto residentWaves = std::min<uint64_t>(tilesPerCu, workgroupsPerCu(candidate))
+                                     * wavesPerWg;
+                auto latencyHiding
+                    = std::min(1.0, static_cast<double>(residentWaves) / (2.0 * mArch.simdsPerCu));
+
+                auto cuFlopsPerMs = mArch.peakTFlopsFor(problem.inputT) * 1.0e9 / mArch.cuCount;
+                return tilesPerCu * tileFlops / (cuFlopsPerMs * latencyHiding);
+            }
+
+            // Global memory traffic in bytes
+            double bytesMoved(Problem const& problem, Candidate const& candidate) const
+            {
+                return tiledGemmBytes(problem.m,
+                                      problem.n,
+                                      problem.k,
+                                      candidate.macroTileM(mArch.waveSize),
+                                      candidate.macroTileN(),
+                                      problem.inputBytes,
+                                      problem.inputBytes,
+                                      problem.betaZero ? 0.0 : problem.outputBytes,
+                                      problem.outputBytes);
+            }
+
+            double memoryMs(Problem const& problem, Candidate const& candidate) const
+            {
+                return bytesMoved(problem, candidate) / (mArch.memBandwidthGBs * 1.0e6);
+            }
+
+            double estimateMs(Problem const& problem, Candidate const& candidate) const
+            {
+                return std::max(computeMs(problem, candidate), memoryMs(problem, candidate))
+                       + LaunchOverheadMs;
+            }
+
+        private:
+            static uint64_t ceilDiv(uint64_t num, uint64_t den)
+            {
+                return (num + den - 1u) / den;
+            }
+
+            ArchProfile mArch;
+        };
+
+        struct Measurement
+        {
+            size_t    index; // Into the candidate list given to the tuner
+            Candidate candidate;
+            double    predictedMs;
+            double    measuredMs;
+        };
+
+        struct TuningResult
+        {
+            // Benchmarked survivors, fastest first
+            std::vector<Measurement> measurements;
+
+            size_t prunedByPredicates = 0u;
+            size_t prunedByModel      = 0u;
+            size_t failed             = 0u;
+
+            bool found() const
+            {
+                return !measurements.empty();
+            }
+
+            Measurement const& best() const
+            {
+                return measurements.front();
+            }
+        };
+
+        // Returns the elapsed time of one candidate in ms.
+        // Non-finite or non-positive results mark the candidate as failed.
+        using TimingBackendT = std::function<double(Candidate const&, size_t index)>;
+
+        ///
+        /// Prunes candidates with the kernel predicates and the cost model,
+        /// then benchmarks the survivors.
+        ///
+        class Autotuner
+        {
+        public:
+            Autotuner(CostModel const& model, uint32_t maxBenchmarks = 8u, double modelSlack = 2.0)
+                : mModel(model)
+                , mMaxBenchmarks(maxBenchmarks)
+                , mModelSlack(modelSlack)
+            {
+            }
+
+            // Survivors ranked by predicted time. Anything predicted slower than
+            // modelSlack x the best prediction is not worth benchmarking.
+            std::vector<Measurement> prune(Problem const&                problem,
+                                           std::vector<Candidate> const& candidates,
+                                           TuningResult&                 result) const
+            {
+                std::vector<Measurement> survivors;
+                for(size_t i = 0; i < candidates.size(); ++i)
+                {
+                    if(!mModel.feasible(problem, candidates[i]))
+                    {
+                        result.prunedByPredicates++;
+                        continue;
+                    }
+                    survivors.push_back(
+                        {i, candidates[i], mModel.estimateMs(problem, candidates[i]), 0.0});
+                }
+
+                // Stable, so equal predictions keep the instantiation order
+                std::stable_sort(survivors.begin(),
+                                 survivors.end(),
+                                 [](Measurement const& lhs, Measurement const& rhs) {
+                                     return lhs.predictedMs < rhs.predictedMs;
+                                 });
+
+                size_t limit = 0u;
+                while(limit < survivors.size() && limit < mMaxBenchmarks
+                      && survivors[limit].predictedMs
+                             <= survivors.front().predictedMs * mModelSlack)
+                {
+                    limit++;
+                }
+
+                result.prunedByModel += survivors.size() - limit;
+                survivors.resize(limit);
+                return survivors;
+            }
+
+            TuningResult tune(Problem const&                problem,
+                              std::vector<Candidate> const& candidates,
+                              TimingBackendT const&         timing) const
+            {
+                TuningResult result;
+                for(auto& measurement : prune(problem, candidates, result))
+                {
+                    measurement.measuredMs = timing(measurement.candidate, measurement.index);
+                    if(!std::isfinite(measurement.measuredMs) || measurement.measuredMs <= 0.0)
+                    {
+                        result.failed++;
+                        continue;
+                    }
+                    result.measurements.push_back(measurement);
+                }
+
+                std::stable_sort(result.measurements.begin(),
+                                 result.measurements.end(),
+                                 [](Measurement const& lhs, Measurement const& rhs) {
+                                     return lhs.measuredMs < rhs.measuredMs;
+                                 });
+                return result;
+            }
+
+        private:
+            CostModel mModel;
+            uint32_t  mMaxBenchmarks;
+            double    mModelSlack;
+        };
+
+        ///
+        /// Host stand-in for device timing. Returns the model prediction with a
+        /// deterministic per-candidate perturbation, so that measured ranking can
+        /// disagree with the model as it does on hardware.
+        ///
+        class SyntheticTimingBackend
+        {
+        public:
+            SyntheticTimingBackend(CostModel const& model,
+                                   Problem const&   problem,
+                                   double           noise = 0.25)
+                : mModel(model)
+                , mProblem(problem)
+                , mNoise(noise)
+            {
+            }
+
+            double operator()(Candidate const& candidate, size_t /*index*/ = 0u) const
+            {
+                // FNV-1a of the candidate name
+                uint64_t hash = 0xcbf29ce484222325ull;
+                for(auto c : candidate.name())
+                {
+                    hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+                }
+                auto unit = static_cast<double>(hash >> 11) / static_cast<double>(1ull << 53);
+                return mModel.estimateMs(mProblem, candidate) * (1.0 + mNoise * (2.0 * unit - 1.0));
+            }
+
+        private:
+            CostModel mModel;
+            Problem   mProblem;
+            double    mNoise;
+        };
+
+        ///
+        /// Database key: arch, types, layouts and a power-of-two shape bucket
+        ///
+        inline uint32_t shapeBucket(uint32_t size)
+        {
+            uint32_t bucket = 0u;
+            while(bucket < 32u && (1ull << bucket) < size)
+            {
+                bucket++;
+            }
+            return bucket;
+        }
+
+        struct Key
+        {
+            std::string arch;
+            std::string inputT, outputT, computeT;
+            std::string layouts;
+            uint32_t    mBucket, nBucket, kBucket;
+
+            static Key fromProblem(std::string const& arch, Problem const& problem)
+            {
+                return {arch.substr(0, arch.find(':')),
+                        problem.inputT,
+                        problem.outputT,
+                        problem.computeT,
+                        problem.layouts,
+                        shapeBucket(problem.m),
+                        shapeBucket(problem.n),
+                        shapeBucket(problem.k)};
+            }
+
+            std::string str() const
+            {
+                return arch + "|" + inputT + "_" + outputT + "_" + computeT + "|" + layouts + "|m"
+                       + std::to_string(mBucket) + "_n" + std::to_string(nBucket) + "_k"
+                       + std::to_string(kBucket);
+            }
+        };
+
+        struct Entry
+        {
+            Candidate candidate;
+            double    measuredMs;
+            double    tflopsPerSec;
+        };
+
+        // Bump when the record layout or key format changes.
+        // Databases with another version are ignored, not migrated.
+        static constexpr uint32_t DatabaseVersion = 1u;
+
+        namespace detail
+        {
+            static constexpr char DatabaseMagic[8] = {'R', 'W', 'T', 'U', 'N', 'E', 'D', 'B'};
+
+            struct FileHeader
+            {
+                char     magic[8];
+                uint32_t version;
+                uint32_t recordSize;
+                uint64_t count;
+            };
+
+            // Fixed size, so the mapped file can be binary searched in place.
+            // Records are sorted by key.
+            struct FileRecord
+            {
+                char     key[96];
+                char     kernel[32];
+                char     gemmConfig[32];
+                char     layoutLds[8];
+                uint32_t blockM, blockN, blockK;
+                uint32_t blocksX, blocksY;
+                uint32_t tBlockX, tBlockY;
+                uint32_t ldsBytes;
+                double   measuredMs;
+                double   tflopsPerSec;
+            };
+
+            template <size_t N>
+            inline void writeField(char (&field)[N], std::string const& value)
+            {
+                if(value.size() >= N)
+                {
+                    throw std::invalid_argument("Tuning database field too long: " + value);
+                }
+                std::memset(field, 0, N);
+                std::memcpy(field, value.data(), value.size());
+            }
+
+            template <size_t N>
+            inline std::string readField(char const (&field)[N])
+            {
+                return std::string(field, strnlen(field, N));
+            }
+
+            inline FileRecord toRecord(std::string const& key, Entry const& entry)
+            {
+                auto const& candidate = entry.candidate;
+
+                FileRecord record;
+                writeField(record.key, key);
+                writeField(record.kernel, candidate.kernel);
+                writeField(record.gemmConfig, candidate.gemmConfig);
+                writeField(record.layoutLds, candidate.layoutLds);
+                record.blockM       = candidate.blockM;
+                record.blockN       = candidate.blockN;
+                record.blockK       = candidate.blockK;
+                record.blocksX      = candidate.blocksX;
+                record.blocksY      = candidate.blocksY;
+                record.tBlockX      = candidate.tBlockX;
+                record.tBlockY      = candidate.tBlockY;
+                record.ldsBytes     = candidate.ldsBytes;
+                record.measuredMs   = entry.measuredMs;
+                record.tflopsPerSec = entry.tflopsPerSec;
+                return record;
+            }
+
+            inline Entry fromRecord(FileRecord const& record)
+            {
+                Entry entry;
+                auto& candidate      = entry.candidate;
+                candidate.kernel     = readField(record.kernel);
+                candidate.gemmConfig = readField(record.gemmConfig);
+                candidate.layoutLds  = readField(record.layoutLds);
+                candidate.blockM     = record.blockM;
+                candidate.blockN     = record.blockN;
+                candidate.blockK     = record.blockK;
+                candidate.blocksX    = record.blocksX;
+                candidate.blocksY    = record.blocksY;
+                candidate.tBlockX    = record.tBlockX;
+                candidate.tBlockY    = record.tBlockY;
+                candidate.ldsBytes   = record.ldsBytes;
+                entry.measuredMs     = record.measuredMs;
+                entry.tflopsPerSec   = record.tflopsPerSec;
+                return entry;
+            }
+
+        } // namespace detail
+
+        ///
+        /// Read-only view of a tuning database file, mapped into memory.
+        /// Lookups binary search the mapped records without parsing the file.
+        ///
+        class MappedTuningDatabase
+        {
+        public:
+            MappedTuningDatabase() = default;
+
+            explicit MappedTuningDatabase(std::string const& path)
+            {
+                open(path);
+            }
+
+            ~MappedTuningDatabase()
+            {
+                close();
+            }
+
+            MappedTuningDatabase(MappedTuningDatabase const&)            = delete;
+            MappedTuningDatabase& operator=(MappedTuningDatabase const&) = delete;
+
+            // False if missing, truncated or of another version
+            bool open(std::string const& path)
+            {
+                close();
+
+                auto fd = ::open(path.c_str(), O_RDONLY);
+                if(fd < 0)
+                {
+                    return false;
+                }
+
+                struct stat info;
+                if(fstat(fd, &info) != 0
+                   || static_cast<size_t>(info.st_size) < sizeof(detail::FileHeader))
+                {
+                    ::close(fd);
+                    return false;
+                }
+
+                auto size = static_cast<size_t>(info.st_size);
+                auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if(data == MAP_FAILED)
+                {
+                    return false;
+                }
+
+                mData = data;
+                mSize = size;
+
+                auto const* header = reinterpret_cast<detail::FileHeader const*>(mData);
+                auto        valid
+                    = std::memcmp(header->magic, detail::DatabaseMagic, sizeof(header->magic)) == 0
+                      && header->version == DatabaseVersion
+                      && header->recordSize == sizeof(detail::FileRecord)
+                      && header->count
+                             <= (mSize - sizeof(detail::FileHeader)) / sizeof(detail::FileRecord);
+                if(!valid)
+                {
+                    close();
+                    return false;
+                }
+
+                mCount = header->count;
+                return true;
+            }
+
+            void close()
+            {
+                if(mData != nullptr)
+                {
+                    munmap(mData, mSize);
+                }
+                mData  = nullptr;
+                mSize  = 0u;
+                mCount = 0u;
+            }
+
+            bool isOpen() const
+            {
+                return mData != nullptr;
+            }
+
+            size_t size() const
+            {
+                return mCount;
+            }
+
+            std::string keyAt(size_t index) const
+            {
+                return detail::readField(records()[index].key);
+            }
+
+            Entry entryAt(size_t index) const
+            {
+                return detail::fromRecord(records()[index]);
+            }
+
+            std::optional<Entry> find(Key const& key) const
+            {
+                if(!isOpen())
+                {
+                    return std::nullopt;
+                }
+
+                auto keyStr = key.str();
+                auto begin  = records();
+                auto end    = begin + mCount;
+                auto it     = std::lower_bound(
+                    begin, end, keyStr, [](detail::FileRecord const& record, std::string const& k) {
+                        return strncmp(record.key, k.c_str(), sizeof(record.key)) < 0;
+                    });
+
+                if(it == end || detail::readField(it->key) != keyStr)
+                {
+                    return std::nullopt;
+                }
+                return detail::fromRecord(*it);
+            }
+
+        private:
+            detail::FileRecord const* records() const
+            {
+                return reinterpret_cast<detail::FileRecord const*>(
+                    static_cast<char const*>(mData) + sizeof(detail::FileHeader));
+            }
+
+            void*  mData  = nullptr;
+            size_t mSize  = 0u;
+            size_t mCount = 0u;
+        };
+
+        ///
+        /// Mutable tuning database, written out in the mapped format
+        ///
+        class TuningDatabase
+        {
+        public:
+            // Keeps the faster entry for a key. Returns true if stored.
+            // A key covers a bucket of shapes, so entries compare by
+            // throughput: raw times would favour the smallest shape measured.
+            bool update(Key const& key, Entry const& entry)
+            {
+                auto [it, inserted] = mEntries.emplace(key.str(), entry);
+                if(!inserted && entry.tflopsPerSec > it->second.tflopsPerSec)
+                {
+                    it->second = entry;
+                    return true;
+                }
+                return inserted;
+            }
+
+            std::optional<Entry> find(Key const& key) const
+            {
+                auto it = mEntries.find(key.str());
+                return it == mEntries.end() ? std::nullopt : std::make_optional(it->second);
+            }
+
+            size_t size() const
+            {
+                return mEntries.size();
+            }
+
+            void merge(MappedTuningDatabase const& other)
+            {
+                for(size_t i = 0; i < other.size(); ++i)
+                {
+                    auto entry = other.entryAt(i);
+                    auto [it, inserted] = mEntries.emplace(other.keyAt(i), entry);
+                    if(!inserted && entry.tflopsPerSec > it->second.tflopsPerSec)
+                    {
+                        it->second = entry;
+                    }
+                }
+            }
+
+            // Written to a temporary and renamed into place, so concurrent
+            // readers only ever map a complete file.
+            void save(std::string const& path) const
+            {
+                detail::FileHeader header;
+                std::memcpy(header.magic, detail::DatabaseMagic, sizeof(header.magic));
+                header.version    = DatabaseVersion;
+                header.recordSize = sizeof(detail::FileRecord);
+                header.count      = mEntries.size();
+
+                // std::map iterates in key order, as the lookups require
+                std::vector<detail::FileRecord> records;
+                for(auto const& [key, entry] : mEntries)
+                {
+                    records.push_back(detail::toRecord(key, entry));
+                }
+
+                auto tmpPath = path + ".tmp." + std::to_string(getpid());
+                {
+                    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+                    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+                    file.write(reinterpret_cast<char const*>(records.data()),
+                               records.size() * sizeof(detail::FileRecord));
+
+                    if(!file)
+                    {
+                        file.close();
+                        std::remove(tmpPath.c_str());
+                        throw std::runtime_error("Failed to write tuning database " + path);
+                    }
+                }
+
+                if(std::rename(tmpPath.c_str(), path.c_str()) != 0)
+                {
+                    std::remove(tmpPath.c_str());
+                    throw std::runtime_error("Failed to replace tuning database " + path);
+                }
+            }
+
+        private:
+            std::map<std::string, Entry> mEntries;
+        };
+
+    } // namespace GemmTuning
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TUNING_HPP
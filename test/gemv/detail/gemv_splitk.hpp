@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMV_SPLITK_DETAIL_HPP
+#define GEMV_SPLITK_DETAIL_HPP
+
+#include "device/gemv_splitk.hpp"
+#include "gemv_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    struct GemvSplitKKernel final
+        : public GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>
+    {
+    private:
+        using Base = GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>;
+
+    public:
+        GemvSplitKKernel() {}
+        ~GemvSplitKKernel() final {}
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                gemvSplitK<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct GemvSplitKGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT   = 0,
+            OutputT  = 1,
+            ComputeT = 2,
+            BlockM   = 3,
+            BlockN   = 4,
+            BlockK   = 5
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = GemvSplitKKernel<std::tuple_element_t<BlockM, TestParamsT>::value,
+                                   std::tuple_element_t<BlockN, TestParamsT>::value,
+                                   std::tuple_element_t<BlockK, TestParamsT>::value,
+                                   std::tuple_element_t<InputT, TestParamsT>,
+                                   std::tuple_element_t<OutputT, TestParamsT>,
+                                   std::tuple_element_t<ComputeT, TestParamsT>>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // GEMV_SPLITK_DETAIL_HPP
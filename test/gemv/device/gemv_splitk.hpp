@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMV_SPLITK_HPP
+#define GEMV_SPLITK_HPP
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    ///
+    /// Batched gemv y = a * x with split-K, for 1 to BlockN vectors.
+    ///
+    /// Weights a are m x k (row major) and vectors x are k x BlockN (col
+    /// major, ld = k), zero padded past the first n vectors. The n outputs
+    /// y are m x n (col major).
+    ///
+    /// A gemv has little reuse: mapped onto one wave per BlockM rows, each
+    /// wave would walk all of K alone and the device would be starved of
+    /// loads in flight. Instead, every workgroup owns one BlockM row block
+    /// and the K range of its split (blockIdx.y of gridDim.y splits), and
+    /// its waves take turns over the BlockK steps of that range. Vectors
+    /// fill the N dimension of the mma, so a batch of up to BlockN costs
+    /// the same weight traffic as a single vector.
+    ///
+    /// Partial tiles of the waves are summed through LDS. With one split
+    /// the sum is stored, otherwise it is added atomically to y, which the
+    /// host zeroes before the launch. Sizes must be block multiples and
+    /// the K blocks must divide evenly into the splits, as checked by the
+    /// host.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    __global__ void __launch_bounds__(256) gemvSplitK(uint32_t m,
+                                                      uint32_t n,
+                                                      uint32_t k,
+                                                      InputT const* __restrict a,
+                                                      InputT const* __restrict x,
+                                                      OutputT* __restrict y)
+    {
+        static_assert(std::is_same<OutputT, float32_t>::value,
+                      "Split-K outputs are accumulated with float atomics");
+
+        using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, row_major>;
+        using FragX   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, col_major>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, row_major>;
+
+        constexpr auto WaveSize = Constants::AMDGCN_WAVE_SIZE;
+
+        auto waves   = blockDim.x / WaveSize;
+        auto waveIdx = threadIdx.x / WaveSize;
+
+        // Row block of the workgroup and K blocks of its split
+        auto  row0         = blockIdx.x * BlockM;
+        auto  splitKBlocks = k / BlockK / gridDim.y;
+        auto  kBlockBegin  = blockIdx.y * splitKBlocks;
+        auto  kBlockEnd    = kBlockBegin + splitKBlocks;
+        auto* addrA        = a + static_cast<uint64_t>(row0) * k;
+
+        auto fragAcc = FragAcc();
+        fill_fragment(fragAcc, static_cast<ComputeT>(0));
+
+        for(auto kBlock = kBlockBegin + waveIdx; kBlock < kBlockEnd; kBlock += waves)
+        {
+            auto fragA = FragA();
+            auto fragX = FragX();
+            load_matrix_sync(fragA, addrA + kBlock * BlockK, k);
+            load_matrix_sync(fragX, x + kBlock * BlockK, k);
+            mma_sync(fragAcc, fragA, fragX, fragAcc);
+        }
+
+        // Partial tile of each wave, BlockM x BlockN row major
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto* ldsPartials = reinterpret_cast<ComputeT*>(localMemPtr);
+        store_matrix_sync(ldsPartials + waveIdx * BlockM * BlockN, fragAcc, BlockN);
+
+        synchronize_workgroup();
+
+        // Sum over waves, walking rows first for contiguous output columns.
+        // Columns past n only hold the zero padding of x.
+        for(uint32_t i = threadIdx.x; i < BlockM * n; i += blockDim.x)
+        {
+            auto row = i % BlockM;
+            auto col = i / BlockM;
+
+            auto sum = static_cast<ComputeT>(0);
+            for(uint32_t w = 0u; w < waves; ++w)
+            {
+                sum += ldsPartials[w * BlockM * BlockN + row * BlockN + col];
+            }
+
+            auto* out = y + static_cast<uint64_t>(col) * m + row0 + row;
+            if(gridDim.y == 1u)
+            {
+                *out = static_cast<OutputT>(sum);
+            }
+            else
+            {
+                atomicAdd(out, static_cast<OutputT>(sum));
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // GEMV_SPLITK_HPP
@@ -0,0 +1,526 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMV_KERNEL_BASE_IMPL_HPP
+#define GEMV_KERNEL_BASE_IMPL_HPP
+
+#include <cmath>
+#include <functional>
+#include <tuple>
+
+#include <hip/hip_ext.h>
+#include <hip/hip_runtime.h>
+#include <hip/hip_runtime_api.h>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/constants.hpp>
+#include <rocwmma/internal/utils.hpp>
+
+#include "../common.hpp"
+#include "gemv_kernel_base.hpp"
+#include "performance.hpp"
+#include "rocwmma_options.hpp"
+
+#if ROCWMMA_VALIDATION_TESTS
+#include "reference.hpp" // Vanilla CPU kernel
+#endif // ROCWMMA_VALIDATION_TESTS
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::GemvKernelBase()
+    {
+        reset();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::~GemvKernelBase()
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    uint32_t GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::ldsUsage() const
+    {
+        // Partial BlockM x BlockN tile of each wave
+        auto waves = mTBlockX / DeviceInfo::instance()->warpSize();
+        return waves * BlockM * BlockN * sizeof(ComputeT);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    dim3 GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::gridDim() const
+    {
+        return dim3(ceilDiv(mM, BlockM), mSplitK);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    dim3 GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::blockDim() const
+    {
+        return dim3(mTBlockX, mTBlockY);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    bool GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::checkDevice() const
+    {
+        auto& deviceInfo = DeviceInfo::instance();
+        auto  deviceArch = deviceInfo->getGcnArch();
+
+        // Arch
+        auto isGfx94x = (deviceArch == DeviceInfo::GFX940) || (deviceArch == DeviceInfo::GFX941)
+                        || (deviceArch == DeviceInfo::GFX942);
+
+        auto isGfx11 = (deviceArch == DeviceInfo::GFX1100) || (deviceArch == DeviceInfo::GFX1101)
+                       || (deviceArch == DeviceInfo::GFX1102);
+
+        auto isGfx12 = (deviceArch == DeviceInfo::GFX1200) || (deviceArch == DeviceInfo::GFX1201);
+
+        // Datatypes
+        auto isF16    = std::is_same<InputT, float16_t>::value;
+        auto isBF16   = std::is_same<InputT, bfloat16_t>::value;
+        auto isF8     = std::is_same<InputT, float8_t>::value;
+        auto isF8Fnuz = std::is_same<InputT, float8_fnuz_t>::value;
+
+        // Block size
+        auto is16x16 = (BlockM == 16 && BlockN == 16);
+
+        // No unsupported devices
+        bool unsupportedDeviceCheck = !(deviceArch == DeviceInfo::UNSUPPORTED_ARCH);
+
+        // gfx11 only supports f16 and bf16 inputs with block size 16
+        bool gfx11Check = !(isGfx11 && ((!isF16 && !isBF16) || !is16x16));
+
+        // gfx12 only supports f16, bf16 and f8 inputs with block size 16
+        bool gfx12Check = !(isGfx12 && ((!isF16 && !isBF16 && !isF8) || !is16x16));
+
+        // OCP f8 only runs on gfx12: no other supported arch has OCP f8 mma.
+        // f8_fnuz only runs on gfx940/941/942.
+        bool f8Check     = !(isF8 && !isGfx12);
+        bool f8FnuzCheck = !(isF8Fnuz && !isGfx94x);
+
+        return unsupportedDeviceCheck && gfx11Check && gfx12Check && f8Check && f8FnuzCheck;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    bool GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::checkSizes() const
+    {
+        // The kernel has no bounds checks: rows and K must be block multiples,
+        // every split gets the same number of K blocks and the vectors fit
+        // the N dimension of one block.
+        auto warpSize = static_cast<uint32_t>(DeviceInfo::instance()->warpSize());
+        auto kBlocks  = mK / BlockK;
+
+        return (mTBlockX % warpSize == 0) && (mTBlockX >= warpSize) && (mTBlockY == 1)
+               && (mM % BlockM == 0) && (mK % BlockK == 0) && (mN > 0) && (mN <= BlockN)
+               && (mSplitK > 0) && (kBlocks >= mSplitK) && (kBlocks % mSplitK == 0);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    bool GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::checkLds() const
+    {
+        return ldsUsage() <= DeviceInfo::instance()->sharedMemSize();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    void GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::reset()
+    {
+        mTBlockX = mTBlockY = 0;
+        mM = mN = mK = 0;
+
+        mSplitK  = 1;
+        mRepeats =
+#if ROCWMMA_VALIDATION_TESTS
+            1;
+#else
+            5;
+#endif // ROCWMMA_VALIDATION_TESTS
+
+        mRunFlag = true;
+
+        mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
+        mElapsedTimeMs                       = 0.0;
+        mEfficiency                          = -1;
+        mRoofline                            = Roofline();
+
+        mValidationResult = false;
+        mMaxRelativeError = 0.0;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    HipResource* GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::getResource()
+    {
+        return DataStorage::instance().get();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    double GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::modeledBytes() const
+    {
+        // Weights are streamed once. The padded vectors are re-read by every
+        // row block but are small enough to stay in cache, so they count once
+        // like the outputs. Split-K adds one zeroing and one atomic update
+        // of the outputs per split.
+        auto weights = static_cast<double>(mM) * mK * sizeof(InputT);
+        auto vectors = static_cast<double>(mK) * BlockN * sizeof(InputT);
+        auto outputs = static_cast<double>(mM) * mN * sizeof(OutputT);
+        return weights + vectors + (mSplitK > 1 ? outputs * (2u * mSplitK + 1u) : outputs);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    std::ostream& GemvKernelBase<BlockM,
+                                 BlockN,
+                                 BlockK,
+                                 InputT,
+                                 OutputT,
+                                 ComputeT>::printHeader(std::ostream& stream) const
+    {
+        stream << "BlkM, BlkN, BlkK, "
+               << "InputT, OutputT, ComputeT, "
+               << "M, N, K, SplitK, "
+               << "TBlkX, TBlkY, "
+#if ROCWMMA_VALIDATION_TESTS
+               << "maxRelativeDiff, "
+#endif // ROCWMMA_VALIDATION_TESTS
+               << "elapsedMs, "
+               << "Problem Size(GFlops), "
+               << "TFlops/s, "
+               << "Efficiency(%), ";
+        return printRooflineHeader(stream) << "Result" << std::endl;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    std::ostream& GemvKernelBase<BlockM,
+                                 BlockN,
+                                 BlockK,
+                                 InputT,
+                                 OutputT,
+                                 ComputeT>::printKernel(std::ostream& stream) const
+    {
+        stream << BlockM << ", " << BlockN << ", " << BlockK << ", "
+               << dataTypeToString<InputT>() << ", " << dataTypeToString<OutputT>() << ", "
+               << dataTypeToString<ComputeT>() << ", " << mM << ", " << mN << ", " << mK << ", "
+               << mSplitK << ", " << mTBlockX << ", " << mTBlockY << ", ";
+
+        if(!mRunFlag)
+        {
+            stream
+#if ROCWMMA_VALIDATION_TESTS
+                << "n/a, "
+#endif // ROCWMMA_VALIDATION_TESTS
+                << "n/a, n/a, n/a, n/a, ";
+            return printRooflineSkipped(stream) << "SKIPPED" << std::endl;
+        }
+        else
+        {
+            stream
+#if ROCWMMA_VALIDATION_TESTS
+                << mMaxRelativeError << ", "
+#endif // ROCWMMA_VALIDATION_TESTS
+                << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec << ", "
+                << mEfficiency << ", ";
+            return printRoofline(stream, mRoofline)
+#if ROCWMMA_VALIDATION_TESTS
+                   << (mValidationResult ? "PASSED" : "FAILED")
+#else
+                   << "BENCH"
+#endif // ROCWMMA_VALIDATION_TESTS
+                   << std::endl;
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    void GemvKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT>::setup(ProblemParams const& problem)
+    {
+        // Reset the flags in case of multiple runs
+        mRunFlag = true;
+
+        // Format incoming problem parameters
+        std::tie(mTBlockX, mTBlockY)
+            = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.threadBlockSize)),
+                       static_cast<uint32_t const&>(std::get<1>(problem.threadBlockSize)));
+        std::tie(mM, mK) = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.problemSize)),
+                                    static_cast<uint32_t const&>(std::get<1>(problem.problemSize)));
+        mN               = static_cast<uint32_t>(problem.vectors);
+        mSplitK          = static_cast<uint32_t>(problem.splitK);
+
+        mRunFlag &= checkDevice();
+        mRunFlag &= checkSizes();
+        mRunFlag &= checkLds();
+
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+
+            // Initialize storage: vectors are padded to BlockN with zeros
+            auto vectorElements = static_cast<int64_t>(mK) * mN;
+            auto paddedElements = static_cast<int64_t>(mK) * BlockN;
+            dataInstance->resizeStorage(std::make_tuple(
+                static_cast<int64_t>(mM) * mK, paddedElements, static_cast<int64_t>(mM) * mN));
+
+            // Initialize matrix data on device and transfer to host for validation
+            MatrixUtil<row_major>::fillLaunchKernel(dataInstance->deviceWeights().get(), mM, mK);
+            MatrixUtil<col_major>::fillLaunchKernel(dataInstance->deviceVectors().get(), mK, mN);
+            CHECK_HIP_ERROR(hipMemset(dataInstance->deviceVectors().get() + vectorElements,
+                                      0,
+                                      (paddedElements - vectorElements) * sizeof(InputT)));
+#if ROCWMMA_VALIDATION_TESTS
+            dataInstance->copyDeviceToHostInputs();
+#endif // ROCWMMA_VALIDATION_TESTS
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    void GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::exec()
+    {
+        if(mRunFlag)
+        {
+            std::function<void()> gemvKernel = [this]() {
+                auto& dataInstance = DataStorage::instance();
+
+                // Split-K partial sums are added to the outputs
+                if(mSplitK > 1)
+                {
+                    CHECK_HIP_ERROR(
+                        hipMemsetAsync(dataInstance->deviceOutput().get(),
+                                       0,
+                                       static_cast<size_t>(mM) * mN * sizeof(OutputT)));
+                }
+
+                hipExtLaunchKernelGGL((this->kernelImpl()),
+                                      (this->gridDim()),
+                                      (this->blockDim()),
+                                      (this->ldsUsage()),
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      0,
+                                      mM,
+                                      mN,
+                                      mK,
+                                      dataInstance->deviceWeights().get(),
+                                      dataInstance->deviceVectors().get(),
+                                      dataInstance->deviceOutput().get());
+            };
+
+            hipEvent_t startEvent, stopEvent;
+            CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+            CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+            CHECK_HIP_ERROR(hipEventRecord(startEvent));
+            for(uint32_t i = 0; i < mRepeats; ++i)
+            {
+                gemvKernel();
+            }
+            CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+            auto timeMs = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+
+            // Calculate efficiency
+            auto& deviceInfo = DeviceInfo::instance();
+
+            auto devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<InputT>();
+
+            mElapsedTimeMs        = float64_t(timeMs);
+            mTotalGFlops          = calculateGFlops(mM, mN, mK);
+            mMeasuredTFlopsPerSec = calculateTFlopsPerSec(mM, mN, mK, mElapsedTimeMs)
+                                    * static_cast<float64_t>(mRepeats);
+
+            mEfficiency = round(mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+
+            // Place the kernel on the roofline of the device. Gemv is memory
+            // bound, so Roofline(%) is the share of the peak bandwidth.
+            auto devicePeakGBs = deviceInfo->peakBandwidthGBs();
+            auto runTimeMs     = mElapsedTimeMs / static_cast<float64_t>(mRepeats);
+            mRoofline          = calculateRoofline(
+                mTotalGFlops, modeledBytes(), runTimeMs, devicePeakGFlopsPerSec, devicePeakGBs);
+
+            if(!RocwmmaOptions::instance()->rooflinePlot().empty())
+            {
+                std::stringstream label;
+                label << "Gemv, " << BlockM << "x" << BlockN << "x" << BlockK << ", " << mM << "x"
+                      << mK << " * " << mN << " splitK " << mSplitK << ", "
+                      << dataTypeToString<InputT>();
+                appendRooflinePlotData(RocwmmaOptions::instance()->rooflinePlot(),
+                                       label.str(),
+                                       mTotalGFlops,
+                                       runTimeMs,
+                                       mRoofline,
+                                       devicePeakGFlopsPerSec,
+                                       devicePeakGBs);
+            }
+
+            CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+            CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+#if ROCWMMA_VALIDATION_TESTS
+            // Run reference CPU kernel
+            auto& dataInstance = DataStorage::instance();
+            gemv_CPU<InputT, OutputT, ComputeT>(mM,
+                                                mN,
+                                                mK,
+                                                dataInstance->hostWeights().get(),
+                                                dataInstance->hostVectors().get(),
+                                                dataInstance->hostOutputRef().get());
+#endif // ROCWMMA_VALIDATION_TESTS
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    void GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::validateResults()
+    {
+#if ROCWMMA_VALIDATION_TESTS
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+            auto  elements     = static_cast<int64_t>(mM) * mN;
+
+            auto reference = dataInstance->template allocDevice<OutputT>(elements);
+            dataInstance->copyData(reference, dataInstance->hostOutputRef(), elements);
+
+            std::tie(mValidationResult, mMaxRelativeError)
+                = compareEqualLaunchKernel<OutputT, OutputT>(
+                    dataInstance->deviceOutput().get(), reference.get(), mM, mN, 1u);
+
+            EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+        }
+#endif // ROCWMMA_VALIDATION_TESTS
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    void GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::reportResults()
+    {
+        if(!KernelI::sHeaderPrinted)
+        {
+            printHeader();
+            KernelI::sHeaderPrinted = true;
+        }
+        printKernel();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT>
+    void GemvKernelBase<BlockM, BlockN, BlockK, InputT, OutputT, ComputeT>::tearDown()
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // GEMV_KERNEL_BASE_IMPL_HPP
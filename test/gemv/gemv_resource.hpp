@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMV_RESOURCE_HPP
+#define GEMV_RESOURCE_HPP
+
+#include <memory>
+#include <tuple>
+
+#include "hip_resource.hpp"
+#include "singleton.hpp"
+
+namespace rocwmma
+{
+
+    // GemvResource class is intended to manage a shared pool of resources for
+    // testing gemv kernels on the GPU.
+    //
+    // It minimizes the memory handling overhead for launching thousands of GPU
+    // kernels by allowing re-use of existing memory allocations. Memory is only
+    // re-allocated as necessary to satisfy minimum size requirements.
+    //
+    // The interface indicates memory ownership by this class and shall only be
+    // used to access for read/write purposes.
+    //
+    // Currently uses HIP as the backend for device allocation.
+    template <typename InputT, typename OutputT>
+    struct GemvResource : public HipResource, public LazySingleton<GemvResource<InputT, OutputT>>
+    {
+        // For static initialization
+        friend std::unique_ptr<GemvResource<InputT, OutputT>>
+            std::make_unique<GemvResource<InputT, OutputT>>();
+
+        using Base = HipResource;
+
+        template <typename T>
+        using DevicePtrT = Base::template DevicePtrT<T>;
+
+        template <typename T>
+        using HostPtrT = Base::template HostPtrT<T>;
+
+        // Weights, Vectors, Output
+        using ElementCount = std::tuple<int64_t, int64_t, int64_t>;
+
+        enum : uint32_t
+        {
+            Weights = 0,
+            Vectors = 1,
+            Output = 2
+        };
+
+    protected: // No public instantiation except make_unique.
+               // No copy
+        GemvResource();
+        GemvResource(GemvResource const&)            = delete;
+        GemvResource& operator=(GemvResource const&) = delete;
+
+        // Helpers
+        template <typename T>
+        static inline void conditionalReallocDeviceHostPair(DevicePtrT<T>& devicePtr,
+                                                            HostPtrT<T>&   hostPtr,
+                                                            int64_t&       currentMax,
+                                                            int64_t        newSize);
+
+    public:
+        GemvResource(GemvResource&&);
+        ~GemvResource() = default;
+
+        void copyHostToDeviceAll();
+        void copyDeviceToHostInputs();
+        void copyDeviceToHostOutput();
+        void resizeStorage(ElementCount const& size);
+
+        HostPtrT<InputT>&  hostWeights();
+        HostPtrT<InputT>&  hostVectors();
+        HostPtrT<OutputT>& hostOutput();
+        HostPtrT<OutputT>& hostOutputRef();
+
+        DevicePtrT<InputT>&  deviceWeights();
+        DevicePtrT<InputT>&  deviceVectors();
+        DevicePtrT<OutputT>& deviceOutput();
+
+        // Data sizes
+        ElementCount currentElementCount() const;
+        ElementCount maxCapacity() const;
+
+        // Reset sizes
+        void reset() final;
+
+    protected:
+        DevicePtrT<InputT>  mDeviceWeights, mDeviceVectors;
+        DevicePtrT<OutputT> mDeviceOutput;
+        HostPtrT<InputT>    mHostWeights, mHostVectors;
+        HostPtrT<OutputT>   mHostOutput, mHostOutputRef;
+
+        ElementCount mCurrentElementCount;
+        ElementCount mMaxCapacity;
+    };
+
+} // namespace rocwmma
+
+#include "gemv_resource_impl.hpp"
+
+#endif // GEMV_RESOURCE_HPP
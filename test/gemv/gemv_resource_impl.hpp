@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMV_RESOURCE_IMPL_HPP
+#define GEMV_RESOURCE_IMPL_HPP
+
+#include "gemv_resource.hpp"
+
+namespace rocwmma
+{
+
+    template <typename InputT, typename OutputT>
+    GemvResource<InputT, OutputT>::GemvResource()
+        : mDeviceWeights(Base::template allocDevice<InputT>(0))
+        , mDeviceVectors(Base::template allocDevice<InputT>(0))
+        , mDeviceOutput(Base::template allocDevice<OutputT>(0))
+        , mHostWeights(Base::template allocHost<InputT>(0))
+        , mHostVectors(Base::template allocHost<InputT>(0))
+        , mHostOutput(Base::template allocHost<OutputT>(0))
+        , mHostOutputRef(Base::template allocHost<OutputT>(0))
+        , mCurrentElementCount({0, 0, 0})
+        , mMaxCapacity({0, 0, 0})
+    {
+    }
+
+    template <typename InputT, typename OutputT>
+    GemvResource<InputT, OutputT>::GemvResource(GemvResource<InputT, OutputT>&& rhs)
+        : HipResource()
+        , mDeviceWeights(std::move(rhs.mDeviceWeights))
+        , mDeviceVectors(std::move(rhs.mDeviceVectors))
+        , mDeviceOutput(std::move(rhs.mDeviceOutput))
+        , mHostWeights(std::move(rhs.mHostWeights))
+        , mHostVectors(std::move(rhs.mHostVectors))
+        , mHostOutput(std::move(rhs.mHostOutput))
+        , mHostOutputRef(std::move(rhs.mHostOutputRef))
+        , mCurrentElementCount(rhs.mCurrentElementCount)
+        , mMaxCapacity(rhs.mMaxCapacity)
+    {
+    }
+
+    template <typename InputT, typename OutputT>
+    template <typename T>
+    inline void
+        GemvResource<InputT, OutputT>::conditionalReallocDeviceHostPair(DevicePtrT<T>& devicePtr,
+                                                                        HostPtrT<T>&   hostPtr,
+                                                                        int64_t&       currentMax,
+                                                                        int64_t        newSize)
+    {
+        if(currentMax < newSize)
+        {
+            Base::reallocDeviceHostPair(devicePtr, hostPtr, newSize);
+            currentMax = newSize;
+        }
+    }
+
+    template <typename InputT, typename OutputT>
+    void GemvResource<InputT, OutputT>::copyHostToDeviceAll()
+    {
+        Base::copyData(mDeviceWeights, mHostWeights, std::get<Weights>(mCurrentElementCount));
+        Base::copyData(mDeviceVectors, mHostVectors, std::get<Vectors>(mCurrentElementCount));
+    }
+
+    template <typename InputT, typename OutputT>
+    void GemvResource<InputT, OutputT>::copyDeviceToHostInputs()
+    {
+        Base::copyData(mHostWeights, mDeviceWeights, std::get<Weights>(mCurrentElementCount));
+        Base::copyData(mHostVectors, mDeviceVectors, std::get<Vectors>(mCurrentElementCount));
+    }
+
+    template <typename InputT, typename OutputT>
+    void GemvResource<InputT, OutputT>::copyDeviceToHostOutput()
+    {
+        Base::copyData(mHostOutput, mDeviceOutput, std::get<Output>(mCurrentElementCount));
+    }
+
+    template <typename InputT, typename OutputT>
+    void GemvResource<InputT, OutputT>::resizeStorage(ElementCount const& newElementCounts)
+    {
+        conditionalReallocDeviceHostPair(mDeviceWeights,
+                                         mHostWeights,
+                                         std::get<Weights>(mMaxCapacity),
+                                         std::get<Weights>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceVectors,
+                                         mHostVectors,
+                                         std::get<Vectors>(mMaxCapacity),
+                                         std::get<Vectors>(newElementCounts));
+        conditionalReallocDeviceHostPair(mDeviceOutput,
+                                         mHostOutput,
+                                         std::get<Output>(mMaxCapacity),
+                                         std::get<Output>(newElementCounts));
+
+        Base::reallocHost(mHostOutputRef, std::get<Output>(newElementCounts));
+
+        mCurrentElementCount = newElementCounts;
+    }
+
+    template <typename InputT, typename OutputT>
+    void GemvResource<InputT, OutputT>::reset()
+    {
+        Base::reallocDeviceHostPair(mDeviceWeights, mHostWeights, 0);
+        Base::reallocDeviceHostPair(mDeviceVectors, mHostVectors, 0);
+        Base::reallocDeviceHostPair(mDeviceOutput, mHostOutput, 0);
+        Base::reallocHost(mHostOutputRef, 0);
+        mCurrentElementCount = {0, 0, 0};
+        mMaxCapacity         = {0, 0, 0};
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::hostWeights() -> HostPtrT<InputT>&
+    {
+        return mHostWeights;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::hostVectors() -> HostPtrT<InputT>&
+    {
+        return mHostVectors;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::hostOutput() -> HostPtrT<OutputT>&
+    {
+        return mHostOutput;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::hostOutputRef() -> HostPtrT<OutputT>&
+    {
+        return mHostOutputRef;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::deviceWeights() -> DevicePtrT<InputT>&
+    {
+        return mDeviceWeights;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::deviceVectors() -> DevicePtrT<InputT>&
+    {
+        return mDeviceVectors;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::deviceOutput() -> DevicePtrT<OutputT>&
+    {
+        return mDeviceOutput;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::currentElementCount() const -> ElementCount
+    {
+        return mCurrentElementCount;
+    }
+
+    template <typename InputT, typename OutputT>
+    auto GemvResource<InputT, OutputT>::maxCapacity() const -> ElementCount
+    {
+        return mMaxCapacity;
+    }
+
+} // namespace rocwmma
+
+#endif // GEMV_RESOURCE_IMPL_HPP
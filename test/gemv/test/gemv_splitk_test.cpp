@@ -0,0 +1,81 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "detail/gemv_splitk.hpp"
+#include "gemv_test.hpp"
+#include "gemv_test_params.hpp"
+#include "kernel_generator.hpp"
+
+namespace rocwmma
+{
+    struct TestParams : public GemvTestParams
+    {
+        // Types: f16, bf16 and f8 weights with f32 accumulation
+        // Block Sizes: 16 x 16 x 32 / 64
+        using Base         = GemvTestParams;
+        using Types        = typename Base::DataTypes;
+        using BlockSizes   = typename Base::BlockSizes;
+        using KernelParams = typename CombineLists<Types, BlockSizes>::Result;
+
+        using GeneratorImpl   = GemvSplitKGenerator;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+    };
+
+} // namespace rocwmma
+
+class GemvSplitKTestBasic : public rocwmma::GemvTest
+{
+};
+
+TEST_P(GemvSplitKTestBasic, RunKernel)
+{
+    static bool ranWarmup = false;
+    if(!ranWarmup)
+    {
+        this->Warmup();
+        ranWarmup = true;
+    }
+    this->RunKernel();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    GemvKernelTests,
+    GemvSplitKTestBasic,
+    ::testing::Combine(
+        ::testing::ValuesIn(rocwmma::TestParams::kernels()),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, threadBlocks)),
+        ::testing::ValuesIn(ROCWMMA_SWEEP_PARAMS(rocwmma::TestParams, problemSizes)),
+        ::testing::ValuesIn(rocwmma::TestParams::vectorCounts()),
+        ::testing::ValuesIn(rocwmma::TestParams::splitKs())));
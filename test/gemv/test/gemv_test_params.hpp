@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMV_TEST_PARAMS_HPP
+#define GEMV_TEST_PARAMS_HPP
+
+#include <tuple>
+#include <vector>
+
+#include <rocwmma/internal/types.hpp>
+
+#include "../common.hpp"
+#include "gemv_kernel_base.hpp"
+#include "kernel_generator.hpp"
+
+namespace rocwmma
+{
+    struct GemvTestParams
+    {
+        // Types of parameters
+        using KernelT      = std::shared_ptr<KernelI>;
+        using ThreadBlockT = std::pair<int64_t, int64_t>;
+        using ProblemSizeT = std::tuple<int64_t, int64_t>;
+        using VectorCountT = int64_t;
+        using SplitKT      = int64_t;
+
+        // InputT, OutputT, ComputeT
+        // f8 weights are skipped at run time off their archs (see checkDevice):
+        // f8 runs on gfx12 only, f8_fnuz on gfx940/941/942 only
+        using DataTypes = std::tuple<std::tuple<float16_t, float32_t, float32_t>,
+                                     std::tuple<bfloat16_t, float32_t, float32_t>,
+                                     std::tuple<float8_t, float32_t, float32_t>,
+                                     std::tuple<float8_fnuz_t, float32_t, float32_t>>;
+
+        // BlockM, BlockN, BlockK
+        // BlockN holds the batch of vectors. BlockK >= 32 covers f8.
+        using BlockSizes = std::tuple<std::tuple<I<16>, I<16>, I<32>>,
+                                      std::tuple<I<16>, I<16>, I<64>>>;
+
+        // M, K
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return {{4096, 4096}, {2048, 8192}};
+        }
+
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            return {{warpSize, 1}, {warpSize * 4, 1}};
+        }
+
+        // Decode batches: a single vector up to a full BlockN
+        static inline std::vector<VectorCountT> vectorCounts()
+        {
+            return {1, 4, 16};
+        }
+
+        static inline std::vector<SplitKT> splitKs()
+        {
+            return {1, 4};
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // GEMV_TEST_PARAMS_HPP
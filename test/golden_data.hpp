@@ -0,0 +1,361 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GOLDEN_DATA_HPP
+#define ROCWMMA_GOLDEN_DATA_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <rocwmma/internal/utils.hpp>
+
+// Golden data container: one typed array per file, behind a fixed header
+// with its datatype, shape, strides and a checksum of the data. Files are
+// mapped read-only and used in place, so opening one costs no more than
+// its header, whatever the size of the dataset.
+namespace rocwmma
+{
+    namespace GoldenData
+    {
+        // Bump when the header layout changes.
+        // Files with another version are rejected, not migrated.
+        static constexpr uint32_t FormatVersion = 1u;
+
+        static constexpr uint32_t MaxRank = 4u;
+
+        // Data starts on a page boundary, so the mapping can be registered
+        // with HIP for device copies as it is
+        static constexpr uint64_t DataAlignment = 4096u;
+
+        namespace detail
+        {
+            static constexpr char FileMagic[8] = {'R', 'W', 'G', 'O', 'L', 'D', 'E', 'N'};
+
+            struct FileHeader
+            {
+                char     magic[8];
+                uint32_t version;
+                uint32_t rank;
+                // As dataTypeToString, e.g. f16
+                char     dataType[16];
+                uint64_t elementBytes;
+                // Outermost dimension first. Strides are in elements.
+                uint64_t shape[MaxRank];
+                uint64_t strides[MaxRank];
+                uint64_t dataOffset;
+                uint64_t dataBytes;
+                uint64_t checksum;
+            };
+
+            // FNV-1a over little endian 64 bit words, then the tail bytes.
+            // test/bin/GoldenData.py computes the same.
+            inline uint64_t checksum(void const* data, uint64_t bytes)
+            {
+                constexpr uint64_t Prime = 0x100000001b3ull;
+
+                auto     bytePtr = static_cast<unsigned char const*>(data);
+                uint64_t hash    = 0xcbf29ce484222325ull;
+                uint64_t i       = 0u;
+                for(; i + sizeof(uint64_t) <= bytes; i += sizeof(uint64_t))
+                {
+                    uint64_t word;
+                    std::memcpy(&word, bytePtr + i, sizeof(word));
+                    hash = (hash ^ word) * Prime;
+                }
+                for(; i < bytes; ++i)
+                {
+                    hash = (hash ^ bytePtr[i]) * Prime;
+                }
+                return hash;
+            }
+
+            // Elements spanned by the shape and strides
+            inline uint64_t span(FileHeader const& header)
+            {
+                uint64_t last = 0u;
+                for(uint32_t i = 0; i < header.rank; ++i)
+                {
+                    if(header.shape[i] == 0u)
+                    {
+                        return 0u;
+                    }
+                    last += (header.shape[i] - 1u) * header.strides[i];
+                }
+                return last + 1u;
+            }
+
+        } // namespace detail
+
+        ///
+        /// Read-only view of a golden data file, mapped into memory.
+        /// open() checks the header and that the data fits the file; the
+        /// checksum is only verified on request, as it reads every page.
+        ///
+        class MappedGoldenFile
+        {
+        public:
+            MappedGoldenFile() = default;
+
+            explicit MappedGoldenFile(std::string const& path)
+            {
+                open(path);
+            }
+
+            ~MappedGoldenFile()
+            {
+                close();
+            }
+
+            MappedGoldenFile(MappedGoldenFile const&)            = delete;
+            MappedGoldenFile& operator=(MappedGoldenFile const&) = delete;
+
+            // False if missing, truncated, inconsistent or of another version
+            bool open(std::string const& path)
+            {
+                close();
+
+                auto fd = ::open(path.c_str(), O_RDONLY);
+                if(fd < 0)
+                {
+                    return false;
+                }
+
+                struct stat info;
+                if(fstat(fd, &info) != 0
+                   || static_cast<size_t>(info.st_size) < sizeof(detail::FileHeader))
+                {
+                    ::close(fd);
+                    return false;
+                }
+
+                auto size = static_cast<size_t>(info.st_size);
+                auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if(data == MAP_FAILED)
+                {
+                    return false;
+                }
+
+                mData = data;
+                mSize = size;
+
+                auto const& header = this->header();
+                auto        valid
+                    = std::memcmp(header.magic, detail::FileMagic, sizeof(header.magic)) == 0
+                      && header.version == FormatVersion && header.rank >= 1u
+                      && header.rank <= MaxRank && header.elementBytes > 0u
+                      && header.dataOffset >= sizeof(detail::FileHeader)
+                      && header.dataOffset <= mSize && header.dataBytes <= mSize - header.dataOffset
+                      && detail::span(header) <= header.dataBytes / header.elementBytes;
+                if(!valid)
+                {
+                    close();
+                    return false;
+                }
+
+                return true;
+            }
+
+            void close()
+            {
+                if(mData != nullptr)
+                {
+                    munmap(mData, mSize);
+                }
+                mData = nullptr;
+                mSize = 0u;
+            }
+
+            bool isOpen() const
+            {
+                return mData != nullptr;
+            }
+
+            bool verifyChecksum() const
+            {
+                return detail::checksum(data(), bytes()) == header().checksum;
+            }
+
+            std::string dataType() const
+            {
+                return std::string(header().dataType, strnlen(header().dataType, 16));
+            }
+
+            uint32_t rank() const
+            {
+                return header().rank;
+            }
+
+            std::vector<uint64_t> shape() const
+            {
+                return std::vector<uint64_t>(header().shape, header().shape + rank());
+            }
+
+            std::vector<uint64_t> strides() const
+            {
+                return std::vector<uint64_t>(header().strides, header().strides + rank());
+            }
+
+            uint64_t elementCount() const
+            {
+                uint64_t count = 1u;
+                for(uint32_t i = 0; i < rank(); ++i)
+                {
+                    count *= header().shape[i];
+                }
+                return count;
+            }
+
+            uint64_t bytes() const
+            {
+                return header().dataBytes;
+            }
+
+            void const* data() const
+            {
+                return static_cast<char const*>(mData) + header().dataOffset;
+            }
+
+            // Typed view of the data. Throws if the file holds another type.
+            template <typename DataT>
+            DataT const* view() const
+            {
+                if(dataType() != dataTypeToString<DataT>()
+                   || header().elementBytes != sizeof(DataT))
+                {
+                    throw std::invalid_argument("Golden data holds " + dataType() + ", not "
+                                                + dataTypeToString<DataT>());
+                }
+                return static_cast<DataT const*>(data());
+            }
+
+            // Whole mapping, page aligned, e.g. for host registration
+            void const* mapping() const
+            {
+                return mData;
+            }
+
+            size_t mappingSize() const
+            {
+                return mSize;
+            }
+
+        private:
+            detail::FileHeader const& header() const
+            {
+                return *reinterpret_cast<detail::FileHeader const*>(mData);
+            }
+
+            void*  mData = nullptr;
+            size_t mSize = 0u;
+        };
+
+        ///
+        /// Writes a packed, row major array as a golden data file.
+        /// Written to a temporary and renamed into place, so concurrent
+        /// readers only ever map a complete file.
+        ///
+        inline void writeGoldenFile(std::string const&           path,
+                                    std::string const&           dataType,
+                                    uint64_t                     elementBytes,
+                                    void const*                  data,
+                                    std::vector<uint64_t> const& shape)
+        {
+            if(shape.empty() || shape.size() > MaxRank)
+            {
+                throw std::invalid_argument("Golden data rank must be 1 to "
+                                            + std::to_string(MaxRank));
+            }
+
+            detail::FileHeader header;
+            std::memset(&header, 0, sizeof(header));
+            if(dataType.size() >= sizeof(header.dataType))
+            {
+                throw std::invalid_argument("Golden data type name too long: " + dataType);
+            }
+            std::memcpy(header.magic, detail::FileMagic, sizeof(header.magic));
+            std::memcpy(header.dataType, dataType.data(), dataType.size());
+            header.version      = FormatVersion;
+            header.rank         = static_cast<uint32_t>(shape.size());
+            header.elementBytes = elementBytes;
+
+            uint64_t count = 1u;
+            for(int i = static_cast<int>(shape.size()) - 1; i >= 0; --i)
+            {
+                header.shape[i]   = shape[i];
+                header.strides[i] = count;
+                count *= shape[i];
+            }
+            header.dataOffset = DataAlignment;
+            header.dataBytes  = count * elementBytes;
+            header.checksum   = detail::checksum(data, header.dataBytes);
+
+            auto tmpPath = path + ".tmp." + std::to_string(getpid());
+            {
+                std::vector<char> padding(header.dataOffset - sizeof(header), 0);
+
+                std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+                file.write(padding.data(), padding.size());
+                file.write(static_cast<char const*>(data), header.dataBytes);
+
+                if(!file)
+                {
+                    file.close();
+                    std::remove(tmpPath.c_str());
+                    throw std::runtime_error("Failed to write golden data " + path);
+                }
+            }
+
+            if(std::rename(tmpPath.c_str(), path.c_str()) != 0)
+            {
+                std::remove(tmpPath.c_str());
+                throw std::runtime_error("Failed to replace golden data " + path);
+            }
+        }
+
+        template <typename DataT>
+        inline void writeGoldenFile(std::string const&           path,
+                                    DataT const*                 data,
+                                    std::vector<uint64_t> const& shape)
+        {
+            writeGoldenFile(path, dataTypeToString<DataT>(), sizeof(DataT), data, shape);
+        }
+
+    } // namespace GoldenData
+} // namespace rocwmma
+
+#endif // ROCWMMA_GOLDEN_DATA_HPP
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GOLDEN_DATA_DEVICE_HPP
+#define ROCWMMA_GOLDEN_DATA_DEVICE_HPP
+
+#include <string>
+
+#include <hip/hip_runtime_api.h>
+
+#include "common.hpp"
+#include "golden_data.hpp"
+#include "hip_resource.hpp"
+
+namespace rocwmma
+{
+    namespace GoldenData
+    {
+        ///
+        /// Golden data file whose mapping is registered with HIP, so device
+        /// uploads DMA from the page cache without a staging copy. Where
+        /// registration is not supported, uploads fall back to pageable copies.
+        ///
+        class PinnedGoldenFile
+        {
+        public:
+            PinnedGoldenFile() = default;
+
+            explicit PinnedGoldenFile(std::string const& path)
+            {
+                open(path);
+            }
+
+            ~PinnedGoldenFile()
+            {
+                close();
+            }
+
+            PinnedGoldenFile(PinnedGoldenFile const&)            = delete;
+            PinnedGoldenFile& operator=(PinnedGoldenFile const&) = delete;
+
+            bool open(std::string const& path)
+            {
+                close();
+                if(!mFile.open(path))
+                {
+                    return false;
+                }
+
+                // The mapping is read-only, and so is the registration
+                mPinned = hipHostRegister(const_cast<void*>(mFile.mapping()),
+                                          mFile.mappingSize(),
+                                          hipHostRegisterReadOnly)
+                          == hipSuccess;
+                if(!mPinned)
+                {
+                    // Clear the sticky error of the failed registration
+                    (void)hipGetLastError();
+                }
+                return true;
+            }
+
+            void close()
+            {
+                if(mPinned)
+                {
+                    CHECK_HIP_ERROR(hipHostUnregister(const_cast<void*>(mFile.mapping())));
+                }
+                mPinned = false;
+                mFile.close();
+            }
+
+            bool isPinned() const
+            {
+                return mPinned;
+            }
+
+            MappedGoldenFile const& file() const
+            {
+                return mFile;
+            }
+
+            // Uploads the whole array. Throws if the file holds another type.
+            template <typename DataT>
+            void copyToDevice(HipResource::DevicePtrT<DataT>& dst) const
+            {
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dst.get(), mFile.view<DataT>(), mFile.bytes(), hipMemcpyHostToDevice));
+            }
+
+        private:
+            MappedGoldenFile mFile;
+            bool             mPinned = false;
+        };
+
+    } // namespace GoldenData
+} // namespace rocwmma
+
+#endif // ROCWMMA_GOLDEN_DATA_DEVICE_HPP
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include "hip_device.hpp"
+#include "arch_profile.hpp"
 #include "common.hpp"
 
 namespace rocwmma
@@ -37,6 +38,7 @@ namespace rocwmma
         , mCuCount(0)
         , mMaxFreqMhz(0)
         , mCurFreqMhz(0)
+        , mPeakBandwidthGBs(0.0)
     {
         CHECK_HIP_ERROR(hipGetDevice(&mHandle));
         CHECK_HIP_ERROR(hipGetDeviceProperties(&mProps, mHandle));
@@ -45,46 +47,7 @@ namespace rocwmma
 
         std::string deviceName(mProps.gcnArchName);
 
-        if(deviceName.find("gfx908") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX908;
-        }
-        else if(deviceName.find("gfx90a") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX90A;
-        }
-        else if(deviceName.find("gfx940") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX940;
-        }
-        else if(deviceName.find("gfx941") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX941;
-        }
-        else if(deviceName.find("gfx942") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX942;
-        }
-        else if(deviceName.find("gfx1100") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX1100;
-        }
-        else if(deviceName.find("gfx1101") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX1101;
-        }
-        else if(deviceName.find("gfx1102") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX1102;
-        }
-        else if(deviceName.find("gfx1200") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX1200;
-        }
-        else if(deviceName.find("gfx1201") != std::string::npos)
-        {
-            mGcnArch = hipGcnArch_t::GFX1201;
-        }
+        mGcnArch = gcnArchFromName(deviceName);
 
         switch(mProps.warpSize)
         {
@@ -99,6 +62,18 @@ namespace rocwmma
         mMaxFreqMhz    = static_cast<int>(static_cast<double>(mProps.clockRate) / 1000.0);
         mCurFreqMhz    = mMaxFreqMhz;
 
+        // Prefer the published figure of known targets. Otherwise derive it from
+        // the memory clock (kHz, double data rate) and bus width (bits).
+        if(auto profile = findArchProfile(deviceName))
+        {
+            mPeakBandwidthGBs = profile->memBandwidthGBs;
+        }
+        else
+        {
+            mPeakBandwidthGBs = 2.0 * static_cast<double>(mProps.memoryClockRate) * 1.0e3
+                                * (mProps.memoryBusWidth / 8.0) / 1.0e9;
+        }
+
 #if ROCWMMA_BENCHMARK_TESTS
         bool smiErrorFlag = false;
         CHECK_RSMI_ERROR(rsmi_init(0), smiErrorFlag);
@@ -145,6 +120,52 @@ namespace rocwmma
 #endif // ROCWMMA_BENCHMARK_TESTS
     }
 
+    HipDevice::hipGcnArch_t HipDevice::gcnArchFromName(std::string const& name)
+    {
+        if(name.find("gfx908") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX908;
+        }
+        else if(name.find("gfx90a") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX90A;
+        }
+        else if(name.find("gfx940") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX940;
+        }
+        else if(name.find("gfx941") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX941;
+        }
+        else if(name.find("gfx942") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX942;
+        }
+        else if(name.find("gfx1100") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX1100;
+        }
+        else if(name.find("gfx1101") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX1101;
+        }
+        else if(name.find("gfx1102") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX1102;
+        }
+        else if(name.find("gfx1200") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX1200;
+        }
+        else if(name.find("gfx1201") != std::string::npos)
+        {
+            return hipGcnArch_t::GFX1201;
+        }
+
+        return hipGcnArch_t::UNSUPPORTED_ARCH;
+    }
+
     hipDevice_t HipDevice::getDeviceHandle() const
     {
         return mHandle;
@@ -190,6 +211,11 @@ namespace rocwmma
         return mCurFreqMhz;
     }
 
+    double HipDevice::peakBandwidthGBs() const
+    {
+        return mPeakBandwidthGBs;
+    }
+
     HipDevice::~HipDevice()
     {
 #if ROCWMMA_BENCHMARK_TESTS
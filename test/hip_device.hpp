@@ -75,6 +75,9 @@ namespace rocwmma
         hipDeviceArch_t getDeviceArch() const;
         hipGcnArch_t    getGcnArch() const;
 
+        // Target id of a gcnArchName, e.g. gfx90a:sramecc+:xnack-
+        static hipGcnArch_t gcnArchFromName(std::string const& name);
+
         int warpSize() const;
         int sharedMemSize() const;
         int cuCount() const;
@@ -84,6 +87,9 @@ namespace rocwmma
         template <typename InputT>
         double peakGFlopsPerSec() const;
 
+        // Nominal peak global memory bandwidth
+        double peakBandwidthGBs() const;
+
         ~HipDevice();
 
     private:
@@ -96,6 +102,7 @@ namespace rocwmma
         int             mCuCount;
         int             mMaxFreqMhz;
         int             mCurFreqMhz;
+        double          mPeakBandwidthGBs;
     };
 
     template <typename InputT>
@@ -31,10 +31,21 @@
 #include <vector>
 
 #include "hip_device.hpp"
+#include "rocwmma_options.hpp"
 #include <rocwmma/internal/types.hpp>
 
 namespace rocwmma
 {
+    ///
+    /// Arch that kernels are generated for: the --dry-run target when one is
+    /// set, so that planning never constructs HipDevice, otherwise the device.
+    ///
+    inline HipDevice::hipGcnArch_t targetGcnArch()
+    {
+        auto const& dryRunArch = RocwmmaOptions::instance()->dryRunArch();
+        return dryRunArch.empty() ? HipDevice::instance()->getGcnArch()
+                                  : HipDevice::gcnArchFromName(dryRunArch);
+    }
 
     ///
     /// TestParams: nested tuple of kernel parameters to build
@@ -287,7 +298,7 @@ namespace rocwmma
                 {
                     // Only gfx12 devices support f8
                     using DeviceInfo = HipDevice;
-                    auto arch        = DeviceInfo::instance()->getGcnArch();
+                    auto arch        = targetGcnArch();
                     if(arch != DeviceInfo::hipGcnArch_t::GFX1200
                        && arch != DeviceInfo::hipGcnArch_t::GFX1201)
                     {
@@ -318,7 +329,7 @@ namespace rocwmma
                 {
                     // Only gfx94* devices support f8_fnuz
                     using DeviceInfo = HipDevice;
-                    auto arch        = DeviceInfo::instance()->getGcnArch();
+                    auto arch        = targetGcnArch();
                     if(arch != DeviceInfo::hipGcnArch_t::GFX940
                        && arch != DeviceInfo::hipGcnArch_t::GFX941
                        && arch != DeviceInfo::hipGcnArch_t::GFX942)
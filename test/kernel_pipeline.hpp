@@ -0,0 +1,286 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_KERNEL_PIPELINE_HPP
+#define ROCWMMA_KERNEL_PIPELINE_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rocwmma
+{
+    ///
+    /// HostThreadPool: fixed set of host workers consuming a FIFO
+    /// of tasks. Used to run host-side work (e.g. CPU reference
+    /// validation) concurrently with device work.
+    ///
+    class HostThreadPool
+    {
+    public:
+        explicit HostThreadPool(uint32_t workerCount)
+            : mStop(false)
+        {
+            workerCount = std::max(workerCount, 1u);
+            for(uint32_t i = 0; i < workerCount; ++i)
+            {
+                mWorkers.emplace_back([this]() { workerLoop(); });
+            }
+        }
+
+        ~HostThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mStop = true;
+            }
+            mCondition.notify_all();
+            for(auto& worker : mWorkers)
+            {
+                worker.join();
+            }
+        }
+
+        HostThreadPool(HostThreadPool const&)            = delete;
+        HostThreadPool& operator=(HostThreadPool const&) = delete;
+
+        // Queue a task. Exceptions thrown by the task are
+        // forwarded through the returned future.
+        template <typename TaskT>
+        std::future<void> submit(TaskT&& task)
+        {
+            auto packaged
+                = std::make_shared<std::packaged_task<void()>>(std::forward<TaskT>(task));
+            auto result = packaged->get_future();
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mTasks.emplace_back([packaged]() { (*packaged)(); });
+            }
+            mCondition.notify_one();
+            return result;
+        }
+
+        uint32_t workerCount() const
+        {
+            return static_cast<uint32_t>(mWorkers.size());
+        }
+
+    private:
+        void workerLoop()
+        {
+            while(true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    mCondition.wait(lock, [this]() { return mStop || !mTasks.empty(); });
+                    if(mStop && mTasks.empty())
+                    {
+                        return;
+                    }
+                    task = std::move(mTasks.front());
+                    mTasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::vector<std::thread>          mWorkers;
+        std::deque<std::function<void()>> mTasks;
+        std::mutex                        mMutex;
+        std::condition_variable           mCondition;
+        bool                              mStop;
+    };
+
+    ///
+    /// KernelPipeline: overlapped issue / validate / report scheduler.
+    ///
+    /// Each job walks through three stages:
+    /// 1. issue    : runs on the calling thread, in submission order.
+    ///               E.g. setup + device launch + capture of results.
+    /// 2. validate : runs on a host worker, concurrently with the issue
+    ///               of subsequent jobs. Must only touch job-owned data.
+    /// 3. report   : runs on the calling thread, in submission order.
+    ///
+    /// At most Depth jobs are in flight (issued but not yet reported).
+    /// Jobs that share a resource key are never in flight together:
+    /// a job is not issued until every earlier job with the same key
+    /// has been reported. A null key means no exclusivity.
+    ///
+    /// The scheduler is agnostic of the kernel interface so that
+    /// the gemm, dlrm and unit harnesses can each bind their own stages.
+    ///
+    template <typename JobT>
+    class KernelPipeline
+    {
+    public:
+        using StageFunc = std::function<void(JobT&)>;
+        using KeyFunc   = std::function<void const*(JobT const&)>;
+
+        struct Stages
+        {
+            StageFunc issue;
+            StageFunc validate;
+            StageFunc report;
+            KeyFunc   resourceKey;
+        };
+
+        struct Stats
+        {
+            uint32_t jobsRun;
+            uint32_t maxInFlight;
+        };
+
+        KernelPipeline(uint32_t depth, uint32_t workerCount)
+            : mDepth(std::max(depth, 1u))
+            , mPool(workerCount)
+        {
+        }
+
+        uint32_t depth() const
+        {
+            return mDepth;
+        }
+
+        // Runs all jobs through the pipeline. Returns when every job
+        // has been reported. Exceptions from any stage are re-thrown
+        // on the calling thread after in-flight work has drained.
+        Stats run(std::vector<JobT>& jobs, Stages const& stages)
+        {
+            struct InFlight
+            {
+                size_t            index;
+                void const*       key;
+                std::future<void> validated;
+            };
+
+            std::deque<InFlight> inFlight;
+            Stats                stats = {0u, 0u};
+            std::exception_ptr   error;
+
+            // Retire the oldest job: wait for validation, then report.
+            auto retireFront = [&]() {
+                auto front = std::move(inFlight.front());
+                inFlight.pop_front();
+                try
+                {
+                    front.validated.get();
+                    if(stages.report)
+                    {
+                        stages.report(jobs[front.index]);
+                    }
+                }
+                catch(...)
+                {
+                    if(!error)
+                    {
+                        error = std::current_exception();
+                    }
+                }
+                stats.jobsRun++;
+            };
+
+            auto hasConflict = [&](void const* key) {
+                return key != nullptr
+                       && std::any_of(inFlight.begin(), inFlight.end(), [key](InFlight const& f) {
+                              return f.key == key;
+                          });
+            };
+
+            for(size_t i = 0; i < jobs.size() && !error; ++i)
+            {
+                auto key = stages.resourceKey ? stages.resourceKey(jobs[i]) : nullptr;
+
+                // Enforce bounded depth and resource exclusivity.
+                // Retiring in order keeps reporting deterministic.
+                while(!inFlight.empty() && (inFlight.size() >= mDepth || hasConflict(key)))
+                {
+                    retireFront();
+                }
+
+                if(error)
+                {
+                    break;
+                }
+
+                try
+                {
+                    if(stages.issue)
+                    {
+                        stages.issue(jobs[i]);
+                    }
+                }
+                catch(...)
+                {
+                    error = std::current_exception();
+                    break;
+                }
+
+                auto& job       = jobs[i];
+                auto  validated = stages.validate
+                                      ? mPool.submit([&job, &stages]() { stages.validate(job); })
+                                      : makeReadyFuture();
+
+                inFlight.push_back({i, key, std::move(validated)});
+                stats.maxInFlight
+                    = std::max(stats.maxInFlight, static_cast<uint32_t>(inFlight.size()));
+            }
+
+            // Drain
+            while(!inFlight.empty())
+            {
+                retireFront();
+            }
+
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
+
+            return stats;
+        }
+
+    private:
+        static std::future<void> makeReadyFuture()
+        {
+            std::promise<void> ready;
+            ready.set_value();
+            return ready.get_future();
+        }
+
+        uint32_t       mDepth;
+        HostThreadPool mPool;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_KERNEL_PIPELINE_HPP
@@ -28,29 +28,75 @@
 
 #include <type_traits>
 
+#include <rocwmma/internal/block_scale.hpp>
 #include <rocwmma/internal/cross_lane_ops.hpp>
 #include <rocwmma/internal/types.hpp>
 
+#include "conv/conv_problem.hpp"
+
 namespace rocwmma
 {
 
+    // B may hold a different datatype from A (InputTB, deduced from b).
+    // Products are formed in ComputeT. Complex datatypes (complex_t) use
+    // their own arithmetic, so this is also the complex gemm reference.
     template <typename InputT,
               typename OutputT,
               typename ComputeT,
               typename LayoutA,
               typename LayoutB,
               typename LayoutC,
-              typename LayoutD>
+              typename LayoutD,
+              typename InputTB = InputT>
     void gemm_CPU(uint32_t       m,
                   uint32_t       n,
                   uint32_t       k,
                   InputT const*  a,
-                  InputT const*  b,
+                  InputTB const* b,
                   OutputT const* c,
                   OutputT*       d,
                   ComputeT       alpha,
                   ComputeT       beta);
 
+    // Block-scaled (MX) gemm: each run of scaleBlockK elements along K of a
+    // row of A and a column of B is scaled by its E8M0 scale. Scales of A
+    // form an m x (k / scaleBlockK) matrix in LayoutA and scales of B a
+    // (k / scaleBlockK) x n matrix in LayoutB.
+    template <typename InputTA,
+              typename InputTB,
+              typename OutputT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_mx_CPU(uint32_t       m,
+                     uint32_t       n,
+                     uint32_t       k,
+                     InputTA const* a,
+                     uint8_t const* scaleA,
+                     InputTB const* b,
+                     uint8_t const* scaleB,
+                     OutputT const* c,
+                     OutputT*       d,
+                     float32_t      alpha,
+                     float32_t      beta,
+                     uint32_t       scaleBlockK = 32u);
+
+    // Direct forward convolution, products formed in ComputeT.
+    // Tensors are in LayoutT: nhwc (filters KRSC) or nchw (filters KCRS).
+    template <typename InputT, typename OutputT, typename ComputeT, typename LayoutT>
+    void conv_fwd_CPU(ConvProblem const& problem,
+                      InputT const*      input,
+                      InputT const*      filter,
+                      OutputT*           output);
+
+    // Batched gemv: y = a * x for n vectors, products formed in ComputeT.
+    // Weights a are m x k (row major), vectors x are k x n and outputs y
+    // are m x n (both col major, one vector per column).
+    template <typename InputT, typename OutputT, typename ComputeT>
+    void gemv_CPU(
+        uint32_t m, uint32_t n, uint32_t k, InputT const* a, InputT const* x, OutputT* y);
+
     template <typename DataT>
     void
         dlrm_fwd_CPU(DataT const* input, DataT* output, uint32_t m, uint32_t k, uint32_t batchSize);
@@ -64,6 +110,31 @@ namespace rocwmma
                       uint32_t     k,
                       uint32_t     batchSize);
 
+    // Interaction fused with the first top MLP layer: the packed output of
+    // dlrm_fwd_CPU (k + m * (m - 1) / 2 features per sample, in DataT) times
+    // weights (features x n, row major) gives the batchSize x n output.
+    template <typename DataT>
+    void dlrm_fused_mlp_fwd_CPU(DataT const* input,
+                                DataT const* weights,
+                                DataT*       output,
+                                uint32_t     m,
+                                uint32_t     k,
+                                uint32_t     n,
+                                uint32_t     batchSize);
+
+    // Input gradients of dlrm_fused_mlp_fwd_CPU: topGrad x weights^T, in
+    // DataT, is the upstream gradient of dlrm_bwd_CPU.
+    template <typename DataT>
+    void dlrm_fused_mlp_bwd_CPU(DataT const* input,
+                                DataT const* weights,
+                                DataT const* topGrad,
+                                DataT*       bottomMlpGrad,
+                                DataT*       output,
+                                uint32_t     m,
+                                uint32_t     k,
+                                uint32_t     n,
+                                uint32_t     batchSize);
+
     template <uint32_t ElementIdx,
               uint32_t GroupSize,
               uint32_t RowMask   = 0xF,
@@ -39,12 +39,13 @@ namespace rocwmma
               typename LayoutA,
               typename LayoutB,
               typename LayoutC,
-              typename LayoutD>
+              typename LayoutD,
+              typename InputTB>
     void gemm_CPU(uint32_t       m,
                   uint32_t       n,
                   uint32_t       k,
                   InputT const*  a,
-                  InputT const*  b,
+                  InputTB const* b,
                   OutputT const* c,
                   OutputT*       d,
                   ComputeT       alpha,
@@ -80,6 +81,151 @@ namespace rocwmma
         }
     }
 
+    template <typename InputTA,
+              typename InputTB,
+              typename OutputT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_mx_CPU(uint32_t       m,
+                     uint32_t       n,
+                     uint32_t       k,
+                     InputTA const* a,
+                     uint8_t const* scaleA,
+                     InputTB const* b,
+                     uint8_t const* scaleB,
+                     OutputT const* c,
+                     OutputT*       d,
+                     float32_t      alpha,
+                     float32_t      beta,
+                     uint32_t       scaleBlockK)
+    {
+        uint32_t kBlocks = (k + scaleBlockK - 1u) / scaleBlockK;
+
+        int lda = std::is_same<LayoutA, row_major>::value ? k : m;
+        int ldb = std::is_same<LayoutB, row_major>::value ? n : k;
+        int ldc = std::is_same<LayoutC, row_major>::value ? n : m;
+        int ldd = std::is_same<LayoutD, row_major>::value ? n : m;
+
+        int ldsa = std::is_same<LayoutA, row_major>::value ? kBlocks : m;
+        int ldsb = std::is_same<LayoutB, row_major>::value ? n : kBlocks;
+
+        auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return row * ld + col; };
+        auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return col * ld + row; };
+
+        auto aIndex = std::is_same<LayoutA, row_major>::value ? rowMjr : colMjr;
+        auto bIndex = std::is_same<LayoutB, row_major>::value ? rowMjr : colMjr;
+        auto cIndex = std::is_same<LayoutC, row_major>::value ? rowMjr : colMjr;
+        auto dIndex = std::is_same<LayoutD, row_major>::value ? rowMjr : colMjr;
+
+#pragma omp parallel for
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                float32_t accum = 0.0f;
+                for(uint32_t kb = 0; kb < kBlocks; ++kb)
+                {
+                    // Unscaled block product, then one rounding for the scales
+                    uint32_t  kBegin     = kb * scaleBlockK;
+                    uint32_t  kEnd       = kBegin + scaleBlockK < k ? kBegin + scaleBlockK : k;
+                    float32_t blockAccum = 0.0f;
+                    for(uint32_t h = kBegin; h < kEnd; ++h)
+                    {
+                        blockAccum += static_cast<float32_t>(a[aIndex(i, h, lda)])
+                                      * static_cast<float32_t>(b[bIndex(h, j, ldb)]);
+                    }
+                    accum += detail::applyBlockScale(blockAccum,
+                                                     scaleA[aIndex(i, kb, ldsa)],
+                                                     scaleB[bIndex(kb, j, ldsb)]);
+                }
+                d[dIndex(i, j, ldd)] = static_cast<OutputT>(
+                    alpha * accum + beta * static_cast<float32_t>(c[cIndex(i, j, ldc)]));
+            }
+        }
+    }
+
+    template <typename InputT, typename OutputT, typename ComputeT, typename LayoutT>
+    void conv_fwd_CPU(ConvProblem const& problem,
+                      InputT const*      input,
+                      InputT const*      filter,
+                      OutputT*           output)
+    {
+        using Tensor = ConvTensorLayout<LayoutT>;
+
+        int outH   = problem.outH();
+        int outW   = problem.outW();
+        int groupC = problem.groupC();
+        int groupK = problem.groupK();
+
+#pragma omp parallel for
+        for(int n = 0; n < problem.n; ++n)
+        {
+            for(int k = 0; k < problem.k; ++k)
+            {
+                int group = k / groupK;
+                for(int y = 0; y < outH; ++y)
+                {
+                    for(int x = 0; x < outW; ++x)
+                    {
+                        ComputeT accum = static_cast<ComputeT>(0);
+                        for(int c = 0; c < groupC; ++c)
+                        {
+                            for(int r = 0; r < problem.r; ++r)
+                            {
+                                int inY = static_cast<int>(y * problem.strideH
+                                                           + r * problem.dilationH)
+                                          - static_cast<int>(problem.padH);
+                                if(inY < 0 || inY >= static_cast<int>(problem.h))
+                                {
+                                    continue;
+                                }
+
+                                for(int s = 0; s < problem.s; ++s)
+                                {
+                                    int inX = static_cast<int>(x * problem.strideW
+                                                               + s * problem.dilationW)
+                                              - static_cast<int>(problem.padW);
+                                    if(inX < 0 || inX >= static_cast<int>(problem.w))
+                                    {
+                                        continue;
+                                    }
+
+                                    accum += static_cast<ComputeT>(input[Tensor::input(
+                                                 problem, n, group * groupC + c, inY, inX)])
+                                             * static_cast<ComputeT>(
+                                                 filter[Tensor::filter(problem, k, c, r, s)]);
+                                }
+                            }
+                        }
+                        output[Tensor::output(problem, n, k, y, x)] = static_cast<OutputT>(accum);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename InputT, typename OutputT, typename ComputeT>
+    void gemv_CPU(
+        uint32_t m, uint32_t n, uint32_t k, InputT const* a, InputT const* x, OutputT* y)
+    {
+#pragma omp parallel for
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                ComputeT accum = static_cast<ComputeT>(0);
+                for(int h = 0; h < k; ++h)
+                {
+                    accum += static_cast<ComputeT>(a[static_cast<uint64_t>(i) * k + h])
+                             * static_cast<ComputeT>(x[static_cast<uint64_t>(j) * k + h]);
+                }
+                y[static_cast<uint64_t>(j) * m + i] = static_cast<OutputT>(accum);
+            }
+        }
+    }
+
     template <typename DataT>
     void dlrm_fwd_CPU(DataT const* input, DataT* output, uint32_t m, uint32_t k, uint32_t batchSize)
     {
@@ -178,6 +324,70 @@ namespace rocwmma
         delete[] acc;
     }
 
+    template <typename DataT>
+    void dlrm_fused_mlp_fwd_CPU(DataT const* input,
+                                DataT const* weights,
+                                DataT*       output,
+                                uint32_t     m,
+                                uint32_t     k,
+                                uint32_t     n,
+                                uint32_t     batchSize)
+    {
+        auto features    = ((m * (m - 1)) / 2) + k;
+        auto interaction = new DataT[batchSize * features];
+
+        dlrm_fwd_CPU<DataT>(input, interaction, m, k, batchSize);
+
+#pragma omp parallel for
+        for(int b = 0; b < batchSize; b++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                float accum = 0.0f;
+                for(int f = 0; f < features; f++)
+                {
+                    accum += static_cast<float>(interaction[b * features + f])
+                             * static_cast<float>(weights[f * n + j]);
+                }
+                output[b * n + j] = static_cast<DataT>(accum);
+            }
+        }
+        delete[] interaction;
+    }
+
+    template <typename DataT>
+    void dlrm_fused_mlp_bwd_CPU(DataT const* input,
+                                DataT const* weights,
+                                DataT const* topGrad,
+                                DataT*       bottomMlpGrad,
+                                DataT*       output,
+                                uint32_t     m,
+                                uint32_t     k,
+                                uint32_t     n,
+                                uint32_t     batchSize)
+    {
+        auto features     = ((m * (m - 1)) / 2) + k;
+        auto upstreamGrad = new DataT[batchSize * features];
+
+#pragma omp parallel for
+        for(int b = 0; b < batchSize; b++)
+        {
+            for(int f = 0; f < features; f++)
+            {
+                float accum = 0.0f;
+                for(int j = 0; j < n; j++)
+                {
+                    accum += static_cast<float>(topGrad[b * n + j])
+                             * static_cast<float>(weights[f * n + j]);
+                }
+                upstreamGrad[b * features + f] = static_cast<DataT>(accum);
+            }
+        }
+
+        dlrm_bwd_CPU<DataT>(input, upstreamGrad, bottomMlpGrad, output, m, k, batchSize);
+        delete[] upstreamGrad;
+    }
+
     template <typename PackedT,
               uint32_t ElementIdx,
               uint32_t GroupSize,
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include "common.hpp"
+#include "deferred_tests.hpp"
 #include "rocwmma_options.hpp"
 #include <gtest/gtest.h>
 
@@ -34,7 +35,27 @@ int main(int argc, char** argv)
     auto& loggingOptions = Options::instance();
     loggingOptions->parseOptions(argc, argv);
 
-    if(loggingOptions->emulationOption() == rocwmma::EmulationOption::SMOKE)
+    // Optional run modes only add their tests when enabled
+    using DeferredTests = rocwmma::DeferredTests;
+    if(loggingOptions->pipelineDepth() > 0u)
+    {
+        DeferredTests::registerTests(DeferredTests::Mode::Pipelined);
+    }
+    if(!loggingOptions->tuningDatabase().empty())
+    {
+        DeferredTests::registerTests(DeferredTests::Mode::Tuned);
+    }
+    if(!loggingOptions->dryRunArch().empty())
+    {
+        DeferredTests::registerTests(DeferredTests::Mode::DryRun);
+    }
+
+    if(!loggingOptions->dryRunArch().empty())
+    {
+        // Dry runs only plan; nothing may touch the device
+        ::testing::GTEST_FLAG(filter) = "*DryRun*";
+    }
+    else if(loggingOptions->emulationOption() == rocwmma::EmulationOption::SMOKE)
     {
         ::testing::GTEST_FLAG(filter) = "*Emulation*Smoke*";
     }
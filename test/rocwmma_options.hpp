@@ -30,6 +30,8 @@
 #include "rocwmma/rocwmma-version.hpp"
 #include "rocwmma_ostream.hpp"
 #include "singleton.hpp"
+#include "sweep_config.hpp"
+#include <limits>
 #include <stdlib.h>
 
 namespace rocwmma
@@ -42,6 +44,33 @@ namespace rocwmma
         EXTENDED
     };
 
+    enum struct ValidationOption
+    {
+        DEVICE,
+        HOST
+    };
+
+    enum struct BenchmarkOption
+    {
+        EVENT, // Event pair around every hot run
+        BATCHED, // Single event pair around all hot runs
+        GRAPH // Hot runs captured into one graph launch
+    };
+
+    inline const char* benchmarkOptionString(BenchmarkOption value)
+    {
+        switch(value)
+        {
+        case BenchmarkOption::BATCHED:
+            return "batched";
+        case BenchmarkOption::GRAPH:
+            return "graph";
+        case BenchmarkOption::EVENT:
+        default:
+            return "event";
+        }
+    }
+
     struct RocwmmaOptions : public LazySingleton<RocwmmaOptions>
     {
         // For static initialization
@@ -63,6 +92,14 @@ namespace rocwmma
             , mOmitPassed(false)
             , mOmitCout(false)
             , mEmulationOption(EmulationOption::NONE)
+            , mPipelineDepth(0u)
+            , mValidationOption(ValidationOption::DEVICE)
+            , mBenchmarkOption(BenchmarkOption::EVENT)
+            , mTuningDatabase()
+            , mSweep()
+            , mDryRunArch()
+            , mPhaseTrace()
+            , mRooflinePlot()
         {
         }
 
@@ -83,6 +120,41 @@ namespace rocwmma
             mEmulationOption = value;
         }
 
+        void setPipelineDepth(uint32_t depth)
+        {
+            mPipelineDepth = depth;
+        }
+
+        void setValidationOption(ValidationOption value)
+        {
+            mValidationOption = value;
+        }
+
+        void setBenchmarkOption(BenchmarkOption value)
+        {
+            mBenchmarkOption = value;
+        }
+
+        void setTuningDatabase(std::string const& path)
+        {
+            mTuningDatabase = path;
+        }
+
+        void setDryRunArch(std::string const& arch)
+        {
+            mDryRunArch = arch;
+        }
+
+        void setPhaseTrace(std::string const& prefix)
+        {
+            mPhaseTrace = prefix;
+        }
+
+        void setRooflinePlot(std::string const& fileName)
+        {
+            mRooflinePlot = fileName;
+        }
+
         void parseOptions(int argc, char** argv)
         {
             const std::vector<std::string> args(argv + 1, argv + argc);
@@ -138,6 +210,166 @@ namespace rocwmma
                     i++;
                     continue;
                 }
+                if(args[i] == "--pipeline")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing pipeline depth\n";
+                        std::cerr << "Usage: --pipeline *depth*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    // Depth counts kernels in flight: reject zero, negatives and junk
+                    auto depth = 0l;
+                    try
+                    {
+                        depth = std::stol(args[i + 1]);
+                    }
+                    catch(std::logic_error const&)
+                    {
+                    }
+                    if(depth < 1 || depth > std::numeric_limits<uint32_t>::max())
+                    {
+                        std::cerr << "Invalid pipeline depth: " << args[i + 1] << "\n";
+                        std::cerr << "Usage: --pipeline *depth*, depth >= 1\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    setPipelineDepth(static_cast<uint32_t>(depth));
+                    i++;
+                    continue;
+                }
+                if(args[i] == "--validate_on")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing validation option\n";
+                        std::cerr << "Usage: --validate_on [device|host]\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    std::string value = args[i + 1];
+                    std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+                    if(value == "device")
+                    {
+                        setValidationOption(ValidationOption::DEVICE);
+                    }
+                    else if(value == "host")
+                    {
+                        setValidationOption(ValidationOption::HOST);
+                    }
+                    else
+                    {
+                        std::cerr << "Invalid validation option: " << args[i + 1] << "\n";
+                        std::cerr << "Usage: --validate_on [device|host]\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    i++;
+                    continue;
+                }
+                if(args[i] == "--bench_mode")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing benchmark mode\n";
+                        std::cerr << "Usage: --bench_mode [event|batched|graph]\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    std::string value = args[i + 1];
+                    std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+                    if(value == "event")
+                    {
+                        setBenchmarkOption(BenchmarkOption::EVENT);
+                    }
+                    else if(value == "batched")
+                    {
+                        setBenchmarkOption(BenchmarkOption::BATCHED);
+                    }
+                    else if(value == "graph")
+                    {
+                        setBenchmarkOption(BenchmarkOption::GRAPH);
+                    }
+                    else
+                    {
+                        std::cerr << "Invalid benchmark mode: " << args[i + 1] << "\n";
+                        std::cerr << "Usage: --bench_mode [event|batched|graph]\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    i++;
+                    continue;
+                }
+                if(args[i] == "--tune")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing tuning database\n";
+                        std::cerr << "Usage: --tune *file.db*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    setTuningDatabase(args[i + 1]);
+                    i++;
+                    continue;
+                }
+                if(args[i] == "--dry-run")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing dry run target\n";
+                        std::cerr << "Usage: --dry-run *gfx_arch*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    setDryRunArch(args[i + 1]);
+                    i++;
+                    continue;
+                }
+                if(args[i] == "--phase_trace")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing phase trace prefix\n";
+                        std::cerr << "Usage: --phase_trace *path_prefix*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    setPhaseTrace(args[i + 1]);
+                    i++;
+                    continue;
+                }
+                if(args[i] == "--roofline")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing roofline plot data file\n";
+                        std::cerr << "Usage: --roofline *file.csv*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    setRooflinePlot(args[i + 1]);
+                    i++;
+                    continue;
+                }
+                if(args[i] == "--sweep" || args[i] == "--trace")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing " << args[i].substr(2) << " file\n";
+                        std::cerr << "Usage: " << args[i] << " *file*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    try
+                    {
+                        if(args[i] == "--sweep")
+                        {
+                            mSweep.loadSpec(args[i + 1]);
+                        }
+                        else
+                        {
+                            mSweep.loadTrace(args[i + 1]);
+                        }
+                    }
+                    catch(std::exception const& e)
+                    {
+                        std::cerr << e.what() << "\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    i++;
+                    continue;
+                }
             }
 
             mOstream.initializeStream(fileName);
@@ -173,6 +405,54 @@ namespace rocwmma
             return mEmulationOption;
         }
 
+        // Max kernels in flight for pipelined suites (0 = disabled)
+        uint32_t pipelineDepth()
+        {
+            return mPipelineDepth;
+        }
+
+        // Where result comparisons are reduced
+        ValidationOption validationOption()
+        {
+            return mValidationOption;
+        }
+
+        // How hot runs are timed in benchmarks
+        BenchmarkOption benchmarkOption()
+        {
+            return mBenchmarkOption;
+        }
+
+        // Autotuning database for tuned suites (empty = disabled)
+        std::string const& tuningDatabase()
+        {
+            return mTuningDatabase;
+        }
+
+        // Runtime parameter sweep and shape trace (empty = compiled lists)
+        SweepConfig const& sweep()
+        {
+            return mSweep;
+        }
+
+        // Target arch of dry runs, which plan kernels without launching (empty = disabled)
+        std::string const& dryRunArch()
+        {
+            return mDryRunArch;
+        }
+
+        // Path prefix of phase trace captures of instrumented kernels (empty = disabled)
+        std::string const& phaseTrace()
+        {
+            return mPhaseTrace;
+        }
+
+        // Csv of roofline plot data of measured kernels (empty = disabled)
+        std::string const& rooflinePlot()
+        {
+            return mRooflinePlot;
+        }
+
     private:
         EmulationOption parseEmulationOption(std::string const& value)
         {
@@ -203,7 +483,32 @@ namespace rocwmma
         bool mOmitSkipped, mOmitFailed, mOmitPassed, mOmitCout;
 
         EmulationOption mEmulationOption;
+
+        uint32_t mPipelineDepth;
+
+        ValidationOption mValidationOption;
+
+        BenchmarkOption mBenchmarkOption;
+
+        std::string mTuningDatabase;
+
+        SweepConfig mSweep;
+
+        std::string mDryRunArch;
+
+        std::string mPhaseTrace;
+
+        std::string mRooflinePlot;
     };
 }
 
+///
+/// Compiled parameter list of a test suite, overridden by --sweep / --trace
+/// @params
+/// test_params : class providing the compiled list (e.g. rocwmma::TestParams)
+/// list : parameter list name (problemSizes, threadBlocks, alphas or betas)
+///
+#define ROCWMMA_SWEEP_PARAMS(test_params, list) \
+    rocwmma::RocwmmaOptions::instance()->sweep().list(test_params::list())
+
 #endif // ROCWMMA_OPTIONS_HPP
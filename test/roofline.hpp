@@ -0,0 +1,181 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_ROOFLINE_HPP
+#define ROCWMMA_TEST_ROOFLINE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+// Roofline reporting for benchmarked kernels: modeled global memory traffic,
+// arithmetic intensity, achieved bandwidth and the share of the applicable
+// roofline ceiling. Host only, so the models can be checked without a device.
+namespace rocwmma
+{
+    ///
+    /// Global memory traffic in bytes of a tiled GEMM, where each workgroup
+    /// computes one tileM x tileN block of D over all of K. A is read once per
+    /// column of tiles and B once per row of tiles; C and D are touched once.
+    /// Pass cBytes = 0 when C is not read (beta == 0).
+    ///
+    inline double tiledGemmBytes(uint64_t m,
+                                 uint64_t n,
+                                 uint64_t k,
+                                 uint64_t tileM,
+                                 uint64_t tileN,
+                                 double   aBytes,
+                                 double   bBytes,
+                                 double   cBytes,
+                                 double   dBytes)
+    {
+        auto tilesM = (m + tileM - 1u) / tileM;
+        auto tilesN = (n + tileN - 1u) / tileN;
+
+        auto mk = static_cast<double>(m) * k;
+        auto kn = static_cast<double>(k) * n;
+        auto mn = static_cast<double>(m) * n;
+        return mk * tilesN * aBytes + kn * tilesM * bBytes + mn * (cBytes + dBytes);
+    }
+
+    ///
+    /// Position of one measured kernel on the roofline.
+    ///
+    struct Roofline
+    {
+        double bytes         = 0.0; // Modeled global traffic of one run
+        double intensity     = 0.0; // Flops per byte
+        double achievedGBs   = 0.0;
+        double ceilingGFlops = 0.0; // Attainable GFlops/s at this intensity
+        double percent       = 0.0; // Achieved GFlops/s as a share of the ceiling
+        bool   memoryBound   = false; // Intensity is left of the ridge point
+    };
+
+    // gflops and bytes are per run and elapsedMs is the time of one run.
+    // A peak <= 0 is unknown and drops that roof from the ceiling.
+    inline Roofline calculateRoofline(
+        double gflops, double bytes, double elapsedMs, double peakGFlopsPerSec, double peakGBs)
+    {
+        Roofline result;
+        result.bytes = bytes;
+        if(bytes <= 0.0 || elapsedMs <= 0.0)
+        {
+            return result;
+        }
+
+        result.intensity   = gflops * 1.0e9 / bytes;
+        result.achievedGBs = bytes / (elapsedMs * 1.0e6);
+
+        auto memoryCeiling = result.intensity * peakGBs;
+        if(peakGBs > 0.0 && (peakGFlopsPerSec <= 0.0 || memoryCeiling < peakGFlopsPerSec))
+        {
+            result.memoryBound   = true;
+            result.ceilingGFlops = memoryCeiling;
+        }
+        else
+        {
+            result.ceilingGFlops = std::max(peakGFlopsPerSec, 0.0);
+        }
+
+        if(result.ceilingGFlops > 0.0)
+        {
+            result.percent = gflops / (elapsedMs * 1.0e-3) / result.ceilingGFlops * 100.0;
+        }
+        return result;
+    }
+
+    // Csv columns, in the order printRoofline writes them
+    inline std::ostream& printRooflineHeader(std::ostream& stream)
+    {
+        return stream << "Bytes(MB), AI(Flops/Byte), GB/s, Bound, Roofline(%), ";
+    }
+
+    inline std::ostream& printRoofline(std::ostream& stream, Roofline const& roofline)
+    {
+        return stream << roofline.bytes / 1.0e6 << ", " << roofline.intensity << ", "
+                      << roofline.achievedGBs << ", "
+                      << (roofline.memoryBound ? "memory" : "compute") << ", "
+                      << roofline.percent << ", ";
+    }
+
+    // Placeholder for kernels that were not run
+    inline std::ostream& printRooflineSkipped(std::ostream& stream)
+    {
+        return stream << "n/a, n/a, n/a, n/a, n/a, ";
+    }
+
+    ///
+    /// Plot data export: appends one csv row per measured kernel with its
+    /// intensity, throughput and the device roofs, which is enough to draw a
+    /// log-log roofline (see test/bin/GenRooflinePlot.py). The first row
+    /// written to a path in this process truncates the file and adds a header.
+    ///
+    inline void appendRooflinePlotData(std::string const& path,
+                                       std::string const& kernel,
+                                       double             gflops,
+                                       double             elapsedMs,
+                                       Roofline const&    roofline,
+                                       double             peakGFlopsPerSec,
+                                       double             peakGBs)
+    {
+        static std::set<std::string> started;
+
+        auto          first = started.insert(path).second;
+        std::ofstream file(path, first ? std::ios::trunc : std::ios::app);
+        if(!file)
+        {
+            throw std::runtime_error("Cannot open roofline plot data: " + path);
+        }
+
+        if(first)
+        {
+            file << "Kernel, AI(Flops/Byte), GFlops/s, GB/s, PeakGFlops/s, PeakGB/s, "
+                    "Ridge(Flops/Byte), Bound, Roofline(%)\n";
+        }
+
+        // Labels carry commas, so quote them
+        std::string label;
+        for(auto c : kernel)
+        {
+            label += (c == '"') ? std::string("\"\"") : std::string(1, c);
+        }
+
+        auto ridge = peakGBs > 0.0 ? peakGFlopsPerSec / peakGBs : 0.0;
+        file << std::setprecision(6) << '"' << label << "\", " << roofline.intensity << ", "
+             << (elapsedMs > 0.0 ? gflops / (elapsedMs * 1.0e-3) : 0.0) << ", "
+             << roofline.achievedGBs << ", " << peakGFlopsPerSec << ", " << peakGBs << ", "
+             << ridge << ", " << (roofline.memoryBound ? "memory" : "compute") << ", "
+             << roofline.percent << "\n";
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_ROOFLINE_HPP
@@ -0,0 +1,440 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_SWEEP_CONFIG_HPP
+#define ROCWMMA_SWEEP_CONFIG_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace rocwmma
+{
+    ///
+    /// Runtime replacement for the compiled parameter lists of test binaries.
+    ///
+    /// Sweep specification (--sweep), one "key = value, value, ..." per line:
+    ///
+    ///   # Comments start with '#'
+    ///   problem_sizes = 1024x1024x1024, 4096x4096x512
+    ///   thread_blocks = 128x2, 256x1
+    ///   alphas        = 1.0
+    ///   betas         = 0, 1
+    ///   cold_runs     = 1
+    ///   hot_runs      = 20
+    ///
+    /// Shape trace (--trace), one shape per line, as captured from service logs:
+    ///
+    ///   MxNxK [, count [, Ti_To_Tc [, LytA_LytB_LytC_LytD]]]
+    ///
+    /// Repeated shapes accumulate their counts. Trace shapes replace the
+    /// problem sizes, heaviest first. Shapes with types or layouts only run on
+    /// kernels of the same signature; the rest of each list is intersected
+    /// with the kernels compiled into the binary by the kernels' own checks.
+    ///
+    class SweepConfig
+    {
+    public:
+        using DimsT = std::vector<int64_t>;
+
+        struct TraceEntry
+        {
+            DimsT                    size;
+            uint64_t                 count;
+            std::vector<std::string> signatures; // "types|layouts", empty field = any
+        };
+
+        void loadSpec(std::string const& path)
+        {
+            std::ifstream file(path);
+            if(!file)
+            {
+                throw std::runtime_error("Cannot open sweep file " + path);
+            }
+            loadSpec(file, path);
+        }
+
+        void loadSpec(std::istream& stream, std::string const& source)
+        {
+            std::string line;
+            for(uint32_t lineNo = 1; std::getline(stream, line); lineNo++)
+            {
+                line = trim(line.substr(0, line.find('#')));
+                if(line.empty())
+                {
+                    continue;
+                }
+
+                auto eq = line.find('=');
+                if(eq == std::string::npos)
+                {
+                    throw parseError(source, lineNo, "expected key = value");
+                }
+
+                auto key    = trim(line.substr(0, eq));
+                auto values = split(line.substr(eq + 1), ',');
+                if(values.empty())
+                {
+                    throw parseError(source, lineNo, "no values for " + key);
+                }
+
+                try
+                {
+                    if(key == "problem_sizes")
+                    {
+                        for(auto const& value : values)
+                        {
+                            mProblemSizes.push_back(parseDims(value));
+                        }
+                    }
+                    else if(key == "thread_blocks")
+                    {
+                        for(auto const& value : values)
+                        {
+                            auto dims = parseDims(value);
+                            if(dims.size() != 2u)
+                            {
+                                throw std::invalid_argument("thread blocks are XxY");
+                            }
+                            mThreadBlocks.push_back({dims[0], dims[1]});
+                        }
+                    }
+                    else if(key == "alphas" || key == "betas")
+                    {
+                        auto& list = (key == "alphas" ? mAlphas : mBetas);
+                        for(auto const& value : values)
+                        {
+                            list.push_back(std::stod(value));
+                        }
+                    }
+                    else if(key == "cold_runs" || key == "hot_runs")
+                    {
+                        if(values.size() != 1u)
+                        {
+                            throw std::invalid_argument("expected a single count");
+                        }
+                        // Timing divides by the hot runs: at least one is required
+                        auto runs    = std::stol(values[0]);
+                        auto minRuns = (key == "hot_runs" ? 1l : 0l);
+                        if(runs < minRuns || runs > std::numeric_limits<uint32_t>::max())
+                        {
+                            throw std::out_of_range(key + " must be at least "
+                                                    + std::to_string(minRuns));
+                        }
+                        (key == "cold_runs" ? mColdRuns : mHotRuns) = static_cast<uint32_t>(runs);
+                    }
+                    else
+                    {
+                        throw std::invalid_argument("unknown key " + key);
+                    }
+                }
+                catch(std::logic_error const& e)
+                {
+                    // std::invalid_argument and std::out_of_range from parsing
+                    throw parseError(source, lineNo, e.what());
+                }
+            }
+        }
+
+        void loadTrace(std::string const& path)
+        {
+            std::ifstream file(path);
+            if(!file)
+            {
+                throw std::runtime_error("Cannot open shape trace " + path);
+            }
+            loadTrace(file, path);
+        }
+
+        void loadTrace(std::istream& stream, std::string const& source)
+        {
+            std::string line;
+            for(uint32_t lineNo = 1; std::getline(stream, line); lineNo++)
+            {
+                auto fields = split(line.substr(0, line.find('#')), ',');
+                if(fields.empty())
+                {
+                    continue;
+                }
+                if(fields.size() > 4u)
+                {
+                    throw parseError(source, lineNo, "too many fields");
+                }
+
+                try
+                {
+                    auto size  = parseDims(fields[0]);
+                    auto count = fields.size() > 1u ? std::stoull(fields[1]) : 1ull;
+                    auto types = fields.size() > 2u ? fields[2] : std::string();
+                    auto lyts  = fields.size() > 3u ? fields[3] : std::string();
+
+                    auto it = std::find_if(mTrace.begin(), mTrace.end(), [&size](auto const& e) {
+                        return e.size == size;
+                    });
+                    if(it == mTrace.end())
+                    {
+                        mTrace.push_back({size, 0u, {}});
+                        it = mTrace.end() - 1;
+                    }
+
+                    it->count += count;
+                    auto signature = types + "|" + lyts;
+                    if(std::find(it->signatures.begin(), it->signatures.end(), signature)
+                       == it->signatures.end())
+                    {
+                        it->signatures.push_back(signature);
+                    }
+                }
+                catch(std::logic_error const& e)
+                {
+                    throw parseError(source, lineNo, e.what());
+                }
+            }
+
+            // Heaviest shapes first; ties keep trace order
+            std::stable_sort(mTrace.begin(), mTrace.end(), [](auto const& lhs, auto const& rhs) {
+                return lhs.count > rhs.count;
+            });
+        }
+
+        bool hasProblemSizes() const
+        {
+            return !mTrace.empty() || !mProblemSizes.empty();
+        }
+
+        ///
+        /// Overrides for a binary's compiled lists.
+        /// The compiled defaults are returned for anything not in the sweep.
+        ///
+        template <typename ProblemSizeT>
+        std::vector<ProblemSizeT> problemSizes(std::vector<ProblemSizeT> const& defaults) const
+        {
+            if(!hasProblemSizes())
+            {
+                return defaults;
+            }
+
+            std::vector<DimsT> sizes;
+            if(!mTrace.empty())
+            {
+                for(auto const& entry : mTrace)
+                {
+                    sizes.push_back(entry.size);
+                }
+            }
+            else
+            {
+                sizes = mProblemSizes;
+            }
+
+            // Binaries differ in problem rank (e.g. unit tests are MxN)
+            constexpr auto            Rank = std::tuple_size<ProblemSizeT>::value;
+            std::vector<ProblemSizeT> result;
+            for(auto const& size : sizes)
+            {
+                if(size.size() == Rank)
+                {
+                    result.push_back(toTuple<ProblemSizeT>(size, std::make_index_sequence<Rank>{}));
+                }
+            }
+
+            if(result.size() != sizes.size())
+            {
+                std::cerr << "Sweep: ignored " << sizes.size() - result.size()
+                          << " problem size(s) without " << Rank << " dimensions\n";
+            }
+            return result;
+        }
+
+        template <typename ThreadBlockT>
+        std::vector<ThreadBlockT> threadBlocks(std::vector<ThreadBlockT> const& defaults) const
+        {
+            if(mThreadBlocks.empty())
+            {
+                return defaults;
+            }
+
+            std::vector<ThreadBlockT> result;
+            for(auto const& block : mThreadBlocks)
+            {
+                result.push_back({block.first, block.second});
+            }
+            return result;
+        }
+
+        template <typename AlphaT>
+        std::vector<AlphaT> alphas(std::vector<AlphaT> const& defaults) const
+        {
+            return mAlphas.empty() ? defaults : std::vector<AlphaT>(mAlphas.begin(), mAlphas.end());
+        }
+
+        template <typename BetaT>
+        std::vector<BetaT> betas(std::vector<BetaT> const& defaults) const
+        {
+            return mBetas.empty() ? defaults : std::vector<BetaT>(mBetas.begin(), mBetas.end());
+        }
+
+        std::optional<uint32_t> coldRuns() const
+        {
+            return mColdRuns;
+        }
+
+        std::optional<uint32_t> hotRuns() const
+        {
+            return mHotRuns;
+        }
+
+        ///
+        /// Trace intersection for kernels with a type / layout signature.
+        /// True if there is no trace, or the trace has the shape for any
+        /// signature or for this one.
+        ///
+        bool includes(DimsT const&       size,
+                      std::string const& types,
+                      std::string const& layouts) const
+        {
+            if(mTrace.empty())
+            {
+                return true;
+            }
+
+            for(auto const& entry : mTrace)
+            {
+                if(entry.size != size)
+                {
+                    continue;
+                }
+                for(auto const& signature : entry.signatures)
+                {
+                    auto sep          = signature.find('|');
+                    auto traceTypes   = signature.substr(0, sep);
+                    auto traceLayouts = signature.substr(sep + 1);
+                    if((traceTypes.empty() || traceTypes == types)
+                       && (traceLayouts.empty() || traceLayouts == layouts))
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Occurrences of a shape in the trace (0 if absent or no trace)
+        uint64_t traceCount(DimsT const& size) const
+        {
+            for(auto const& entry : mTrace)
+            {
+                if(entry.size == size)
+                {
+                    return entry.count;
+                }
+            }
+            return 0u;
+        }
+
+        std::vector<TraceEntry> const& trace() const
+        {
+            return mTrace;
+        }
+
+    private:
+        static std::string trim(std::string const& value)
+        {
+            auto begin = value.find_first_not_of(" \t\r\n");
+            auto end   = value.find_last_not_of(" \t\r\n");
+            return begin == std::string::npos ? std::string()
+                                              : value.substr(begin, end - begin + 1);
+        }
+
+        static std::vector<std::string> split(std::string const& value, char delim)
+        {
+            std::vector<std::string> result;
+            std::stringstream        stream(value);
+            std::string              token;
+            while(std::getline(stream, token, delim))
+            {
+                token = trim(token);
+                if(!token.empty())
+                {
+                    result.push_back(token);
+                }
+            }
+            return result;
+        }
+
+        // "1024x512x64" -> {1024, 512, 64}
+        static DimsT parseDims(std::string const& value)
+        {
+            DimsT dims;
+            for(auto const& token : split(value, 'x'))
+            {
+                size_t pos = 0;
+                auto   dim = std::stoll(token, &pos);
+                if(pos != token.size() || dim <= 0)
+                {
+                    throw std::invalid_argument("invalid dimension in " + value);
+                }
+                dims.push_back(dim);
+            }
+            if(dims.size() < 2u || dims.size() > 3u)
+            {
+                throw std::invalid_argument("expected 2 or 3 dimensions in " + value);
+            }
+            return dims;
+        }
+
+        template <typename TupleT, size_t... Indices>
+        static TupleT toTuple(DimsT const& dims, std::index_sequence<Indices...>)
+        {
+            return TupleT{dims[Indices]...};
+        }
+
+        static std::runtime_error
+            parseError(std::string const& source, uint32_t lineNo, std::string const& what)
+        {
+            return std::runtime_error(source + ":" + std::to_string(lineNo) + ": " + what);
+        }
+
+        std::vector<DimsT>                       mProblemSizes;
+        std::vector<std::pair<int64_t, int64_t>> mThreadBlocks;
+        std::vector<double>                      mAlphas, mBetas;
+        std::optional<uint32_t>                  mColdRuns, mHotRuns;
+        std::vector<TraceEntry>                  mTrace;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SWEEP_CONFIG_HPP
@@ -0,0 +1,322 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/block_scale.hpp>
+
+#include "bulk_convert.hpp"
+#include "reference.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using BulkConvert::Format;
+        using BulkConvert::Rounding;
+        using BulkConvert::Saturation;
+        using BulkConvert::detail::bitsFloat;
+        using BulkConvert::detail::floatBits;
+
+        // MX element formats: E4M3 and E5M2 with their largest normal exponent
+        template <typename DataT>
+        struct MxFormat;
+
+        template <>
+        struct MxFormat<float8_t>
+        {
+            constexpr static Format  Fmt  = Format::F8;
+            constexpr static int32_t Emax = 8;
+        };
+
+        template <>
+        struct MxFormat<bfloat8_t>
+        {
+            constexpr static Format  Fmt  = Format::Bf8;
+            constexpr static int32_t Emax = 15;
+        };
+
+        constexpr uint32_t ScaleBlockK = 32u;
+
+        template <typename LayoutT>
+        uint32_t index(uint32_t row, uint32_t col, uint32_t rows, uint32_t cols)
+        {
+            return std::is_same<LayoutT, row_major>::value ? row * cols + col : col * rows + row;
+        }
+
+        // MX-quantized rows x cols matrix, scaled in blocks of ScaleBlockK along K.
+        // KAlongRows selects K as the row dimension (matrix_b) instead of the
+        // column dimension (matrix_a).
+        template <typename DataT, typename LayoutT, bool KAlongRows>
+        struct MxMatrix
+        {
+            uint32_t             rows, cols;
+            std::vector<DataT>   data;
+            std::vector<uint8_t> scales;
+            std::vector<float>   dequantized;
+
+            MxMatrix(std::vector<float> const& values, uint32_t rows, uint32_t cols)
+                : rows(rows)
+                , cols(cols)
+                , data(rows * cols)
+                , dequantized(rows * cols)
+            {
+                using Fmt = MxFormat<DataT>;
+
+                auto k       = KAlongRows ? rows : cols;
+                auto kBlocks = (k + ScaleBlockK - 1u) / ScaleBlockK;
+                auto sRows   = KAlongRows ? kBlocks : rows;
+                auto sCols   = KAlongRows ? cols : kBlocks;
+                scales.resize(sRows * sCols);
+
+                std::vector<uint8_t> codes(rows * cols);
+                for(uint32_t i = 0; i < sRows; i++)
+                {
+                    for(uint32_t j = 0; j < sCols; j++)
+                    {
+                        // Elements of the scale block at (i, j)
+                        auto kBegin = (KAlongRows ? i : j) * ScaleBlockK;
+                        auto kEnd   = std::min(kBegin + ScaleBlockK, k);
+                        auto elem   = [&](uint32_t h) {
+                            return KAlongRows ? index<LayoutT>(h, j, rows, cols)
+                                                : index<LayoutT>(i, h, rows, cols);
+                        };
+
+                        float amax = 0.0f;
+                        for(auto h = kBegin; h < kEnd; h++)
+                        {
+                            amax = std::max(amax, std::fabs(values[elem(h)]));
+                        }
+
+                        auto scale = detail::e8m0BlockScale<Fmt::Emax>(amax);
+                        auto x     = detail::e8m0ToFloat(scale);
+
+                        scales[index<LayoutT>(i, j, sRows, sCols)] = static_cast<uint8_t>(scale);
+                        for(auto h = kBegin; h < kEnd; h++)
+                        {
+                            auto code = BulkConvert::encodeScalar<Fmt::Fmt>(
+                                floatBits(values[elem(h)] / x));
+                            codes[elem(h)] = static_cast<uint8_t>(code);
+                            dequantized[elem(h)]
+                                = bitsFloat(BulkConvert::decodeScalar<Fmt::Fmt>(code)) * x;
+                        }
+                    }
+                }
+                std::memcpy(data.data(), codes.data(), codes.size());
+            }
+        };
+
+        std::vector<float> randomValues(uint32_t count, uint32_t seed)
+        {
+            // Magnitudes spanning several binades, so blocks get distinct scales
+            std::mt19937                          gen(seed);
+            std::uniform_real_distribution<float> mant(-1.0f, 1.0f);
+            std::uniform_int_distribution<int>    exp(-12, 12);
+
+            std::vector<float> values(count);
+            for(auto& v : values)
+            {
+                v = std::ldexp(mant(gen), exp(gen));
+            }
+            return values;
+        }
+
+        // The MX reference matches a plain gemm on the dequantized inputs
+        template <typename InputTA, typename InputTB, typename LayoutA, typename LayoutB>
+        void checkReference(uint32_t m, uint32_t n, uint32_t k)
+        {
+            using LayoutC = col_major;
+            using LayoutD = row_major;
+
+            MxMatrix<InputTA, LayoutA, false> a(randomValues(m * k, 1u), m, k);
+            MxMatrix<InputTB, LayoutB, true>  b(randomValues(k * n, 2u), k, n);
+
+            auto c = randomValues(m * n, 3u);
+
+            std::vector<float> d(m * n), dRef(m * n);
+            float              alpha = 1.5f, beta = -0.5f;
+
+            gemm_mx_CPU<InputTA, InputTB, float, LayoutA, LayoutB, LayoutC, LayoutD>(
+                m,
+                n,
+                k,
+                a.data.data(),
+                a.scales.data(),
+                b.data.data(),
+                b.scales.data(),
+                c.data(),
+                d.data(),
+                alpha,
+                beta);
+
+            gemm_CPU<float, float, float, LayoutA, LayoutB, LayoutC, LayoutD>(m,
+                                                                              n,
+                                                                              k,
+                                                                              a.dequantized.data(),
+                                                                              b.dequantized.data(),
+                                                                              c.data(),
+                                                                              dRef.data(),
+                                                                              alpha,
+                                                                              beta);
+
+            for(uint32_t i = 0; i < m; i++)
+            {
+                for(uint32_t j = 0; j < n; j++)
+                {
+                    // Bound on the summation order difference
+                    double bound = 0.0;
+                    for(uint32_t h = 0; h < k; h++)
+                    {
+                        bound += std::fabs(static_cast<double>(
+                                     a.dequantized[index<LayoutA>(i, h, m, k)])
+                                     * b.dequantized[index<LayoutB>(h, j, k, n)]);
+                    }
+                    bound = 4.0 * k * std::numeric_limits<float>::epsilon()
+                            * (alpha * bound + std::fabs(beta * c[index<LayoutC>(i, j, m, n)]));
+
+                    auto idx = index<LayoutD>(i, j, m, n);
+                    ASSERT_NEAR(d[idx], dRef[idx], bound) << i << ", " << j;
+                }
+            }
+        }
+
+    } // namespace
+
+    TEST(BlockScaleTest, E8M0Decode)
+    {
+        for(uint32_t code = 0u; code < 255u; code++)
+        {
+            EXPECT_EQ(detail::e8m0ToFloat(code), std::ldexp(1.0f, static_cast<int>(code) - 127))
+                << code;
+        }
+        EXPECT_TRUE(std::isnan(detail::e8m0ToFloat(0xFFu)));
+    }
+
+    TEST(BlockScaleTest, ScaleSelection)
+    {
+        // floor(log2(amax)) - Emax, clamped
+        EXPECT_EQ(detail::e8m0BlockScale<8>(448.0f), 127u);
+        EXPECT_EQ(detail::e8m0BlockScale<8>(1.0f), 119u);
+        EXPECT_EQ(detail::e8m0BlockScale<15>(57344.0f), 127u);
+        EXPECT_EQ(detail::e8m0BlockScale<15>(0.75f), 111u);
+        EXPECT_EQ(detail::e8m0BlockScale<8>(std::numeric_limits<float>::max()), 246u);
+        EXPECT_EQ(detail::e8m0BlockScale<8>(std::numeric_limits<float>::min()), 0u);
+        EXPECT_EQ(detail::e8m0BlockScale<8>(0.0f), 0u);
+        EXPECT_EQ(detail::e8m0BlockScale<8>(std::numeric_limits<float>::denorm_min()), 0u);
+        EXPECT_EQ(detail::e8m0BlockScale<8>(std::numeric_limits<float>::infinity()), 0xFFu);
+        EXPECT_EQ(detail::e8m0BlockScale<8>(std::numeric_limits<float>::quiet_NaN()), 0xFFu);
+
+        // Scaled amax lands in the top binade of the element format
+        for(auto amax : randomValues(4096u, 4u))
+        {
+            amax = std::fabs(amax);
+            if(amax == 0.0f)
+            {
+                continue;
+            }
+            auto scaled = amax / detail::e8m0ToFloat(detail::e8m0BlockScale<8>(amax));
+            EXPECT_GE(scaled, 256.0f) << amax;
+            EXPECT_LT(scaled, 512.0f) << amax;
+        }
+    }
+
+    TEST(BlockScaleTest, ApplyScale)
+    {
+        for(auto value : randomValues(4096u, 5u))
+        {
+            for(uint32_t sa : {0u, 64u, 120u, 127u, 131u, 200u, 254u})
+            {
+                for(uint32_t sb : {0u, 100u, 127u, 140u, 254u})
+                {
+                    // Single rounding of the exact product
+                    auto expected = static_cast<float>(
+                        std::ldexp(static_cast<double>(value),
+                                   static_cast<int>(sa + sb) - 254));
+                    auto result = detail::applyBlockScale(value, sa, sb);
+                    EXPECT_EQ(floatBits(result), floatBits(expected))
+                        << value << " " << sa << " " << sb;
+                }
+            }
+            EXPECT_TRUE(std::isnan(detail::applyBlockScale(value, 0xFFu, 127u)));
+            EXPECT_TRUE(std::isnan(detail::applyBlockScale(value, 127u, 0xFFu)));
+        }
+    }
+
+    TEST(BlockScaleTest, QuantizeRoundTrip)
+    {
+        // Dequantized E4M3 values are within half an ulp, the subnormal step of
+        // the block, or the saturation at 448 of a block whose amax scales above it
+        auto                                 values = randomValues(64u * 96u, 6u);
+        MxMatrix<float8_t, row_major, false> a(values, 64u, 96u);
+
+        for(uint32_t i = 0; i < values.size(); i++)
+        {
+            auto x   = detail::e8m0ToFloat(a.scales[i / ScaleBlockK]);
+            auto tol = std::max({std::ldexp(std::fabs(values[i]), -4),
+                                 std::ldexp(x, -10),
+                                 std::fabs(values[i]) - 448.0f * x});
+            EXPECT_NEAR(a.dequantized[i], values[i], tol) << i;
+        }
+    }
+
+    TEST(BlockScaleTest, ReferenceE4M3)
+    {
+        checkReference<float8_t, float8_t, row_major, col_major>(32u, 48u, 128u);
+        checkReference<float8_t, float8_t, col_major, row_major>(16u, 16u, 96u);
+        checkReference<float8_t, float8_t, row_major, row_major>(24u, 8u, 64u);
+        checkReference<float8_t, float8_t, col_major, col_major>(8u, 40u, 160u);
+    }
+
+    TEST(BlockScaleTest, ReferenceE5M2)
+    {
+        checkReference<bfloat8_t, bfloat8_t, row_major, col_major>(32u, 48u, 128u);
+        checkReference<bfloat8_t, bfloat8_t, col_major, row_major>(16u, 16u, 96u);
+        checkReference<bfloat8_t, bfloat8_t, row_major, row_major>(24u, 8u, 64u);
+        checkReference<bfloat8_t, bfloat8_t, col_major, col_major>(8u, 40u, 160u);
+    }
+
+    TEST(BlockScaleTest, ReferenceMixedFormats)
+    {
+        checkReference<float8_t, bfloat8_t, row_major, col_major>(32u, 32u, 128u);
+        checkReference<bfloat8_t, float8_t, col_major, row_major>(16u, 32u, 64u);
+    }
+
+    TEST(BlockScaleTest, ReferencePartialScaleBlock)
+    {
+        // K not a multiple of the scale block size
+        checkReference<float8_t, bfloat8_t, row_major, col_major>(16u, 16u, 80u);
+        checkReference<float8_t, float8_t, col_major, row_major>(8u, 8u, 20u);
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,482 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "bulk_convert.hpp"
+
+#if __has_include(<rocwmma/internal/types.hpp>)
+#include <rocwmma/internal/types.hpp>
+#define ROCWMMA_BULK_CONVERT_TEST_TYPES 1
+#else
+#define ROCWMMA_BULK_CONVERT_TEST_TYPES 0
+#endif
+
+namespace rocwmma
+{
+    namespace
+    {
+        using BulkConvert::Format;
+        using BulkConvert::FormatTraits;
+        using BulkConvert::Isa;
+        using BulkConvert::Rounding;
+        using BulkConvert::Saturation;
+        using BulkConvert::detail::bitsFloat;
+        using BulkConvert::detail::floatBits;
+
+        template <Format F>
+        using StorageT = typename FormatTraits<F>::StorageT;
+
+        // Value of an 8-bit code from the format definition, in double
+        template <Format F>
+        double referenceValue(uint32_t code)
+        {
+            using Traits = FormatTraits<F>;
+
+            auto sign = (code & 0x80u) ? -1.0 : 1.0;
+            auto exp  = static_cast<int>((code & 0x7Fu) >> Traits::MantBits);
+            auto mant = static_cast<int>(code & ((1u << Traits::MantBits) - 1u));
+            auto bias = static_cast<int>(Traits::Bias);
+
+            if(Traits::Fnuz ? code == 0x80u
+                            : (Traits::HasInf ? (exp == (1 << Traits::ExpBits) - 1 && mant)
+                                              : (code & 0x7Fu) == 0x7Fu))
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if(Traits::HasInf && exp == (1 << Traits::ExpBits) - 1)
+            {
+                return sign * std::numeric_limits<double>::infinity();
+            }
+            if(exp == 0)
+            {
+                return sign * std::ldexp(mant, 1 - bias - static_cast<int>(Traits::MantBits));
+            }
+            return sign * std::ldexp((1 << Traits::MantBits) + mant,
+                                     exp - bias - static_cast<int>(Traits::MantBits));
+        }
+
+        // Brute force conversion: nearest finite code, ties to even
+        // mantissa, or the largest code not above |x| when truncating.
+        template <Format F, Rounding R>
+        uint32_t referenceEncode(float x)
+        {
+            using Traits = FormatTraits<F>;
+
+            auto     target = std::fabs(static_cast<double>(x));
+            uint32_t best   = 0u;
+            for(uint32_t code = 0u; code <= Traits::MaxCode; ++code)
+            {
+                auto value = referenceValue<F>(code);
+                auto bestV = referenceValue<F>(best);
+                if(R == Rounding::TowardZero)
+                {
+                    best = value <= target ? code : best;
+                }
+                else if(std::fabs(value - target) < std::fabs(bestV - target)
+                        || (std::fabs(value - target) == std::fabs(bestV - target)
+                            && !(code & 1u)))
+                {
+                    best = code;
+                }
+            }
+
+            bool negative = std::signbit(x);
+            if(Traits::Fnuz && best == 0u)
+            {
+                return 0u;
+            }
+            return best | (negative ? 0x80u : 0u);
+        }
+
+        // Float inputs around every code: values, midpoints and their neighbours,
+        // plus a strided sweep of all float bit patterns.
+        template <Format F>
+        std::vector<float> sweep()
+        {
+            std::vector<float> values;
+            for(uint32_t code = 0u; code < FormatTraits<F>::MaxCode; ++code)
+            {
+                auto lo  = referenceValue<F>(code);
+                auto mid = static_cast<float>(0.5 * (lo + referenceValue<F>(code + 1u)));
+                for(auto v : {static_cast<float>(lo),
+                              mid,
+                              std::nextafter(mid, 0.0f),
+                              std::nextafter(mid, 1.0e30f)})
+                {
+                    values.push_back(v);
+                    values.push_back(-v);
+                }
+            }
+            for(uint64_t bits = 0u; bits <= 0xFFFFFFFFu; bits += 65521u)
+            {
+                values.push_back(bitsFloat(static_cast<uint32_t>(bits)));
+            }
+            return values;
+        }
+
+        template <Format F>
+        void checkCodes()
+        {
+            using Traits = FormatTraits<F>;
+
+            for(uint32_t code = 0u; code < 256u; ++code)
+            {
+                auto expected = referenceValue<F>(code);
+                auto decoded  = bitsFloat(BulkConvert::decodeScalar<F>(code));
+                if(std::isnan(expected))
+                {
+                    EXPECT_TRUE(std::isnan(decoded)) << std::hex << code;
+                    continue;
+                }
+                EXPECT_EQ(static_cast<double>(decoded), expected) << std::hex << code;
+                EXPECT_EQ(std::signbit(decoded), std::signbit(expected)) << std::hex << code;
+
+                // Every finite code survives a round trip
+                if(std::isfinite(expected))
+                {
+                    EXPECT_EQ(BulkConvert::encodeScalar<F>(floatBits(decoded)), code)
+                        << std::hex << code;
+                }
+            }
+            EXPECT_EQ(bitsFloat(BulkConvert::decodeScalar<F>(Traits::MaxCode)),
+                      static_cast<float>(referenceValue<F>(Traits::MaxCode)));
+        }
+
+        template <Format F>
+        void checkRounding()
+        {
+            using Traits = FormatTraits<F>;
+            auto maxValue = referenceValue<F>(Traits::MaxCode);
+
+            for(auto x : sweep<F>())
+            {
+                if(std::isnan(x))
+                {
+                    continue;
+                }
+
+                auto bits = floatBits(x);
+                auto sat  = std::fabs(x) > maxValue;
+                auto max  = Traits::MaxCode | (std::signbit(x) ? 0x80u : 0u);
+
+                auto rne = referenceEncode<F, Rounding::NearestEven>(x);
+                auto rtz = referenceEncode<F, Rounding::TowardZero>(x);
+                EXPECT_EQ((BulkConvert::encodeScalar<F, Rounding::NearestEven>(bits)),
+                          sat ? max : rne)
+                    << x;
+                EXPECT_EQ((BulkConvert::encodeScalar<F, Rounding::TowardZero>(bits)),
+                          sat ? max : rtz)
+                    << x;
+
+                // Without saturation, only out of range values change
+                auto none = BulkConvert::encodeScalar<F, Rounding::NearestEven, Saturation::None>(
+                    bits);
+                auto value = bitsFloat(BulkConvert::decodeScalar<F>(none));
+                if(!sat)
+                {
+                    EXPECT_EQ(none, rne) << x;
+                }
+                else
+                {
+                    EXPECT_TRUE(std::isinf(value) || std::isnan(value)
+                                || std::fabs(value) == maxValue)
+                        << x;
+                }
+            }
+        }
+
+        template <Format F, Rounding R, Saturation S>
+        void checkArrays(std::vector<float> const& inputs)
+        {
+            std::vector<StorageT<F>> expected(inputs.size());
+            for(size_t i = 0; i < inputs.size(); ++i)
+            {
+                expected[i] = BulkConvert::detail::bitsStorage<F>(
+                    BulkConvert::encodeScalar<F, R, S>(floatBits(inputs[i])));
+            }
+
+            for(auto isa : {Isa::Portable, Isa::Avx2, Isa::Avx512, Isa::Neon})
+            {
+                if(!BulkConvert::isaSupported(isa))
+                {
+                    continue;
+                }
+
+                std::vector<StorageT<F>> encoded(inputs.size());
+                BulkConvert::fromFloat<F, R, S>(inputs.data(), encoded.data(), inputs.size(), isa);
+                for(size_t i = 0; i < inputs.size(); ++i)
+                {
+                    ASSERT_EQ(BulkConvert::detail::storageBits<F>(encoded[i]),
+                              BulkConvert::detail::storageBits<F>(expected[i]))
+                        << "isa " << static_cast<uint32_t>(isa) << " input " << std::hex
+                        << floatBits(inputs[i]);
+                }
+
+                std::vector<float> decoded(inputs.size());
+                BulkConvert::toFloat<F>(encoded.data(), decoded.data(), encoded.size(), isa);
+                for(size_t i = 0; i < inputs.size(); ++i)
+                {
+                    auto reference
+                        = F == Format::Xf32
+                              ? floatBits(BulkConvert::detail::bitsFloat(
+                                  BulkConvert::detail::storageBits<F>(encoded[i]) << 13u))
+                              : BulkConvert::decodeScalar<F>(
+                                  BulkConvert::detail::storageBits<F>(encoded[i]));
+                    ASSERT_EQ(floatBits(decoded[i]), reference)
+                        << "isa " << static_cast<uint32_t>(isa) << " code " << std::hex
+                        << BulkConvert::detail::storageBits<F>(encoded[i]);
+                }
+            }
+        }
+
+        template <Format F>
+        void checkAllModes(std::vector<float> const& inputs)
+        {
+            checkArrays<F, Rounding::NearestEven, Saturation::Finite>(inputs);
+            checkArrays<F, Rounding::NearestEven, Saturation::None>(inputs);
+            checkArrays<F, Rounding::TowardZero, Saturation::Finite>(inputs);
+            checkArrays<F, Rounding::TowardZero, Saturation::None>(inputs);
+        }
+
+        // Sweep plus specials, with an odd length to exercise the tails
+        std::vector<float> arrayInputs()
+        {
+            std::vector<float> inputs;
+            for(uint64_t bits = 0u; bits <= 0xFFFFFFFFu; bits += 4099u)
+            {
+                inputs.push_back(bitsFloat(static_cast<uint32_t>(bits)));
+            }
+            for(uint32_t bits : {0x0u,
+                                 0x80000000u,
+                                 0x7F800000u,
+                                 0xFF800000u,
+                                 0x7FC00000u,
+                                 0xFFC00001u,
+                                 0x7F800001u,
+                                 0x7F7FFFFFu,
+                                 0x00000001u,
+                                 0x807FFFFFu})
+            {
+                inputs.push_back(bitsFloat(bits));
+            }
+            inputs.resize(inputs.size() | 1u);
+            return inputs;
+        }
+
+    } // namespace
+
+    TEST(BulkConvertTest, Fp8Codes)
+    {
+        checkCodes<Format::F8>();
+        checkCodes<Format::Bf8>();
+        checkCodes<Format::F8Fnuz>();
+        checkCodes<Format::Bf8Fnuz>();
+
+        EXPECT_EQ(bitsFloat(BulkConvert::decodeScalar<Format::F8>(0x7Eu)), 448.0f);
+        EXPECT_EQ(bitsFloat(BulkConvert::decodeScalar<Format::Bf8>(0x7Bu)), 57344.0f);
+        EXPECT_EQ(bitsFloat(BulkConvert::decodeScalar<Format::F8Fnuz>(0x7Fu)), 240.0f);
+        EXPECT_EQ(bitsFloat(BulkConvert::decodeScalar<Format::Bf8Fnuz>(0x7Fu)), 57344.0f);
+        EXPECT_EQ(bitsFloat(BulkConvert::decodeScalar<Format::F8Fnuz>(0x01u)),
+                  std::ldexp(1.0f, -10));
+    }
+
+    TEST(BulkConvertTest, Fp8Rounding)
+    {
+        checkRounding<Format::F8>();
+        checkRounding<Format::Bf8>();
+        checkRounding<Format::F8Fnuz>();
+        checkRounding<Format::Bf8Fnuz>();
+    }
+
+    TEST(BulkConvertTest, Specials)
+    {
+        auto inf = floatBits(std::numeric_limits<float>::infinity());
+        auto nan = floatBits(std::numeric_limits<float>::quiet_NaN());
+
+        // OCP e4m3 has no Inf: overflow is NaN unless saturating
+        EXPECT_EQ((BulkConvert::encodeScalar<Format::F8>(inf)), 0x7Eu);
+        EXPECT_EQ((BulkConvert::encodeScalar<Format::F8, Rounding::NearestEven, Saturation::None>(
+                      inf | 0x80000000u)),
+                  0xFFu);
+        EXPECT_EQ((BulkConvert::encodeScalar<Format::Bf8, Rounding::NearestEven, Saturation::None>(
+                      inf)),
+                  0x7Cu);
+
+        // FNUZ has a single NaN and no negative zero
+        EXPECT_EQ(BulkConvert::encodeScalar<Format::F8Fnuz>(nan | 0x80000000u), 0x80u);
+        EXPECT_EQ(BulkConvert::encodeScalar<Format::Bf8Fnuz>(0x80000000u), 0x00u);
+        EXPECT_EQ(BulkConvert::encodeScalar<Format::F8>(0x80000000u), 0x80u);
+
+        // Truncation overflows to the largest finite value
+        EXPECT_EQ(
+            (BulkConvert::encodeScalar<Format::F16, Rounding::TowardZero, Saturation::None>(
+                floatBits(1.0e6f))),
+            0x7BFFu);
+        EXPECT_EQ((BulkConvert::encodeScalar<Format::F16, Rounding::NearestEven, Saturation::None>(
+                      floatBits(65520.0f))),
+                  0x7C00u);
+    }
+
+    TEST(BulkConvertTest, WideFormatsMatchScalarDefinitions)
+    {
+        for(uint64_t bits = 0u; bits <= 0xFFFFFFFFu; bits += 997u)
+        {
+            auto u = static_cast<uint32_t>(bits);
+
+            // As hip_bfloat16's conversions
+            auto bf16 = (~u & 0x7F800000u) ? (u + 0x7FFFu + ((u >> 16u) & 1u)) >> 16u
+                                           : ((u & 0xFFFFu) ? (u | 0x10000u) : u) >> 16u;
+            EXPECT_EQ(
+                (BulkConvert::encodeScalar<Format::Bf16, Rounding::NearestEven, Saturation::None>(
+                    u)),
+                bf16)
+                << std::hex << u;
+            EXPECT_EQ(
+                (BulkConvert::encodeScalar<Format::Bf16, Rounding::TowardZero, Saturation::None>(
+                    u)),
+                u >> 16u)
+                << std::hex << u;
+
+            // As rocwmma_xfloat32's conversions
+            auto xf32 = (~u & 0x7F800000u) ? (u + 0xFFFu + ((u >> 13u) & 1u)) & 0xFFFFE000u
+                                           : ((u & 0x1FFFu) ? (u | 0x2000u) : u) & 0xFFFFE000u;
+            EXPECT_EQ(
+                (BulkConvert::encodeScalar<Format::Xf32, Rounding::NearestEven, Saturation::None>(
+                    u))
+                    << 13u,
+                xf32)
+                << std::hex << u;
+            EXPECT_EQ(
+                (BulkConvert::encodeScalar<Format::Xf32, Rounding::TowardZero, Saturation::None>(
+                    u))
+                    << 13u,
+                u & 0xFFFFE000u)
+                << std::hex << u;
+
+#if defined(__FLT16_MAX__)
+            // IEEE half conversion of the compiler
+            auto f = bitsFloat(u);
+            if(!std::isnan(f))
+            {
+                auto     half = static_cast<_Float16>(f);
+                uint16_t code;
+                std::memcpy(&code, &half, sizeof(code));
+                EXPECT_EQ(
+                    (BulkConvert::encodeScalar<Format::F16,
+                                               Rounding::NearestEven,
+                                               Saturation::None>(u)),
+                    code)
+                    << std::hex << u;
+            }
+#endif
+        }
+
+        // Every half code decodes to its value
+        for(uint32_t code = 0u; code < 0x10000u; ++code)
+        {
+            auto exp  = (code >> 10u) & 0x1Fu;
+            auto mant = code & 0x3FFu;
+            auto sign = (code & 0x8000u) ? -1.0 : 1.0;
+            auto f    = bitsFloat(BulkConvert::decodeScalar<Format::F16>(code));
+            if(exp == 0x1Fu)
+            {
+                EXPECT_TRUE(mant ? std::isnan(f) : std::isinf(f)) << std::hex << code;
+                continue;
+            }
+            auto expected = exp ? sign * std::ldexp(1024.0 + mant, int(exp) - 25)
+                                : sign * std::ldexp(double(mant), -24);
+            EXPECT_EQ(static_cast<double>(f), expected) << std::hex << code;
+        }
+    }
+
+    TEST(BulkConvertTest, ArraysMatchScalar)
+    {
+        auto inputs = arrayInputs();
+        checkAllModes<Format::F8>(inputs);
+        checkAllModes<Format::Bf8>(inputs);
+        checkAllModes<Format::F8Fnuz>(inputs);
+        checkAllModes<Format::Bf8Fnuz>(inputs);
+        checkAllModes<Format::F16>(inputs);
+        checkAllModes<Format::Bf16>(inputs);
+        checkAllModes<Format::Xf32>(inputs);
+    }
+
+#if ROCWMMA_BULK_CONVERT_TEST_TYPES
+
+    namespace
+    {
+        template <Format F, typename DataT>
+        void checkAgainstType()
+        {
+            // Scalar constructors round to nearest even and saturate fp8
+            constexpr auto S = sizeof(DataT) == 1u ? Saturation::Finite : Saturation::None;
+
+            for(uint64_t bits = 0u; bits <= 0xFFFFFFFFu; bits += 4099u)
+            {
+                auto x = bitsFloat(static_cast<uint32_t>(bits));
+                if(std::isnan(x) || std::isinf(x))
+                {
+                    continue;
+                }
+
+                auto value = static_cast<DataT>(x);
+                StorageT<F> code;
+                std::memcpy(&code, &value, sizeof(code));
+                EXPECT_EQ((BulkConvert::encodeScalar<F, Rounding::NearestEven, S>(floatBits(x))),
+                          code)
+                    << x;
+            }
+
+            for(uint32_t code = 0u; code < 256u && sizeof(DataT) == 1u; ++code)
+            {
+                DataT value;
+                std::memcpy(&value, &code, 1u);
+                auto expected = static_cast<float>(value);
+                auto decoded  = bitsFloat(BulkConvert::decodeScalar<F>(code));
+                EXPECT_TRUE(std::isnan(expected) ? std::isnan(decoded) : decoded == expected)
+                    << std::hex << code;
+            }
+        }
+    }
+
+    TEST(BulkConvertTest, MatchesRocwmmaTypes)
+    {
+        checkAgainstType<Format::F8, float8_t>();
+        checkAgainstType<Format::Bf8, bfloat8_t>();
+        checkAgainstType<Format::F8Fnuz, float8_fnuz_t>();
+        checkAgainstType<Format::Bf8Fnuz, bfloat8_fnuz_t>();
+        checkAgainstType<Format::Bf16, bfloat16_t>();
+    }
+
+#endif // ROCWMMA_BULK_CONVERT_TEST_TYPES
+
+} // namespace rocwmma
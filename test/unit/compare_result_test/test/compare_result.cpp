@@ -0,0 +1,255 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "compare_result.hpp"
+
+namespace rocwmma
+{
+    static std::vector<float> makeMatrix(uint32_t m, uint32_t n)
+    {
+        std::vector<float> result(m * n);
+        std::iota(result.begin(), result.end(), -7.0f);
+        return result;
+    }
+
+    static std::vector<float> transpose(std::vector<float> const& mat, uint32_t m, uint32_t n)
+    {
+        std::vector<float> result(m * n);
+        for(uint32_t i = 0; i < m; ++i)
+        {
+            for(uint32_t j = 0; j < n; ++j)
+            {
+                result[j * m + i] = mat[i * n + j];
+            }
+        }
+        return result;
+    }
+
+    TEST(CompareResultTest, IdenticalMatricesPass)
+    {
+        auto a = makeMatrix(17, 9);
+
+        auto result
+            = compareEqualHost<float, float, row_major, row_major>(a.data(), a.data(), 17, 9);
+
+        EXPECT_TRUE(result.passed);
+        EXPECT_EQ(result.maxRelativeError, 0.0);
+        EXPECT_FALSE(result.hasNaN);
+        EXPECT_FALSE(result.hasInf);
+        EXPECT_FALSE(result.hasFailure());
+    }
+
+    TEST(CompareResultTest, ReportsMaxRelativeErrorWithinTolerance)
+    {
+        auto a = makeMatrix(8, 8);
+        auto b = a;
+
+        // |a - b| / (|a| + |b| + 1) = eps / 3
+        a[10] = 1.0f;
+        b[10] = 1.0f + std::numeric_limits<float>::epsilon();
+
+        auto result
+            = compareEqualHost<float, float, row_major, row_major>(a.data(), b.data(), 8, 8);
+
+        EXPECT_TRUE(result.passed);
+        EXPECT_NEAR(result.maxRelativeError, std::numeric_limits<float>::epsilon() / 3.0, 1.0e-12);
+        EXPECT_FALSE(result.hasFailure());
+    }
+
+    TEST(CompareResultTest, ReportsFirstFailureCoordinates)
+    {
+        uint32_t m = 6, n = 5;
+        auto     a = makeMatrix(m, n);
+        auto     b = a;
+
+        // Failures at (4, 1) and (2, 3): first in row-major order is (2, 3)
+        b[4 * n + 1] += 100.0f;
+        b[2 * n + 3] += 1.0f;
+
+        auto colA = transpose(a, m, n);
+        auto colB = transpose(b, m, n);
+
+        auto result = compareEqualHost<float, float, col_major, col_major>(
+            colA.data(), colB.data(), m, n);
+
+        EXPECT_FALSE(result.passed);
+        EXPECT_EQ(result.failRow, 2u);
+        EXPECT_EQ(result.failCol, 3u);
+        auto expectedError = 100.0 / (2.0 * std::fabs(a[4 * n + 1]) + 101.0);
+        EXPECT_NEAR(result.maxRelativeError, expectedError, 1.0e-9);
+    }
+
+    TEST(CompareResultTest, ComparesAcrossLayouts)
+    {
+        uint32_t m = 7, n = 3;
+        auto     a = makeMatrix(m, n);
+        auto     b = transpose(a, m, n);
+
+        auto result
+            = compareEqualHost<float, float, row_major, col_major>(a.data(), b.data(), m, n);
+        EXPECT_TRUE(result.passed);
+
+        b[2 * m + 5] = -b[2 * m + 5] + 3.0f; // (5, 2) in col_major
+        result = compareEqualHost<float, float, row_major, col_major>(a.data(), b.data(), m, n);
+        EXPECT_FALSE(result.passed);
+        EXPECT_EQ(result.failRow, 5u);
+        EXPECT_EQ(result.failCol, 2u);
+    }
+
+    TEST(CompareResultTest, RespectsLeadingDimensions)
+    {
+        uint32_t m = 4, n = 4, ld = 6;
+
+        // Padding holds garbage that must not be compared
+        std::vector<float> a(m * ld, 0.0f), b(m * ld, 1000.0f);
+        for(uint32_t i = 0; i < m; ++i)
+        {
+            for(uint32_t j = 0; j < n; ++j)
+            {
+                a[i * ld + j] = b[i * ld + j] = static_cast<float>(i * n + j);
+            }
+        }
+
+        auto result = compareEqualHost<float, float, row_major, row_major>(
+            a.data(), b.data(), m, n, ld, ld);
+        EXPECT_TRUE(result.passed);
+    }
+
+    TEST(CompareResultTest, FlagsNaN)
+    {
+        auto a = makeMatrix(4, 4);
+        auto b = a;
+        b[9]   = std::numeric_limits<float>::quiet_NaN();
+
+        auto result
+            = compareEqualHost<float, float, row_major, row_major>(a.data(), b.data(), 4, 4);
+
+        EXPECT_FALSE(result.passed);
+        EXPECT_TRUE(result.hasNaN);
+        EXPECT_FALSE(result.hasInf);
+        EXPECT_TRUE(std::isnan(result.maxRelativeError));
+        EXPECT_EQ(result.failRow, 2u);
+        EXPECT_EQ(result.failCol, 1u);
+    }
+
+    TEST(CompareResultTest, FlagsInf)
+    {
+        auto a = makeMatrix(4, 4);
+        auto b = a;
+        a[3]   = std::numeric_limits<float>::infinity();
+        b[3]   = std::numeric_limits<float>::infinity();
+        b[12]  = std::numeric_limits<float>::quiet_NaN();
+
+        auto result
+            = compareEqualHost<float, float, row_major, row_major>(a.data(), b.data(), 4, 4);
+
+        EXPECT_FALSE(result.passed);
+        EXPECT_TRUE(result.hasInf);
+        EXPECT_TRUE(result.hasNaN);
+        EXPECT_TRUE(std::isinf(result.maxRelativeError));
+        EXPECT_EQ(result.failRow, 0u);
+        EXPECT_EQ(result.failCol, 3u);
+    }
+
+    TEST(CompareResultTest, MergeIsOrderIndependent)
+    {
+        // Device workgroups merge partials in arbitrary order
+        uint32_t n         = 16;
+        auto     a         = makeMatrix(16, n);
+        auto     b         = a;
+        double   threshold = compareThreshold<float>(10.0);
+        b[200] += 0.5f;
+        b[37] += 2.0f;
+        b[90] += 0.25f;
+
+        std::vector<CompareAccumulator> partials(8, compareAccumulatorInit());
+        for(uint32_t i = 0; i < a.size(); ++i)
+        {
+            compareAccumulate(partials[i % partials.size()], i, a[i], b[i], threshold);
+        }
+
+        auto forward = compareAccumulatorInit();
+        for(auto const& partial : partials)
+        {
+            compareMerge(forward, partial);
+        }
+
+        auto reverse = compareAccumulatorInit();
+        for(auto it = partials.rbegin(); it != partials.rend(); ++it)
+        {
+            compareMerge(reverse, *it);
+        }
+
+        auto expected = compareEqualHost<float, float, row_major, row_major>(
+            a.data(), b.data(), 16, n);
+        for(auto const& acc : {forward, reverse})
+        {
+            auto result = compareFinalize(acc, n);
+            EXPECT_EQ(result.passed, expected.passed);
+            EXPECT_EQ(result.maxRelativeError, expected.maxRelativeError);
+            EXPECT_EQ(result.failRow, 2u);
+            EXPECT_EQ(result.failCol, 5u);
+        }
+    }
+
+    TEST(CompareResultTest, ComparesComplexByModulus)
+    {
+        uint32_t m = 4, n = 5;
+        auto     re = makeMatrix(m, n);
+
+        std::vector<complex_t<float>> a(m * n);
+        for(uint32_t i = 0; i < m * n; ++i)
+        {
+            a[i] = complex_t<float>(re[i], -2.0f * re[i]);
+        }
+        auto b = a;
+
+        auto result = compareEqualHost<complex_t<float>, complex_t<float>, row_major, row_major>(
+            a.data(), b.data(), m, n);
+        EXPECT_TRUE(result.passed);
+        EXPECT_EQ(result.maxRelativeError, 0.0);
+
+        // A mismatch in the imaginary part alone fails.
+        // |a - b| / (|a| + |b| + 1) with |a| = |b| = 5
+        a[1 * n + 2] = complex_t<float>(3.0f, 4.0f);
+        b[1 * n + 2] = complex_t<float>(3.0f, -4.0f);
+
+        result = compareEqualHost<complex_t<float>, complex_t<float>, row_major, row_major>(
+            a.data(), b.data(), m, n);
+        EXPECT_FALSE(result.passed);
+        EXPECT_EQ(result.failRow, 1u);
+        EXPECT_EQ(result.failCol, 2u);
+        EXPECT_NEAR(result.maxRelativeError, 8.0 / 11.0, 1.0e-12);
+    }
+
+} // namespace rocwmma
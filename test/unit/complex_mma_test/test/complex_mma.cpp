@@ -0,0 +1,263 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdint>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/complex.hpp>
+
+namespace rocwmma
+{
+    namespace
+    {
+        using detail::ComplexMma;
+        using detail::ElementwiseOps;
+
+        // Host stand-in for a fragment: a Size x Size block of DataT
+        template <typename DataT, uint32_t Size>
+        struct Block
+        {
+            constexpr static uint32_t num_elements = Size * Size;
+            using element_type                     = DataT;
+
+            DataT&       operator[](uint32_t i)
+            {
+                return data[i];
+            }
+            DataT const& operator[](uint32_t i) const
+            {
+                return data[i];
+            }
+
+            DataT data[num_elements];
+        };
+
+        constexpr uint32_t Size = 8u;
+
+        using BlockT   = Block<float32_t, Size>;
+        using ComplexT = complex_t<float64_t>;
+
+        // Real mma d = a * b + c over row-major blocks. d may alias c.
+        struct BlockMma
+        {
+            void operator()(BlockT& d, BlockT const& a, BlockT const& b, BlockT const& c)
+            {
+                BlockT result;
+                for(uint32_t i = 0u; i < Size; i++)
+                {
+                    for(uint32_t j = 0u; j < Size; j++)
+                    {
+                        auto accum = c[i * Size + j];
+                        for(uint32_t k = 0u; k < Size; k++)
+                        {
+                            accum += a[i * Size + k] * b[k * Size + j];
+                        }
+                        result[i * Size + j] = accum;
+                    }
+                }
+                d = result;
+                count++;
+            }
+
+            uint32_t& count;
+        };
+
+        struct ComplexBlock
+        {
+            BlockT real;
+            BlockT imag;
+        };
+
+        // Small integers keep every product and sum exact in float32_t
+        ComplexBlock randomBlock(std::mt19937& gen)
+        {
+            std::uniform_int_distribution<int32_t> dist(-4, 4);
+
+            ComplexBlock result;
+            for(uint32_t i = 0u; i < BlockT::num_elements; i++)
+            {
+                result.real[i] = static_cast<float32_t>(dist(gen));
+                result.imag[i] = static_cast<float32_t>(dist(gen));
+            }
+            return result;
+        }
+
+        ComplexT element(ComplexBlock const& x, uint32_t i)
+        {
+            return ComplexT(x.real[i], x.imag[i]);
+        }
+
+        // Complex reference D = A * B + C
+        void referenceMma(ComplexBlock&       d,
+                          ComplexBlock const& a,
+                          ComplexBlock const& b,
+                          ComplexBlock const& c)
+        {
+            for(uint32_t i = 0u; i < Size; i++)
+            {
+                for(uint32_t j = 0u; j < Size; j++)
+                {
+                    auto accum = element(c, i * Size + j);
+                    for(uint32_t k = 0u; k < Size; k++)
+                    {
+                        accum += element(a, i * Size + k) * element(b, k * Size + j);
+                    }
+                    d.real[i * Size + j] = static_cast<float32_t>(accum.real);
+                    d.imag[i * Size + j] = static_cast<float32_t>(accum.imag);
+                }
+            }
+        }
+
+        template <typename AlgoT>
+        uint32_t complexMma(ComplexBlock&       d,
+                            ComplexBlock const& a,
+                            ComplexBlock const& b,
+                            ComplexBlock const& c)
+        {
+            uint32_t count = 0u;
+            ComplexMma<AlgoT>::template exec<ElementwiseOps>(d.real,
+                                                             d.imag,
+                                                             a.real,
+                                                             a.imag,
+                                                             b.real,
+                                                             b.imag,
+                                                             c.real,
+                                                             c.imag,
+                                                             BlockMma{count});
+            return count;
+        }
+
+        void expectEqual(ComplexBlock const& result, ComplexBlock const& expected)
+        {
+            for(uint32_t i = 0u; i < BlockT::num_elements; i++)
+            {
+                EXPECT_EQ(result.real[i], expected.real[i]) << "real " << i;
+                EXPECT_EQ(result.imag[i], expected.imag[i]) << "imag " << i;
+            }
+        }
+
+        template <typename AlgoT>
+        void testMatchesReference()
+        {
+            std::mt19937 gen(41u);
+            for(uint32_t trial = 0u; trial < 8u; trial++)
+            {
+                auto a = randomBlock(gen);
+                auto b = randomBlock(gen);
+                auto c = randomBlock(gen);
+
+                ComplexBlock result, expected;
+                referenceMma(expected, a, b, c);
+
+                auto count = complexMma<AlgoT>(result, a, b, c);
+                EXPECT_EQ(count, ComplexMma<AlgoT>::MmaCount);
+                expectEqual(result, expected);
+            }
+        }
+
+        template <typename AlgoT>
+        void testAccumulateInPlace()
+        {
+            std::mt19937 gen(7u);
+            auto         a = randomBlock(gen);
+            auto         b = randomBlock(gen);
+            auto         c = randomBlock(gen);
+
+            ComplexBlock expected;
+            referenceMma(expected, a, b, c);
+
+            // c = d is valid
+            complexMma<AlgoT>(c, a, b, c);
+            expectEqual(c, expected);
+        }
+
+    } // namespace
+
+    TEST(ComplexMmaTest, ComplexArithmetic)
+    {
+        constexpr auto x = complex_t<float32_t>(1.0f, 2.0f);
+        constexpr auto y = complex_t<float32_t>(3.0f, -4.0f);
+
+        static_assert(x * y == complex_t<float32_t>(11.0f, 2.0f));
+        static_assert(x + y == complex_t<float32_t>(4.0f, -2.0f));
+        static_assert(x - y == complex_t<float32_t>(-2.0f, 6.0f));
+        static_assert(-x == complex_t<float32_t>(-1.0f, -2.0f));
+        static_assert(complex_t<float64_t>(x) == complex_t<float64_t>(1.0, 2.0));
+
+        // Interleaved layout of std::complex
+        static_assert(sizeof(complex_float32_t) == 2u * sizeof(float32_t));
+        static_assert(sizeof(complex_float64_t) == 2u * sizeof(float64_t));
+
+        auto accum = complex_t<float32_t>(0.5f);
+        accum += y;
+        EXPECT_EQ(accum, complex_t<float32_t>(3.5f, -4.0f));
+    }
+
+    TEST(ComplexMmaTest, FourMultiplyMatchesReference)
+    {
+        testMatchesReference<complex_mma_4m>();
+    }
+
+    TEST(ComplexMmaTest, GaussMatchesReference)
+    {
+        testMatchesReference<complex_mma_3m>();
+    }
+
+    TEST(ComplexMmaTest, FourMultiplyAccumulatesInPlace)
+    {
+        testAccumulateInPlace<complex_mma_4m>();
+    }
+
+    TEST(ComplexMmaTest, GaussAccumulatesInPlace)
+    {
+        testAccumulateInPlace<complex_mma_3m>();
+    }
+
+    TEST(ComplexMmaTest, ElementwiseOps)
+    {
+        BlockT x, y;
+        for(uint32_t i = 0u; i < BlockT::num_elements; i++)
+        {
+            x[i] = static_cast<float32_t>(i);
+            y[i] = static_cast<float32_t>(2u * i + 1u);
+        }
+
+        auto zero = ElementwiseOps::zero<BlockT>();
+        auto neg  = ElementwiseOps::neg(x);
+        auto sum  = ElementwiseOps::add(x, y);
+        auto diff = ElementwiseOps::sub(x, y);
+        for(uint32_t i = 0u; i < BlockT::num_elements; i++)
+        {
+            EXPECT_EQ(zero[i], 0.0f);
+            EXPECT_EQ(neg[i], -x[i]);
+            EXPECT_EQ(sum[i], x[i] + y[i]);
+            EXPECT_EQ(diff[i], x[i] - y[i]);
+        }
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,308 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "conv_global_mapping.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        // n, c, h, w, k, r, s, strideH, strideW, padH, padW, dilationH, dilationW, groups
+        const std::vector<ConvProblem> problems = {
+            {2u, 8u, 6u, 6u, 4u, 3u, 3u, 1u, 1u, 1u, 1u, 1u, 1u, 1u}, // 3x3, same padding
+            {1u, 4u, 7u, 9u, 6u, 3u, 2u, 2u, 3u, 1u, 0u, 1u, 1u, 1u}, // strides, uneven pads
+            {2u, 4u, 9u, 8u, 4u, 3u, 3u, 1u, 1u, 2u, 2u, 2u, 2u, 1u}, // dilation
+            {1u, 8u, 5u, 5u, 6u, 3u, 3u, 2u, 1u, 1u, 1u, 1u, 2u, 2u}, // grouped
+            {3u, 6u, 4u, 4u, 6u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 6u}, // depthwise 1x1
+        };
+
+        // Deterministic small values, distinct per element
+        std::vector<int64_t> tensor(uint64_t elements, int64_t seed)
+        {
+            std::vector<int64_t> values(elements);
+            for(uint64_t i = 0u; i < elements; i++)
+            {
+                values[i] = static_cast<int64_t>((i * 7u + seed) % 13u) - 6;
+            }
+            return values;
+        }
+
+        // Direct convolution, independent of the implicit GEMM mapping
+        template <typename LayoutT>
+        std::vector<int64_t> directConv(ConvProblem const&          p,
+                                        std::vector<int64_t> const& input,
+                                        std::vector<int64_t> const& filter)
+        {
+            using Tensor = ConvTensorLayout<LayoutT>;
+
+            std::vector<int64_t> output(p.outputElements(), 0);
+            for(uint32_t n = 0u; n < p.n; n++)
+            {
+                for(uint32_t k = 0u; k < p.k; k++)
+                {
+                    auto group = k / p.groupK();
+                    for(uint32_t y = 0u; y < p.outH(); y++)
+                    {
+                        for(uint32_t x = 0u; x < p.outW(); x++)
+                        {
+                            int64_t accum = 0;
+                            for(uint32_t c = 0u; c < p.groupC(); c++)
+                            {
+                                for(uint32_t r = 0u; r < p.r; r++)
+                                {
+                                    for(uint32_t s = 0u; s < p.s; s++)
+                                    {
+                                        int64_t inY = int64_t(y * p.strideH + r * p.dilationH)
+                                                      - int64_t(p.padH);
+                                        int64_t inX = int64_t(x * p.strideW + s * p.dilationW)
+                                                      - int64_t(p.padW);
+                                        if(inY < 0 || inX < 0 || inY >= p.h || inX >= p.w)
+                                        {
+                                            continue;
+                                        }
+                                        accum += input[Tensor::input(p,
+                                                                     n,
+                                                                     group * p.groupC() + c,
+                                                                     uint32_t(inY),
+                                                                     uint32_t(inX))]
+                                                 * filter[Tensor::filter(p, k, c, r, s)];
+                                    }
+                                }
+                            }
+                            output[Tensor::output(p, n, k, y, x)] = accum;
+                        }
+                    }
+                }
+            }
+            return output;
+        }
+
+        // Implicit GEMM of each group through the mapping
+        template <typename LayoutT>
+        std::vector<int64_t> implicitGemmConv(ConvProblem const&          p,
+                                              std::vector<int64_t> const& input,
+                                              std::vector<int64_t> const& filter)
+        {
+            using Mapping = ConvGlobalMapping<LayoutT>;
+
+            std::vector<int64_t> output(p.outputElements(), 0);
+            for(uint32_t g = 0u; g < p.groups; g++)
+            {
+                for(uint32_t row = 0u; row < Mapping::gemmM(p); row++)
+                {
+                    for(uint32_t col = 0u; col < Mapping::gemmN(p); col++)
+                    {
+                        int64_t accum = 0;
+                        for(uint32_t kIdx = 0u; kIdx < Mapping::gemmK(p); kIdx++)
+                        {
+                            auto a = Mapping::inputOffset(p, g, row, kIdx);
+                            if(a >= 0)
+                            {
+                                accum += input[a] * filter[Mapping::filterOffset(p, g, kIdx, col)];
+                            }
+                        }
+                        output[Mapping::outputOffset(p, g, row, col)] = accum;
+                    }
+                }
+            }
+            return output;
+        }
+
+        template <typename LayoutT>
+        void checkImplicitGemm(ConvProblem const& p)
+        {
+            ASSERT_TRUE(p.isValid());
+
+            auto input  = tensor(p.inputElements(), 1);
+            auto filter = tensor(p.filterElements(), 5);
+
+            EXPECT_EQ(directConv<LayoutT>(p, input, filter),
+                      implicitGemmConv<LayoutT>(p, input, filter));
+        }
+
+        // Filter offsets are the filter tensor element of the tap, and the
+        // K order walks the group's filter slice contiguously.
+        template <typename LayoutT>
+        void checkFilterOffsets(ConvProblem const& p)
+        {
+            using Mapping = ConvGlobalMapping<LayoutT>;
+            using Tensor  = ConvTensorLayout<LayoutT>;
+
+            for(uint32_t g = 0u; g < p.groups; g++)
+            {
+                for(uint32_t col = 0u; col < Mapping::gemmN(p); col++)
+                {
+                    for(uint32_t kIdx = 0u; kIdx < Mapping::gemmK(p); kIdx++)
+                    {
+                        auto tap = Mapping::tapCoord(p, kIdx);
+                        ASSERT_EQ(Mapping::filterOffset(p, g, kIdx, col),
+                                  Tensor::filter(p, g * p.groupK() + col, tap.c, tap.r, tap.s));
+                    }
+                }
+            }
+        }
+
+        // Outputs of all groups tile the output tensor exactly once
+        template <typename LayoutT>
+        void checkOutputOffsets(ConvProblem const& p)
+        {
+            using Mapping = ConvGlobalMapping<LayoutT>;
+
+            std::vector<uint32_t> hits(p.outputElements(), 0u);
+            for(uint32_t g = 0u; g < p.groups; g++)
+            {
+                for(uint32_t row = 0u; row < Mapping::gemmM(p); row++)
+                {
+                    for(uint32_t col = 0u; col < Mapping::gemmN(p); col++)
+                    {
+                        auto offset = Mapping::outputOffset(p, g, row, col);
+                        ASSERT_LT(offset, p.outputElements());
+                        hits[offset]++;
+                    }
+                }
+            }
+            EXPECT_EQ(hits, std::vector<uint32_t>(p.outputElements(), 1u));
+        }
+
+    } // namespace
+
+    TEST(ConvMappingTest, OutputSizes)
+    {
+        // 3x3, pad 1: same size
+        ConvProblem same = {1u, 1u, 8u, 8u, 1u, 3u, 3u, 1u, 1u, 1u, 1u, 1u, 1u, 1u};
+        EXPECT_EQ(same.outH(), 8u);
+        EXPECT_EQ(same.outW(), 8u);
+
+        // Stride 2 rounds down
+        ConvProblem strided = {1u, 1u, 9u, 8u, 1u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 1u, 1u};
+        EXPECT_EQ(strided.outH(), 5u);
+        EXPECT_EQ(strided.outW(), 4u);
+
+        // Dilation 2 spans 5 x 5
+        ConvProblem dilated = {1u, 1u, 9u, 9u, 1u, 3u, 3u, 1u, 1u, 0u, 0u, 2u, 2u, 1u};
+        EXPECT_EQ(dilated.outH(), 5u);
+        EXPECT_EQ(dilated.outW(), 5u);
+
+        // Dilated filter larger than the padded input
+        ConvProblem tooBig = {1u, 1u, 4u, 4u, 1u, 3u, 3u, 1u, 1u, 0u, 0u, 2u, 2u, 1u};
+        EXPECT_FALSE(tooBig.isValid());
+
+        // Channels must split evenly into groups
+        ConvProblem uneven = {1u, 6u, 4u, 4u, 4u, 1u, 1u, 1u, 1u, 0u, 0u, 1u, 1u, 4u};
+        EXPECT_FALSE(uneven.isValid());
+    }
+
+    TEST(ConvMappingTest, GemmSizes)
+    {
+        ConvProblem p = {2u, 8u, 5u, 5u, 6u, 3u, 3u, 2u, 1u, 1u, 1u, 1u, 1u, 2u};
+        EXPECT_EQ(ConvGlobalMapping<nhwc>::gemmM(p), 2u * 3u * 5u);
+        EXPECT_EQ(ConvGlobalMapping<nhwc>::gemmN(p), 3u);
+        EXPECT_EQ(ConvGlobalMapping<nhwc>::gemmK(p), 4u * 3u * 3u);
+        EXPECT_EQ(ConvGlobalMapping<nchw>::filterLd(p), 4u * 3u * 3u);
+    }
+
+    TEST(ConvMappingTest, TapOrder)
+    {
+        ConvProblem p = {1u, 4u, 5u, 5u, 1u, 3u, 2u, 1u, 1u, 0u, 0u, 1u, 1u, 1u};
+
+        // nhwc walks channels fastest, nchw filter columns
+        auto nhwcTap = ConvGlobalMapping<nhwc>::tapCoord(p, 1u * 2u * 4u + 1u * 4u + 3u);
+        EXPECT_EQ(nhwcTap.c, 3u);
+        EXPECT_EQ(nhwcTap.r, 1u);
+        EXPECT_EQ(nhwcTap.s, 1u);
+
+        auto nchwTap = ConvGlobalMapping<nchw>::tapCoord(p, 3u * 3u * 2u + 2u * 2u + 1u);
+        EXPECT_EQ(nchwTap.c, 3u);
+        EXPECT_EQ(nchwTap.r, 2u);
+        EXPECT_EQ(nchwTap.s, 1u);
+    }
+
+    TEST(ConvMappingTest, PaddingTaps)
+    {
+        ConvProblem p = {1u, 1u, 4u, 4u, 1u, 3u, 3u, 1u, 1u, 1u, 1u, 1u, 1u, 1u};
+        using Mapping = ConvGlobalMapping<nhwc>;
+
+        // Output (0, 0): the top row and left column of taps are padding
+        for(uint32_t kIdx = 0u; kIdx < Mapping::gemmK(p); kIdx++)
+        {
+            auto tap     = Mapping::tapCoord(p, kIdx);
+            auto padding = tap.r == 0u || tap.s == 0u;
+            EXPECT_EQ(Mapping::inputOffset(p, 0u, 0u, kIdx) < 0, padding) << "kIdx " << kIdx;
+        }
+
+        // Output (3, 3): the bottom row and right column of taps are padding
+        auto last = Mapping::gemmM(p) - 1u;
+        for(uint32_t kIdx = 0u; kIdx < Mapping::gemmK(p); kIdx++)
+        {
+            auto tap     = Mapping::tapCoord(p, kIdx);
+            auto padding = tap.r == 2u || tap.s == 2u;
+            EXPECT_EQ(Mapping::inputOffset(p, 0u, last, kIdx) < 0, padding) << "kIdx " << kIdx;
+        }
+
+        // Centre tap of output (1, 2) is input (1, 2)
+        EXPECT_EQ(Mapping::inputOffset(p, 0u, 1u * 4u + 2u, 4u), 1 * 4 + 2);
+    }
+
+    TEST(ConvMappingTest, FilterOffsets)
+    {
+        for(auto const& p : problems)
+        {
+            checkFilterOffsets<nhwc>(p);
+            checkFilterOffsets<nchw>(p);
+        }
+    }
+
+    TEST(ConvMappingTest, OutputOffsets)
+    {
+        for(auto const& p : problems)
+        {
+            checkOutputOffsets<nhwc>(p);
+            checkOutputOffsets<nchw>(p);
+        }
+    }
+
+    TEST(ConvMappingTest, ImplicitGemmNhwc)
+    {
+        for(auto const& p : problems)
+        {
+            checkImplicitGemm<nhwc>(p);
+        }
+    }
+
+    TEST(ConvMappingTest, ImplicitGemmNchw)
+    {
+        for(auto const& p : problems)
+        {
+            checkImplicitGemm<nchw>(p);
+        }
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,215 @@
+// Generated by rocWMMA GemmJit. Do not edit.
+// float32_t_float32_t_float32_t col_major_row_major_col_major_col_major M=128 N=128 K=8192 on gfx942
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "gemm_config.hpp"
+#include "kernel_predicates.hpp"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    namespace GemmJitKernel
+    {
+        // Problem constants
+        constexpr uint32_t M   = 128u;
+        constexpr uint32_t N   = 128u;
+        constexpr uint32_t K   = 8192u;
+        constexpr uint32_t Lda = 128u;
+        constexpr uint32_t Ldb = 128u;
+        constexpr uint32_t Ldc = 128u;
+        constexpr uint32_t Ldd = 128u;
+
+        constexpr bool AlphaZero = false;
+        constexpr bool BetaZero  = true;
+
+        // GemmDriver configuration
+        constexpr uint32_t BlockM  = 32u;
+        constexpr uint32_t BlockN  = 32u;
+        constexpr uint32_t BlockK  = 8u;
+        constexpr uint32_t BlocksX = 2u;
+        constexpr uint32_t BlocksY = 2u;
+        constexpr uint32_t TBlockX = 128u;
+        constexpr uint32_t TBlockY = 2u;
+
+        using InputT   = float32_t;
+        using OutputT  = float32_t;
+        using ComputeT = float32_t;
+
+        using LayoutA   = col_major;
+        using LayoutB   = row_major;
+        using LayoutC   = col_major;
+        using LayoutD   = col_major;
+        using LayoutLds = col_major;
+
+        using GemmConfig = CooperativeGemm::WorkgroupLevel::LdsNT;
+
+        using Guard = gemm_PGR1_LB2_MP0_MB_CP_guard<BlockM,
+                                                    BlockN,
+                                                    BlockK,
+                                                    InputT,
+                                                    OutputT,
+                                                    ComputeT,
+                                                    LayoutA,
+                                                    LayoutB,
+                                                    LayoutC,
+                                                    LayoutD,
+                                                    LayoutLds,
+                                                    GemmConfig,
+                                                    BlocksX,
+                                                    BlocksY,
+                                                    TBlockX,
+                                                    TBlockY,
+                                                    Constants::AMDGCN_WAVE_SIZE,
+                                                    Constants::AMDGCN_CURRENT_ARCH_ID>;
+
+        static_assert(Guard::enableBuild(), "GemmJit configuration is not supported on target");
+
+        using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                          BlockN,
+                                                                          BlockK,
+                                                                          InputT,
+                                                                          OutputT,
+                                                                          ComputeT,
+                                                                          LayoutA,
+                                                                          LayoutB,
+                                                                          LayoutC,
+                                                                          LayoutD,
+                                                                          BlocksX,
+                                                                          BlocksY,
+                                                                          TBlockX,
+                                                                          TBlockY>;
+
+        using LdsMapping     = typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+        using CoopSchedulerA = typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+        using CoopSchedulerB = typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+        using GemmDriver     = typename GemmConfig::
+            template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+        using DataMappingA   = GetDataLayout_t<typename GlobalMapping::MfmaFragA>;
+        using DataMappingB   = GetDataLayout_t<typename GlobalMapping::MfmaFragB>;
+        using DataMappingC   = GetDataLayout_t<typename GlobalMapping::MfmaFragC>;
+        using DataMappingD   = GetDataLayout_t<typename GlobalMapping::MfmaFragD>;
+        using DataMappingLds = typename LdsMapping::DataLayout;
+
+    } // namespace GemmJitKernel
+} // namespace rocwmma
+
+// Grid is exactly 1 x 1 macro tiles, so no bounds checks are needed.
+extern "C" __global__ void __launch_bounds__(256)
+    rocwmma_jit_gemm(rocwmma::GemmJitKernel::InputT const*  a,
+                   rocwmma::GemmJitKernel::InputT const*  b,
+                   rocwmma::GemmJitKernel::OutputT const* c,
+                   rocwmma::GemmJitKernel::OutputT*       d,
+                   rocwmma::GemmJitKernel::ComputeT       alpha,
+                   rocwmma::GemmJitKernel::ComputeT       beta)
+{
+    using namespace rocwmma;
+    using namespace rocwmma::GemmJitKernel;
+
+    ///
+    /// Initialize accumulation frags
+    ///
+    typename GlobalMapping::MfmaBuffAcc fragsAcc;
+    GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
+
+    if constexpr(!AlphaZero)
+    {
+        ///
+        /// Setup global addressing offsets in 1D
+        ///
+        auto globalReadOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(), Lda);
+        auto globalReadOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(), Ldb);
+        auto kStepOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), Lda);
+        auto kStepOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), Ldb);
+
+        ///
+        /// Start global prefetch
+        ///
+        typename GlobalMapping::GRBuffA grBuffA;
+        typename GlobalMapping::GRBuffB grBuffB;
+        GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, Lda);
+        GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, Ldb);
+        globalReadOffsetA += kStepOffsetA;
+        globalReadOffsetB += kStepOffsetB;
+
+        ///
+        /// Setup LDS addressing: 2 LDS blocks for pipelining
+        ///
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto  sizeLds  = LdsMapping::sizeLds();
+        auto* ldsPtrLo = reinterpret_cast<InputT*>(localMemPtr);
+        auto* ldsPtrHi = ldsPtrLo + get<0>(sizeLds) * get<1>(sizeLds);
+
+        auto ldlds = LdsMapping::ldLds();
+        auto ldsWriteOffsetA = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordA(), ldlds);
+        auto ldsWriteOffsetB = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordB(), ldlds);
+        auto ldsReadOffsetA  = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordA(), ldlds);
+        auto ldsReadOffsetB  = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordB(), ldlds);
+
+        ///
+        /// Write prefetch to local
+        ///
+        GemmDriver::localWriteCoopA(ldsPtrLo + ldsWriteOffsetA, grBuffA, ldlds);
+        GemmDriver::localWriteCoopB(ldsPtrLo + ldsWriteOffsetB, grBuffB, ldlds);
+        GemmDriver::syncWorkgroup();
+
+        ///
+        /// Accumulate A * B: 1023 steady-state iterations
+        ///
+#pragma unroll 8
+        for(uint32_t currentK = BlockK; currentK < K; currentK += BlockK)
+        {
+            typename GlobalMapping::MfmaBuffA fragsA;
+            typename GlobalMapping::MfmaBuffB fragsB;
+
+            GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
+            GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
+
+            GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, Lda);
+            GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, Ldb);
+            globalReadOffsetA += kStepOffsetA;
+            globalReadOffsetB += kStepOffsetB;
+
+            GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+
+            GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldlds);
+            GemmDriver::localWriteCoopB(ldsPtrHi + ldsWriteOffsetB, grBuffB, ldlds);
+            GemmDriver::syncWorkgroup();
+
+            auto* tmp = ldsPtrLo;
+            ldsPtrLo  = ldsPtrHi;
+            ldsPtrHi  = tmp;
+        }
+
+        ///
+        /// Clean up tail A * B
+        ///
+        typename GlobalMapping::MfmaBuffA fragsA;
+        typename GlobalMapping::MfmaBuffB fragsB;
+        GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
+        GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
+        GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+    }
+
+    ///
+    /// D = alpha * accum + beta * C
+    ///
+    typename GlobalMapping::MfmaBuffC fragsC;
+    if constexpr(BetaZero)
+    {
+        GemmDriver::fill(fragsC, static_cast<OutputT>(0));
+    }
+    else
+    {
+        auto globalReadOffsetC = DataMappingC::fromMatrixCoord(GlobalMapping::readCoordC(), Ldc);
+        GemmDriver::globalReadC(fragsC, c + globalReadOffsetC, Ldc);
+    }
+
+    typename GlobalMapping::MfmaBuffD fragsD;
+    auto globalWriteOffsetD = DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(), Ldd);
+    GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+    GemmDriver::globalWriteD(d + globalWriteOffsetD, fragsD, Ldd);
+}
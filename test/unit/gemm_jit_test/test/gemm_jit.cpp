@@ -0,0 +1,414 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hiprtc.h>
+
+#include "gemm_jit.hpp"
+#include "hiprtc_cache.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        GemmJit::Problem makeProblem(uint32_t           m,
+                                     uint32_t           n,
+                                     uint32_t           k,
+                                     std::string const& inputT,
+                                     std::string const& arch)
+        {
+            GemmJit::Problem problem;
+            problem.m        = m;
+            problem.n        = n;
+            problem.k        = k;
+            problem.inputT   = inputT;
+            problem.outputT  = inputT;
+            problem.computeT = "float32_t";
+            problem.layoutA  = "col_major";
+            problem.layoutB  = "row_major";
+            problem.layoutC  = "col_major";
+            problem.layoutD  = "col_major";
+            problem.arch     = arch;
+            problem.setPackedLeadingDims();
+            return problem;
+        }
+
+        // Compare against a checked-in golden source.
+        // Set ROCWMMA_UPDATE_GOLDEN=1 to regenerate after intended changes.
+        void expectGolden(std::string const& name, std::string const& source)
+        {
+            auto path = std::string(ROCWMMA_GEMM_JIT_GOLDEN_DIR) + "/" + name + ".cpp";
+            if(std::getenv("ROCWMMA_UPDATE_GOLDEN") != nullptr)
+            {
+                std::ofstream(path, std::ios::binary) << source;
+            }
+
+            std::ifstream file(path, std::ios::binary);
+            ASSERT_TRUE(file.good()) << "Missing golden file " << path;
+
+            std::stringstream golden;
+            golden << file.rdbuf();
+            EXPECT_EQ(golden.str(), source) << "Generated source differs from " << path;
+        }
+
+        // Compile the generated program with its own options through the offline
+        // HIP compiler. hiprtc spellings are mapped to their clang equivalents.
+        void expectCompiles(std::string const& name, GemmJit::Program const& program)
+        {
+#if defined(ROCWMMA_GEMM_JIT_COMPILER)
+            auto path = ::testing::TempDir() + name + ".hip";
+            std::ofstream(path, std::ios::binary) << program.source;
+
+            std::string const archOption = "--gpu-architecture=";
+
+            std::stringstream command;
+            command << ROCWMMA_GEMM_JIT_COMPILER << " -x hip -fsyntax-only";
+            for(auto const& option : program.options)
+            {
+                if(option.rfind(archOption, 0) == 0)
+                {
+                    command << " --offload-arch=" << option.substr(archOption.size());
+                }
+                else
+                {
+                    command << " '" << option << "'";
+                }
+            }
+            command << " '" << path << "'";
+
+            EXPECT_EQ(std::system(command.str().c_str()), 0) << "Failed: " << command.str();
+#else
+            (void)name;
+            (void)program;
+            GTEST_SKIP() << "No HIP compiler configured for the generated sources";
+#endif // defined(ROCWMMA_GEMM_JIT_COMPILER)
+        }
+
+        // Compile the checked-in golden through hipRTC with the generated options.
+        // The offline check above uses the full HIP headers, so it cannot catch
+        // includes that only the runtime compiler fails to resolve.
+        void expectRtcCompiles(std::string const&      name,
+                               std::string const&      arch,
+                               GemmJit::Program const& program)
+        {
+            int deviceCount = 0;
+            if(hipGetDeviceCount(&deviceCount) != hipSuccess || deviceCount == 0)
+            {
+                GTEST_SKIP() << "No device available for hipRTC";
+            }
+
+            auto          path = std::string(ROCWMMA_GEMM_JIT_GOLDEN_DIR) + "/" + name + ".cpp";
+            std::ifstream file(path, std::ios::binary);
+            ASSERT_TRUE(file.good()) << "Missing golden file " << path;
+
+            std::stringstream golden;
+            golden << file.rdbuf();
+            ASSERT_EQ(golden.str(), program.source) << "Generated source differs from " << path;
+
+            int major = 0, minor = 0;
+            ASSERT_EQ(hiprtcVersion(&major, &minor), HIPRTC_SUCCESS);
+
+            CodeObjectKey key{golden.str(),
+                              program.options,
+                              arch,
+                              "hiprtc-" + std::to_string(major) + "." + std::to_string(minor)};
+
+            // Fresh cache: entries are not keyed on header contents
+            auto cacheDir = std::filesystem::path(::testing::TempDir()) / ("rocwmma_jit_" + name);
+            std::error_code ec;
+            std::filesystem::remove_all(cacheDir, ec);
+            CodeObjectCache cache(cacheDir);
+
+            std::string log;
+            auto        compiler = [&log, &name](CodeObjectKey const& key) {
+                CodeObjectCache::CodeT code;
+
+                hiprtcProgram prog;
+                if(hiprtcCreateProgram(
+                       &prog, key.source.c_str(), (name + ".cpp").c_str(), 0, nullptr, nullptr)
+                   != HIPRTC_SUCCESS)
+                {
+                    log = "hiprtcCreateProgram failed";
+                    return code;
+                }
+
+                std::vector<char const*> opts;
+                for(auto const& option : key.options)
+                {
+                    opts.push_back(option.c_str());
+                }
+
+                auto result = hiprtcCompileProgram(prog, opts.size(), opts.data());
+
+                size_t logSize = 0;
+                if(hiprtcGetProgramLogSize(prog, &logSize) == HIPRTC_SUCCESS && logSize > 0)
+                {
+                    log.resize(logSize);
+                    hiprtcGetProgramLog(prog, &log[0]);
+                }
+
+                size_t codeSize = 0;
+                if(result == HIPRTC_SUCCESS
+                   && hiprtcGetCodeSize(prog, &codeSize) == HIPRTC_SUCCESS)
+                {
+                    code.resize(codeSize);
+                    hiprtcGetCode(prog, code.data());
+                }
+                else
+                {
+                    log = std::string(hiprtcGetErrorString(result)) + "\n" + log;
+                }
+
+                hiprtcDestroyProgram(&prog);
+                return code;
+            };
+
+            auto code = cache.getOrCompile(key, compiler);
+            ASSERT_FALSE(code.empty()) << "hipRTC failed for " << path << ":\n" << log;
+
+            // Published code object is served back without recompiling
+            EXPECT_EQ(cache.getOrCompile(key, compiler), code);
+            EXPECT_EQ(cache.stats().misses, 1u);
+            EXPECT_EQ(cache.stats().hits, 1u);
+        }
+
+        std::vector<std::string> compileIncludeDirs()
+        {
+#if defined(ROCWMMA_GEMM_JIT_INCLUDE_DIRS)
+            std::vector<std::string> dirs;
+            std::stringstream        list(ROCWMMA_GEMM_JIT_INCLUDE_DIRS);
+            for(std::string dir; std::getline(list, dir, '|');)
+            {
+                dirs.push_back(dir);
+            }
+            return dirs;
+#else
+            return {};
+#endif // defined(ROCWMMA_GEMM_JIT_INCLUDE_DIRS)
+        }
+    }
+
+    TEST(GemmJitTest, ArchFamily)
+    {
+        EXPECT_EQ(GemmJit::archFamily("gfx90a:sramecc+:xnack-"), GemmJit::ArchFamily::GFX9);
+        EXPECT_EQ(GemmJit::archFamily("gfx942"), GemmJit::ArchFamily::GFX9);
+        EXPECT_EQ(GemmJit::archFamily("gfx1100"), GemmJit::ArchFamily::GFX11);
+        EXPECT_EQ(GemmJit::archFamily("gfx1201"), GemmJit::ArchFamily::GFX12);
+        EXPECT_EQ(GemmJit::archFamily("gfx803"), GemmJit::ArchFamily::UNSUPPORTED);
+        EXPECT_EQ(GemmJit::waveSize(GemmJit::ArchFamily::GFX9), 64u);
+        EXPECT_EQ(GemmJit::waveSize(GemmJit::ArchFamily::GFX11), 32u);
+    }
+
+    TEST(GemmJitTest, HeuristicPrefersLargestExactTile)
+    {
+        // 2x2 blocks of 32x32 on 2x2 waves tile 128 x 128
+        auto config = GemmJit::selectConfig(makeProblem(1024, 1024, 1024, "float16_t", "gfx90a"));
+        ASSERT_TRUE(config.has_value());
+        EXPECT_EQ(config->blocksX, 2u);
+        EXPECT_EQ(config->macroTileM(64), 128u);
+        EXPECT_EQ(config->macroTileN(), 128u);
+
+        // Falls back to a smaller tile when the big one does not divide M
+        config = GemmJit::selectConfig(makeProblem(64, 1024, 1024, "float16_t", "gfx90a"));
+        ASSERT_TRUE(config.has_value());
+        EXPECT_EQ(config->blocksX, 1u);
+        EXPECT_EQ(config->macroTileM(64), 64u);
+
+        // No bounds checks in specialized kernels: ragged shapes are rejected
+        EXPECT_FALSE(GemmJit::selectConfig(makeProblem(100, 100, 100, "float16_t", "gfx90a")));
+
+        // gfx11 only supports 16 x 16 blocks
+        config = GemmJit::selectConfig(makeProblem(256, 256, 256, "float16_t", "gfx1100"));
+        ASSERT_TRUE(config.has_value());
+        EXPECT_EQ(config->blockM, 16u);
+        EXPECT_EQ(config->macroTileM(32), 64u);
+    }
+
+    TEST(GemmJitTest, LaunchParameters)
+    {
+        auto program = GemmJit::generate(makeProblem(1024, 512, 256, "float16_t", "gfx90a"),
+                                         {"/opt/rocm/include"});
+        ASSERT_TRUE(program.has_value());
+        EXPECT_EQ(program->kernelName, "rocwmma_jit_gemm");
+        EXPECT_EQ(program->gridX, 8u);
+        EXPECT_EQ(program->gridY, 4u);
+        EXPECT_EQ(program->blockX, 128u);
+        EXPECT_EQ(program->blockY, 2u);
+
+        // 2 buffers * 2 bytes * (2 * 2 * 32 + 2 * 2 * 32) * 16
+        EXPECT_EQ(program->ldsBytes, 2u * 2u * 256u * 16u);
+
+        auto const& options = program->options;
+        EXPECT_NE(std::find(options.begin(), options.end(), "--gpu-architecture=gfx90a"),
+                  options.end());
+        EXPECT_NE(std::find(options.begin(), options.end(), "-I/opt/rocm/include"),
+                  options.end());
+
+        // Any -D__HIP_NO_HALF_CONVERSIONS__ form would disable the _Float16 mapping
+        EXPECT_NE(std::find(options.begin(), options.end(), "-U__HIP_NO_HALF_CONVERSIONS__"),
+                  options.end());
+        EXPECT_TRUE(std::none_of(options.begin(), options.end(), [](std::string const& option) {
+            return option.rfind("-D__HIP_NO_HALF_CONVERSIONS__", 0) == 0;
+        }));
+    }
+
+    TEST(GemmJitTest, InvalidProblem)
+    {
+        auto problem = makeProblem(1024, 1024, 1024, "float16_t", "gfx90a");
+        problem.lda  = 16;
+        EXPECT_THROW(GemmJit::generate(problem, {}), std::invalid_argument);
+
+        problem         = makeProblem(1024, 1024, 1024, "float16_t", "gfx90a");
+        problem.layoutB = "diagonal";
+        EXPECT_THROW(GemmJit::generate(problem, {}), std::invalid_argument);
+
+        EXPECT_THROW(GemmJit::generate(makeProblem(1024, 1024, 1024, "float16_t", "gfx803"), {}),
+                     std::invalid_argument);
+        EXPECT_THROW(GemmJit::generate(makeProblem(1024, 1024, 1024, "half", "gfx90a"), {}),
+                     std::invalid_argument);
+        EXPECT_THROW(GemmJit::generate(makeProblem(0, 1024, 1024, "float16_t", "gfx90a"), {}),
+                     std::invalid_argument);
+    }
+
+    TEST(GemmJitTest, GoldenF16Gfx90a)
+    {
+        auto program = GemmJit::generate(makeProblem(1024, 1024, 1024, "float16_t", "gfx90a"), {});
+        ASSERT_TRUE(program.has_value());
+        expectGolden("f16_nt_1024x1024x1024_gfx90a", program->source);
+    }
+
+    TEST(GemmJitTest, GoldenF32BetaZeroLongK)
+    {
+        // K loop too long for full unroll; C is never read
+        auto problem     = makeProblem(128, 128, 8192, "float32_t", "gfx942");
+        problem.betaZero = true;
+
+        auto program = GemmJit::generate(problem, {});
+        ASSERT_TRUE(program.has_value());
+        expectGolden("f32_nt_128x128x8192_beta0_gfx942", program->source);
+    }
+
+    TEST(GemmJitTest, GoldenF16AlphaZeroGfx1100)
+    {
+        // A * B is skipped entirely and no LDS is needed
+        auto problem      = makeProblem(64, 64, 64, "float16_t", "gfx1100");
+        problem.alphaZero = true;
+
+        auto program = GemmJit::generate(problem, {});
+        ASSERT_TRUE(program.has_value());
+        EXPECT_EQ(program->ldsBytes, 0u);
+        expectGolden("f16_nt_64x64x64_alpha0_gfx1100", program->source);
+    }
+
+    TEST(GemmJitTest, GoldenUnsupportedInputType)
+    {
+        // No source is generated for pairs the kernel predicates would reject
+        auto generate = [](std::string const& inputT, std::string const& arch) {
+            return GemmJit::generate(makeProblem(1024, 1024, 1024, inputT, arch), {});
+        };
+
+        EXPECT_FALSE(generate("float8_t", "gfx908"));
+        EXPECT_FALSE(generate("bfloat8_t", "gfx90a"));
+        EXPECT_FALSE(generate("float8_t", "gfx1100"));
+        EXPECT_FALSE(generate("bfloat8_t", "gfx1101"));
+        EXPECT_FALSE(generate("xfloat32_t", "gfx90a"));
+        EXPECT_FALSE(generate("float64_t", "gfx908"));
+        EXPECT_FALSE(generate("float32_t", "gfx1100"));
+        EXPECT_FALSE(generate("int32_t", "gfx942"));
+
+        EXPECT_TRUE(generate("float8_t", "gfx942"));
+        EXPECT_TRUE(generate("bfloat8_t", "gfx1201"));
+        EXPECT_TRUE(generate("int8_t", "gfx1100"));
+        EXPECT_TRUE(generate("float64_t", "gfx90a"));
+    }
+
+    TEST(GemmJitTest, CompileF16Gfx90a)
+    {
+        auto program = GemmJit::generate(makeProblem(1024, 1024, 1024, "float16_t", "gfx90a"),
+                                         compileIncludeDirs());
+        ASSERT_TRUE(program.has_value());
+        expectCompiles("f16_nt_1024x1024x1024_gfx90a", *program);
+    }
+
+    TEST(GemmJitTest, CompileF32BetaZeroLongK)
+    {
+        auto problem     = makeProblem(128, 128, 8192, "float32_t", "gfx942");
+        problem.betaZero = true;
+
+        auto program = GemmJit::generate(problem, compileIncludeDirs());
+        ASSERT_TRUE(program.has_value());
+        expectCompiles("f32_nt_128x128x8192_beta0_gfx942", *program);
+    }
+
+    TEST(GemmJitTest, CompileF16AlphaZeroGfx1100)
+    {
+        auto problem      = makeProblem(64, 64, 64, "float16_t", "gfx1100");
+        problem.alphaZero = true;
+
+        auto program = GemmJit::generate(problem, compileIncludeDirs());
+        ASSERT_TRUE(program.has_value());
+        expectCompiles("f16_nt_64x64x64_alpha0_gfx1100", *program);
+    }
+
+    TEST(GemmJitTest, RtcCompileF16Gfx90a)
+    {
+        auto problem = makeProblem(1024, 1024, 1024, "float16_t", "gfx90a");
+
+        auto program = GemmJit::generate(problem, compileIncludeDirs());
+        ASSERT_TRUE(program.has_value());
+        expectRtcCompiles("f16_nt_1024x1024x1024_gfx90a", problem.arch, *program);
+    }
+
+    TEST(GemmJitTest, RtcCompileF32BetaZeroLongK)
+    {
+        auto problem     = makeProblem(128, 128, 8192, "float32_t", "gfx942");
+        problem.betaZero = true;
+
+        auto program = GemmJit::generate(problem, compileIncludeDirs());
+        ASSERT_TRUE(program.has_value());
+        expectRtcCompiles("f32_nt_128x128x8192_beta0_gfx942", problem.arch, *program);
+    }
+
+    TEST(GemmJitTest, RtcCompileF16AlphaZeroGfx1100)
+    {
+        auto problem      = makeProblem(64, 64, 64, "float16_t", "gfx1100");
+        problem.alphaZero = true;
+
+        auto program = GemmJit::generate(problem, compileIncludeDirs());
+        ASSERT_TRUE(program.has_value());
+        expectRtcCompiles("f16_nt_64x64x64_alpha0_gfx1100", problem.arch, *program);
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "arch_profile.hpp"
+#include "gemm_occupancy.hpp"
+#include "gemm_planner.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using GemmOccupancy::Limiter;
+        using GemmOccupancy::occupancy;
+        using GemmOccupancy::resourceLimits;
+        using GemmOccupancy::ResourceUsage;
+
+        constexpr ResourceUsage usage(uint32_t vgprs,
+                                      uint32_t agprs,
+                                      uint32_t ldsBytes,
+                                      uint32_t threads)
+        {
+            return {vgprs, agprs, ldsBytes, threads};
+        }
+
+        // The model must be usable in static_asserts
+        static_assert(occupancy(usage(100u, 0u, 0u, 256u), resourceLimits(0x90A)).wavesPerSimd
+                          == 4u,
+                      "Unexpected constexpr occupancy");
+        static_assert(!resourceLimits(0x0).valid(), "Unknown archs have no limits");
+
+    } // namespace
+
+    TEST(GemmOccupancyTest, RegisterLimited)
+    {
+        // 100 registers allocate as 104: 4 waves per SIMD, one workgroup per SIMD
+        auto result = occupancy(usage(100u, 0u, 0u, 256u), resourceLimits(0x90A));
+        EXPECT_EQ(result.allocatedVgprs, 104u);
+        EXPECT_EQ(result.registerWavesPerSimd, 4u);
+        EXPECT_EQ(result.wavesPerWorkgroup, 4u);
+        EXPECT_EQ(result.workgroupsPerCu, 4u);
+        EXPECT_EQ(result.wavesPerSimd, 4u);
+        EXPECT_EQ(result.limiter, Limiter::Vgprs);
+        EXPECT_FALSE(result.spills);
+
+        // Accumulators share the file on a unified arch
+        auto unified = occupancy(usage(100u, 100u, 0u, 256u), resourceLimits(0x942));
+        EXPECT_EQ(unified.allocatedVgprs, 200u);
+        EXPECT_EQ(unified.allocatedAgprs, 0u);
+        EXPECT_EQ(unified.wavesPerSimd, 2u);
+    }
+
+    TEST(GemmOccupancyTest, SeparateAccumulationFile)
+    {
+        // gfx908 addresses 256 of each; accumulators spill and limit occupancy
+        auto result = occupancy(usage(64u, 300u, 0u, 256u), resourceLimits(0x908));
+        EXPECT_TRUE(result.spills);
+        EXPECT_EQ(result.allocatedVgprs, 64u);
+        EXPECT_EQ(result.allocatedAgprs, 256u);
+        EXPECT_EQ(result.registerWavesPerSimd, 2u);
+        EXPECT_EQ(result.wavesPerSimd, 2u);
+        EXPECT_EQ(result.limiter, Limiter::Agprs);
+        EXPECT_TRUE(result.fits());
+    }
+
+    TEST(GemmOccupancyTest, LdsAndThreadLimits)
+    {
+        auto limits = resourceLimits(0x90A);
+
+        auto lds = occupancy(usage(64u, 0u, 20000u, 256u), limits);
+        EXPECT_EQ(lds.registerWavesPerSimd, 8u);
+        EXPECT_EQ(lds.workgroupsPerCu, 3u);
+        EXPECT_EQ(lds.wavesPerSimd, 3u);
+        EXPECT_EQ(lds.limiter, Limiter::Lds);
+
+        auto tooBig    = limits.maxLdsBytesPerWorkgroup + 1u;
+        auto oversized = occupancy(usage(64u, 0u, tooBig, 256u), limits);
+        EXPECT_EQ(oversized.wavesPerSimd, 0u);
+        EXPECT_EQ(oversized.limiter, Limiter::Lds);
+        EXPECT_FALSE(oversized.fits());
+
+        auto threads = occupancy(usage(64u, 0u, 0u, 2048u), limits);
+        EXPECT_EQ(threads.wavesPerSimd, 0u);
+        EXPECT_EQ(threads.limiter, Limiter::Threads);
+    }
+
+    TEST(GemmOccupancyTest, Wave32)
+    {
+        // 8 waves of 32 lanes over 2 SIMDs, 4 workgroups fill the slots
+        auto result = occupancy(usage(96u, 0u, 0u, 256u), resourceLimits(0x1100));
+        EXPECT_EQ(result.wavesPerWorkgroup, 8u);
+        EXPECT_EQ(result.registerWavesPerSimd, 16u);
+        EXPECT_EQ(result.workgroupsPerCu, 4u);
+        EXPECT_EQ(result.wavesPerSimd, 16u);
+        EXPECT_EQ(result.limiter, Limiter::Waves);
+    }
+
+    TEST(GemmOccupancyTest, ArchProfilesMatchLimits)
+    {
+        std::pair<char const*, uint32_t> const archs[] = {{"gfx908", 0x908},
+                                                          {"gfx90a", 0x90A},
+                                                          {"gfx942", 0x942},
+                                                          {"gfx1100", 0x1100},
+                                                          {"gfx1201", 0x1201}};
+        for(auto const& arch : archs)
+        {
+            auto profile = findArchProfile(arch.first);
+            ASSERT_TRUE(profile) << arch.first;
+
+            auto expected = resourceLimits(arch.second);
+            auto actual   = GemmPlanner::resourceLimits(*profile);
+            EXPECT_EQ(actual.waveSize, expected.waveSize) << arch.first;
+            EXPECT_EQ(actual.simdsPerCu, expected.simdsPerCu) << arch.first;
+            EXPECT_EQ(actual.maxWavesPerSimd, expected.maxWavesPerSimd) << arch.first;
+            EXPECT_EQ(actual.vgprsPerSimd, expected.vgprsPerSimd) << arch.first;
+            EXPECT_EQ(actual.agprsPerSimd, expected.agprsPerSimd) << arch.first;
+            EXPECT_EQ(actual.maxVgprsPerWave, expected.maxVgprsPerWave) << arch.first;
+            EXPECT_EQ(actual.vgprGranularity, expected.vgprGranularity) << arch.first;
+            EXPECT_EQ(actual.ldsBytesPerCu, expected.ldsBytesPerCu) << arch.first;
+            EXPECT_EQ(actual.maxLdsBytesPerWorkgroup, expected.maxLdsBytesPerWorkgroup)
+                << arch.first;
+            EXPECT_EQ(actual.maxThreadsPerWorkgroup, expected.maxThreadsPerWorkgroup)
+                << arch.first;
+        }
+    }
+
+    TEST(GemmOccupancyTest, Report)
+    {
+        std::stringstream report;
+        GemmOccupancy::printReport(report, usage(64u, 300u, 16384u, 256u), resourceLimits(0x908));
+        EXPECT_EQ(report.str(),
+                  "VGPRs 64 (64/256), AGPRs 300 (256/256), LDS 16384/65536 B, "
+                  "waves/SIMD 2/10 (agprs), SPILLS");
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,311 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gemm_phase_trace_report.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using namespace GemmPhaseTrace;
+
+        // 100 MHz wall clock: 100 ticks per microsecond
+        constexpr uint32_t ClockRateKhz = 100000u;
+
+        Capture makeCapture(uint64_t slotCount, uint32_t slotRecords)
+        {
+            Capture capture;
+            capture.header
+                = FileHeader{FileMagic, FileVersion, ClockRateKhz, slotRecords, slotCount};
+            capture.slots.assign(slotCount * slotBytes(slotRecords), 0u);
+            return capture;
+        }
+
+        // Writes a slot as a wave recorder would: records up to the slot
+        // capacity, and the attempted count in the header.
+        void recordWave(Capture&                   capture,
+                        uint64_t                   slot,
+                        uint32_t                   workgroup,
+                        uint16_t                   wave,
+                        uint64_t                   baseClock,
+                        std::vector<Record> const& records)
+        {
+            auto  slotRecords = capture.header.slotRecords;
+            auto* slotPtr     = capture.slots.data() + slot * slotBytes(slotRecords);
+
+            for(uint32_t i = 0u; i < records.size() && i < slotRecords; i++)
+            {
+                std::memcpy(slotPtr + sizeof(WaveHeader) + i * sizeof(Record),
+                            &records[i],
+                            sizeof(Record));
+            }
+
+            auto header = WaveHeader{
+                baseClock, workgroup, wave, static_cast<uint16_t>(records.size())};
+            std::memcpy(slotPtr, &header, sizeof(WaveHeader));
+        }
+
+        Record record(uint32_t start, Phase phase, uint32_t duration)
+        {
+            return Record{start, packPhase(phase, duration)};
+        }
+
+        // Two workgroups of two waves; wave 1 of workgroup 1 exited early
+        Capture sampleCapture()
+        {
+            auto capture = makeCapture(4u, slotRecords(1u));
+            recordWave(capture,
+                       0u,
+                       0u,
+                       0u,
+                       1000u,
+                       {record(0u, GlobalRead, 10u),
+                        record(10u, LocalWrite, 20u),
+                        record(30u, LocalRead, 40u),
+                        record(70u, Mma, 100u),
+                        record(170u, Epilogue, 30u)});
+            recordWave(capture,
+                       1u,
+                       0u,
+                       1u,
+                       1005u,
+                       {record(0u, GlobalRead, 12u), record(12u, Mma, 300u)});
+            recordWave(
+                capture, 2u, 1u, 0u, 900u, {record(0u, GlobalRead, 8u), record(8u, Mma, 200u)});
+            return capture;
+        }
+
+    } // namespace
+
+    TEST(GemmPhaseTraceTest, RecordPacking)
+    {
+        auto packed = record(7u, Epilogue, 1234u);
+        EXPECT_EQ(phaseOf(packed), static_cast<uint32_t>(Epilogue));
+        EXPECT_EQ(durationOf(packed), 1234u);
+
+        // Durations beyond the field saturate rather than corrupting the phase
+        auto saturated = Record{0u, packPhase(Mma, 1ull << 40u)};
+        EXPECT_EQ(phaseOf(saturated), static_cast<uint32_t>(Mma));
+        EXPECT_EQ(durationOf(saturated), DurationMask);
+
+        EXPECT_EQ(sizeof(WaveHeader), 16u);
+        EXPECT_EQ(sizeof(Record), 8u);
+        EXPECT_EQ(slotBytes(3u), 16u + 3u * 8u);
+    }
+
+    TEST(GemmPhaseTraceTest, SlotRecordsCoverGemmFlow)
+    {
+        // Prologue read and write, four phases per further k step, then the
+        // C read, tail read, tail mma and epilogue.
+        for(uint32_t kSteps = 1u; kSteps < 64u; kSteps++)
+        {
+            auto flowRecords = 2u + 4u * (kSteps - 1u) + 4u;
+            EXPECT_GE(slotRecords(kSteps), flowRecords) << "kSteps " << kSteps;
+        }
+    }
+
+    TEST(GemmPhaseTraceTest, CaptureFileRoundTrip)
+    {
+        auto capture = sampleCapture();
+        auto path    = testing::TempDir() + "gemm_phase_trace_test.trace";
+
+        writeCaptureFile(path, capture);
+        auto loaded = readCaptureFile(path);
+        std::remove(path.c_str());
+
+        EXPECT_EQ(loaded.header.magic, FileMagic);
+        EXPECT_EQ(loaded.header.version, FileVersion);
+        EXPECT_EQ(loaded.header.clockRateKhz, ClockRateKhz);
+        EXPECT_EQ(loaded.header.slotRecords, capture.header.slotRecords);
+        EXPECT_EQ(loaded.header.slotCount, capture.header.slotCount);
+        EXPECT_EQ(loaded.slots, capture.slots);
+    }
+
+    TEST(GemmPhaseTraceTest, RejectsMalformedCaptures)
+    {
+        auto capture = sampleCapture();
+
+        auto bytesOf = [](Capture const& c) {
+            std::stringstream stream;
+            writeCapture(stream, c);
+            return stream.str();
+        };
+        auto read = [](std::string const& bytes) {
+            std::istringstream stream(bytes);
+            return readCapture(stream);
+        };
+
+        auto badMagic         = capture;
+        badMagic.header.magic = 0u;
+        EXPECT_THROW(read(bytesOf(badMagic)), std::runtime_error);
+
+        auto badVersion           = capture;
+        badVersion.header.version = FileVersion + 1u;
+        EXPECT_THROW(read(bytesOf(badVersion)), std::runtime_error);
+
+        auto bytes = bytesOf(capture);
+        EXPECT_THROW(read(bytes.substr(0u, sizeof(FileHeader) - 1u)), std::runtime_error);
+        EXPECT_THROW(read(bytes.substr(0u, bytes.size() - 1u)), std::runtime_error);
+        EXPECT_NO_THROW(read(bytes));
+
+        EXPECT_THROW(readCaptureFile(testing::TempDir() + "missing.trace"), std::runtime_error);
+
+        // Phase ids past the enum are corruption
+        auto badPhase = makeCapture(1u, 1u);
+        recordWave(badPhase, 0u, 0u, 0u, 0u, {Record{0u, packPhase(PhaseCount, 1u)}});
+        EXPECT_THROW(decode(badPhase), std::runtime_error);
+    }
+
+    TEST(GemmPhaseTraceTest, DecodeSkipsOpenSlots)
+    {
+        auto trace = decode(sampleCapture());
+
+        EXPECT_EQ(trace.clockRateKhz, ClockRateKhz);
+        EXPECT_EQ(trace.waves, 3u);
+        EXPECT_EQ(trace.dropped, 0u);
+        ASSERT_EQ(trace.events.size(), 9u);
+
+        auto const& mma = trace.events[3];
+        EXPECT_EQ(mma.workgroup, 0u);
+        EXPECT_EQ(mma.wave, 0u);
+        EXPECT_EQ(mma.phase, Mma);
+        EXPECT_EQ(mma.start, 1070u);
+        EXPECT_EQ(mma.duration, 100u);
+
+        auto const& last = trace.events.back();
+        EXPECT_EQ(last.workgroup, 1u);
+        EXPECT_EQ(last.phase, Mma);
+        EXPECT_EQ(last.start, 908u);
+    }
+
+    TEST(GemmPhaseTraceTest, DecodeCountsDroppedRecords)
+    {
+        auto capture = makeCapture(1u, 2u);
+        recordWave(capture,
+                   0u,
+                   3u,
+                   2u,
+                   0u,
+                   {record(0u, GlobalRead, 1u),
+                    record(1u, LocalWrite, 1u),
+                    record(2u, LocalRead, 1u),
+                    record(3u, Mma, 1u),
+                    record(4u, Epilogue, 1u)});
+
+        auto trace = decode(capture);
+        EXPECT_EQ(trace.waves, 1u);
+        EXPECT_EQ(trace.dropped, 3u);
+        ASSERT_EQ(trace.events.size(), 2u);
+        EXPECT_EQ(trace.events[1].phase, LocalWrite);
+        EXPECT_EQ(trace.events[1].workgroup, 3u);
+        EXPECT_EQ(trace.events[1].wave, 2u);
+    }
+
+    TEST(GemmPhaseTraceTest, SummaryPercentilesAndBuckets)
+    {
+        auto capture = makeCapture(1u, 100u);
+
+        // Mma durations 1..100
+        std::vector<Record> records;
+        for(uint32_t i = 1u; i <= 100u; i++)
+        {
+            records.push_back(record(i, Mma, i));
+        }
+        recordWave(capture, 0u, 0u, 0u, 0u, records);
+
+        auto summaries = summarize(decode(capture));
+        auto mma       = summaries[Mma];
+
+        EXPECT_EQ(mma.count, 100u);
+        EXPECT_EQ(mma.total, 5050u);
+        EXPECT_EQ(mma.min, 1u);
+        EXPECT_EQ(mma.p50, 50u);
+        EXPECT_EQ(mma.p99, 99u);
+        EXPECT_EQ(mma.max, 100u);
+
+        // [1, 2) [2, 4) [4, 8) ... [64, 128)
+        EXPECT_EQ(mma.buckets[0], 1u);
+        EXPECT_EQ(mma.buckets[1], 2u);
+        EXPECT_EQ(mma.buckets[2], 4u);
+        EXPECT_EQ(mma.buckets[5], 32u);
+        EXPECT_EQ(mma.buckets[6], 37u);
+
+        EXPECT_EQ(summaries[GlobalRead].count, 0u);
+        EXPECT_EQ(summaries[GlobalRead].max, 0u);
+    }
+
+    TEST(GemmPhaseTraceTest, HistogramReport)
+    {
+        std::stringstream report;
+        writeHistogramReport(report, decode(sampleCapture()), "sample kernel");
+        auto text = report.str();
+
+        EXPECT_NE(text.find("# sample kernel\n"), std::string::npos);
+        EXPECT_NE(text.find("# waves: 3, events: 9, dropped: 0"), std::string::npos);
+
+        // Mma: 600 ticks of 720 total, 6us at 100 ticks per us
+        EXPECT_NE(text.find("Mma, 3, 6.000, 83.3, 100, 200, 300, 300\n"), std::string::npos);
+        EXPECT_NE(text.find("GlobalRead, 3, 0.300, 4.2, 8, 10, 12, 12\n"), std::string::npos);
+
+        // 8, 10 and 12 all land in [8, 16)
+        EXPECT_NE(text.find("GlobalRead: 3:3\n"), std::string::npos);
+        EXPECT_NE(text.find("Mma: 6:1 7:1 8:1\n"), std::string::npos);
+    }
+
+    TEST(GemmPhaseTraceTest, ChromeTrace)
+    {
+        std::stringstream json;
+        writeChromeTrace(json, decode(sampleCapture()));
+        auto text = json.str();
+
+        EXPECT_EQ(text.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0u), 0u);
+        EXPECT_NE(text.find("\n]}\n"), std::string::npos);
+
+        // Origin is the earliest event, workgroup 1 wave 0 at tick 900
+        EXPECT_NE(text.find("{\"name\":\"GlobalRead\",\"ph\":\"X\",\"pid\":1,\"tid\":0,"
+                            "\"ts\":0.000,\"dur\":0.080}"),
+                  std::string::npos);
+        EXPECT_NE(text.find("{\"name\":\"Mma\",\"ph\":\"X\",\"pid\":0,\"tid\":1,"
+                            "\"ts\":1.170,\"dur\":3.000}"),
+                  std::string::npos);
+
+        size_t events = 0u;
+        for(auto pos = text.find("\"ph\":\"X\""); pos != std::string::npos;
+            pos      = text.find("\"ph\":\"X\"", pos + 1u))
+        {
+            events++;
+        }
+        EXPECT_EQ(events, 9u);
+    }
+
+} // namespace rocwmma
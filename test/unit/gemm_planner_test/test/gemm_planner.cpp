@@ -0,0 +1,224 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "gemm_planner.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        GemmTuning::Problem makeProblem(uint32_t    m,
+                                        uint32_t    n,
+                                        uint32_t    k,
+                                        std::string computeT = "f32")
+        {
+            return {m, n, k, "f16", "f16", computeT, "N_T_N_N", 2u, 2u, false};
+        }
+
+        GemmTuning::Candidate makeCandidate(uint32_t block,
+                                            uint32_t blockK,
+                                            uint32_t blocks,
+                                            uint32_t tBlockX,
+                                            uint32_t tBlockY,
+                                            uint32_t ldsBytes = 0u)
+        {
+            GemmTuning::Candidate candidate;
+            candidate.kernel     = "PGR1_LB2_MP0_MB_CP";
+            candidate.gemmConfig = "Workgroup_LdsNT";
+            candidate.layoutLds  = "N";
+            candidate.blockM     = block;
+            candidate.blockN     = block;
+            candidate.blockK     = blockK;
+            candidate.blocksX    = blocks;
+            candidate.blocksY    = blocks;
+            candidate.tBlockX    = tBlockX;
+            candidate.tBlockY    = tBlockY;
+            candidate.ldsBytes   = ldsBytes;
+            return candidate;
+        }
+
+        ArchProfile profile(std::string const& arch)
+        {
+            return *findArchProfile(arch);
+        }
+    }
+
+    TEST(GemmPlannerTest, DataTypeBytes)
+    {
+        EXPECT_EQ(GemmPlanner::dataTypeBytes("f8(fnuz)"), 1u);
+        EXPECT_EQ(GemmPlanner::dataTypeBytes("bf16"), 2u);
+        EXPECT_EQ(GemmPlanner::dataTypeBytes("xf32"), 4u);
+        EXPECT_EQ(GemmPlanner::dataTypeBytes("f64"), 8u);
+        EXPECT_THROW(GemmPlanner::dataTypeBytes("float16_t"), std::invalid_argument);
+    }
+
+    TEST(GemmPlannerTest, RegistersFromFragmentSizes)
+    {
+        auto problem   = makeProblem(4096u, 4096u, 4096u);
+        auto candidate = makeCandidate(32u, 8u, 2u, 128u, 2u);
+
+        // Per lane: A and B 2 x 2, accumulators 4 x 16, prefetch 4, overhead 16
+        auto unified = GemmPlanner::estimateRegisters(profile("gfx90a"), problem, candidate);
+        EXPECT_EQ(unified.vgprs, 96u);
+        EXPECT_EQ(unified.agprs, 0u);
+
+        // Separate accumulation file
+        auto split = GemmPlanner::estimateRegisters(profile("gfx908"), problem, candidate);
+        EXPECT_EQ(split.vgprs, 32u);
+        EXPECT_EQ(split.agprs, 64u);
+
+        // No global prefetch outside of PGR1
+        candidate.kernel = "PGR0_LB0_MP0_MB_NC";
+        EXPECT_EQ(GemmPlanner::estimateRegisters(profile("gfx90a"), problem, candidate).vgprs,
+                  88u);
+
+        // Accumulator width follows the compute type
+        problem.computeT = "f64";
+        EXPECT_EQ(GemmPlanner::estimateRegisters(profile("gfx90a"), problem, candidate).vgprs,
+                  152u);
+    }
+
+    TEST(GemmPlannerTest, OccupancyLimiters)
+    {
+        auto arch    = profile("gfx90a");
+        auto problem = makeProblem(4096u, 4096u, 4096u);
+
+        // 5 waves per SIMD by registers, 4 workgroups per CU by LDS
+        auto lds = GemmPlanner::plan(arch, problem, makeCandidate(32u, 8u, 2u, 128u, 2u, 16384u));
+        EXPECT_EQ(lds.limiter, "lds");
+        EXPECT_EQ(lds.wavesPerSimd, 4u);
+        EXPECT_DOUBLE_EQ(lds.occupancy(arch), 0.5);
+
+        auto regs = GemmPlanner::plan(arch, problem, makeCandidate(32u, 8u, 2u, 128u, 2u, 4096u));
+        EXPECT_EQ(regs.limiter, "vgprs");
+        EXPECT_EQ(regs.wavesPerSimd, 5u);
+
+        // Small fragments are limited by wave slots
+        auto slots = GemmPlanner::plan(arch, problem, makeCandidate(16u, 16u, 1u, 64u, 1u));
+        EXPECT_EQ(slots.limiter, "waves");
+        EXPECT_EQ(slots.wavesPerSimd, arch.maxWavesPerSimd);
+        EXPECT_TRUE(slots.runs());
+    }
+
+    TEST(GemmPlannerTest, SpillsAndOversizedWorkgroups)
+    {
+        auto arch    = profile("gfx942");
+        auto problem = makeProblem(8192u, 8192u, 8192u);
+
+        // 16 accumulators of 64 x 64 f32 need 1024 registers per lane
+        auto spills = GemmPlanner::plan(arch, problem, makeCandidate(64u, 16u, 4u, 256u, 1u));
+        EXPECT_TRUE(spills.spills);
+        EXPECT_TRUE(spills.runs());
+
+        // More LDS than a CU has
+        auto oversized
+            = GemmPlanner::plan(arch, problem, makeCandidate(32u, 8u, 2u, 128u, 2u, 1u << 17));
+        EXPECT_EQ(oversized.wavesPerSimd, 0u);
+        EXPECT_FALSE(oversized.runs());
+
+        // Failed run checks are kept, but not planned
+        auto candidate    = makeCandidate(32u, 8u, 2u, 128u, 2u);
+        candidate.enabled = false;
+        EXPECT_FALSE(GemmPlanner::plan(arch, problem, candidate).runs());
+    }
+
+    TEST(GemmPlannerTest, GridAndRoofline)
+    {
+        auto arch      = profile("gfx90a");
+        auto candidate = makeCandidate(64u, 16u, 2u, 128u, 2u, 32768u);
+
+        // Macro tile is 256 x 256
+        auto square = GemmPlanner::plan(arch, makeProblem(8192u, 4096u, 8192u), candidate);
+        EXPECT_FALSE(square.spills);
+        EXPECT_EQ(square.gridX, 32u);
+        EXPECT_EQ(square.gridY, 16u);
+        EXPECT_DOUBLE_EQ(square.flops, 2.0 * 8192.0 * 4096.0 * 8192.0);
+        EXPECT_STREQ(square.bound(), "compute");
+        EXPECT_GT(square.predictedTFlopsPerSec(), 0.0);
+        EXPECT_LT(square.predictedTFlopsPerSec(), arch.peakTFlopsFor("f16"));
+
+        // Shallow K is bound by reading C and writing D, partial tiles round up
+        auto skinny = GemmPlanner::plan(arch, makeProblem(8192u, 8000u, 64u), candidate);
+        EXPECT_EQ(skinny.gridY, 32u);
+        EXPECT_STREQ(skinny.bound(), "memory");
+        EXPECT_NEAR(skinny.predictedMs,
+                    skinny.memoryMs + GemmTuning::CostModel::LaunchOverheadMs,
+                    1.0e-12);
+        EXPECT_DOUBLE_EQ(skinny.bytes,
+                         GemmTuning::CostModel(arch).bytesMoved(skinny.problem, candidate));
+    }
+
+    TEST(GemmPlannerTest, Wave32Profile)
+    {
+        auto arch      = profile("gfx1100");
+        auto candidate = makeCandidate(16u, 16u, 1u, 64u, 2u);
+        auto plan      = GemmPlanner::plan(arch, makeProblem(1024u, 1024u, 1024u), candidate);
+
+        // 2 x 2 waves of 32 lanes, 32 x 32 macro tile
+        EXPECT_EQ(plan.gridX, 32u);
+        EXPECT_EQ(plan.gridY, 32u);
+        EXPECT_EQ(plan.registers.agprs, 0u);
+        EXPECT_TRUE(plan.runs());
+    }
+
+    TEST(GemmPlannerTest, Report)
+    {
+        auto arch = profile("gfx90a");
+
+        std::stringstream header;
+        GemmPlanner::printHeader(header);
+        EXPECT_NE(header.str().find("VGPRs, AGPRs, WavesPerSimd"), std::string::npos);
+
+        auto candidate = makeCandidate(32u, 8u, 2u, 128u, 2u, 16384u);
+        auto plan      = GemmPlanner::plan(arch, makeProblem(4096u, 4096u, 4096u), candidate);
+
+        std::stringstream planned;
+        GemmPlanner::printPlan(planned, arch, plan);
+        EXPECT_EQ(planned.str().rfind("PGR1_LB2_MP0_MB_CP, Workgroup_LdsNT, N, 32, 32, 8", 0), 0u);
+        EXPECT_NE(planned.str().find("f16_f16_f32, 16384, 96, 0, 4, 50, lds, 32, 32"),
+                  std::string::npos);
+        EXPECT_NE(planned.str().find("PLANNED"), std::string::npos);
+
+        plan.candidate.enabled = false;
+        std::stringstream skipped;
+        GemmPlanner::printPlan(skipped, arch, plan);
+        EXPECT_NE(skipped.str().find("n/a, n/a, n/a, SKIPPED"), std::string::npos);
+
+        // Header and rows have matching columns
+        auto columns = [](std::string const& line) {
+            return std::count(line.begin(), line.end(), ',');
+        };
+        EXPECT_EQ(columns(header.str()), columns(planned.str()));
+        EXPECT_EQ(columns(header.str()), columns(skipped.str()));
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,429 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "gemm_tuning.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        GemmTuning::Problem makeProblem(uint32_t m, uint32_t n, uint32_t k)
+        {
+            return {m, n, k, "f16", "f16", "f32", "N_T_N_N", 2u, 2u, false};
+        }
+
+        GemmTuning::Candidate makeCandidate(uint32_t block,
+                                            uint32_t blockK,
+                                            uint32_t blocks,
+                                            uint32_t tBlockX,
+                                            uint32_t tBlockY,
+                                            uint32_t waveSize = 64u)
+        {
+            GemmTuning::Candidate candidate;
+            candidate.kernel     = "PGR1_LB2_MP0_MB_CP";
+            candidate.gemmConfig = "Workgroup_LdsNT";
+            candidate.layoutLds  = "N";
+            candidate.blockM     = block;
+            candidate.blockN     = block;
+            candidate.blockK     = blockK;
+            candidate.blocksX    = blocks;
+            candidate.blocksY    = blocks;
+            candidate.tBlockX    = tBlockX;
+            candidate.tBlockY    = tBlockY;
+
+            // As Kernel_PGR1_LB2_MP0_MB_CP::ldsUsage() for 16-bit inputs
+            candidate.ldsBytes
+                = 2u * 2u * (tBlockX / waveSize * blocks * block + tBlockY * blocks * block)
+                  * blockK;
+            return candidate;
+        }
+
+        // The sort of space a gemm suite instantiates
+        std::vector<GemmTuning::Candidate> candidateSpace()
+        {
+            std::vector<GemmTuning::Candidate> candidates;
+            for(auto block : {16u, 32u})
+            {
+                for(auto blockK : {16u, 32u, 64u})
+                {
+                    for(auto blocks : {1u, 2u, 4u})
+                    {
+                        for(auto tBlock : {std::make_pair(64u, 1u),
+                                           std::make_pair(128u, 2u),
+                                           std::make_pair(256u, 1u)})
+                        {
+                            candidates.push_back(makeCandidate(
+                                block, blockK, blocks, tBlock.first, tBlock.second));
+                        }
+                    }
+                }
+            }
+            return candidates;
+        }
+
+        GemmTuning::CostModel gfx90aModel()
+        {
+            return GemmTuning::CostModel(*findArchProfile("gfx90a"));
+        }
+
+        // Timing backends are called with the candidate index, which the
+        // synthetic backend doesn't need
+        GemmTuning::TimingBackendT
+            syntheticTiming(GemmTuning::SyntheticTimingBackend const& backend)
+        {
+            return [backend](GemmTuning::Candidate const& candidate, size_t) {
+                return backend(candidate);
+            };
+        }
+
+        std::string tempPath(std::string const& name)
+        {
+            return (std::filesystem::temp_directory_path()
+                    / ("rocwmma_tuning_" + std::to_string(getpid()) + "_" + name))
+                .string();
+        }
+    }
+
+    TEST(GemmTuningTest, ArchProfiles)
+    {
+        auto profile = findArchProfile("gfx942:sramecc+:xnack-");
+        ASSERT_TRUE(profile.has_value());
+        EXPECT_EQ(profile->waveSize, 64u);
+        EXPECT_GT(profile->peakTFlopsFor("f16"), profile->peakTFlopsFor("f32"));
+        EXPECT_EQ(profile->peakTFlopsFor("f64x"), 0.0);
+
+        EXPECT_EQ(findArchProfile("gfx1100")->waveSize, 32u);
+        EXPECT_FALSE(findArchProfile("gfx803").has_value());
+    }
+
+    TEST(GemmTuningTest, Feasibility)
+    {
+        auto model   = gfx90aModel();
+        auto problem = makeProblem(1024, 1024, 1024);
+
+        EXPECT_TRUE(model.feasible(problem, makeCandidate(32, 16, 2, 128, 2)));
+
+        // Failed kernel predicates
+        auto disabled    = makeCandidate(32, 16, 2, 128, 2);
+        disabled.enabled = false;
+        EXPECT_FALSE(model.feasible(problem, disabled));
+
+        // Exceeds 64KiB of LDS
+        EXPECT_FALSE(model.feasible(problem, makeCandidate(32, 64, 4, 256, 1)));
+
+        // Macro tile larger than the problem
+        EXPECT_FALSE(model.feasible(makeProblem(64, 64, 64), makeCandidate(32, 16, 2, 128, 2)));
+
+        // TBlockX not a multiple of the wave size
+        EXPECT_FALSE(model.feasible(problem, makeCandidate(16, 16, 1, 32, 2)));
+
+        // No matrix core support for the type on this arch
+        auto fp8Problem   = problem;
+        fp8Problem.inputT = "f8";
+        EXPECT_FALSE(model.feasible(fp8Problem, makeCandidate(32, 16, 2, 128, 2)));
+    }
+
+    TEST(GemmTuningTest, CostModelRanking)
+    {
+        auto model = gfx90aModel();
+
+        // Large problems favour large macro tiles for data re-use
+        auto large = makeProblem(8192, 8192, 8192);
+        EXPECT_LT(model.estimateMs(large, makeCandidate(32, 16, 2, 128, 2)),
+                  model.estimateMs(large, makeCandidate(16, 16, 1, 64, 1)));
+
+        // Small problems can't fill the device with large tiles
+        auto small = makeProblem(256, 256, 4096);
+        EXPECT_LT(model.estimateMs(small, makeCandidate(16, 32, 1, 64, 1)),
+                  model.estimateMs(small, makeCandidate(32, 32, 2, 128, 2)));
+
+        // Never faster than the roofline
+        auto candidate = makeCandidate(32, 16, 2, 128, 2);
+        auto peakMs    = large.flops() / (model.arch().peakTFlopsFor("f16") * 1.0e9);
+        EXPECT_GE(model.estimateMs(large, candidate), peakMs);
+    }
+
+    TEST(GemmTuningTest, PruneLimitsBenchmarks)
+    {
+        auto problem    = makeProblem(4096, 4096, 4096);
+        auto candidates = candidateSpace();
+
+        GemmTuning::Autotuner    tuner(gfx90aModel(), 5u, 1.5);
+        GemmTuning::TuningResult stats;
+        auto                     survivors = tuner.prune(problem, candidates, stats);
+
+        ASSERT_FALSE(survivors.empty());
+        EXPECT_LE(survivors.size(), 5u);
+        EXPECT_GT(stats.prunedByPredicates, 0u);
+        EXPECT_EQ(survivors.size() + stats.prunedByPredicates + stats.prunedByModel,
+                  candidates.size());
+
+        for(size_t i = 0; i < survivors.size(); ++i)
+        {
+            EXPECT_EQ(survivors[i].candidate.name(), candidates[survivors[i].index].name());
+            EXPECT_LE(survivors[i].predictedMs, survivors.front().predictedMs * 1.5);
+            if(i > 0)
+            {
+                EXPECT_GE(survivors[i].predictedMs, survivors[i - 1].predictedMs);
+            }
+        }
+    }
+
+    TEST(GemmTuningTest, TuneWithSyntheticBackend)
+    {
+        auto model      = gfx90aModel();
+        auto problem    = makeProblem(4096, 4096, 4096);
+        auto candidates = candidateSpace();
+
+        GemmTuning::SyntheticTimingBackend backend(model, problem);
+        GemmTuning::Autotuner              tuner(model, 6u, 2.0);
+
+        uint32_t calls  = 0u;
+        auto     result = tuner.tune(problem,
+                                 candidates,
+                                 [&](GemmTuning::Candidate const& candidate, size_t index) {
+                                     calls++;
+                                     EXPECT_EQ(candidate.name(), candidates[index].name());
+                                     return backend(candidate);
+                                 });
+
+        ASSERT_TRUE(result.found());
+        EXPECT_EQ(calls, result.measurements.size());
+        EXPECT_LE(calls, 6u);
+
+        // Winner is the fastest measured, not necessarily the best predicted
+        for(auto const& measurement : result.measurements)
+        {
+            EXPECT_GE(measurement.measuredMs, result.best().measuredMs);
+            EXPECT_EQ(measurement.measuredMs, backend(measurement.candidate));
+        }
+
+        // Synthetic timing is deterministic
+        auto again = tuner.tune(problem, candidates, syntheticTiming(backend));
+        EXPECT_EQ(again.best().candidate.name(), result.best().candidate.name());
+    }
+
+    TEST(GemmTuningTest, FailedBenchmarksAreSkipped)
+    {
+        auto model      = gfx90aModel();
+        auto problem    = makeProblem(2048, 2048, 2048);
+        auto candidates = candidateSpace();
+
+        GemmTuning::SyntheticTimingBackend backend(model, problem);
+        GemmTuning::Autotuner              tuner(model, 4u, 4.0);
+
+        auto first  = tuner.tune(problem, candidates, syntheticTiming(backend));
+        auto failed = first.best().index;
+
+        auto result = tuner.tune(problem, candidates, [&](auto const& c, size_t index) {
+            return index == failed ? std::nan("") : backend(c);
+        });
+
+        EXPECT_EQ(result.failed, 1u);
+        ASSERT_TRUE(result.found());
+        EXPECT_NE(result.best().index, failed);
+    }
+
+    TEST(GemmTuningTest, Keys)
+    {
+        EXPECT_EQ(GemmTuning::shapeBucket(1), 0u);
+        EXPECT_EQ(GemmTuning::shapeBucket(1024), 10u);
+        EXPECT_EQ(GemmTuning::shapeBucket(1025), 11u);
+
+        auto key = GemmTuning::Key::fromProblem("gfx90a:sramecc+:xnack-",
+                                                makeProblem(1000, 2048, 3000));
+        EXPECT_EQ(key.str(), "gfx90a|f16_f16_f32|N_T_N_N|m10_n11_k12");
+
+        // Shapes in the same bucket share an entry
+        EXPECT_EQ(key.str(),
+                  GemmTuning::Key::fromProblem("gfx90a", makeProblem(1024, 1500, 4096)).str());
+    }
+
+    TEST(GemmTuningTest, DatabaseRoundTrip)
+    {
+        auto path    = tempPath("roundtrip.db");
+        auto model   = gfx90aModel();
+        auto tuner   = GemmTuning::Autotuner(model);
+        auto written = GemmTuning::TuningDatabase();
+
+        // Tune a spread of shapes, in no particular key order
+        for(auto size : {4096u, 256u, 1024u, 512u, 2048u})
+        {
+            auto problem = makeProblem(size, size, size);
+            auto backend = GemmTuning::SyntheticTimingBackend(model, problem);
+            auto result  = tuner.tune(problem, candidateSpace(), syntheticTiming(backend));
+            ASSERT_TRUE(result.found());
+
+            auto const& best = result.best();
+            EXPECT_TRUE(written.update(
+                GemmTuning::Key::fromProblem("gfx90a", problem),
+                {best.candidate, best.measuredMs, problem.flops() / best.measuredMs * 1.0e-9}));
+        }
+        written.save(path);
+
+        GemmTuning::MappedTuningDatabase mapped(path);
+        ASSERT_TRUE(mapped.isOpen());
+        EXPECT_EQ(mapped.size(), written.size());
+
+        for(auto size : {4096u, 256u, 1024u, 512u, 2048u})
+        {
+            auto key      = GemmTuning::Key::fromProblem("gfx90a", makeProblem(size, size, size));
+            auto found    = mapped.find(key);
+            auto expected = written.find(key);
+            ASSERT_TRUE(found.has_value());
+            EXPECT_EQ(found->candidate.name(), expected->candidate.name());
+            EXPECT_EQ(found->candidate.ldsBytes, expected->candidate.ldsBytes);
+            EXPECT_EQ(found->measuredMs, expected->measuredMs);
+            EXPECT_EQ(found->tflopsPerSec, expected->tflopsPerSec);
+        }
+
+        auto otherArch = GemmTuning::Key::fromProblem("gfx942", makeProblem(256, 256, 256));
+        auto otherSize = GemmTuning::Key::fromProblem("gfx90a", makeProblem(8, 8, 8));
+        EXPECT_FALSE(mapped.find(otherArch).has_value());
+        EXPECT_FALSE(mapped.find(otherSize).has_value());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(GemmTuningTest, DatabaseKeepsFastestOnMerge)
+    {
+        auto path     = tempPath("merge.db");
+        auto key      = GemmTuning::Key::fromProblem("gfx90a", makeProblem(512, 512, 512));
+        auto otherKey = GemmTuning::Key::fromProblem("gfx90a", makeProblem(64, 64, 64));
+        auto fast     = makeCandidate(32, 16, 1, 128, 2);
+        auto slow     = makeCandidate(16, 16, 1, 64, 1);
+
+        GemmTuning::TuningDatabase first;
+        first.update(key, {fast, 1.0, 0.27});
+        first.update(otherKey, {slow, 0.5, 0.01});
+        first.save(path);
+
+        // A later run with a slower result must not evict the faster one
+        GemmTuning::TuningDatabase second;
+        EXPECT_TRUE(second.update(key, {slow, 2.0, 0.13}));
+        EXPECT_FALSE(second.update(key, {slow, 3.0, 0.09}));
+        {
+            GemmTuning::MappedTuningDatabase existing(path);
+            ASSERT_TRUE(existing.isOpen());
+            second.merge(existing);
+        }
+        second.save(path);
+
+        GemmTuning::MappedTuningDatabase mapped(path);
+        ASSERT_TRUE(mapped.isOpen());
+        EXPECT_EQ(mapped.size(), 2u);
+        EXPECT_EQ(mapped.find(key)->candidate.name(), fast.name());
+        EXPECT_EQ(mapped.find(otherKey)->candidate.name(), slow.name());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(GemmTuningTest, DatabaseComparesThroughputWithinBucket)
+    {
+        // 512 and 400 cubed share a bucket. The small shape finishes sooner
+        // with the slower config; the entry must follow throughput instead.
+        auto large = makeProblem(512, 512, 512);
+        auto small = makeProblem(400, 400, 400);
+        auto key   = GemmTuning::Key::fromProblem("gfx90a", large);
+        ASSERT_EQ(key.str(), GemmTuning::Key::fromProblem("gfx90a", small).str());
+
+        auto fast = makeCandidate(32, 16, 1, 128, 2);
+        auto slow = makeCandidate(16, 16, 1, 64, 1);
+
+        auto entry = [](GemmTuning::Problem const&   problem,
+                        GemmTuning::Candidate const& candidate,
+                        double                       measuredMs) {
+            return GemmTuning::Entry{candidate, measuredMs, problem.flops() / measuredMs * 1.0e-9};
+        };
+
+        GemmTuning::TuningDatabase database;
+        EXPECT_TRUE(database.update(key, entry(large, fast, 1.0)));
+        EXPECT_FALSE(database.update(key, entry(small, slow, 0.8)));
+        EXPECT_EQ(database.find(key)->candidate.name(), fast.name());
+
+        EXPECT_TRUE(database.update(key, entry(small, fast, 0.4)));
+        EXPECT_EQ(database.find(key)->measuredMs, 0.4);
+    }
+
+    TEST(GemmTuningTest, RejectsForeignFiles)
+    {
+        auto path = tempPath("foreign.db");
+        auto key  = GemmTuning::Key::fromProblem("gfx90a", makeProblem(512, 512, 512));
+
+        GemmTuning::MappedTuningDatabase mapped;
+        EXPECT_FALSE(mapped.open(path));
+        EXPECT_FALSE(mapped.find(key).has_value());
+
+        // Not a database
+        std::ofstream(path) << "M,N,K,elapsedMs\n";
+        EXPECT_FALSE(mapped.open(path));
+
+        // Other version
+        GemmTuning::TuningDatabase database;
+        database.update(key, {makeCandidate(32, 16, 1, 128, 2), 1.0, 0.0});
+        database.save(path);
+        {
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            uint32_t     version = GemmTuning::DatabaseVersion + 1u;
+            file.seekp(8);
+            file.write(reinterpret_cast<char const*>(&version), sizeof(version));
+        }
+        EXPECT_FALSE(mapped.open(path));
+
+        // Truncated
+        database.save(path);
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8u);
+        EXPECT_FALSE(mapped.open(path));
+
+        database.save(path);
+        EXPECT_TRUE(mapped.open(path));
+        EXPECT_TRUE(mapped.find(key).has_value());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(GemmTuningTest, FieldOverflowThrows)
+    {
+        auto candidate   = makeCandidate(32, 16, 1, 128, 2);
+        candidate.kernel = std::string(64, 'x');
+
+        GemmTuning::TuningDatabase database;
+        database.update(GemmTuning::Key::fromProblem("gfx90a", makeProblem(512, 512, 512)),
+                        {candidate, 1.0, 0.0});
+        EXPECT_THROW(database.save(tempPath("overflow.db")), std::invalid_argument);
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,228 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/types.hpp>
+
+#include "golden_data.hpp"
+#include "reference.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        std::string tempPath(std::string const& name)
+        {
+            return (std::filesystem::temp_directory_path()
+                    / ("rocwmma_golden_" + std::to_string(getpid()) + "_" + name))
+                .string();
+        }
+
+        std::string dlrmGolden(std::string const& name)
+        {
+            return std::string(ROCWMMA_TEST_DLRM_DATA_DIR) + "/" + name + ".golden";
+        }
+
+        // Overwrites one byte of a file in place
+        void patchByte(std::string const& path, uint64_t offset, char value)
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(offset);
+            file.write(&value, 1);
+        }
+
+        // Largest difference relative to the reference, or to 1 near zero
+        template <typename DataT>
+        double maxRelativeDiff(DataT const* result, DataT const* reference, uint64_t count)
+        {
+            double maxDiff = 0.0;
+            for(uint64_t i = 0; i < count; ++i)
+            {
+                auto ref = static_cast<double>(static_cast<float>(reference[i]));
+                auto res = static_cast<double>(static_cast<float>(result[i]));
+                maxDiff  = std::max(maxDiff, std::fabs(res - ref) / std::max(1.0, std::fabs(ref)));
+            }
+            return maxDiff;
+        }
+
+        // Shipped DLRM goldens against dlrm_fwd_CPU and dlrm_bwd_CPU
+        template <typename DataT>
+        void checkDlrmGoldens(std::string const& suffix, double tolerance)
+        {
+            GoldenData::MappedGoldenFile input(dlrmGolden("input_" + suffix));
+            if(!input.isOpen())
+            {
+                GTEST_SKIP() << "DLRM goldens not found in " << ROCWMMA_TEST_DLRM_DATA_DIR;
+            }
+
+            GoldenData::MappedGoldenFile grad(dlrmGolden("input_grad_" + suffix));
+            GoldenData::MappedGoldenFile output(dlrmGolden("output_" + suffix));
+            GoldenData::MappedGoldenFile inputGrad(dlrmGolden("output_input_grad_" + suffix));
+            GoldenData::MappedGoldenFile bottomMlpGrad(
+                dlrmGolden("output_mlp_input_grad_" + suffix));
+            for(auto const* file : {&input, &grad, &output, &inputGrad, &bottomMlpGrad})
+            {
+                ASSERT_TRUE(file->isOpen());
+                EXPECT_TRUE(file->verifyChecksum());
+            }
+
+            ASSERT_EQ(input.rank(), 3u);
+            auto shape    = input.shape();
+            auto batch    = shape[0];
+            auto m        = shape[1];
+            auto k        = shape[2];
+            auto features = ((m * (m - 1)) / 2) + k;
+            ASSERT_EQ(output.shape(), (std::vector<uint64_t>{batch, features}));
+            ASSERT_EQ(grad.shape(), output.shape());
+            ASSERT_EQ(inputGrad.shape(), shape);
+            ASSERT_EQ(bottomMlpGrad.shape(), (std::vector<uint64_t>{batch, k}));
+
+            std::vector<DataT> result(batch * features);
+            dlrm_fwd_CPU<DataT>(input.view<DataT>(), result.data(), m, k, batch);
+            EXPECT_LE(maxRelativeDiff(result.data(), output.view<DataT>(), result.size()),
+                      tolerance);
+
+            std::vector<DataT> resultGrad(batch * m * k);
+            std::vector<DataT> resultMlpGrad(batch * k);
+            dlrm_bwd_CPU<DataT>(input.view<DataT>(),
+                                grad.view<DataT>(),
+                                resultMlpGrad.data(),
+                                resultGrad.data(),
+                                m,
+                                k,
+                                batch);
+            EXPECT_LE(
+                maxRelativeDiff(resultGrad.data(), inputGrad.view<DataT>(), resultGrad.size()),
+                tolerance);
+            EXPECT_EQ(maxRelativeDiff(
+                          resultMlpGrad.data(), bottomMlpGrad.view<DataT>(), resultMlpGrad.size()),
+                      0.0);
+        }
+    }
+
+    TEST(GoldenDataTest, RoundTrip)
+    {
+        auto path = tempPath("round_trip");
+
+        std::vector<float32_t> values(3 * 5 * 7);
+        for(size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<float32_t>(i) * 0.25f - 10.0f;
+        }
+        GoldenData::writeGoldenFile(path, values.data(), {3, 5, 7});
+
+        GoldenData::MappedGoldenFile file(path);
+        ASSERT_TRUE(file.isOpen());
+        EXPECT_TRUE(file.verifyChecksum());
+        EXPECT_EQ(file.dataType(), "f32");
+        EXPECT_EQ(file.shape(), (std::vector<uint64_t>{3, 5, 7}));
+        EXPECT_EQ(file.strides(), (std::vector<uint64_t>{35, 7, 1}));
+        EXPECT_EQ(file.elementCount(), values.size());
+        EXPECT_EQ(file.bytes(), values.size() * sizeof(float32_t));
+
+        // In place and page aligned
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(file.data()) % GoldenData::DataAlignment, 0u);
+        EXPECT_TRUE(std::equal(values.begin(), values.end(), file.view<float32_t>()));
+
+        // Rewriting replaces the file as a whole
+        std::vector<float16_t> halves(16, static_cast<float16_t>(1.5f));
+        GoldenData::writeGoldenFile(path, halves.data(), {16});
+        ASSERT_TRUE(file.open(path));
+        EXPECT_EQ(file.dataType(), "f16");
+        EXPECT_EQ(file.rank(), 1u);
+        EXPECT_EQ(static_cast<float>(file.view<float16_t>()[15]), 1.5f);
+
+        file.close();
+        std::filesystem::remove(path);
+    }
+
+    TEST(GoldenDataTest, RejectsInvalidFiles)
+    {
+        auto path = tempPath("invalid");
+
+        GoldenData::MappedGoldenFile file;
+        EXPECT_FALSE(file.open(path));
+
+        std::vector<int32_t> values(1000, 7);
+        GoldenData::writeGoldenFile(path, values.data(), {10, 100});
+        ASSERT_TRUE(file.open(path));
+
+        // Wrong type
+        EXPECT_THROW(file.view<float32_t>(), std::invalid_argument);
+        EXPECT_NO_THROW(file.view<int32_t>());
+        file.close();
+
+        // Corrupted data still maps, but fails the checksum
+        patchByte(path, GoldenData::DataAlignment + 5, 1);
+        ASSERT_TRUE(file.open(path));
+        EXPECT_FALSE(file.verifyChecksum());
+        file.close();
+
+        // Truncated data
+        std::filesystem::resize_file(path, GoldenData::DataAlignment + 100);
+        EXPECT_FALSE(file.open(path));
+
+        // Another format version
+        GoldenData::writeGoldenFile(path, values.data(), {1000});
+        patchByte(path, offsetof(GoldenData::detail::FileHeader, version), 9);
+        EXPECT_FALSE(file.open(path));
+
+        // Not a golden file
+        GoldenData::writeGoldenFile(path, values.data(), {1000});
+        patchByte(path, 0, 'X');
+        EXPECT_FALSE(file.open(path));
+
+        EXPECT_THROW(GoldenData::writeGoldenFile(path, values.data(), {}), std::invalid_argument);
+        EXPECT_THROW(GoldenData::writeGoldenFile(path, values.data(), {1, 1, 1, 1, 1000}),
+                     std::invalid_argument);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(GoldenDataTest, DlrmGoldensF32)
+    {
+        checkDlrmGoldens<float32_t>("fp32", 1.0e-4);
+    }
+
+    TEST(GoldenDataTest, DlrmGoldensF16)
+    {
+        // The goldens round the fp32 accumulation to f16 once
+        checkDlrmGoldens<float16_t>("fp16", 1.0e-2);
+    }
+
+} // namespace rocwmma
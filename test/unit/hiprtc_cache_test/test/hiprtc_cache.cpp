@@ -0,0 +1,303 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "hiprtc_cache.hpp"
+
+namespace rocwmma
+{
+    // Stand-in for hipRTC: deterministic "binary" derived from the key
+    struct FakeCompiler
+    {
+        std::atomic<uint32_t> calls{0};
+
+        static CodeObjectCache::CodeT expected(CodeObjectKey const& key, size_t bytes = 64)
+        {
+            CodeObjectCache::CodeT code(bytes);
+            auto                   seed = key.hash();
+            for(size_t i = 0; i < bytes; ++i)
+            {
+                code[i] = static_cast<char>((seed >> ((i % 8) * 8)) + i);
+            }
+            return code;
+        }
+
+        CodeObjectCache::CompilerT compiler(size_t bytes = 64)
+        {
+            return [this, bytes](CodeObjectKey const& key) {
+                ++calls;
+                return expected(key, bytes);
+            };
+        }
+    };
+
+    class HiprtcCacheTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            auto name = std::string("rocwmma_hiprtc_cache_test_") + std::to_string(getpid()) + "_"
+                        + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+            mDirectory = std::filesystem::temp_directory_path() / name;
+            std::filesystem::remove_all(mDirectory);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all(mDirectory);
+        }
+
+        static CodeObjectKey makeKey(std::string const& source = "__global__ void k() {}")
+        {
+            return CodeObjectKey{source, {"--std=c++17", "-O3"}, "gfx90a:sramecc+:xnack-", "1.7.0"};
+        }
+
+        static void age(std::filesystem::path const& path, std::chrono::seconds seconds)
+        {
+            std::filesystem::last_write_time(
+                path, std::filesystem::file_time_type::clock::now() - seconds);
+        }
+
+        std::filesystem::path mDirectory;
+    };
+
+    TEST_F(HiprtcCacheTest, CompilesOnMissAndReusesAcrossInstances)
+    {
+        FakeCompiler fake;
+        auto         key = makeKey();
+
+        {
+            CodeObjectCache cache(mDirectory);
+            EXPECT_EQ(cache.getOrCompile(key, fake.compiler()), FakeCompiler::expected(key));
+            EXPECT_EQ(cache.stats().misses, 1u);
+            EXPECT_EQ(cache.stats().hits, 0u);
+        }
+
+        // A new instance models a later process run
+        CodeObjectCache cache(mDirectory);
+        EXPECT_EQ(cache.getOrCompile(key, fake.compiler()), FakeCompiler::expected(key));
+        EXPECT_EQ(cache.stats().hits, 1u);
+        EXPECT_EQ(fake.calls, 1u);
+    }
+
+    TEST_F(HiprtcCacheTest, EveryKeyFieldSelectsADistinctEntry)
+    {
+        FakeCompiler    fake;
+        CodeObjectCache cache(mDirectory);
+
+        auto base    = makeKey();
+        auto source  = makeKey("__global__ void k2() {}");
+        auto options = base;
+        auto order   = base;
+        auto arch    = base;
+        auto version = base;
+        options.options.push_back("-DROCWMMA_M=32");
+        std::swap(order.options[0], order.options[1]);
+        arch.arch       = "gfx942";
+        version.version = "1.7.1";
+
+        std::vector<CodeObjectKey> keys = {base, source, options, order, arch, version};
+        for(auto const& key : keys)
+        {
+            cache.getOrCompile(key, fake.compiler());
+        }
+        EXPECT_EQ(fake.calls, keys.size());
+
+        for(uint32_t i = 0; i < keys.size(); ++i)
+        {
+            for(uint32_t j = i + 1; j < keys.size(); ++j)
+            {
+                EXPECT_NE(cache.entryPath(keys[i]), cache.entryPath(keys[j]));
+            }
+            EXPECT_EQ(cache.load(keys[i]), FakeCompiler::expected(keys[i]));
+        }
+    }
+
+    TEST_F(HiprtcCacheTest, RejectsCorruptAndCollidingEntries)
+    {
+        FakeCompiler    fake;
+        CodeObjectCache cache(mDirectory);
+        auto            key   = makeKey();
+        auto            other = makeKey("__global__ void other() {}");
+
+        // Truncated file
+        cache.store(key, FakeCompiler::expected(key));
+        std::filesystem::resize_file(cache.entryPath(key), 20);
+        EXPECT_FALSE(cache.load(key).has_value());
+
+        // Code size beyond the end of the file must not be allocated
+        cache.store(key, FakeCompiler::expected(key));
+        {
+            uint64_t     codeSize = 1ull << 62;
+            std::fstream file(cache.entryPath(key),
+                              std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(8 + sizeof(uint64_t) + key.descriptor().size());
+            file.write(reinterpret_cast<char const*>(&codeSize), sizeof(codeSize));
+        }
+        EXPECT_FALSE(cache.load(key).has_value());
+
+        // A different key's entry found at this key's path (hash collision)
+        cache.store(other, FakeCompiler::expected(other));
+        std::filesystem::copy_file(cache.entryPath(other),
+                                   cache.entryPath(key),
+                                   std::filesystem::copy_options::overwrite_existing);
+        EXPECT_FALSE(cache.load(key).has_value());
+
+        // Recompiled and repaired
+        EXPECT_EQ(cache.getOrCompile(key, fake.compiler()), FakeCompiler::expected(key));
+        EXPECT_EQ(fake.calls, 1u);
+        EXPECT_EQ(cache.load(key), FakeCompiler::expected(key));
+    }
+
+    TEST_F(HiprtcCacheTest, EvictsLeastRecentlyUsed)
+    {
+        FakeCompiler fake;
+        auto         keyA = makeKey("a"), keyB = makeKey("b"), keyC = makeKey("c");
+
+        // Budget fits two entries
+        CodeObjectCache probe(mDirectory);
+        probe.store(keyA, FakeCompiler::expected(keyA, 1024));
+        auto entryBytes = std::filesystem::file_size(probe.entryPath(keyA));
+
+        CodeObjectCache cache(mDirectory, 2 * entryBytes + entryBytes / 2);
+        cache.store(keyB, FakeCompiler::expected(keyB, 1024));
+        age(cache.entryPath(keyA), std::chrono::seconds(300));
+        age(cache.entryPath(keyB), std::chrono::seconds(200));
+
+        // Touching A makes B the least recently used
+        EXPECT_TRUE(cache.load(keyA).has_value());
+        cache.getOrCompile(keyC, fake.compiler(1024));
+
+        EXPECT_TRUE(std::filesystem::exists(cache.entryPath(keyA)));
+        EXPECT_FALSE(std::filesystem::exists(cache.entryPath(keyB)));
+        EXPECT_TRUE(std::filesystem::exists(cache.entryPath(keyC)));
+        EXPECT_EQ(cache.stats().evictions, 1u);
+    }
+
+    TEST_F(HiprtcCacheTest, RemovesStaleTemporaries)
+    {
+        CodeObjectCache cache(mDirectory);
+        auto            stale = mDirectory / "0123456789abcdef.co.tmp.1.1.0";
+        auto            fresh = mDirectory / "0123456789abcdef.co.tmp.2.1.0";
+        std::ofstream(stale) << "partial";
+        std::ofstream(fresh) << "partial";
+        age(stale, std::chrono::hours(2));
+
+        cache.evict();
+
+        // A fresh temporary may belong to a live writer
+        EXPECT_FALSE(std::filesystem::exists(stale));
+        EXPECT_TRUE(std::filesystem::exists(fresh));
+    }
+
+    TEST_F(HiprtcCacheTest, ConcurrentThreadsShareEntries)
+    {
+        FakeCompiler             fake;
+        CodeObjectCache          cache(mDirectory);
+        std::atomic<uint32_t>    mismatches(0);
+        std::vector<std::thread> threads;
+
+        for(uint32_t t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([&]() {
+                for(uint32_t i = 0; i < 50; ++i)
+                {
+                    auto key = makeKey(std::to_string(i % 5));
+                    if(cache.getOrCompile(key, fake.compiler(4096))
+                       != FakeCompiler::expected(key, 4096))
+                    {
+                        ++mismatches;
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(mismatches, 0u);
+        EXPECT_EQ(cache.stats().hits + cache.stats().misses, 8u * 50u);
+    }
+
+    TEST_F(HiprtcCacheTest, ConcurrentProcessesNeverObservePartialEntries)
+    {
+        // Each child hammers the same keys with a budget that forces
+        // eviction, and exits non-zero on any torn or mismatched read.
+        std::filesystem::create_directories(mDirectory);
+        std::vector<pid_t> children;
+
+        for(uint32_t p = 0; p < 4; ++p)
+        {
+            auto pid = fork();
+            ASSERT_GE(pid, 0);
+            if(pid == 0)
+            {
+                FakeCompiler    fake;
+                CodeObjectCache cache(mDirectory, 6u * 64u * 1024u);
+                int             status = 0;
+                for(uint32_t i = 0; i < 100 && status == 0; ++i)
+                {
+                    auto key = makeKey(std::to_string((i * (p + 1)) % 8));
+                    if(cache.getOrCompile(key, fake.compiler(64 * 1024))
+                       != FakeCompiler::expected(key, 64 * 1024))
+                    {
+                        status = 1;
+                    }
+                }
+                _exit(status);
+            }
+            children.push_back(pid);
+        }
+
+        for(auto pid : children)
+        {
+            int status = -1;
+            waitpid(pid, &status, 0);
+            EXPECT_TRUE(WIFEXITED(status));
+            EXPECT_EQ(WEXITSTATUS(status), 0);
+        }
+
+        // No temporaries left behind by clean writers
+        for(auto const& it : std::filesystem::directory_iterator(mDirectory))
+        {
+            EXPECT_EQ(it.path().extension(), CodeObjectCache::Extension);
+        }
+    }
+
+} // namespace rocwmma
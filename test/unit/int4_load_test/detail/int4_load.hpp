@@ -0,0 +1,311 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_INT4_LOAD_HPP
+#define ROCWMMA_DETAIL_INT4_LOAD_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <rocwmma/internal/int4_unpack.hpp>
+
+#include "device/int4_load.hpp"
+#include "helper_macros.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Packed 4-bit loads into int8_t or float16_t fragments against the host
+    // Int4Unpack model. Inputs are passed as raw bytes.
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename Layout,
+              typename PackedT>
+    struct Int4LoadKernel final : public UnitKernelBase<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, Layout>;
+
+        template <uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = FragSize_guard<BlockM, BlockN, DataT, Layout, WaveSize, ArchId>;
+
+        constexpr static bool Signed = std::is_same<PackedT, int4x2_t>::value;
+
+        // Host inputs, kept for the reference
+        std::vector<uint8_t>   mPacked;
+        std::vector<uint8_t>   mZeroPoints;
+        std::vector<float16_t> mScales;
+
+        // Zero-points / scales leading dimension
+        uint32_t groupLd() const
+        {
+            auto groups = int4LoadGroups<MatrixT, BlockM, BlockN>(Base::mM, Base::mN);
+            return std::is_same<Layout, row_major>::value ? get<1>(groups) : get<0>(groups);
+        }
+
+        uint32_t groupIndex(uint32_t row, uint32_t col) const
+        {
+            auto isMatrixA = std::is_same<MatrixT, matrix_a>::value;
+            auto groupRow  = isMatrixA ? row : row / BlockM;
+            auto groupCol  = isMatrixA ? col / BlockN : col;
+            return std::is_same<Layout, row_major>::value ? groupRow * groupLd() + groupCol
+                                                          : groupCol * groupLd() + groupRow;
+        }
+
+        // Unpacked element at matrix offset, through the host Int4Unpack model
+        DataT reference(uint32_t offset) const
+        {
+            using Unpack = detail::Int4Unpack;
+
+            uint32_t packed;
+            std::memcpy(&packed, mPacked.data() + offset / 8u * 4u, sizeof(uint32_t));
+            auto i = offset % 8u;
+
+            if constexpr(std::is_same<DataT, int8_t>::value)
+            {
+                uint32_t lo, hi;
+                Unpack::toInt8<Signed>(packed, lo, hi);
+                return static_cast<int8_t>((i < 4u ? lo : hi) >> ((i % 4u) * 8u));
+            }
+            else
+            {
+                uint32_t words[4];
+                Unpack::toF16Magic<Signed>(packed, words);
+                auto bits = static_cast<uint16_t>(words[i / 2u] >> ((i % 2u) * 16u));
+
+                float16_t value;
+                std::memcpy(&value, &bits, sizeof(uint16_t));
+                return value;
+            }
+        }
+
+    public:
+        Int4LoadKernel()  = default;
+        ~Int4LoadKernel() = default;
+
+        bool checkSizes() const final
+        {
+            // Dword loads need leading dimensions in multiples of 8 elements
+            return Base::checkSizes() && (Base::mLd % 8u == 0u);
+        }
+
+        bool checkQuirks() const final
+        {
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // The test guard for this class requires 2 values at runtime.
+            auto dispatchGuard = [waveSize, deviceArch]() {
+                bool dispatchResult = false;
+
+#define CASE_IMPL_ASSIGN2(WAVE_SIZE, ARCH_ID) \
+    dispatchResult = TestGuard<WAVE_SIZE, ARCH_ID>::enable();
+
+#define SWITCH_BODY_WAVE_SIZE(ARCH_ID) \
+    ROCWMMA_SWITCH_BODY2_ARG2(         \
+        waveSize, CASE_IMPL_ASSIGN2, HipDevice::Wave32, HipDevice::Wave64, ARCH_ID)
+
+#define DISPATCH_GUARD_BODY                           \
+    ROCWMMA_SWITCH_BODY10_ARG1(deviceArch,            \
+                               SWITCH_BODY_WAVE_SIZE, \
+                               HipDevice::GFX908,     \
+                               HipDevice::GFX90A,     \
+                               HipDevice::GFX940,     \
+                               HipDevice::GFX941,     \
+                               HipDevice::GFX942,     \
+                               HipDevice::GFX1100,    \
+                               HipDevice::GFX1101,    \
+                               HipDevice::GFX1102,    \
+                               HipDevice::GFX1200,    \
+                               HipDevice::GFX1201)
+
+                DISPATCH_GUARD_BODY
+
+#undef CASE_IMPL_ASSIGN2
+#undef SWITCH_BODY_WAVE_SIZE
+#undef DISPATCH_GUARD_BODY
+
+                return dispatchResult;
+            };
+
+            return Base::checkQuirks() && dispatchGuard();
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, BlkM, BlkN, MatM, MatN, ld, Matrix, Packed, "
+                             "Lyt, Td, Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << BlockM << ", " << BlockN << ", "
+                   << Base::mM << ", " << Base::mN << ", " << Base::mLd << ", "
+                   << (std::is_same<MatrixT, matrix_a>::value ? "A" : "B") << ", "
+                   << (Signed ? "i4" : "u4") << ", " << dataTypeToString<Layout>() << ", "
+                   << dataTypeToString<DataT>() << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+            return stream;
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& /*probsize*/) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto groups = int4LoadGroups<MatrixT, BlockM, BlockN>(Base::mM, Base::mN);
+            auto count  = get<0>(groups) * get<1>(groups);
+
+            // Random nibbles, zero-points and scales of 1/16 to 4
+            std::mt19937 gen(static_cast<uint32_t>(Base::mM * 31u + Base::mN));
+            mPacked.resize(Base::mM * Base::mN / 2u);
+            mZeroPoints.resize(count);
+            mScales.resize(count);
+            std::generate(mPacked.begin(), mPacked.end(), [&gen]() { return gen() & 0xFFu; });
+            std::generate(
+                mZeroPoints.begin(), mZeroPoints.end(), [&gen]() { return gen() & 0xFu; });
+            std::generate(mScales.begin(), mScales.end(), [&gen]() {
+                return static_cast<float16_t>(static_cast<float>(gen() % 64u + 1u) / 16.0f);
+            });
+
+            // Pack [data][zero-points][pad to 2 bytes][scales] as bytes
+            auto scalesOffset = mPacked.size() + count + (count & 1u);
+            auto inBytes      = scalesOffset + mScales.size() * sizeof(float16_t);
+            auto inElements   = static_cast<int64_t>(ceilDiv(inBytes, sizeof(DataT)));
+            auto outElements  = static_cast<int64_t>(Base::mM) * Base::mN;
+
+            dataInstance->resizeStorage({std::max(inElements, outElements), 1});
+
+            auto* bytes = reinterpret_cast<uint8_t*>(dataInstance->hostIn().get());
+            std::memcpy(bytes, mPacked.data(), mPacked.size());
+            std::memcpy(bytes + mPacked.size(), mZeroPoints.data(), count);
+            std::memcpy(bytes + scalesOffset, mScales.data(), mScales.size() * sizeof(float16_t));
+
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), inElements);
+
+            // 0x7F bytes are out of the int8_t result range, and NaN in float16_t
+            CHECK_HIP_ERROR(
+                hipMemset(dataInstance->deviceOut().get(), 0x7F, outElements * sizeof(DataT)));
+        }
+
+        void validateResultsImpl() final
+        {
+            using Unpack = detail::Int4Unpack;
+
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto m = Base::mM;
+            auto n = Base::mN;
+
+            dataInstance->copyData(
+                dataInstance->hostOut(), dataInstance->deviceOut(), static_cast<int64_t>(m) * n);
+
+            std::vector<DataT> expected(m * n);
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < n; col++)
+                {
+                    auto offset = std::is_same<Layout, row_major>::value ? row * n + col
+                                                                         : col * m + row;
+                    auto group  = groupIndex(row, col);
+                    auto value  = reference(offset);
+
+                    if constexpr(std::is_same<DataT, int8_t>::value)
+                    {
+                        expected[offset] = static_cast<int8_t>(value - mZeroPoints[group]);
+                    }
+                    else
+                    {
+                        auto offset16 = Unpack::f16Offset<Signed>(mZeroPoints[group]);
+                        value -= static_cast<float16_t>(offset16);
+                        expected[offset] = value * mScales[group];
+                    }
+                }
+            }
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqual<DataT, DataT, Layout, Layout>(
+                    expected.data(), dataInstance->hostOut().get(), m, n, 10.0);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                int4LoadSync<MatrixT, BlockM, BlockN, DataT, Layout, PackedT>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct Int4LoadGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT   = 0,
+            PackedT = 1,
+            MatrixT = 2,
+            BlockM  = 3,
+            BlockN  = 4,
+            Layout  = 5
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = Int4LoadKernel<std::tuple_element_t<MatrixT, TestParamsT>, // MatrixT
+                                 std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                 std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                 std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                 std::tuple_element_t<Layout, TestParamsT>, // Layout
+                                 std::tuple_element_t<PackedT, TestParamsT> // PackedT
+                                 >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_INT4_LOAD_HPP
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_INT4_LOAD_HPP
+#define ROCWMMA_DEVICE_INT4_LOAD_HPP
+
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+
+    // Zero-points / scales matrix: one per row of matrix_a or column of
+    // matrix_b, for each fragment along K
+    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN>
+    ROCWMMA_HOST_DEVICE constexpr inline auto int4LoadGroups(uint32_t m, uint32_t n)
+    {
+        return is_same<MatrixT, matrix_a>::value ? make_coord2d(m, n / BlockN)
+                                                 : make_coord2d(m / BlockM, n);
+    }
+
+    // Loads packed 4-bit data into a matrix_a (BlockM x BlockK = BlockN) or
+    // matrix_b (BlockK = BlockM x BlockN) fragment, then stores the unpacked
+    // fragment. Zero-points, and scales for float16_t, are applied on load.
+    //
+    // in: [packed m x n][zero-points][pad to 2 bytes][float16_t scales] as bytes
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename Layout,
+              typename PackedT>
+    ROCWMMA_KERNEL void int4LoadSync(uint32_t     m,
+                                     uint32_t     n,
+                                     DataT const* in,
+                                     DataT*       out,
+                                     uint32_t     ld,
+                                     DataT        param1,
+                                     DataT        param2)
+    {
+        if constexpr(FragSize_guard<BlockM,
+                                    BlockN,
+                                    DataT,
+                                    Layout,
+                                    Constants::AMDGCN_WAVE_SIZE,
+                                    Constants::AMDGCN_CURRENT_ARCH_ID>::enable())
+        {
+            using Mapping      = MappingUtil<BlockM, BlockN, DataT, Layout>;
+            using GroupMapping = DataLayout::template Array1d<Layout>;
+
+            constexpr bool IsMatrixA = is_same<MatrixT, matrix_a>::value;
+
+            using FragT = conditional_t<IsMatrixA,
+                                        fragment<matrix_a, BlockM, 1, BlockN, DataT, Layout>,
+                                        fragment<matrix_b, 1, BlockN, BlockM, DataT, Layout>>;
+
+            auto groups = int4LoadGroups<MatrixT, BlockM, BlockN>(m, n);
+            auto count  = get<0>(groups) * get<1>(groups);
+            auto ldq    = is_same<Layout, row_major>::value ? get<1>(groups) : get<0>(groups);
+
+            auto const* bytes      = reinterpret_cast<uint8_t const*>(in);
+            auto const* packed     = reinterpret_cast<PackedT const*>(bytes);
+            auto const* zeroPoints = bytes + m * n / 2u;
+            auto const* scales
+                = reinterpret_cast<float16_t const*>(zeroPoints + count + (count & 1u));
+
+            // Group of the current fragment
+            auto coord      = Mapping::matrixCoord();
+            auto groupCoord = IsMatrixA ? make_coord2d(get<0>(coord), get<1>(coord) / BlockN)
+                                        : make_coord2d(get<0>(coord) / BlockM, get<1>(coord));
+            auto group      = GroupMapping::fromMatrixCoord(groupCoord, ldq);
+
+            // Fragments start on an even element
+            auto* data = packed + GroupMapping::fromMatrixCoord(coord, ld) / 2u;
+
+            FragT frag;
+            if constexpr(is_same<DataT, int8_t>::value)
+            {
+                load_matrix_sync(frag, data, ld, int4_zero_points{zeroPoints + group, ldq});
+            }
+            else
+            {
+                load_matrix_sync(
+                    frag, data, ld, int4_dequantization{zeroPoints + group, scales + group, ldq});
+            }
+            store_matrix_sync(Mapping::dataCoord(out, ld), frag, ld);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_INT4_LOAD_HPP
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <tuple>
+#include <type_traits>
+
+#include "detail/int4_load.hpp"
+#include "kernel_generator.hpp"
+#include "unit_test.hpp"
+
+namespace rocwmma
+{
+
+    struct TestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        // Types: int8_t, float16_t from int4 and uint4
+        // Matrices: A, B
+        // Block Sizes: 16 x 16, 16 x 64, 32 x 32
+        // Layouts: N, T
+        using Types        = std::tuple<int8_t, float16_t>;
+        using PackedTypes  = std::tuple<int4x2_t, uint4x2_t>;
+        using Matrices     = std::tuple<matrix_a, matrix_b>;
+        using BlockSizes   = std::tuple<std::tuple<I<16>, I<16>>,
+                                      std::tuple<I<16>, I<64>>,
+                                      std::tuple<I<32>, I<32>>>;
+        using Layouts      = typename Base::TestLayoutsAll;
+        using KernelParams =
+            typename CombineLists<Types, PackedTypes, Matrices, BlockSizes, Layouts>::Result;
+
+        // Assemble the kernel generator
+        // Kernel: int4LoadSync
+        using GeneratorImpl   = Int4LoadGenerator;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return {{16, 16}, {32, 32}, {64, 64}, {64, 256}, {256, 64}, {128, 128}};
+        }
+    };
+
+} // namespace rocwmma
+
+// Test suite for unique parameterization
+class Int4LoadTest : public rocwmma::UnitTest
+{
+};
+
+TEST_P(Int4LoadTest, RunKernel)
+{
+    this->RunKernel();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    KernelTests,
+    Int4LoadTest,
+    ::testing::Combine(::testing::ValuesIn(rocwmma::TestParams::kernels()),
+                       ::testing::ValuesIn(rocwmma::TestParams::threadBlocks()),
+                       ::testing::ValuesIn(rocwmma::TestParams::problemSizes()),
+                       ::testing::ValuesIn(rocwmma::TestParams::param1s()),
+                       ::testing::ValuesIn(rocwmma::TestParams::param2s())));
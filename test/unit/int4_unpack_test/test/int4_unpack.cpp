@@ -0,0 +1,219 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/int4_unpack.hpp>
+
+#include "bulk_convert.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using detail::Int4Unpack;
+        using detail::permBytes;
+
+        // Element i of a packed dword, as an integer
+        template <bool Signed>
+        int32_t nibble(uint32_t packed, uint32_t i)
+        {
+            auto q = static_cast<int32_t>((packed >> (i * 4u)) & 0xFu);
+            return Signed && q >= 8 ? q - 16 : q;
+        }
+
+        uint32_t byteOf(uint32_t word, uint32_t i)
+        {
+            return (word >> (i * 8u)) & 0xFFu;
+        }
+
+        // Packed dwords: every nibble value at every position, then random
+        std::vector<uint32_t> packedValues()
+        {
+            std::vector<uint32_t> values;
+            for(uint32_t q = 0u; q < 16u; q++)
+            {
+                for(uint32_t i = 0u; i < 8u; i++)
+                {
+                    values.push_back(q << (i * 4u));
+                    values.push_back((q << (i * 4u)) | (0xFFFFFFFFu & ~(0xFu << (i * 4u))));
+                }
+                values.push_back(q * 0x11111111u);
+            }
+
+            std::mt19937 gen(1u);
+            for(uint32_t i = 0u; i < 1u << 16u; i++)
+            {
+                values.push_back(gen());
+            }
+            return values;
+        }
+
+        template <bool Signed>
+        void checkInt8()
+        {
+            for(auto packed : packedValues())
+            {
+                uint32_t lo, hi;
+                Int4Unpack::toInt8<Signed>(packed, lo, hi);
+                for(uint32_t i = 0u; i < 8u; i++)
+                {
+                    auto value = static_cast<int8_t>(byteOf(i < 4u ? lo : hi, i % 4u));
+                    ASSERT_EQ(value, nibble<Signed>(packed, i)) << std::hex << packed << " " << i;
+                }
+            }
+        }
+
+        template <bool Signed>
+        void checkF16Magic()
+        {
+            using BulkConvert::decodeScalar;
+            using BulkConvert::Format;
+            using BulkConvert::detail::bitsFloat;
+
+            for(auto packed : packedValues())
+            {
+                uint32_t words[4];
+                Int4Unpack::toF16Magic<Signed>(packed, words);
+                for(uint32_t i = 0u; i < 8u; i++)
+                {
+                    auto bits  = (words[i / 2u] >> ((i % 2u) * 16u)) & 0xFFFFu;
+                    auto value = bitsFloat(decodeScalar<Format::F16>(bits));
+
+                    // Subtracting the offset of each zero-point is exact in f16
+                    for(uint32_t zeroPoint = 0u; zeroPoint < 16u; zeroPoint++)
+                    {
+                        auto offset = static_cast<float>(Int4Unpack::f16Offset<Signed>(zeroPoint));
+                        ASSERT_EQ(value - offset,
+                                  static_cast<float>(nibble<Signed>(packed, i))
+                                      - static_cast<float>(zeroPoint))
+                            << std::hex << packed << " " << i;
+                    }
+                }
+            }
+        }
+
+    } // namespace
+
+    TEST(Int4UnpackTest, PermBytesModel)
+    {
+        uint32_t src0 = 0x83027100u;
+        uint32_t src1 = 0x07F68504u;
+
+        // Byte select from {src1, src0}
+        for(uint32_t s = 0u; s < 8u; s++)
+        {
+            auto expected = s < 4u ? byteOf(src0, s) : byteOf(src1, s - 4u);
+            EXPECT_EQ(permBytes(src0, src1, s * 0x01010101u), expected * 0x01010101u) << s;
+        }
+
+        // Sign bits of bytes 1 and 3 of each source: 0x71, 0x83, 0x85, 0x07
+        EXPECT_EQ(permBytes(src0, src1, 0x08080808u), 0x00000000u);
+        EXPECT_EQ(permBytes(src0, src1, 0x09090909u), 0xFFFFFFFFu);
+        EXPECT_EQ(permBytes(src0, src1, 0x0A0A0A0Au), 0xFFFFFFFFu);
+        EXPECT_EQ(permBytes(src0, src1, 0x0B0B0B0Bu), 0x00000000u);
+
+        // Constants
+        EXPECT_EQ(permBytes(src0, src1, 0x0C0C0C0Cu), 0x00000000u);
+        EXPECT_EQ(permBytes(src0, src1, 0x0D0E0F10u), 0xFFFFFFFFu);
+
+        // Blend::UnpackByteLo / UnpackByteHi orderings
+        EXPECT_EQ(permBytes(0x03020100u, 0x07060504u, Int4Unpack::selector(0u, 4u, 1u, 5u)),
+                  0x05010400u);
+        EXPECT_EQ(permBytes(0x03020100u, 0x07060504u, Int4Unpack::selector(2u, 6u, 3u, 7u)),
+                  0x07030602u);
+    }
+
+    TEST(Int4UnpackTest, Int4ToInt8)
+    {
+        checkInt8<true>();
+    }
+
+    TEST(Int4UnpackTest, Uint4ToInt8)
+    {
+        checkInt8<false>();
+    }
+
+    TEST(Int4UnpackTest, Int4ToF16)
+    {
+        checkF16Magic<true>();
+    }
+
+    TEST(Int4UnpackTest, Uint4ToF16)
+    {
+        checkF16Magic<false>();
+    }
+
+    TEST(Int4UnpackTest, SubBytes)
+    {
+        // Each lane against every pair of bytes, with the other lanes varying
+        std::mt19937 gen(2u);
+        for(uint32_t lane = 0u; lane < 4u; lane++)
+        {
+            for(uint32_t a = 0u; a < 256u; a++)
+            {
+                for(uint32_t b = 0u; b < 256u; b++)
+                {
+                    auto mask  = ~(0xFFu << (lane * 8u));
+                    auto wordA = (gen() & mask) | (a << (lane * 8u));
+                    auto wordB = (gen() & mask) | (b << (lane * 8u));
+
+                    auto result = Int4Unpack::subBytes(wordA, wordB);
+                    for(uint32_t i = 0u; i < 4u; i++)
+                    {
+                        ASSERT_EQ(byteOf(result, i), (byteOf(wordA, i) - byteOf(wordB, i)) & 0xFFu)
+                            << std::hex << wordA << " " << wordB;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Int4UnpackTest, ZeroPoints)
+    {
+        // uint4 with zero-points in [0, 15] stays in int8 range
+        for(auto packed : packedValues())
+        {
+            uint32_t lo, hi;
+            Int4Unpack::toInt8<false>(packed, lo, hi);
+
+            uint32_t zeroPoints = (packed * 0x9E3779B9u) & 0x0F0F0F0Fu;
+            auto     resultLo   = Int4Unpack::subBytes(lo, zeroPoints);
+            auto     resultHi   = Int4Unpack::subBytes(hi, zeroPoints);
+            for(uint32_t i = 0u; i < 8u; i++)
+            {
+                auto value = static_cast<int8_t>(byteOf(i < 4u ? resultLo : resultHi, i % 4u));
+                auto zp    = static_cast<int32_t>(byteOf(zeroPoints, i % 4u));
+                ASSERT_EQ(value, nibble<false>(packed, i) - zp) << std::hex << packed << " " << i;
+            }
+        }
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "kernel_pipeline.hpp"
+
+namespace rocwmma
+{
+    // Host stand-in for a test kernel: records when each stage ran
+    struct FakeKernelJob
+    {
+        uint32_t    id;
+        void const* resource;
+        uint32_t    validateSleepMs;
+        bool        throwOnValidate;
+
+        int64_t issueBegin, issueEnd;
+        int64_t validateBegin, validateEnd;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    static int64_t nowUs(Clock::time_point const& start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    }
+
+    struct FakeKernelHarness
+    {
+        FakeKernelHarness()
+            : start(Clock::now())
+            , inFlight(0)
+            , maxInFlight(0)
+        {
+        }
+
+        typename KernelPipeline<FakeKernelJob>::Stages stages(uint32_t issueSleepMs = 1u)
+        {
+            typename KernelPipeline<FakeKernelJob>::Stages result;
+            result.issue = [this, issueSleepMs](FakeKernelJob& job) {
+                // Issue and report both run on the calling thread
+                auto current = ++inFlight;
+                if(current > maxInFlight)
+                {
+                    maxInFlight = current;
+                }
+
+                job.issueBegin = nowUs(start);
+                std::this_thread::sleep_for(std::chrono::milliseconds(issueSleepMs));
+                job.issueEnd = nowUs(start);
+            };
+            result.validate = [this](FakeKernelJob& job) {
+                job.validateBegin = nowUs(start);
+                std::this_thread::sleep_for(std::chrono::milliseconds(job.validateSleepMs));
+                if(job.throwOnValidate)
+                {
+                    throw std::runtime_error("validation failure " + std::to_string(job.id));
+                }
+                job.validateEnd = nowUs(start);
+            };
+            result.report = [this](FakeKernelJob& job) {
+                --inFlight;
+                reportOrder.push_back(job.id);
+            };
+            result.resourceKey = [](FakeKernelJob const& job) { return job.resource; };
+            return result;
+        }
+
+        Clock::time_point     start;
+        std::atomic<uint32_t> inFlight;
+        std::atomic<uint32_t> maxInFlight;
+        std::vector<uint32_t> reportOrder;
+    };
+
+    static std::vector<FakeKernelJob>
+        makeJobs(uint32_t count, uint32_t validateSleepMs, uint32_t resourceCount = 0u)
+    {
+        static char resources[64];
+        auto        jobs = std::vector<FakeKernelJob>(count);
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            jobs[i]                 = FakeKernelJob();
+            jobs[i].id              = i;
+            jobs[i].resource        = resourceCount ? &resources[i % resourceCount] : nullptr;
+            jobs[i].validateSleepMs = validateSleepMs;
+            jobs[i].throwOnValidate = false;
+        }
+        return jobs;
+    }
+
+    TEST(KernelPipelineTest, ReportsInSubmissionOrder)
+    {
+        auto jobs = makeJobs(16u, 0u);
+
+        // Make validation finish out of order
+        for(auto& job : jobs)
+        {
+            job.validateSleepMs = (job.id % 4u == 0u) ? 8u : 0u;
+        }
+
+        FakeKernelHarness harness;
+        KernelPipeline<FakeKernelJob> pipeline(4u, 4u);
+        auto                          stats = pipeline.run(jobs, harness.stages());
+
+        EXPECT_EQ(stats.jobsRun, 16u);
+        ASSERT_EQ(harness.reportOrder.size(), 16u);
+        for(uint32_t i = 0; i < 16u; ++i)
+        {
+            EXPECT_EQ(harness.reportOrder[i], i);
+        }
+    }
+
+    TEST(KernelPipelineTest, BoundsInFlightDepth)
+    {
+        for(uint32_t depth : {1u, 2u, 3u, 5u})
+        {
+            auto              jobs = makeJobs(12u, 2u);
+            FakeKernelHarness harness;
+            KernelPipeline<FakeKernelJob> pipeline(depth, 8u);
+            auto                          stats = pipeline.run(jobs, harness.stages());
+
+            EXPECT_LE(stats.maxInFlight, depth);
+            EXPECT_LE(harness.maxInFlight.load(), depth);
+            EXPECT_EQ(harness.reportOrder.size(), 12u);
+        }
+    }
+
+    TEST(KernelPipelineTest, DepthZeroRunsSerially)
+    {
+        auto              jobs = makeJobs(6u, 1u);
+        FakeKernelHarness harness;
+        KernelPipeline<FakeKernelJob> pipeline(0u, 2u);
+        EXPECT_EQ(pipeline.depth(), 1u);
+
+        pipeline.run(jobs, harness.stages());
+
+        // Next issue never starts before previous validation finished
+        for(uint32_t i = 1; i < jobs.size(); ++i)
+        {
+            EXPECT_GE(jobs[i].issueBegin, jobs[i - 1].validateEnd);
+        }
+    }
+
+    TEST(KernelPipelineTest, OverlapsIssueWithValidation)
+    {
+        auto              jobs = makeJobs(4u, 20u);
+        FakeKernelHarness harness;
+        KernelPipeline<FakeKernelJob> pipeline(2u, 2u);
+        pipeline.run(jobs, harness.stages(5u));
+
+        // Issue of job i+1 happens while job i is validating
+        for(uint32_t i = 1; i < jobs.size(); ++i)
+        {
+            EXPECT_LT(jobs[i].issueBegin, jobs[i - 1].validateEnd);
+        }
+    }
+
+    TEST(KernelPipelineTest, SerializesSharedResources)
+    {
+        // Two kernel objects alternate: neighbours may overlap, but
+        // jobs on the same kernel object must not.
+        auto              jobs = makeJobs(10u, 3u, 2u);
+        FakeKernelHarness harness;
+        KernelPipeline<FakeKernelJob> pipeline(4u, 4u);
+        auto                          stats = pipeline.run(jobs, harness.stages());
+
+        EXPECT_LE(stats.maxInFlight, 2u);
+        for(uint32_t i = 2; i < jobs.size(); ++i)
+        {
+            EXPECT_GE(jobs[i].issueBegin, jobs[i - 2].validateEnd);
+        }
+    }
+
+    TEST(KernelPipelineTest, PropagatesValidationErrors)
+    {
+        auto jobs                = makeJobs(8u, 1u);
+        jobs[3].throwOnValidate  = true;
+        FakeKernelHarness harness;
+        KernelPipeline<FakeKernelJob> pipeline(3u, 3u);
+
+        EXPECT_THROW(pipeline.run(jobs, harness.stages()), std::runtime_error);
+
+        // Everything before the failure was reported, in order
+        ASSERT_GE(harness.reportOrder.size(), 3u);
+        for(uint32_t i = 0; i < 3u; ++i)
+        {
+            EXPECT_EQ(harness.reportOrder[i], i);
+        }
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "roofline.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        // 100 TFlops/s and 1 TB/s: ridge point at 100 flops per byte
+        constexpr double PeakGFlops = 100000.0;
+        constexpr double PeakGBs    = 1000.0;
+
+        std::vector<std::string> readLines(std::string const& path)
+        {
+            std::ifstream            file(path);
+            std::vector<std::string> lines;
+            for(std::string line; std::getline(file, line);)
+            {
+                lines.push_back(line);
+            }
+            return lines;
+        }
+    }
+
+    TEST(RooflineTest, TiledGemmBytesCountsTileReuse)
+    {
+        // One tile covers everything: each operand is read once
+        EXPECT_DOUBLE_EQ(tiledGemmBytes(64, 64, 32, 64, 64, 2.0, 2.0, 4.0, 4.0),
+                         64.0 * 32 * 2 + 32.0 * 64 * 2 + 64.0 * 64 * 8);
+
+        // 2 x 4 tiles: A is read by 4 tile columns and B by 2 tile rows
+        EXPECT_DOUBLE_EQ(tiledGemmBytes(64, 128, 16, 32, 32, 1.0, 2.0, 0.0, 4.0),
+                         64.0 * 16 * 4 + 16.0 * 128 * 2 * 2 + 64.0 * 128 * 4);
+
+        // Partial tiles are read whole
+        EXPECT_DOUBLE_EQ(tiledGemmBytes(33, 16, 16, 32, 16, 1.0, 1.0, 0.0, 1.0),
+                         33.0 * 16 + 16.0 * 16 * 2 + 33.0 * 16);
+    }
+
+    TEST(RooflineTest, MemoryBoundBelowRidge)
+    {
+        // 1 GFlop over 100 MB in 1 ms: 10 flops per byte
+        auto roofline = calculateRoofline(1.0, 1.0e8, 1.0, PeakGFlops, PeakGBs);
+
+        EXPECT_DOUBLE_EQ(roofline.intensity, 10.0);
+        EXPECT_DOUBLE_EQ(roofline.achievedGBs, 100.0);
+        EXPECT_TRUE(roofline.memoryBound);
+        EXPECT_DOUBLE_EQ(roofline.ceilingGFlops, 10000.0);
+        EXPECT_DOUBLE_EQ(roofline.percent, 10.0);
+    }
+
+    TEST(RooflineTest, ComputeBoundAboveRidge)
+    {
+        // 50 GFlops over 100 MB in 1 ms: 500 flops per byte
+        auto roofline = calculateRoofline(50.0, 1.0e8, 1.0, PeakGFlops, PeakGBs);
+
+        EXPECT_DOUBLE_EQ(roofline.intensity, 500.0);
+        EXPECT_FALSE(roofline.memoryBound);
+        EXPECT_DOUBLE_EQ(roofline.ceilingGFlops, PeakGFlops);
+        EXPECT_DOUBLE_EQ(roofline.percent, 50.0);
+    }
+
+    TEST(RooflineTest, UnknownPeaksDropTheirRoof)
+    {
+        // No compute peak: the bandwidth roof applies at any intensity
+        auto noCompute = calculateRoofline(50.0, 1.0e8, 1.0, 0.0, PeakGBs);
+        EXPECT_TRUE(noCompute.memoryBound);
+        EXPECT_DOUBLE_EQ(noCompute.ceilingGFlops, 500000.0);
+
+        // No bandwidth figure: only the compute roof
+        auto noMemory = calculateRoofline(1.0, 1.0e8, 1.0, PeakGFlops, 0.0);
+        EXPECT_FALSE(noMemory.memoryBound);
+        EXPECT_DOUBLE_EQ(noMemory.percent, 1.0);
+
+        // Nothing measured
+        auto empty = calculateRoofline(1.0, 0.0, 1.0, PeakGFlops, PeakGBs);
+        EXPECT_DOUBLE_EQ(empty.intensity, 0.0);
+        EXPECT_DOUBLE_EQ(empty.percent, 0.0);
+    }
+
+    TEST(RooflineTest, CsvColumnsMatchHeader)
+    {
+        std::stringstream header, row, skipped;
+        printRooflineHeader(header);
+        printRoofline(row, calculateRoofline(1.0, 1.0e8, 1.0, PeakGFlops, PeakGBs));
+        printRooflineSkipped(skipped);
+
+        auto columns = [](std::string const& s) { return std::count(s.begin(), s.end(), ','); };
+        EXPECT_EQ(columns(row.str()), columns(header.str()));
+        EXPECT_EQ(columns(skipped.str()), columns(header.str()));
+        EXPECT_EQ(row.str(), "100, 10, 100, memory, 10, ");
+    }
+
+    TEST(RooflineTest, PlotDataTruncatesOncePerProcess)
+    {
+        auto path = testing::TempDir() + "roofline_test_plot.csv";
+        {
+            std::ofstream stale(path);
+            stale << "stale\n";
+        }
+
+        auto roofline = calculateRoofline(1.0, 1.0e8, 1.0, PeakGFlops, PeakGBs);
+        appendRooflinePlotData(
+            path, "Kernel \"A\", 64x64", 1.0, 1.0, roofline, PeakGFlops, PeakGBs);
+        appendRooflinePlotData(path, "Kernel B", 1.0, 1.0, roofline, PeakGFlops, PeakGBs);
+
+        auto lines = readLines(path);
+        std::remove(path.c_str());
+
+        ASSERT_EQ(lines.size(), 3u);
+        EXPECT_EQ(lines[0].rfind("Kernel, AI(Flops/Byte), GFlops/s", 0), 0u);
+        EXPECT_EQ(lines[1],
+                  "\"Kernel \"\"A\"\", 64x64\", 10, 1000, 100, 100000, 1000, 100, memory, 10");
+        EXPECT_EQ(lines[2].rfind("\"Kernel B\", ", 0), 0u);
+    }
+
+} // namespace rocwmma
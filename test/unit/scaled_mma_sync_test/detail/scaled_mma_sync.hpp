@@ -0,0 +1,236 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_SCALED_MMA_SYNC_HPP
+#define ROCWMMA_DETAIL_SCALED_MMA_SYNC_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "device/scaled_mma_sync.hpp"
+#include "reference.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Block-scaled mma_sync against gemm_mx_CPU. The problem size is M x N,
+    // param1 is K. Inputs and outputs are passed as raw 32-bit words.
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename InputT, typename Layout>
+    struct ScaledMmaSyncKernel final : public UnitKernelBase<BlockM, BlockN, uint32_t, Layout>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, uint32_t, Layout>;
+
+        constexpr static uint32_t ScaleBlockK = 32u;
+
+        uint32_t kBlocks() const
+        {
+            return ceilDiv(Base::mParam1, ScaleBlockK);
+        }
+
+        // Host inputs, kept for the reference
+        std::vector<InputT>  mA, mB;
+        std::vector<uint8_t> mScaleA, mScaleB;
+
+    public:
+        ScaledMmaSyncKernel()  = default;
+        ~ScaledMmaSyncKernel() = default;
+
+        bool checkDevice() const final
+        {
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            auto isGfx94x = (deviceArch == Base::DeviceInfo::GFX940)
+                            || (deviceArch == Base::DeviceInfo::GFX941)
+                            || (deviceArch == Base::DeviceInfo::GFX942);
+            auto isGfx12  = (deviceArch == Base::DeviceInfo::GFX1200)
+                           || (deviceArch == Base::DeviceInfo::GFX1201);
+
+            // f8 / bf8 mma: OCP types on gfx12 with 16 x 16 blocks, fnuz types on gfx94x
+            auto isFnuz = std::is_same<InputT, float8_fnuz_t>::value
+                          || std::is_same<InputT, bfloat8_fnuz_t>::value;
+            auto is16x16 = (BlockM == 16u && BlockN == 16u);
+
+            return Base::checkDevice() && (isFnuz ? isGfx94x : (isGfx12 && is16x16));
+        }
+
+        bool checkSizes() const final
+        {
+            return Base::checkSizes() && (Base::mParam1 > 0u) && (Base::mParam1 % BlockK == 0u);
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, BlkM, BlkN, BlkK, MatM, MatN, MatK, "
+                             "ScaleBlkK, Lyt, Ti, Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << BlockM << ", " << BlockN << ", " << BlockK
+                   << ", " << Base::mM << ", " << Base::mN << ", " << Base::mParam1 << ", "
+                   << ScaleBlockK << ", " << dataTypeToString<Layout>() << ", "
+                   << dataTypeToString<InputT>() << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+            return stream;
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& /*probsize*/) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto m = Base::mM;
+            auto n = Base::mN;
+            auto k = Base::mParam1;
+
+            mA.resize(m * k);
+            mB.resize(k * n);
+            mScaleA.resize(m * kBlocks());
+            mScaleB.resize(kBlocks() * n);
+
+            MatrixUtil<Layout>::fill(mA, m, k);
+            MatrixUtil<Layout>::fill(mB, k, n);
+
+            // Scales of 2^-4 to 2^4 keep every block product exact in float32_t
+            auto fillScales = [](std::vector<uint8_t>& scales, uint32_t seed) {
+                for(uint32_t i = 0u; i < scales.size(); i++)
+                {
+                    scales[i]
+                        = static_cast<uint8_t>(detail::E8M0::Bias - 4u + (i * 7u + seed) % 9u);
+                }
+            };
+            fillScales(mScaleA, 0u);
+            fillScales(mScaleB, 5u);
+
+            // Pack [A][B][scales A][scales B] as bytes
+            auto sizeA   = mA.size() * sizeof(InputT);
+            auto sizeB   = mB.size() * sizeof(InputT);
+            auto inBytes = sizeA + sizeB + mScaleA.size() + mScaleB.size();
+            auto inWords = static_cast<int64_t>(ceilDiv(inBytes, sizeof(uint32_t)));
+            auto outSize = static_cast<int64_t>(m) * n;
+
+            dataInstance->resizeStorage({std::max(inWords, outSize), 1});
+
+            auto* bytes = reinterpret_cast<uint8_t*>(dataInstance->hostIn().get());
+            std::memcpy(bytes, mA.data(), sizeA);
+            std::memcpy(bytes + sizeA, mB.data(), sizeB);
+            std::memcpy(bytes + sizeA + sizeB, mScaleA.data(), mScaleA.size());
+            std::memcpy(bytes + sizeA + sizeB + mScaleA.size(), mScaleB.data(), mScaleB.size());
+
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), inWords);
+
+            // NaN output, so that unwritten results fail
+            CHECK_HIP_ERROR(
+                hipMemset(dataInstance->deviceOut().get(), 0xFF, outSize * sizeof(uint32_t)));
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto m = Base::mM;
+            auto n = Base::mN;
+            auto k = Base::mParam1;
+
+            dataInstance->copyData(
+                dataInstance->hostOut(), dataInstance->deviceOut(), static_cast<int64_t>(m) * n);
+
+            std::vector<float32_t> c(m * n, 0.0f);
+            std::vector<float32_t> reference(m * n);
+            gemm_mx_CPU<InputT, InputT, float32_t, Layout, Layout, Layout, Layout>(m,
+                                                                                   n,
+                                                                                   k,
+                                                                                   mA.data(),
+                                                                                   mScaleA.data(),
+                                                                                   mB.data(),
+                                                                                   mScaleB.data(),
+                                                                                   c.data(),
+                                                                                   reference.data(),
+                                                                                   1.0f,
+                                                                                   0.0f,
+                                                                                   ScaleBlockK);
+
+            auto const* result = reinterpret_cast<float32_t const*>(dataInstance->hostOut().get());
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqual<float32_t, float32_t, Layout, Layout>(
+                    reference.data(), result, m, n, 10.0);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                scaledMmaSync<BlockM, BlockN, BlockK, ScaleBlockK, InputT, Layout>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct ScaledMmaSyncGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT = 0,
+            BlockM = 1,
+            BlockN = 2,
+            BlockK = 3,
+            Layout = 4
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = ScaledMmaSyncKernel<std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                                      std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                                      std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                      std::tuple_element_t<InputT, TestParamsT>, // InputT
+                                      std::tuple_element_t<Layout, TestParamsT> // Layout
+                                      >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_SCALED_MMA_SYNC_HPP
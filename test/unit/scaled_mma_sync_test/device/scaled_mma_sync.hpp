@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_SCALED_MMA_SYNC_HPP
+#define ROCWMMA_DEVICE_SCALED_MMA_SYNC_HPP
+
+#include <rocwmma/rocwmma.hpp>
+
+namespace rocwmma
+{
+    // Block-scaled gemm D = A x B over K = param1, one BlockM x BlockN tile of
+    // D per wave. A, B and D share the same layout, and the E8M0 scales of A
+    // (m x K / ScaleBlockK) and B (K / ScaleBlockK x n) use the layouts of
+    // their data.
+    //
+    // in: [A][B][scales A][scales B] as bytes
+    // out: D as float32_t bits
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              uint32_t ScaleBlockK,
+              typename InputT,
+              typename Layout>
+    ROCWMMA_KERNEL void scaledMmaSync(uint32_t        m,
+                                      uint32_t        n,
+                                      uint32_t const* in,
+                                      uint32_t*       out,
+                                      uint32_t        ld,
+                                      uint32_t        param1,
+                                      uint32_t        param2)
+    {
+        // f8 / bf8 mma: OCP types on gfx12 with 16 x 16 blocks, fnuz types on gfx94x
+        constexpr bool IsFnuz
+            = is_same<InputT, float8_fnuz_t>::value || is_same<InputT, bfloat8_fnuz_t>::value;
+        constexpr bool Enable = IsFnuz ? (bool)ROCWMMA_ARCH_GFX94X
+                                       : (bool)ROCWMMA_ARCH_GFX12 && BlockM == 16u && BlockN == 16u;
+
+        if constexpr(Enable)
+        {
+            using Mapping = DataLayout::template Array1d<Layout>;
+
+            constexpr bool IsRowMajor = is_same<Layout, row_major>::value;
+
+            auto k       = param1;
+            auto kBlocks = (k + ScaleBlockK - 1u) / ScaleBlockK;
+            auto lda     = IsRowMajor ? k : m;
+            auto ldb     = IsRowMajor ? n : k;
+            auto ldsa    = IsRowMajor ? kBlocks : m;
+            auto ldsb    = IsRowMajor ? n : kBlocks;
+
+            auto const* a      = reinterpret_cast<InputT const*>(in);
+            auto const* b      = a + m * k;
+            auto const* scaleA = reinterpret_cast<uint8_t const*>(b + k * n);
+            auto const* scaleB = scaleA + m * kBlocks;
+            auto*       d      = reinterpret_cast<float32_t*>(out);
+
+            // Output tile of the current wave
+            auto waveX = (blockIdx.x * blockDim.x + threadIdx.x) / Constants::AMDGCN_WAVE_SIZE;
+            auto waveY = blockIdx.y * blockDim.y + threadIdx.y;
+            auto row   = waveX * BlockM;
+            auto col   = waveY * BlockN;
+
+            scaled_fragment<matrix_a, BlockM, BlockN, BlockK, InputT, Layout, ScaleBlockK> fragA;
+            scaled_fragment<matrix_b, BlockM, BlockN, BlockK, InputT, Layout, ScaleBlockK> fragB;
+            fragment<accumulator, BlockM, BlockN, BlockK, float32_t, Layout>              fragAcc;
+
+            fill_fragment(fragAcc, 0.0f);
+
+            for(uint32_t kk = 0u; kk < k; kk += BlockK)
+            {
+                auto kb = kk / ScaleBlockK;
+                load_matrix_sync(fragA,
+                                 a + Mapping::fromMatrixCoord(make_coord2d(row, kk), lda),
+                                 lda,
+                                 scaleA + Mapping::fromMatrixCoord(make_coord2d(row, kb), ldsa),
+                                 ldsa);
+                load_matrix_sync(fragB,
+                                 b + Mapping::fromMatrixCoord(make_coord2d(kk, col), ldb),
+                                 ldb,
+                                 scaleB + Mapping::fromMatrixCoord(make_coord2d(kb, col), ldsb),
+                                 ldsb);
+                mma_sync(fragAcc, fragA, fragB, fragAcc);
+            }
+
+            store_matrix_sync(
+                d + Mapping::fromMatrixCoord(make_coord2d(row, col), ld), fragAcc, ld);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_SCALED_MMA_SYNC_HPP
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <tuple>
+#include <type_traits>
+
+#include "detail/scaled_mma_sync.hpp"
+#include "kernel_generator.hpp"
+#include "unit_test.hpp"
+
+namespace rocwmma
+{
+
+    struct TestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        // Types: f8 / bf8
+        // Block Sizes: 16 x 16 x 32, and 32 x 32 x 16 for fnuz types
+        // Layouts: N, T
+        using KernelParams = std::tuple<
+#if ROCWMMA_FP8
+            std::tuple<float8_t, I<16>, I<16>, I<32>, col_major>,
+            std::tuple<float8_t, I<16>, I<16>, I<32>, row_major>,
+            std::tuple<bfloat8_t, I<16>, I<16>, I<32>, col_major>,
+            std::tuple<bfloat8_t, I<16>, I<16>, I<32>, row_major>
+#endif // ROCWMMA_FP8
+
+// Only host will ever include both
+#if ROCWMMA_FP8 && ROCWMMA_FP8_FNUZ
+            ,
+#endif // ROCWMMA_FP8 && ROCWMMA_FP8_FNUZ
+
+#if ROCWMMA_FP8_FNUZ
+            std::tuple<float8_fnuz_t, I<16>, I<16>, I<32>, col_major>,
+            std::tuple<float8_fnuz_t, I<16>, I<16>, I<32>, row_major>,
+            std::tuple<float8_fnuz_t, I<32>, I<32>, I<16>, col_major>,
+            std::tuple<float8_fnuz_t, I<32>, I<32>, I<16>, row_major>,
+            std::tuple<bfloat8_fnuz_t, I<16>, I<16>, I<32>, col_major>,
+            std::tuple<bfloat8_fnuz_t, I<32>, I<32>, I<16>, row_major>
+#endif // ROCWMMA_FP8_FNUZ
+            >;
+
+        // Assemble the kernel generator
+        // Kernel: scaledMmaSync
+        using GeneratorImpl   = ScaledMmaSyncGenerator;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return {{32, 32}, {64, 64}, {128, 64}, {256, 256}};
+        }
+
+        // K: one, several and a partial last scale block
+        static inline std::vector<Param1T> param1s()
+        {
+            return {32.0, 96.0, 256.0, 48.0};
+        }
+    };
+
+} // namespace rocwmma
+
+// Test suite for unique parameterization
+class ScaledMmaSyncTest : public rocwmma::UnitTest
+{
+};
+
+TEST_P(ScaledMmaSyncTest, RunKernel)
+{
+    this->RunKernel();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    KernelTests,
+    ScaledMmaSyncTest,
+    ::testing::Combine(::testing::ValuesIn(rocwmma::TestParams::kernels()),
+                       ::testing::ValuesIn(rocwmma::TestParams::threadBlocks()),
+                       ::testing::ValuesIn(rocwmma::TestParams::problemSizes()),
+                       ::testing::ValuesIn(rocwmma::TestParams::param1s()),
+                       ::testing::ValuesIn(rocwmma::TestParams::param2s())));
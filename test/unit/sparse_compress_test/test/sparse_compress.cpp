@@ -0,0 +1,335 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/sparse_util.hpp>
+
+namespace rocwmma
+{
+    namespace
+    {
+        using detail::Sparse24;
+        using detail::sparse24Compress;
+        using detail::sparse24Decompress;
+
+        template <typename DataLayoutT>
+        uint64_t offset(uint32_t row, uint32_t col, uint32_t ld)
+        {
+            return Sparse24::offset<DataLayoutT>(row, col, ld);
+        }
+
+        // Leading dimensions with padding, to catch stride mix-ups
+        template <typename DataLayoutT>
+        uint32_t leadingDim(uint32_t m, uint32_t k)
+        {
+            return (std::is_same<DataLayoutT, row_major>::value ? k : m) + 3u;
+        }
+
+        // Random m x k matrix with at most two non-zeros in each group of four.
+        // Group g of each row uses pattern g % 11: the six 2-of-4 patterns,
+        // the four 1-of-4 patterns, then an empty group.
+        template <typename DataT, typename DataLayoutT>
+        std::vector<DataT> sparseMatrix(uint32_t m, uint32_t k, uint32_t ld, uint32_t seed)
+        {
+            const uint32_t masks[]
+                = {0x3u, 0x5u, 0x9u, 0x6u, 0xAu, 0xCu, 0x1u, 0x2u, 0x4u, 0x8u, 0x0u};
+
+            std::mt19937                           gen(seed);
+            std::uniform_int_distribution<int32_t> dist(1, 100);
+            std::vector<DataT> dense(uint64_t(ld) * (std::max)(m, k), DataT(0));
+
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t g = 0u; g < k / Sparse24::GroupSize; g++)
+                {
+                    auto mask = masks[(row + g) % 11u];
+                    for(uint32_t i = 0u; i < Sparse24::GroupSize; i++)
+                    {
+                        auto value = (mask >> i) & 1u ? dist(gen) * (gen() & 1u ? 1 : -1) : 0;
+                        dense[offset<DataLayoutT>(row, g * Sparse24::GroupSize + i, ld)]
+                            = static_cast<DataT>(value);
+                    }
+                }
+            }
+            return dense;
+        }
+
+        template <typename DataT, typename DataLayoutT>
+        void checkRoundTrip(uint32_t m, uint32_t k)
+        {
+            auto ldd    = leadingDim<DataLayoutT>(m, k);
+            auto ldv    = leadingDim<DataLayoutT>(m, k / 2u);
+            auto ldmeta = leadingDim<DataLayoutT>(m, k / 8u);
+
+            auto dense = sparseMatrix<DataT, DataLayoutT>(m, k, ldd, m * k);
+
+            std::vector<DataT>   values(uint64_t(ldv) * (std::max)(m, k), DataT(0));
+            std::vector<uint8_t> metadata(uint64_t(ldmeta) * (std::max)(m, k), 0u);
+            std::vector<DataT>   result(dense.size(), DataT(0));
+
+            sparse24Compress<DataT, DataLayoutT>(
+                m, k, dense.data(), ldd, values.data(), ldv, metadata.data(), ldmeta);
+            sparse24Decompress<DataT, DataLayoutT>(
+                m, k, values.data(), ldv, metadata.data(), ldmeta, result.data(), ldd);
+
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < k; col++)
+                {
+                    auto i = offset<DataLayoutT>(row, col, ldd);
+                    ASSERT_EQ(dense[i], result[i]) << "row " << row << " col " << col;
+                }
+
+                // Each nibble holds two distinct, ordered positions
+                for(uint32_t g = 0u; g < k / Sparse24::GroupSize; g++)
+                {
+                    auto byte   = metadata[offset<DataLayoutT>(row, g / 2u, ldmeta)];
+                    auto nibble = Sparse24::nibble(byte, g);
+                    EXPECT_LT(Sparse24::index(nibble, 0u), Sparse24::index(nibble, 1u));
+                }
+            }
+        }
+
+    } // namespace
+
+    TEST(SparseCompressTest, EncodeRoundTrip)
+    {
+        for(uint32_t idx0 = 0u; idx0 < 4u; idx0++)
+        {
+            for(uint32_t idx1 = idx0 + 1u; idx1 < 4u; idx1++)
+            {
+                auto nibble = Sparse24::encode(idx0, idx1);
+                EXPECT_LT(nibble, 16u);
+                EXPECT_EQ(Sparse24::index(nibble, 0u), idx0);
+                EXPECT_EQ(Sparse24::index(nibble, 1u), idx1);
+
+                // Even groups in the low nibble, odd groups in the high nibble
+                auto byte = nibble | (Sparse24::encode(idx1 - idx0, 3u) << 4u);
+                EXPECT_EQ(Sparse24::nibble(byte, 0u), nibble);
+                EXPECT_EQ(Sparse24::nibble(byte, 2u), nibble);
+                EXPECT_EQ(Sparse24::nibble(byte, 1u), Sparse24::encode(idx1 - idx0, 3u));
+            }
+        }
+    }
+
+    TEST(SparseCompressTest, SelectKeepsNonZeros)
+    {
+        for(uint32_t mask = 0u; mask < 16u; mask++)
+        {
+            uint32_t count = 0u;
+            for(uint32_t i = 0u; i < 4u; i++)
+            {
+                count += (mask >> i) & 1u;
+            }
+            if(count > 2u)
+            {
+                continue;
+            }
+
+            float32_t group[4];
+            for(uint32_t i = 0u; i < 4u; i++)
+            {
+                group[i] = (mask >> i) & 1u ? -2.0f - float32_t(i) : 0.0f;
+            }
+
+            auto nibble = Sparse24::select(group);
+            auto kept
+                = (1u << Sparse24::index(nibble, 0u)) | (1u << Sparse24::index(nibble, 1u));
+            EXPECT_EQ(kept & mask, mask) << "mask " << mask;
+            EXPECT_LT(Sparse24::index(nibble, 0u), Sparse24::index(nibble, 1u));
+        }
+
+        // Empty groups keep the first two positions
+        float32_t zeros[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        EXPECT_EQ(Sparse24::select(zeros), Sparse24::encode(0u, 1u));
+    }
+
+    TEST(SparseCompressTest, SelectPrunesToLargestMagnitudes)
+    {
+        float32_t group0[4] = {1.0f, -5.0f, 3.0f, 4.0f};
+        EXPECT_EQ(Sparse24::select(group0), Sparse24::encode(1u, 3u));
+
+        float32_t group1[4] = {-7.0f, 0.5f, 6.0f, -6.5f};
+        EXPECT_EQ(Sparse24::select(group1), Sparse24::encode(0u, 3u));
+
+        // Ties go to the lower position
+        float32_t group2[4] = {2.0f, 2.0f, -2.0f, 2.0f};
+        EXPECT_EQ(Sparse24::select(group2), Sparse24::encode(0u, 1u));
+
+        float32_t group3[4] = {1.0f, 3.0f, 3.0f, -3.0f};
+        EXPECT_EQ(Sparse24::select(group3), Sparse24::encode(1u, 2u));
+
+        int8_t group4[4] = {-128, 127, 0, -127};
+        EXPECT_EQ(Sparse24::select(group4), Sparse24::encode(0u, 1u));
+    }
+
+    TEST(SparseCompressTest, MetadataFormat)
+    {
+        // One row, k = 16: groups {0, 1}, {1, 3}, {0, 2}, {2, 3}
+        float32_t dense[16] = {
+            1.0f, 2.0f, 0.0f, 0.0f,
+            0.0f, 3.0f, 0.0f, 4.0f,
+            5.0f, 0.0f, 6.0f, 0.0f,
+            0.0f, 0.0f, 7.0f, 8.0f,
+        };
+        float32_t values[8];
+        uint8_t   metadata[2];
+
+        sparse24Compress<float32_t, row_major>(1u, 16u, dense, 16u, values, 8u, metadata, 2u);
+
+        const float32_t expected[8] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        for(uint32_t i = 0u; i < 8u; i++)
+        {
+            EXPECT_EQ(values[i], expected[i]);
+        }
+
+        EXPECT_EQ(metadata[0], Sparse24::encode(0u, 1u) | (Sparse24::encode(1u, 3u) << 4u));
+        EXPECT_EQ(metadata[1], Sparse24::encode(0u, 2u) | (Sparse24::encode(2u, 3u) << 4u));
+        EXPECT_EQ(metadata[0], 0xD4u);
+        EXPECT_EQ(metadata[1], 0xE8u);
+    }
+
+    TEST(SparseCompressTest, RoundTripRowMajor)
+    {
+        checkRoundTrip<float32_t, row_major>(16u, 64u);
+        checkRoundTrip<float32_t, row_major>(33u, 40u);
+        checkRoundTrip<int8_t, row_major>(32u, 128u);
+    }
+
+    TEST(SparseCompressTest, RoundTripColMajor)
+    {
+        checkRoundTrip<float32_t, col_major>(16u, 64u);
+        checkRoundTrip<float32_t, col_major>(33u, 40u);
+        checkRoundTrip<int8_t, col_major>(32u, 128u);
+    }
+
+    TEST(SparseCompressTest, PrunesDenseInput)
+    {
+        const uint32_t m = 8u, k = 32u;
+
+        std::mt19937                           gen(7u);
+        std::uniform_int_distribution<int32_t> dist(-50, 50);
+
+        std::vector<float32_t> dense(m * k);
+        for(auto& value : dense)
+        {
+            value = static_cast<float32_t>(dist(gen));
+        }
+
+        std::vector<float32_t> values(m * k / 2u);
+        std::vector<uint8_t>   metadata(m * k / 8u);
+        std::vector<float32_t> pruned(m * k);
+
+        sparse24Compress<float32_t, row_major>(
+            m, k, dense.data(), k, values.data(), k / 2u, metadata.data(), k / 8u);
+        sparse24Decompress<float32_t, row_major>(
+            m, k, values.data(), k / 2u, metadata.data(), k / 8u, pruned.data(), k);
+
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t g = 0u; g < k / 4u; g++)
+            {
+                auto* in  = dense.data() + row * k + g * 4u;
+                auto* out = pruned.data() + row * k + g * 4u;
+
+                // Kept values are unchanged and are not smaller than pruned ones
+                float32_t minKept = 1.0e9f, maxPruned = 0.0f;
+                uint32_t  nonZeros = 0u;
+                for(uint32_t i = 0u; i < 4u; i++)
+                {
+                    auto mag = in[i] < 0.0f ? -in[i] : in[i];
+                    if(out[i] != 0.0f)
+                    {
+                        EXPECT_EQ(out[i], in[i]);
+                        minKept = mag < minKept ? mag : minKept;
+                        nonZeros++;
+                    }
+                    else
+                    {
+                        maxPruned = mag > maxPruned ? mag : maxPruned;
+                    }
+                }
+                EXPECT_LE(nonZeros, 2u);
+                EXPECT_GE(minKept, maxPruned);
+            }
+        }
+    }
+
+    template <typename DataT, uint32_t BlockMN>
+    void checkLaneLayout(uint32_t kPerMma, uint32_t valuesPerLane)
+    {
+        using Layout = detail::Sparse24Layout<DataT, BlockMN>;
+
+        EXPECT_EQ(Layout::KPerMma, kPerMma);
+        EXPECT_EQ(Layout::ValuesPerLane, valuesPerLane);
+
+        for(uint32_t step = 0u; step < 2u; step++)
+        {
+            // Across lane groups, each step covers its K window once, in whole groups
+            std::set<uint32_t> groups;
+            for(uint32_t laneGroup = 0u; laneGroup < Layout::LaneGroups; laneGroup++)
+            {
+                for(uint32_t i = 0u; i < Layout::GroupsPerLane; i++)
+                {
+                    auto k = Layout::groupK(step, laneGroup, i);
+                    EXPECT_EQ(k % 4u, 0u);
+                    EXPECT_GE(k, step * Layout::KPerMma);
+                    EXPECT_LT(k, (step + 1u) * Layout::KPerMma);
+                    EXPECT_TRUE(groups.insert(k).second) << "K " << k << " mapped twice";
+
+                    // Within the lane's K of the dense mfma B layout for block k / DenseK
+                    auto laneK = k % Layout::DenseKPerMma;
+                    EXPECT_EQ(laneK / Layout::DenseVW, laneGroup);
+
+                    // Register order follows the B registers: first dense block first
+                    EXPECT_EQ(k / Layout::DenseKPerMma, 2u * step + i / Layout::GroupsPerChunk);
+                }
+            }
+            EXPECT_EQ(groups.size(), Layout::KPerMma / 4u);
+        }
+    }
+
+    TEST(SparseCompressTest, LaneLayout)
+    {
+        // f16 / bf16: smfmac 16x16x32 and 32x32x16, four values per lane
+        checkLaneLayout<uint16_t, 16u>(32u, 4u);
+        checkLaneLayout<uint16_t, 32u>(16u, 4u);
+
+        // i8: smfmac 16x16x64 and 32x32x32, eight values per lane
+        checkLaneLayout<int8_t, 16u>(64u, 8u);
+        checkLaneLayout<int8_t, 32u>(32u, 8u);
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_SPARSE_LOAD_HPP
+#define ROCWMMA_DETAIL_SPARSE_LOAD_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "device/sparse_load.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Sparse fragment loads against the lane mapping of the sparse mma A
+    // operand. The problem size is M x K, with one BlockMN x BlockK fragment per
+    // wave. Inputs and outputs are passed as raw 32-bit words.
+    template <uint32_t BlockMN, uint32_t BlockK, typename InputT, typename Layout>
+    struct SparseLoadKernel final : public UnitKernelBase<BlockMN, BlockK, uint32_t, Layout>
+    {
+    private:
+        using Base = UnitKernelBase<BlockMN, BlockK, uint32_t, Layout>;
+
+        using Sparse24 = detail::Sparse24;
+        using Traits =
+            typename sparse_fragment<matrix_a, BlockMN, BlockMN, BlockK, InputT, Layout>::Traits;
+        using BitsT = std::conditional_t<sizeof(InputT) == 1u, uint8_t, uint16_t>;
+
+        constexpr static uint32_t WaveSize = Traits::Layout::WaveSize;
+        constexpr static uint32_t Regs     = sparseLoadRegs<BlockMN, BlockK, InputT>();
+
+        // Host inputs, kept for the reference
+        std::vector<InputT>   mDense;
+        std::vector<uint32_t> mNibbles;
+
+        uint32_t tileCount() const
+        {
+            return (Base::mM / BlockMN) * (Base::mN / BlockK);
+        }
+
+        uint32_t outputSize() const
+        {
+            return tileCount() * WaveSize * Regs;
+        }
+
+        uint64_t offset(uint32_t row, uint32_t col, uint32_t ld) const
+        {
+            return Sparse24::offset<Layout>(row, col, ld);
+        }
+
+        uint32_t leadingDim(uint32_t cols) const
+        {
+            return std::is_same<Layout, row_major>::value ? cols : Base::mM;
+        }
+
+        uint32_t bits(InputT value) const
+        {
+            BitsT result;
+            std::memcpy(&result, &value, sizeof(BitsT));
+            return result;
+        }
+
+    public:
+        SparseLoadKernel()  = default;
+        ~SparseLoadKernel() = default;
+
+        bool checkDevice() const final
+        {
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // Sparse fragments map the sparse mma of gfx94x
+            auto isGfx94x = (deviceArch == Base::DeviceInfo::GFX940)
+                            || (deviceArch == Base::DeviceInfo::GFX941)
+                            || (deviceArch == Base::DeviceInfo::GFX942);
+
+            return Base::checkDevice() && isGfx94x
+                   && (Base::DeviceInfo::instance()->warpSize() == WaveSize);
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, BlkMN, BlkK, MatM, MatK, Steps, Lyt, Ti, Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << BlockMN << ", " << BlockK << ", "
+                   << Base::mM << ", " << Base::mN << ", " << Traits::Steps << ", "
+                   << dataTypeToString<Layout>() << ", " << dataTypeToString<InputT>() << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+            return stream;
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& /*probsize*/) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto m = Base::mM;
+            auto k = Base::mN;
+
+            // Exactly two non-zeros of +/- 1 to 8 in each group of four, so
+            // that every group has a single valid nibble
+            const uint32_t positions[][2]
+                = {{0u, 1u}, {0u, 2u}, {0u, 3u}, {1u, 2u}, {1u, 3u}, {2u, 3u}};
+
+            std::mt19937 gen(static_cast<uint32_t>(m * 31u + k));
+            mDense.assign(m * k, static_cast<InputT>(0.0f));
+            mNibbles.resize(m * (k / Sparse24::GroupSize));
+
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t g = 0u; g < k / Sparse24::GroupSize; g++)
+                {
+                    auto const& kept = positions[gen() % 6u];
+                    auto        idx0 = kept[0];
+                    auto        idx1 = kept[1];
+
+                    mNibbles[row * (k / Sparse24::GroupSize) + g] = Sparse24::encode(idx0, idx1);
+                    for(auto i : {idx0, idx1})
+                    {
+                        auto value = static_cast<float32_t>(gen() % 8u + 1u);
+                        mDense[offset(row, g * Sparse24::GroupSize + i, leadingDim(k))]
+                            = static_cast<InputT>(gen() & 1u ? value : -value);
+                    }
+                }
+            }
+
+            // Pack [values][metadata] as bytes
+            auto valuesSize   = m * k / 2u;
+            auto metadataSize = m * k / Sparse24::KPerMetadataByte;
+            auto inBytes      = valuesSize * sizeof(InputT) + metadataSize;
+            auto inWords      = static_cast<int64_t>(ceilDiv(inBytes, sizeof(uint32_t)));
+
+            dataInstance->resizeStorage(
+                {std::max(inWords, static_cast<int64_t>(outputSize())), 1});
+
+            auto* bytes    = reinterpret_cast<uint8_t*>(dataInstance->hostIn().get());
+            auto* values   = reinterpret_cast<InputT*>(bytes);
+            auto* metadata = bytes + valuesSize * sizeof(InputT);
+
+            compress_sparse_2_4<InputT, Layout>(m,
+                                                k,
+                                                mDense.data(),
+                                                leadingDim(k),
+                                                values,
+                                                leadingDim(k / 2u),
+                                                metadata,
+                                                leadingDim(k / Sparse24::KPerMetadataByte));
+
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), inWords);
+
+            // Values and metadata only use the low bits of each word
+            CHECK_HIP_ERROR(
+                hipMemset(dataInstance->deviceOut().get(), 0xFF, outputSize() * sizeof(uint32_t)));
+        }
+
+        void validateResultsImpl() final
+        {
+            using LayoutT = typename Traits::Layout;
+
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->copyData(
+                dataInstance->hostOut(), dataInstance->deviceOut(), outputSize());
+
+            auto m      = Base::mM;
+            auto k      = Base::mN;
+            auto groups = k / Sparse24::GroupSize;
+            auto tilesM = m / BlockMN;
+
+            // Expected registers from the dense matrix: kept value j of group i
+            // of step s in value (s * GroupsPerLane + i) * 2 + j, and the nibble
+            // of group i in bits 4i of metadata register s.
+            std::vector<uint32_t> expected(outputSize());
+            for(uint32_t tile = 0u; tile < tileCount(); tile++)
+            {
+                auto tileK = (tile / tilesM) * BlockK;
+
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    auto  row       = (tile % tilesM) * BlockMN + lane % BlockMN;
+                    auto  laneGroup = lane / BlockMN;
+                    auto* regs      = expected.data() + (tile * WaveSize + lane) * Regs;
+
+                    for(uint32_t step = 0u; step < Traits::Steps; step++)
+                    {
+                        uint32_t indices = 0u;
+                        for(uint32_t i = 0u; i < LayoutT::GroupsPerLane; i++)
+                        {
+                            auto groupK = tileK + LayoutT::groupK(step, laneGroup, i);
+                            auto nibble = mNibbles[row * groups + groupK / Sparse24::GroupSize];
+                            auto index
+                                = (step * LayoutT::GroupsPerLane + i) * Sparse24::KeptPerGroup;
+
+                            for(uint32_t j = 0u; j < Sparse24::KeptPerGroup; j++)
+                            {
+                                auto col        = groupK + Sparse24::index(nibble, j);
+                                regs[index + j] = bits(mDense[offset(row, col, leadingDim(k))]);
+                            }
+                            indices |= nibble << (i * Sparse24::NibbleBits);
+                        }
+                        regs[Traits::Size + step] = indices;
+                    }
+                }
+            }
+
+            auto const* result = dataInstance->hostOut().get();
+            Base::mValidationResult = std::equal(expected.begin(), expected.end(), result);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(sparseLoadSync<BlockMN, BlockK, InputT, Layout>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct SparseLoadGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT  = 0,
+            BlockMN = 1,
+            BlockK  = 2,
+            Layout  = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = SparseLoadKernel<std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockMN
+                                   std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                   std::tuple_element_t<InputT, TestParamsT>, // InputT
+                                   std::tuple_element_t<Layout, TestParamsT> // Layout
+                                   >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_SPARSE_LOAD_HPP
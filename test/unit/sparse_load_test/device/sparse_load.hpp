@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_SPARSE_LOAD_HPP
+#define ROCWMMA_DEVICE_SPARSE_LOAD_HPP
+
+#include <rocwmma/rocwmma.hpp>
+
+namespace rocwmma
+{
+    // Registers of one lane of a sparse fragment: the values, then one
+    // metadata register per sparse mma
+    template <uint32_t BlockMN, uint32_t BlockK, typename InputT>
+    ROCWMMA_HOST_DEVICE constexpr inline uint32_t sparseLoadRegs()
+    {
+        using Traits =
+            typename sparse_fragment<matrix_a, BlockMN, BlockMN, BlockK, InputT, row_major>::Traits;
+        return Traits::Size + Traits::Steps;
+    }
+
+    // Loads one BlockMN x BlockK sparse fragment per wave from the compressed
+    // values (m x k / 2) and metadata (m x k / 8) of an m x k matrix, then
+    // dumps the registers of each lane. The values are written as their bits.
+    //
+    // in: [values][metadata] as bytes
+    // out: sparseLoadRegs() words per lane, lanes of each tile in order, tiles
+    // in column-major order
+    template <uint32_t BlockMN, uint32_t BlockK, typename InputT, typename Layout>
+    ROCWMMA_KERNEL void sparseLoadSync(uint32_t        m,
+                                       uint32_t        k,
+                                       uint32_t const* in,
+                                       uint32_t*       out,
+                                       uint32_t        ld,
+                                       uint32_t        param1,
+                                       uint32_t        param2)
+    {
+        // Sparse fragments map the sparse mma of gfx94x
+        if constexpr((bool)ROCWMMA_ARCH_GFX94X)
+        {
+            using FragT   = sparse_fragment<matrix_a, BlockMN, BlockMN, BlockK, InputT, Layout>;
+            using Traits  = typename FragT::Traits;
+            using Mapping = DataLayout::template Array1d<Layout>;
+            using BitsT   = conditional_t<sizeof(InputT) == 1u, uint8_t, uint16_t>;
+
+            constexpr bool IsRowMajor = is_same<Layout, row_major>::value;
+
+            auto ldv    = IsRowMajor ? k / 2u : m;
+            auto ldmeta = IsRowMajor ? k / detail::Sparse24::KPerMetadataByte : m;
+
+            auto const* values   = reinterpret_cast<InputT const*>(in);
+            auto const* metadata = reinterpret_cast<uint8_t const*>(values + m * k / 2u);
+
+            // Tile of the current wave
+            auto waveX = (blockIdx.x * blockDim.x + threadIdx.x) / Constants::AMDGCN_WAVE_SIZE;
+            auto waveY = blockIdx.y * blockDim.y + threadIdx.y;
+            auto row   = waveX * BlockMN;
+            auto col   = waveY * BlockK;
+
+            FragT frag;
+            load_matrix_sync(
+                frag,
+                values + Mapping::fromMatrixCoord(make_coord2d(row, col / 2u), ldv),
+                ldv,
+                metadata
+                    + Mapping::fromMatrixCoord(
+                        make_coord2d(row, col / detail::Sparse24::KPerMetadataByte), ldmeta),
+                ldmeta);
+
+            auto tile = waveY * (m / BlockMN) + waveX;
+            auto lane = threadIdx.x % Constants::AMDGCN_WAVE_SIZE;
+            auto regs = out
+                        + (tile * Constants::AMDGCN_WAVE_SIZE + lane)
+                              * sparseLoadRegs<BlockMN, BlockK, InputT>();
+
+            for(uint32_t i = 0u; i < Traits::Size; i++)
+            {
+                regs[i] = reinterpret_cast<BitsT const&>(frag.mValues.data[i]);
+            }
+
+            for(uint32_t step = 0u; step < Traits::Steps; step++)
+            {
+                regs[Traits::Size + step] = frag.mMetadata.data[step];
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_SPARSE_LOAD_HPP
@@ -0,0 +1,293 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_STOCHASTIC_ROUNDING_SYNC_HPP
+#define ROCWMMA_DETAIL_STOCHASTIC_ROUNDING_SYNC_HPP
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <rocwmma/internal/stochastic_rounding.hpp>
+
+#include "device/stochastic_rounding_sync.hpp"
+#include "helper_macros.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Stochastic rounding of float32_t fragments to OutputT on the device,
+    // element by element against the host bit model and random stream.
+    // Inputs and outputs are passed as raw 32-bit words.
+    template <uint32_t BlockM, uint32_t BlockN, typename OutputT, typename Layout>
+    struct StochasticRoundingSyncKernel final
+        : public UnitKernelBase<BlockM, BlockN, uint32_t, Layout>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, uint32_t, Layout>;
+
+        template <uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = FragSize_guard<BlockM, BlockN, float32_t, Layout, WaveSize, ArchId>;
+
+        using Traits = detail::StochasticRoundingTraits<OutputT>;
+        using BitsT  = std::conditional_t<sizeof(OutputT) == 1u, uint8_t, uint16_t>;
+
+        // Host inputs, kept for the reference
+        std::vector<float32_t> mValues;
+
+        uint32_t outputSize() const
+        {
+            auto elements = Base::mM * Base::mN;
+            return elements + ceilDiv(elements * sizeof(OutputT), sizeof(uint32_t));
+        }
+
+    public:
+        StochasticRoundingSyncKernel()  = default;
+        ~StochasticRoundingSyncKernel() = default;
+
+        bool checkDevice() const final
+        {
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            auto isGfx94x = (deviceArch == Base::DeviceInfo::GFX940)
+                            || (deviceArch == Base::DeviceInfo::GFX941)
+                            || (deviceArch == Base::DeviceInfo::GFX942);
+            auto isGfx12  = (deviceArch == Base::DeviceInfo::GFX1200)
+                           || (deviceArch == Base::DeviceInfo::GFX1201);
+
+            // fp8 / bf8 types are only visible on their native targets
+            auto isOcp  = std::is_same<OutputT, float8_t>::value
+                         || std::is_same<OutputT, bfloat8_t>::value;
+            auto isFnuz = std::is_same<OutputT, float8_fnuz_t>::value
+                          || std::is_same<OutputT, bfloat8_fnuz_t>::value;
+
+            return Base::checkDevice() && (isOcp ? isGfx12 : (isFnuz ? isGfx94x : true));
+        }
+
+        bool checkQuirks() const final
+        {
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // The test guard for this class requires 2 values at runtime.
+            auto dispatchGuard = [waveSize, deviceArch]() {
+                bool dispatchResult = false;
+
+#define CASE_IMPL_ASSIGN2(WAVE_SIZE, ARCH_ID) \
+    dispatchResult = TestGuard<WAVE_SIZE, ARCH_ID>::enable();
+
+#define SWITCH_BODY_WAVE_SIZE(ARCH_ID) \
+    ROCWMMA_SWITCH_BODY2_ARG2(         \
+        waveSize, CASE_IMPL_ASSIGN2, HipDevice::Wave32, HipDevice::Wave64, ARCH_ID)
+
+#define DISPATCH_GUARD_BODY                           \
+    ROCWMMA_SWITCH_BODY10_ARG1(deviceArch,            \
+                               SWITCH_BODY_WAVE_SIZE, \
+                               HipDevice::GFX908,     \
+                               HipDevice::GFX90A,     \
+                               HipDevice::GFX940,     \
+                               HipDevice::GFX941,     \
+                               HipDevice::GFX942,     \
+                               HipDevice::GFX1100,    \
+                               HipDevice::GFX1101,    \
+                               HipDevice::GFX1102,    \
+                               HipDevice::GFX1200,    \
+                               HipDevice::GFX1201)
+
+                DISPATCH_GUARD_BODY
+
+#undef CASE_IMPL_ASSIGN2
+#undef SWITCH_BODY_WAVE_SIZE
+#undef DISPATCH_GUARD_BODY
+
+                return dispatchResult;
+            };
+
+            return Base::checkQuirks() && dispatchGuard();
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, BlkM, BlkN, MatM, MatN, ld, Path, Lyt, To, "
+                             "Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << BlockM << ", " << BlockN << ", "
+                   << Base::mM << ", " << Base::mN << ", " << Base::mLd << ", "
+                   << (Base::mParam1 == 0u ? "store" : "convert") << ", "
+                   << dataTypeToString<Layout>() << ", " << dataTypeToString<OutputT>() << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+            return stream;
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& /*probsize*/) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto elements = Base::mM * Base::mN;
+
+            // Random mantissas over the subnormal, normal and saturating
+            // ranges of OutputT, with some Inf and NaN
+            auto maxExp = sizeof(OutputT) == 1u ? 20u : 130u;
+
+            std::mt19937 gen(static_cast<uint32_t>(Base::mM * 31u + Base::mN));
+            mValues.resize(elements);
+            for(uint32_t i = 0u; i < elements; i++)
+            {
+                auto mant  = 1.0f + static_cast<float32_t>(gen() & 0xFFFFFFu) / 16777216.0f;
+                auto exp   = static_cast<int32_t>(gen() % (2u * maxExp + 1u) - maxExp);
+                auto value = std::ldexp(gen() & 1u ? mant : -mant, exp);
+
+                if(i % 61u == 60u)
+                {
+                    value = std::numeric_limits<float32_t>::infinity();
+                }
+                else if(i % 67u == 66u)
+                {
+                    value = std::numeric_limits<float32_t>::quiet_NaN();
+                }
+                mValues[i] = value;
+            }
+
+            dataInstance->resizeStorage({std::max(2u * elements, outputSize()), 1});
+
+            // Pack [values][offsets] as float32_t
+            auto* in = reinterpret_cast<float32_t*>(dataInstance->hostIn().get());
+            for(uint32_t i = 0u; i < elements; i++)
+            {
+                in[i]            = mValues[i];
+                in[elements + i] = static_cast<float32_t>(i);
+            }
+
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), 2u * elements);
+
+            // Unwritten element ids are out of range
+            CHECK_HIP_ERROR(
+                hipMemset(dataInstance->deviceOut().get(), 0xFF, outputSize() * sizeof(uint32_t)));
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->copyData(
+                dataInstance->hostOut(), dataInstance->deviceOut(), outputSize());
+
+            auto m        = Base::mM;
+            auto ld       = Base::mLd;
+            auto elements = m * Base::mN;
+            auto waveSize = Base::DeviceInfo::instance()->warpSize();
+
+            auto const* ids     = dataInstance->hostOut().get();
+            auto const* rounded = reinterpret_cast<uint8_t const*>(ids + elements);
+
+            Base::mValidationResult = true;
+            for(uint32_t i = 0u; i < elements; i++)
+            {
+                auto lane    = ids[i] / StochasticRoundingLaneStride;
+                auto element = ids[i] % StochasticRoundingLaneStride;
+                if(lane >= waveSize)
+                {
+                    Base::mValidationResult = false;
+                    break;
+                }
+
+                // Random word of the element in the stream of its tile
+                auto isRowMajor = std::is_same<Layout, row_major>::value;
+                auto row        = isRowMajor ? i / ld : i % ld;
+                auto col        = isRowMajor ? i % ld : i / ld;
+                auto sr         = stochasticRoundingTile<BlockM, BlockN>(m, row, col);
+
+                auto rng = detail::stochasticRoundingWord(sr.seed, sr.offset, lane, element);
+
+                uint32_t bits;
+                std::memcpy(&bits, &mValues[i], sizeof(uint32_t));
+
+                BitsT result;
+                std::memcpy(&result, rounded + i * sizeof(OutputT), sizeof(BitsT));
+
+                if(result != Traits::round(bits, rng))
+                {
+                    Base::mValidationResult = false;
+                    break;
+                }
+            }
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                stochasticRoundingSync<BlockM, BlockN, OutputT, Layout>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct StochasticRoundingSyncGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            OutputT = 0,
+            BlockM  = 1,
+            BlockN  = 2,
+            Layout  = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = StochasticRoundingSyncKernel<
+                std::tuple_element_t<BlockM, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<OutputT, TestParamsT>, // OutputT
+                std::tuple_element_t<Layout, TestParamsT> // Layout
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_STOCHASTIC_ROUNDING_SYNC_HPP
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_STOCHASTIC_ROUNDING_SYNC_HPP
+#define ROCWMMA_DEVICE_STOCHASTIC_ROUNDING_SYNC_HPP
+
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+
+    // Random stream of the BlockM x BlockN tile at (row, col): one stream
+    // offset per tile, with high offset bits set
+    template <uint32_t BlockM, uint32_t BlockN>
+    ROCWMMA_HOST_DEVICE constexpr inline stochastic_rounding
+        stochasticRoundingTile(uint32_t m, uint32_t row, uint32_t col)
+    {
+        constexpr uint64_t Seed   = 0x243F6A8885A308D3ull;
+        constexpr uint64_t Offset = 0x13198A2E00000000ull;
+
+        return stochastic_rounding{Seed, Offset + (col / BlockN) * (m / BlockM) + row / BlockM};
+    }
+
+    // Element id: lane and register of the element in its fragment
+    constexpr uint32_t StochasticRoundingLaneStride = 256u;
+
+    // Rounds a float32_t accumulator fragment to OutputT with stochastic
+    // rounding, through store_matrix_sync (param1 = 0) or convert_fragment
+    // (param1 = 1). Also records the element id of each matrix element, from
+    // a fragment of the elements' offsets.
+    //
+    // in: [values m x n][offsets m x n] as float32_t
+    // out: [element ids m x n][rounded m x n as OutputT]
+    template <uint32_t BlockM, uint32_t BlockN, typename OutputT, typename Layout>
+    ROCWMMA_KERNEL void stochasticRoundingSync(uint32_t        m,
+                                               uint32_t        n,
+                                               uint32_t const* in,
+                                               uint32_t*       out,
+                                               uint32_t        ld,
+                                               uint32_t        param1,
+                                               uint32_t        param2)
+    {
+        if constexpr(FragSize_guard<BlockM,
+                                    BlockN,
+                                    float32_t,
+                                    Layout,
+                                    Constants::AMDGCN_WAVE_SIZE,
+                                    Constants::AMDGCN_CURRENT_ARCH_ID>::enable())
+        {
+            using Mapping     = MappingUtil<BlockM, BlockN, float32_t, Layout>;
+            using DataMapping = DataLayout::template Array1d<Layout>;
+            using FragT       = fragment<accumulator, BlockM, BlockN, 1, float32_t, Layout>;
+            using OutputFragT = fragment<accumulator, BlockM, BlockN, 1, OutputT, Layout>;
+
+            auto const* values  = reinterpret_cast<float32_t const*>(in);
+            auto const* offsets = values + m * n;
+            auto*       ids     = out;
+            auto*       rounded = reinterpret_cast<OutputT*>(out + m * n);
+
+            auto coord  = Mapping::matrixCoord();
+            auto offset = DataMapping::fromMatrixCoord(coord, ld);
+            auto sr     = stochasticRoundingTile<BlockM, BlockN>(m, get<0>(coord), get<1>(coord));
+
+            FragT frag, fragOffsets;
+            load_matrix_sync(frag, values + offset, ld);
+            load_matrix_sync(fragOffsets, offsets + offset, ld);
+
+            auto lane = detail::laneId();
+            for(uint32_t i = 0u; i < FragT::num_elements; i++)
+            {
+                ids[static_cast<uint32_t>(fragOffsets.mAccess.data[i])]
+                    = lane * StochasticRoundingLaneStride + i;
+            }
+
+            if(param1 == 0u)
+            {
+                store_matrix_sync(rounded + offset, frag, ld, sr);
+            }
+            else
+            {
+                OutputFragT converted;
+                convert_fragment(converted, frag, sr);
+                store_matrix_sync(rounded + offset, converted, ld);
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_STOCHASTIC_ROUNDING_SYNC_HPP
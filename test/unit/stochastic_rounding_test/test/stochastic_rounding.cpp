@@ -0,0 +1,329 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/stochastic_rounding.hpp>
+
+#include "bulk_convert.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using BulkConvert::Format;
+        using BulkConvert::FormatTraits;
+        using BulkConvert::Rounding;
+        using BulkConvert::Saturation;
+        using BulkConvert::detail::bitsFloat;
+        using BulkConvert::detail::floatBits;
+
+        // Bit model of each format under test
+        template <Format F>
+        uint32_t stochasticRoundBits(uint32_t bits, uint32_t rng)
+        {
+            using Traits = FormatTraits<F>;
+            if constexpr(F == Format::Bf16)
+            {
+                return detail::stochasticRoundBf16(bits, rng);
+            }
+            else
+            {
+                return detail::stochasticRoundFp8<Traits::ExpBits,
+                                                  Traits::MantBits,
+                                                  Traits::Bias,
+                                                  Traits::Fnuz>(bits, rng);
+            }
+        }
+
+        // Number of low random bits consumed for normal results
+        template <Format F>
+        constexpr uint32_t dropBits()
+        {
+            return 23u - FormatTraits<F>::MantBits;
+        }
+
+        template <Format F>
+        double decode(uint32_t code)
+        {
+            return static_cast<double>(bitsFloat(BulkConvert::decodeScalar<F>(code)));
+        }
+
+        // Finite sweep over the whole float range, including denormals
+        std::vector<float> sweepValues()
+        {
+            std::vector<float> values;
+            for(uint32_t bits = 0u; bits < 0x7F800000u; bits += 0x1F3Bu)
+            {
+                values.push_back(bitsFloat(bits));
+                values.push_back(-bitsFloat(bits));
+            }
+            return values;
+        }
+
+        // Word generator for sweeps, independent of the stream under test
+        uint32_t mix(uint32_t x)
+        {
+            x ^= x >> 16u;
+            x *= 0x7FEB352Du;
+            x ^= x >> 15u;
+            x *= 0x846CA68Bu;
+            x ^= x >> 16u;
+            return x;
+        }
+
+        template <Format F>
+        void checkTruncation()
+        {
+            constexpr auto S = F == Format::Bf16 ? Saturation::None : Saturation::Finite;
+            for(auto value : sweepValues())
+            {
+                auto bits = floatBits(value);
+                ASSERT_EQ(stochasticRoundBits<F>(bits, 0u),
+                          (BulkConvert::encodeScalar<F, Rounding::TowardZero, S>(bits)))
+                    << std::hex << bits;
+            }
+        }
+
+        // The result is one of the two neighbours of the input: the input
+        // itself when representable, and never beyond the saturation bound.
+        template <Format F>
+        void checkNeighbours()
+        {
+            constexpr bool Saturates = F != Format::Bf16;
+            constexpr auto S         = Saturates ? Saturation::Finite : Saturation::None;
+            constexpr auto SignBit   = F == Format::Bf16 ? 0x8000u : 0x80u;
+
+            uint32_t i = 0u;
+            for(auto value : sweepValues())
+            {
+                auto bits  = floatBits(value);
+                auto lower = BulkConvert::encodeScalar<F, Rounding::TowardZero, S>(bits);
+                auto upper = (std::signbit(value) ? SignBit : 0u) | ((lower & ~SignBit) + 1u);
+                auto code  = stochasticRoundBits<F>(bits, mix(i++));
+
+                auto exact = decode<F>(lower) == static_cast<double>(value);
+                if(exact || (Saturates && !std::isfinite(decode<F>(upper))))
+                {
+                    ASSERT_EQ(code, lower) << std::hex << bits;
+                }
+                else
+                {
+                    ASSERT_TRUE(code == lower || code == upper) << std::hex << bits;
+                }
+            }
+        }
+
+        // Over every value of the consumed random bits, the mean result equals
+        // the input exactly for results in the normal range.
+        template <Format F>
+        void checkUnbiased(std::vector<float> const& values)
+        {
+            constexpr uint32_t Count = 1u << dropBits<F>();
+            for(auto value : values)
+            {
+                auto   bits = floatBits(value);
+                double sum  = 0.0;
+                for(uint32_t rng = 0u; rng < Count; rng++)
+                {
+                    sum += decode<F>(stochasticRoundBits<F>(bits, rng));
+                }
+                EXPECT_EQ(sum, static_cast<double>(value) * Count) << value;
+            }
+        }
+
+        // Typed conversion stores the model's code, which the type decodes
+        // to the format's value
+        template <Format F, typename DataT>
+        void checkTyped(float value, uint32_t rng)
+        {
+            auto result = detail::stochasticRound<DataT>(value, rng);
+            auto code   = stochasticRoundBits<F>(floatBits(value), rng);
+
+            uint32_t stored = 0u;
+            std::memcpy(&stored, &result, sizeof(DataT));
+            ASSERT_EQ(stored, code) << value;
+
+            auto decoded = static_cast<float>(result);
+            if(!std::isnan(decoded))
+            {
+                ASSERT_EQ(floatBits(decoded), BulkConvert::decodeScalar<F>(code)) << value;
+            }
+        }
+
+    } // namespace
+
+    TEST(StochasticRoundingTest, PhiloxKnownAnswers)
+    {
+        using Block = detail::Philox4x32::Block;
+
+        // Known answer vectors of the reference Philox4x32-10 implementation
+        struct Case
+        {
+            Block    counter;
+            uint32_t key0, key1;
+            Block    expected;
+        };
+
+        Case const cases[] = {
+            {{{0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u}},
+             0x00000000u,
+             0x00000000u,
+             {{0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u}}},
+            {{{0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu}},
+             0xFFFFFFFFu,
+             0xFFFFFFFFu,
+             {{0x408F276Du, 0x41C83B0Eu, 0xA20BC7C6u, 0x6D5451FDu}}},
+            {{{0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u}},
+             0xA4093822u,
+             0x299F31D0u,
+             {{0xD16CFE09u, 0x94FDCCEBu, 0x5001E420u, 0x24126EA1u}}},
+        };
+
+        for(auto const& c : cases)
+        {
+            auto result = detail::Philox4x32::exec(c.counter, c.key0, c.key1);
+            for(int i = 0; i < 4; i++)
+            {
+                EXPECT_EQ(result.data[i], c.expected.data[i]) << i;
+            }
+        }
+
+        // Usable in constant expressions
+        static_assert(detail::Philox4x32::exec(Block{{0u, 0u, 0u, 0u}}, 0u, 0u).data[0]
+                          == 0x6627E8D5u,
+                      "Philox4x32-10 known answer");
+    }
+
+    TEST(StochasticRoundingTest, StreamLayout)
+    {
+        constexpr uint64_t Seed   = 0x0123456789ABCDEFull;
+        constexpr uint64_t Offset = 0xFEDCBA9876543210ull;
+
+        for(uint32_t lane = 0u; lane < 64u; lane++)
+        {
+            for(uint32_t element = 0u; element < 32u; element++)
+            {
+                auto block = detail::Philox4x32::exec(
+                    detail::Philox4x32::Block{{element / 4u, lane, 0x76543210u, 0xFEDCBA98u}},
+                    0x89ABCDEFu,
+                    0x01234567u);
+                ASSERT_EQ(detail::stochasticRoundingWord(Seed, Offset, lane, element),
+                          block.data[element % 4u]);
+            }
+        }
+
+        // Seed and offset select different streams
+        EXPECT_NE(detail::stochasticRoundingWord(Seed, Offset, 0u, 0u),
+                  detail::stochasticRoundingWord(Seed + 1u, Offset, 0u, 0u));
+        EXPECT_NE(detail::stochasticRoundingWord(Seed, Offset, 0u, 0u),
+                  detail::stochasticRoundingWord(Seed, Offset + 1u, 0u, 0u));
+        EXPECT_NE(detail::stochasticRoundingWord(Seed, Offset, 0u, 0u),
+                  detail::stochasticRoundingWord(Seed, Offset + (1ull << 32u), 0u, 0u));
+    }
+
+    TEST(StochasticRoundingTest, ZeroRandomTruncates)
+    {
+        checkTruncation<Format::F8>();
+        checkTruncation<Format::Bf8>();
+        checkTruncation<Format::F8Fnuz>();
+        checkTruncation<Format::Bf8Fnuz>();
+        checkTruncation<Format::Bf16>();
+    }
+
+    TEST(StochasticRoundingTest, RoundsToNeighbours)
+    {
+        checkNeighbours<Format::F8>();
+        checkNeighbours<Format::Bf8>();
+        checkNeighbours<Format::F8Fnuz>();
+        checkNeighbours<Format::Bf8Fnuz>();
+        checkNeighbours<Format::Bf16>();
+    }
+
+    TEST(StochasticRoundingTest, Unbiased)
+    {
+        std::vector<float> const values = {1.1f, -1.3f, 3.14159f, -0.0390625f * 1.7f, 100.3f};
+
+        checkUnbiased<Format::F8>(values);
+        checkUnbiased<Format::Bf8>(values);
+        checkUnbiased<Format::F8Fnuz>(values);
+        checkUnbiased<Format::Bf8Fnuz>(values);
+        checkUnbiased<Format::Bf16>({1.1f, -1.3f, 3.14159f, 1.0e-30f, -7.7e20f});
+    }
+
+    TEST(StochasticRoundingTest, Specials)
+    {
+        auto inf  = floatBits(std::numeric_limits<float>::infinity());
+        auto nan  = floatBits(std::numeric_limits<float>::quiet_NaN());
+        auto ones = 0xFFFFFFFFu;
+
+        // Saturation to the largest finite value, whatever the random word
+        EXPECT_EQ(stochasticRoundBits<Format::F8>(inf, ones), 0x7Eu);
+        EXPECT_EQ(stochasticRoundBits<Format::F8>(inf | 0x80000000u, ones), 0xFEu);
+        EXPECT_EQ(stochasticRoundBits<Format::F8>(floatBits(447.0f), ones), 0x7Eu);
+        EXPECT_EQ(stochasticRoundBits<Format::Bf8>(floatBits(1.0e6f), ones), 0x7Bu);
+        EXPECT_EQ(stochasticRoundBits<Format::F8Fnuz>(inf, ones), 0x7Fu);
+        EXPECT_EQ(stochasticRoundBits<Format::Bf8Fnuz>(inf | 0x80000000u, ones), 0xFFu);
+
+        // NaN
+        EXPECT_EQ(stochasticRoundBits<Format::F8>(nan, 0u), 0x7Fu);
+        EXPECT_EQ(stochasticRoundBits<Format::Bf8>(nan | 0x80000000u, 0u), 0xFFu);
+        EXPECT_EQ(stochasticRoundBits<Format::F8Fnuz>(nan, ones), 0x80u);
+        EXPECT_EQ(stochasticRoundBits<Format::Bf8Fnuz>(nan, ones), 0x80u);
+        EXPECT_EQ(stochasticRoundBits<Format::Bf16>(0x7F800001u, ones), 0x7F81u);
+
+        // bf16 overflow rounds to Inf; Inf is kept
+        EXPECT_EQ(stochasticRoundBits<Format::Bf16>(0x7F7FFFFFu, 1u), 0x7F80u);
+        EXPECT_EQ(stochasticRoundBits<Format::Bf16>(inf, ones), 0x7F80u);
+
+        // Signed zero survives only in the OCP formats
+        auto negTiny = floatBits(-1.0e-20f);
+        EXPECT_EQ(stochasticRoundBits<Format::F8>(negTiny, ones), 0x80u);
+        EXPECT_EQ(stochasticRoundBits<Format::F8Fnuz>(negTiny, ones), 0x00u);
+        EXPECT_EQ(stochasticRoundBits<Format::Bf8Fnuz>(floatBits(-0.0f), 0u), 0x00u);
+    }
+
+    TEST(StochasticRoundingTest, MatchesTypedConversion)
+    {
+        uint32_t i = 0u;
+        for(auto value : sweepValues())
+        {
+            auto rng = mix(i++);
+            checkTyped<Format::F8, float8_t>(value, rng);
+            checkTyped<Format::Bf8, bfloat8_t>(value, rng);
+            checkTyped<Format::F8Fnuz, float8_fnuz_t>(value, rng);
+            checkTyped<Format::Bf8Fnuz, bfloat8_fnuz_t>(value, rng);
+            checkTyped<Format::Bf16, bfloat16_t>(value, rng);
+        }
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sweep_config.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using ProblemSize3T = std::tuple<int64_t, int64_t, int64_t>;
+        using ProblemSize2T = std::pair<int64_t, int64_t>;
+        using ThreadBlockT  = std::pair<int64_t, int64_t>;
+
+        SweepConfig fromSpec(std::string const& text)
+        {
+            SweepConfig        sweep;
+            std::istringstream stream(text);
+            sweep.loadSpec(stream, "spec");
+            return sweep;
+        }
+
+        SweepConfig fromTrace(std::string const& text)
+        {
+            SweepConfig        sweep;
+            std::istringstream stream(text);
+            sweep.loadTrace(stream, "trace");
+            return sweep;
+        }
+    }
+
+    TEST(SweepConfigTest, EmptyKeepsCompiledLists)
+    {
+        SweepConfig sweep;
+        auto        sizes  = std::vector<ProblemSize3T>{{64, 64, 64}, {128, 128, 128}};
+        auto        blocks = std::vector<ThreadBlockT>{{64, 1}};
+
+        EXPECT_EQ(sweep.problemSizes(sizes), sizes);
+        EXPECT_EQ(sweep.threadBlocks(blocks), blocks);
+        EXPECT_EQ(sweep.alphas(std::vector<double>{2.0}), std::vector<double>{2.0});
+        EXPECT_FALSE(sweep.coldRuns());
+        EXPECT_FALSE(sweep.hotRuns());
+        EXPECT_TRUE(sweep.includes({64, 64, 64}, "f16_f32_f32", "N_N_N_N"));
+    }
+
+    TEST(SweepConfigTest, SpecOverridesLists)
+    {
+        auto sweep = fromSpec("# Service shapes\n"
+                              "problem_sizes = 1024x512x64, 4096x4096x4096  # trailing\n"
+                              "\n"
+                              "thread_blocks = 128x2, 256x1\n"
+                              "alphas = 1.5\n"
+                              "betas = 0, 1\n"
+                              "cold_runs = 2\n"
+                              "hot_runs = 50\n");
+
+        auto sizes = sweep.problemSizes(std::vector<ProblemSize3T>{{64, 64, 64}});
+        EXPECT_EQ(sizes, (std::vector<ProblemSize3T>{{1024, 512, 64}, {4096, 4096, 4096}}));
+        EXPECT_EQ(sweep.threadBlocks(std::vector<ThreadBlockT>{{64, 1}}),
+                  (std::vector<ThreadBlockT>{{128, 2}, {256, 1}}));
+        EXPECT_EQ(sweep.alphas(std::vector<double>{2.0}), std::vector<double>{1.5});
+        EXPECT_EQ(sweep.betas(std::vector<double>{2.0}), (std::vector<double>{0.0, 1.0}));
+        EXPECT_EQ(sweep.coldRuns().value(), 2u);
+        EXPECT_EQ(sweep.hotRuns().value(), 50u);
+    }
+
+    TEST(SweepConfigTest, ProblemRankMatchesBinary)
+    {
+        auto sweep = fromSpec("problem_sizes = 256x256, 64x64x64, 1024x32\n");
+
+        // Unit tests take MxN, GEMM and DLRM take three dimensions
+        EXPECT_EQ(sweep.problemSizes(std::vector<ProblemSize2T>{}),
+                  (std::vector<ProblemSize2T>{{256, 256}, {1024, 32}}));
+        EXPECT_EQ(sweep.problemSizes(std::vector<ProblemSize3T>{}),
+                  (std::vector<ProblemSize3T>{{64, 64, 64}}));
+    }
+
+    TEST(SweepConfigTest, SpecErrorsReportLine)
+    {
+        auto expectError = [](std::string const& text, std::string const& where) {
+            try
+            {
+                fromSpec(text);
+                FAIL() << "Expected error for: " << text;
+            }
+            catch(std::runtime_error const& e)
+            {
+                EXPECT_NE(std::string(e.what()).find(where), std::string::npos) << e.what();
+            }
+        };
+
+        expectError("problem_sizes = 64x64x64\nblock_sizes = 32x32\n", "spec:2: unknown key");
+        expectError("problem_sizes\n", "spec:1: expected key = value");
+        expectError("problem_sizes = 64xAx64\n", "spec:1");
+        expectError("problem_sizes = 64x0x64\n", "spec:1");
+        expectError("problem_sizes = 64\n", "spec:1");
+        expectError("thread_blocks = 64x1x1\n", "spec:1");
+        expectError("\n\nhot_runs = 1, 2\n", "spec:3");
+        expectError("hot_runs = 0\n", "spec:1: hot_runs must be at least 1");
+        expectError("cold_runs = -1\n", "spec:1: cold_runs must be at least 0");
+        expectError("alphas =\n", "spec:1: no values");
+        EXPECT_THROW(SweepConfig().loadSpec("/nonexistent/sweep.cfg"), std::runtime_error);
+    }
+
+    TEST(SweepConfigTest, TraceAggregatesByCount)
+    {
+        auto sweep = fromTrace("128x128x128\n"
+                               "4096x1024x512, 10\n"
+                               "# comment\n"
+                               "128x128x128, 4\n"
+                               "256x256x256, 5\n");
+
+        ASSERT_EQ(sweep.trace().size(), 3u);
+        EXPECT_EQ(sweep.traceCount({4096, 1024, 512}), 10u);
+        EXPECT_EQ(sweep.traceCount({128, 128, 128}), 5u);
+        EXPECT_EQ(sweep.traceCount({32, 32, 32}), 0u);
+
+        // Heaviest first, ties in trace order
+        EXPECT_EQ(sweep.problemSizes(std::vector<ProblemSize3T>{}),
+                  (std::vector<ProblemSize3T>{
+                      {4096, 1024, 512}, {128, 128, 128}, {256, 256, 256}}));
+    }
+
+    TEST(SweepConfigTest, TraceTakesPrecedenceOverSpec)
+    {
+        SweepConfig        sweep;
+        std::istringstream spec("problem_sizes = 64x64x64\nhot_runs = 3\n");
+        std::istringstream trace("512x512x512, 2\n");
+        sweep.loadSpec(spec, "spec");
+        sweep.loadTrace(trace, "trace");
+
+        EXPECT_EQ(sweep.problemSizes(std::vector<ProblemSize3T>{}),
+                  (std::vector<ProblemSize3T>{{512, 512, 512}}));
+        EXPECT_EQ(sweep.hotRuns().value(), 3u);
+    }
+
+    TEST(SweepConfigTest, TraceIncludesBySignature)
+    {
+        auto sweep = fromTrace("512x512x512\n"
+                               "1024x1024x64, 3, f16_f32_f32\n"
+                               "1024x1024x64, 1, bf16_f32_f32, N_T_N_N\n");
+
+        // Shape without a signature runs on any kernel
+        EXPECT_TRUE(sweep.includes({512, 512, 512}, "f32_f32_f32", "T_T_T_T"));
+
+        // Shapes outside the trace never run
+        EXPECT_FALSE(sweep.includes({64, 64, 64}, "f16_f32_f32", "N_N_N_N"));
+
+        EXPECT_TRUE(sweep.includes({1024, 1024, 64}, "f16_f32_f32", "T_T_T_T"));
+        EXPECT_TRUE(sweep.includes({1024, 1024, 64}, "bf16_f32_f32", "N_T_N_N"));
+        EXPECT_FALSE(sweep.includes({1024, 1024, 64}, "bf16_f32_f32", "N_N_N_N"));
+        EXPECT_FALSE(sweep.includes({1024, 1024, 64}, "i8_i32_i32", "N_T_N_N"));
+        EXPECT_EQ(sweep.traceCount({1024, 1024, 64}), 4u);
+    }
+
+    TEST(SweepConfigTest, TraceErrorsReportLine)
+    {
+        EXPECT_THROW(fromTrace("64x64x64, 1, f16_f32_f32, N_N_N_N, extra\n"), std::runtime_error);
+        EXPECT_THROW(fromTrace("64x64x64\n64x64, x\n"), std::runtime_error);
+        EXPECT_THROW(SweepConfig().loadTrace("/nonexistent/trace.txt"), std::runtime_error);
+
+        try
+        {
+            fromTrace("64x64x64\n\n64by64\n");
+            FAIL();
+        }
+        catch(std::runtime_error const& e)
+        {
+            EXPECT_NE(std::string(e.what()).find("trace:3"), std::string::npos) << e.what();
+        }
+    }
+
+} // namespace rocwmma
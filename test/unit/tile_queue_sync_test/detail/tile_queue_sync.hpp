@@ -0,0 +1,168 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_TILE_QUEUE_SYNC_HPP
+#define ROCWMMA_DETAIL_TILE_QUEUE_SYNC_HPP
+
+#include "device/tile_queue_sync.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Drains a device tile_queue with a persistent grid of param2 workgroups.
+    // BlockM, BlockN and Layout are redundant for this test.
+    template <uint32_t ChunkSize>
+    struct TileQueueSyncKernel final : public UnitKernelBase<1, 1, uint32_t, col_major>
+    {
+    private:
+        using Base = UnitKernelBase<1, 1, uint32_t, col_major>;
+
+        // Two tile groups of m x n tiles, see tileQueueSync
+        uint32_t tileCount() const
+        {
+            return 2u * Base::mM * Base::mN;
+        }
+
+        uint32_t outputSize() const
+        {
+            return Base::mParam1 + tileCount() + 1u;
+        }
+
+    public:
+        TileQueueSyncKernel()  = default;
+        ~TileQueueSyncKernel() = default;
+
+        dim3 gridDim() const final
+        {
+            return dim3(Base::mParam2);
+        }
+
+        bool checkSizes() const final
+        {
+            // Whole waves for the global mapping, and a valid queue
+            tile_queue<uint32_t> queue{nullptr, 0u, 0u, 0u};
+            return (Base::mTBlockX % Base::DeviceInfo::instance()->warpSize() == 0u)
+                   && (Base::mParam2 > 0u)
+                   && make_tile_queue(queue, nullptr, tileCount(), Base::mParam1, ChunkSize);
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return stream << "WSize, TBlkX, TBlkY, TilesX, TilesY, Shards, Workgroups, "
+                             "ChunkSize, Result"
+                          << std::endl;
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            stream << "w" << Base::DeviceInfo::instance()->warpSize() << ", " << Base::mTBlockX
+                   << ", " << Base::mTBlockY << ", " << Base::mM << ", " << Base::mN << ", "
+                   << Base::mParam1 << ", " << Base::mParam2 << ", " << ChunkSize << ", ";
+
+            if(!Base::mRunFlag)
+            {
+                stream << "SKIPPED" << std::endl;
+            }
+            else
+            {
+                stream << (Base::mValidationResult ? "PASSED" : "FAILED") << std::endl;
+            }
+            return stream;
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& /*probsize*/) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Zero counters and claims; status 0 is SUCCESS_VALUE
+            dataInstance->resizeStorage({outputSize(), 1});
+            CHECK_HIP_ERROR(hipMemset(
+                dataInstance->deviceOut().get(), 0, outputSize() * sizeof(uint32_t)));
+        }
+
+        void validateResultsImpl() final
+        {
+            using Shards = detail::TileQueueShards;
+
+            auto& dataInstance = Base::DataStorage::instance();
+            dataInstance->copyData(
+                dataInstance->hostOut(), dataInstance->deviceOut(), outputSize());
+
+            auto const* counters = dataInstance->hostOut().get();
+            auto const* claims   = counters + Base::mParam1;
+            auto const  status   = claims[tileCount()];
+
+            // Every tile claimed exactly once
+            bool exactlyOnce = true;
+            for(uint32_t tile = 0u; tile < tileCount(); tile++)
+            {
+                exactlyOnce &= (claims[tile] == 1u);
+            }
+
+            // Every shard drained
+            bool drained = true;
+            for(uint32_t s = 0u; s < Base::mParam1; s++)
+            {
+                drained &= (counters[s] >= Shards::end(tileCount(), Base::mParam1, s)
+                                               - Shards::begin(tileCount(), Base::mParam1, s));
+            }
+
+            Base::mValidationResult = exactlyOnce && drained && (status == SUCCESS_VALUE);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(tileQueueSync<ChunkSize>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct TileQueueSyncGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            ChunkSize = 0
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = TileQueueSyncKernel<std::tuple_element_t<ChunkSize, TestParamsT>::value>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_TILE_QUEUE_SYNC_HPP
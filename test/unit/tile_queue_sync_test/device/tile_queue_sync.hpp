@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_TILE_QUEUE_SYNC_HPP
+#define ROCWMMA_DEVICE_TILE_QUEUE_SYNC_HPP
+
+#include "common.hpp"
+#include "gemm_global_mapping.hpp"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_tile_queue.hpp>
+
+namespace rocwmma
+{
+    // Persistent kernel draining a device tile_queue over two tile groups:
+    // m x n tiles, then their n x m transpose. Each claimed tile goes through
+    // locate_tile and the GEMM global mapping overloads for explicit workgroup
+    // coordinates, and the linear tile rebuilt from the mapped macro tile is
+    // counted in claims. Every tile must be counted exactly once.
+    //
+    // out: [shards claim counters][2 * m * n tile claims][status]
+    // param1: shard count, param2: persistent workgroups (gridDim.x)
+    template <uint32_t ChunkSize>
+    ROCWMMA_KERNEL void tileQueueSync(uint32_t        m,
+                                      uint32_t        n,
+                                      uint32_t const* in,
+                                      uint32_t*       out,
+                                      uint32_t        ld,
+                                      uint32_t        param1,
+                                      uint32_t        param2)
+    {
+        using Mapping = GlobalMapping::BlockLevelMapping<16u,
+                                                         16u,
+                                                         16u,
+                                                         float16_t,
+                                                         float32_t,
+                                                         float32_t,
+                                                         col_major,
+                                                         row_major,
+                                                         col_major,
+                                                         col_major,
+                                                         2u,
+                                                         2u>;
+
+        tile_group const groups[]   = {{0u, m, n}, {m * n, n, m}};
+        auto             groupCount = 2u;
+        auto             tileCount  = tile_count(groups, groupCount);
+
+        auto* counters = out;
+        auto* claims   = out + param1;
+        auto* status   = claims + tileCount;
+
+        tile_queue<uint32_t> queue{nullptr, 0u, 0u, 0u};
+        if(!make_tile_queue(queue, counters, tileCount, param1, ChunkSize))
+        {
+            *status = ERROR_VALUE;
+            return;
+        }
+
+        // Explicit blockIdx coordinates map as the implicit ones
+        auto blockCoord = make_coord2d(static_cast<uint32_t>(blockIdx.x),
+                                       static_cast<uint32_t>(blockIdx.y));
+        auto implicitC  = Mapping::waveTileCoordC();
+        auto explicitC  = Mapping::waveTileCoordC(blockCoord);
+        if(get<0>(implicitC) != get<0>(explicitC) || get<1>(implicitC) != get<1>(explicitC))
+        {
+            *status = ERROR_VALUE;
+        }
+
+        auto macroSize  = Mapping::macroTileSizeC();
+        auto waveOffset = Mapping::waveOffsetC();
+        auto isLeader   = threadIdx.x == 0u && threadIdx.y == 0u && threadIdx.z == 0u;
+
+        auto       shard = home_shard_sync(queue);
+        tile_chunk chunk;
+        while(claim_tile_chunk_sync(queue, shard, chunk))
+        {
+            for(auto tile = chunk.begin; tile < chunk.end; tile++)
+            {
+                auto coord      = locate_tile(groups, groupCount, tile);
+                auto tileCoord  = make_coord2d(coord.x, coord.y);
+                auto macroCoord = Mapping::macroTileCoordC(tileCoord);
+                auto waveCoord  = Mapping::waveTileCoordC(tileCoord);
+
+                if(get<0>(waveCoord) != get<0>(macroCoord) + get<0>(waveOffset)
+                   || get<1>(waveCoord) != get<1>(macroCoord) + get<1>(waveOffset))
+                {
+                    *status = ERROR_VALUE;
+                }
+
+                if(isLeader)
+                {
+                    auto const& group = groups[coord.group];
+                    auto        x     = get<0>(macroCoord) / get<0>(macroSize);
+                    auto        y     = get<1>(macroCoord) / get<1>(macroSize);
+                    atomicAdd(claims + group.tile_begin + y * group.tiles_x + x, 1u);
+                }
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_TILE_QUEUE_SYNC_HPP
@@ -0,0 +1,332 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/tile_queue.hpp>
+
+namespace rocwmma
+{
+    namespace
+    {
+        using HostQueue = tile_queue<std::atomic<uint32_t>>;
+        using Shards    = detail::TileQueueShards;
+
+        struct QueueStorage
+        {
+            QueueStorage(uint32_t tileCount, uint32_t shardCount, uint32_t chunkSize)
+                : counters(new std::atomic<uint32_t>[shardCount])
+            {
+                EXPECT_TRUE(
+                    make_tile_queue(queue, counters.get(), tileCount, shardCount, chunkSize));
+                queue.reset();
+            }
+
+            std::unique_ptr<std::atomic<uint32_t>[]> counters;
+            HostQueue                                queue{nullptr, 0u, 0u, 0u};
+        };
+
+        // True when every shard has handed out all of its tiles
+        bool drained(HostQueue const& queue)
+        {
+            for(uint32_t s = 0u; s < queue.shard_count; s++)
+            {
+                auto size = Shards::end(queue.tile_count, queue.shard_count, s)
+                            - Shards::begin(queue.tile_count, queue.shard_count, s);
+                if(queue.counters[s].load() < size)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        struct StressResult
+        {
+            std::vector<uint32_t> claims; // Times each tile was claimed
+            std::vector<uint32_t> tiles; // Tiles processed per worker
+            bool                  drainedOnExit = true;
+        };
+
+        // Workers claim until the queue is drained, with stopAfter[w] chunks
+        // at most for worker w (0 = no limit).
+        StressResult stress(HostQueue const&             queue,
+                            uint32_t                     workers,
+                            std::vector<uint32_t> const& stopAfter = {})
+        {
+            StressResult result;
+            result.tiles.assign(workers, 0u);
+
+            std::vector<std::atomic<uint32_t>> claims(queue.tile_count);
+            for(auto& c : claims)
+            {
+                c = 0u;
+            }
+
+            std::atomic<bool> drainedOnExit{true};
+            std::atomic<bool> start{false};
+
+            std::vector<std::thread> threads;
+            for(uint32_t w = 0u; w < workers; w++)
+            {
+                threads.emplace_back([&, w]() {
+                    while(!start.load())
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    auto limit = w < stopAfter.size() ? stopAfter[w] : 0u;
+                    auto shard = queue.home_shard(w);
+
+                    tile_chunk chunk;
+                    uint32_t   chunks = 0u;
+                    while((limit == 0u || chunks < limit) && queue.claim(shard, chunk))
+                    {
+                        for(auto tile = chunk.begin; tile < chunk.end; tile++)
+                        {
+                            claims[tile]++;
+                        }
+                        result.tiles[w] += chunk.end - chunk.begin;
+                        chunks++;
+                    }
+
+                    // A worker only runs dry once no tile is left unclaimed
+                    if(limit == 0u && !drained(queue))
+                    {
+                        drainedOnExit = false;
+                    }
+                });
+            }
+
+            start = true;
+            for(auto& t : threads)
+            {
+                t.join();
+            }
+
+            for(auto const& c : claims)
+            {
+                result.claims.push_back(c.load());
+            }
+            result.drainedOnExit = drainedOnExit.load();
+            return result;
+        }
+
+        uint32_t workerCount()
+        {
+            auto hw = std::thread::hardware_concurrency();
+            return hw < 4u ? 4u : (hw > 32u ? 32u : hw);
+        }
+
+    } // namespace
+
+    TEST(TileQueueTest, ShardsCoverTiles)
+    {
+        for(uint32_t tileCount : {0u, 1u, 7u, 64u, 1000u, 100003u})
+        {
+            for(uint32_t shardCount : {1u, 3u, 8u, 120u})
+            {
+                uint32_t expectedBegin = 0u;
+                for(uint32_t s = 0u; s < shardCount; s++)
+                {
+                    auto begin = Shards::begin(tileCount, shardCount, s);
+                    auto end   = Shards::end(tileCount, shardCount, s);
+                    EXPECT_EQ(begin, expectedBegin);
+                    EXPECT_GE(end, begin);
+
+                    // Even split: sizes differ by at most one
+                    EXPECT_LE(end - begin, tileCount / shardCount + 1u);
+                    EXPECT_GE(end - begin, tileCount / shardCount);
+                    expectedBegin = end;
+                }
+                EXPECT_EQ(expectedBegin, tileCount);
+            }
+        }
+    }
+
+    TEST(TileQueueTest, RejectsEmptyShardsAndChunks)
+    {
+        std::atomic<uint32_t> counter{0u};
+        HostQueue             queue{nullptr, 0u, 0u, 0u};
+
+        EXPECT_FALSE(make_tile_queue(queue, &counter, 16u, 0u, 4u));
+        EXPECT_FALSE(make_tile_queue(queue, &counter, 16u, 1u, 0u));
+        EXPECT_EQ(queue.counters, nullptr);
+
+        ASSERT_TRUE(make_tile_queue(queue, &counter, 16u, 1u, 4u));
+        EXPECT_EQ(queue.counters, &counter);
+        EXPECT_EQ(queue.tile_count, 16u);
+        EXPECT_EQ(queue.shard_count, 1u);
+        EXPECT_EQ(queue.chunk_size, 4u);
+    }
+
+    TEST(TileQueueTest, ChunkBounds)
+    {
+        // 10 tiles, 2 shards: [0, 5) and [5, 10)
+        auto full = Shards::chunk(10u, 2u, 1u, 0u, 3u);
+        EXPECT_EQ(full.begin, 5u);
+        EXPECT_EQ(full.end, 8u);
+
+        // Last chunk is partial
+        auto partial = Shards::chunk(10u, 2u, 1u, 3u, 3u);
+        EXPECT_EQ(partial.begin, 8u);
+        EXPECT_EQ(partial.end, 10u);
+
+        // Counters past the shard size give empty chunks
+        auto empty = Shards::chunk(10u, 2u, 1u, 6u, 3u);
+        EXPECT_EQ(empty.begin, empty.end);
+    }
+
+    TEST(TileQueueTest, HomeShardFirstThenSteal)
+    {
+        QueueStorage storage(20u, 4u, 2u);
+        auto const&  queue = storage.queue;
+
+        // Worker 6 is homed on shard 2 and walks shards 2, 3, 0, 1
+        auto shard = queue.home_shard(6u);
+        EXPECT_EQ(shard, 2u);
+
+        std::vector<uint32_t> order;
+        tile_chunk            chunk;
+        while(queue.claim(shard, chunk))
+        {
+            EXPECT_LE(chunk.end - chunk.begin, 2u);
+            for(auto tile = chunk.begin; tile < chunk.end; tile++)
+            {
+                order.push_back(tile);
+            }
+        }
+
+        std::vector<uint32_t> expected;
+        for(uint32_t s : {2u, 3u, 0u, 1u})
+        {
+            for(uint32_t tile = s * 5u; tile < s * 5u + 5u; tile++)
+            {
+                expected.push_back(tile);
+            }
+        }
+        EXPECT_EQ(order, expected);
+
+        // Drained queue stays drained, without growing the counters further
+        EXPECT_FALSE(queue.claim(shard, chunk));
+        for(uint32_t s = 0u; s < queue.shard_count; s++)
+        {
+            EXPECT_EQ(queue.counters[s].load(), 6u);
+        }
+
+        // Reset refills the queue
+        queue.reset();
+        shard = 0u;
+        ASSERT_TRUE(queue.claim(shard, chunk));
+        EXPECT_EQ(chunk.begin, 0u);
+        EXPECT_EQ(chunk.end, 2u);
+    }
+
+    TEST(TileQueueTest, MoreShardsThanTiles)
+    {
+        QueueStorage storage(3u, 8u, 4u);
+
+        auto result = stress(storage.queue, 2u);
+        EXPECT_EQ(result.claims, std::vector<uint32_t>(3u, 1u));
+    }
+
+    TEST(TileQueueTest, ConcurrentClaimsExactlyOnce)
+    {
+        auto workers = workerCount();
+
+        for(uint32_t chunkSize : {1u, 7u, 64u})
+        {
+            for(uint32_t shardCount : {1u, workers / 2u, workers, workers * 3u})
+            {
+                QueueStorage storage(100003u, shardCount, chunkSize);
+
+                auto result = stress(storage.queue, workers);
+                EXPECT_EQ(result.claims, std::vector<uint32_t>(100003u, 1u))
+                    << "chunk " << chunkSize << ", shards " << shardCount;
+
+                // No worker gives up while another shard still has tiles
+                EXPECT_TRUE(result.drainedOnExit)
+                    << "chunk " << chunkSize << ", shards " << shardCount;
+            }
+        }
+    }
+
+    TEST(TileQueueTest, StealsFromStalledWorkers)
+    {
+        auto workers = workerCount();
+
+        // Half of the workers stall after one chunk: the rest must drain their shards
+        std::vector<uint32_t> stopAfter(workers, 0u);
+        for(uint32_t w = 0u; w < workers; w += 2u)
+        {
+            stopAfter[w] = 1u;
+        }
+
+        QueueStorage storage(50000u, workers, 16u);
+
+        auto result = stress(storage.queue, workers, stopAfter);
+        EXPECT_EQ(result.claims, std::vector<uint32_t>(50000u, 1u));
+        EXPECT_TRUE(result.drainedOnExit);
+
+        for(uint32_t w = 0u; w < workers; w += 2u)
+        {
+            EXPECT_LE(result.tiles[w], 16u);
+        }
+    }
+
+    TEST(TileQueueTest, LocateTile)
+    {
+        // 3 x 2, empty, 1 x 4, 5 x 1
+        std::vector<tile_group> groups = {{0u, 3u, 2u}, {6u, 0u, 0u}, {6u, 1u, 4u}, {10u, 5u, 1u}};
+        auto                    count  = static_cast<uint32_t>(groups.size());
+
+        EXPECT_EQ(tile_count(groups.data(), count), 15u);
+        EXPECT_EQ(tile_count(groups.data(), 0u), 0u);
+
+        // Enumerate groups in blockIdx order: x fastest
+        uint32_t tile = 0u;
+        for(uint32_t g = 0u; g < count; g++)
+        {
+            for(uint32_t y = 0u; y < groups[g].tiles_y; y++)
+            {
+                for(uint32_t x = 0u; x < groups[g].tiles_x; x++, tile++)
+                {
+                    auto coord = locate_tile(groups.data(), count, tile);
+                    EXPECT_EQ(coord.group, g) << "tile " << tile;
+                    EXPECT_EQ(coord.x, x) << "tile " << tile;
+                    EXPECT_EQ(coord.y, y) << "tile " << tile;
+                }
+            }
+        }
+        EXPECT_EQ(tile, 15u);
+    }
+
+} // namespace rocwmma
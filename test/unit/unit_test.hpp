@@ -29,6 +29,8 @@
 
 #include <gtest/gtest.h>
 
+#include "kernel_pipeline.hpp"
+#include "rocwmma_options.hpp"
 #include "unit_kernel_base.hpp"
 #include "unit_test_params.hpp"
 
@@ -48,8 +50,20 @@ namespace rocwmma
                                                          typename UnitTestParams::Param1T,
                                                          typename UnitTestParams::Param2T>>;
 
+        using KernelT      = typename UnitTestParams::KernelT;
+        using ThreadBlockT = typename UnitTestParams::ThreadBlockT;
+        using ProblemSizeT = typename UnitTestParams::ProblemSizeT;
+        using Param1T      = typename UnitTestParams::Param1T;
+        using Param2T      = typename UnitTestParams::Param2T;
+
         void SetUp() override
         {
+            // The pipelined suite covers these kernels
+            if(RocwmmaOptions::instance()->pipelineDepth() > 0u)
+            {
+                GTEST_SKIP();
+            }
+
             // Construct ProblemParams from
             // incoming gtest parameterization
             auto param       = Base::GetParam();
@@ -95,6 +109,71 @@ namespace rocwmma
             auto kernel = std::get<0>(param);
             kernel->tearDown();
         }
+
+        // Runs every combination of a suite's parameters through the KernelPipeline.
+        // Validation reads the shared UnitResource, so it stays in the issue stage;
+        // reports and teardown are deferred and come out in submission order.
+        static void RunKernelsPipelined(std::vector<KernelT> const&      kernels,
+                                        std::vector<ThreadBlockT> const& threadBlocks,
+                                        std::vector<ProblemSizeT> const& problemSizes,
+                                        std::vector<Param1T> const&      param1s,
+                                        std::vector<Param2T> const&      param2s)
+        {
+            auto depth = RocwmmaOptions::instance()->pipelineDepth();
+            if(depth == 0u)
+            {
+                GTEST_SKIP();
+            }
+
+            struct Job
+            {
+                KernelT       kernel;
+                ProblemParams params;
+            };
+
+            // Same ordering as the parameterized suite
+            auto jobs = std::vector<Job>();
+            for(auto const& kernel : kernels)
+            {
+                for(auto const& threadBlock : threadBlocks)
+                {
+                    for(auto const& problemSize : problemSizes)
+                    {
+                        for(auto const& param1 : param1s)
+                        {
+                            for(auto const& param2 : param2s)
+                            {
+                                jobs.push_back(
+                                    {kernel, {threadBlock, problemSize, param1, param2}});
+                            }
+                        }
+                    }
+                }
+            }
+
+            typename KernelPipeline<Job>::Stages stages;
+            stages.issue = [](Job& job) {
+                job.kernel->setup(job.params);
+                job.kernel->exec();
+                job.kernel->validateResults();
+            };
+            stages.report = [](Job& job) {
+                if(job.kernel->runFlag())
+                {
+                    job.kernel->reportResults();
+                    EXPECT_TRUE(job.kernel->validationResult());
+                }
+                else
+                {
+                    std::cout << *job.kernel << std::endl;
+                }
+                job.kernel->tearDown();
+            };
+            stages.resourceKey = [](Job const& job) -> void const* { return job.kernel.get(); };
+
+            KernelPipeline<Job> pipeline(depth, depth);
+            pipeline.run(jobs, stages);
+        }
     };
 
 } // namespace rocwmma
@@ -27,29 +27,51 @@
 #ifndef ROCWMMA_UNIT_TEST_MACROS_HPP
 #define ROCWMMA_UNIT_TEST_MACROS_HPP
 
+#include "deferred_tests.hpp"
+#include "rocwmma_options.hpp"
+
 ///
-/// Unit test suite definition
+/// Unit test suite definition. Also queues a <TestClassName>_Pipelined
+/// test, registered only with --pipeline *depth*.
 /// @params
 /// TestClassName: name of the unit test class
 /// TestParamClassName: name of the params class name of unit test
 ///
-#define ROCWMMA_GENERATE_UNIT_GTEST_SUITE(TestClassName, TestParamsClassName)                 \
-    class TestClassName : public rocwmma::UnitTest                                            \
-    {                                                                                         \
-    };                                                                                        \
-                                                                                              \
-    TEST_P(TestClassName, RunKernel)                                                          \
-    {                                                                                         \
-        this->RunKernel();                                                                    \
-    }                                                                                         \
-                                                                                              \
-    INSTANTIATE_TEST_SUITE_P(                                                                 \
-        KernelTests,                                                                          \
-        TestClassName,                                                                        \
-        ::testing::Combine(::testing::ValuesIn(rocwmma::TestParamsClassName::kernels()),      \
-                           ::testing::ValuesIn(rocwmma::TestParamsClassName::threadBlocks()), \
-                           ::testing::ValuesIn(rocwmma::TestParamsClassName::problemSizes()), \
-                           ::testing::ValuesIn(rocwmma::TestParamsClassName::param1s()),      \
-                           ::testing::ValuesIn(rocwmma::TestParamsClassName::param2s())));
+#define ROCWMMA_GENERATE_UNIT_GTEST_SUITE(TestClassName, TestParamsClassName)                   \
+    class TestClassName : public rocwmma::UnitTest                                              \
+    {                                                                                           \
+    };                                                                                          \
+                                                                                                \
+    TEST_P(TestClassName, RunKernel)                                                            \
+    {                                                                                           \
+        this->RunKernel();                                                                      \
+    }                                                                                           \
+                                                                                                \
+    INSTANTIATE_TEST_SUITE_P(                                                                   \
+        KernelTests,                                                                            \
+        TestClassName,                                                                          \
+        ::testing::Combine(                                                                     \
+            ::testing::ValuesIn(rocwmma::TestParamsClassName::kernels()),                       \
+            ::testing::ValuesIn(                                                                \
+                ROCWMMA_SWEEP_PARAMS(rocwmma::TestParamsClassName, threadBlocks)),              \
+            ::testing::ValuesIn(                                                                \
+                ROCWMMA_SWEEP_PARAMS(rocwmma::TestParamsClassName, problemSizes)),              \
+            ::testing::ValuesIn(rocwmma::TestParamsClassName::param1s()),                       \
+            ::testing::ValuesIn(rocwmma::TestParamsClassName::param2s())));                     \
+                                                                                                \
+    [[maybe_unused]] static bool const TestClassName##_Pipelined = rocwmma::DeferredTests::add( \
+        rocwmma::DeferredTests::Mode::Pipelined,                                                \
+        "KernelTests",                                                                          \
+        #TestClassName "_Pipelined",                                                            \
+        __FILE__,                                                                               \
+        __LINE__,                                                                               \
+        []() {                                                                                  \
+            rocwmma::UnitTest::RunKernelsPipelined(                                             \
+                rocwmma::TestParamsClassName::kernels(),                                        \
+                ROCWMMA_SWEEP_PARAMS(rocwmma::TestParamsClassName, threadBlocks),               \
+                ROCWMMA_SWEEP_PARAMS(rocwmma::TestParamsClassName, problemSizes),               \
+                rocwmma::TestParamsClassName::param1s(),                                        \
+                rocwmma::TestParamsClassName::param2s());                                       \
+        });
 
 #endif // ROCWMMA_UNIT_TEST_MACROS_HPP